@@ -104,6 +104,35 @@ public:
         return default_mws;
     }
 
+    /** Estimate the number of bytes read and written by the kernel over its whole execution window
+     *
+     * Used by @ref IWorkloadPartitioner implementations to size the workloads. Kernels which access much more or
+     * much less memory than the size of their tensors (e.g. because of data reuse) should override it.
+     *
+     * @param[in] tensors Tensors the kernel operates on. Empty for kernels holding their own tensors.
+     *
+     * @return The estimated number of bytes, or 0 if unknown.
+     */
+    virtual size_t estimate_bytes_accessed(const ITensorPack &tensors) const
+    {
+        ARM_COMPUTE_UNUSED(tensors);
+
+        return 0;
+    }
+
+    /** Whether the kernel computes the same result for any split of its window into workloads
+     *
+     * Only such kernels are scheduled with the @ref IWorkloadPartitioner set on the scheduler. Kernels relying on the
+     * number of workloads set at configuration time, or on @ref ThreadInfo::thread_id and @ref ThreadInfo::num_threads,
+     * keep the default split of one workload per thread.
+     *
+     * @return True if the kernel can run on any partition of its window
+     */
+    virtual bool partitions_by_window() const
+    {
+        return false;
+    }
+
     /** Name of the kernel
      *
      * @return Kernel name
@@ -42,6 +42,21 @@ struct FFTDigitReverseKernelInfo
 {
     unsigned int axis{0};          /**< Axis to perform the kernel on. */
     bool         conjugate{false}; /**< Flag to conjugate the output/ */
+    bool         pack_real{false}; /**< Flag to pack a real input along axis 0 as a complex one of half length. */
+};
+
+/** Descriptor for FFT chirp kernels */
+struct FFTChirpKernelInfo
+{
+    unsigned int axis{0};          /**< Axis to perform the kernel on. */
+    bool         conjugate{false}; /**< Flag to conjugate the input before the multiplication. */
+};
+
+/** Descriptor for FFT real unpack kernels */
+struct FFTRealUnpackKernelInfo
+{
+    float scale{1.f};       /**< Scale to divide the output by. */
+    bool  conjugate{false}; /**< Flag to conjugate the output. */
 };
 
 /** Descriptor used by the FFT core kernels */
@@ -249,5 +264,16 @@ struct MatMulKernelInfo
     int  k0{1};                         /**< Number of inner accumulations */
     bool export_rhs_to_cl_image{false}; /**< Flag to know whether the RHS tensor should be exported to cl_image*/
 };
+
+/** Descriptor used by the LSTM cell kernel */
+struct LSTMCellKernelInfo
+{
+    ActivationLayerInfo activation_info{};     /**< Activation applied to the cell gate and to the cell state */
+    float               cell_threshold{0.f};   /**< Clipping threshold of the cell state. 0 disables the clipping */
+    float               epsilon{1e-8f};        /**< Lower bound value for the variance of the layer normalization */
+    bool                has_cifg{false};       /**< The input gate is coupled to the forget gate */
+    bool                has_peephole{false};   /**< The gates are connected to the cell state */
+    bool                use_layer_norm{false}; /**< The gates are normalized before the bias is added */
+};
 } // namespace arm_compute
 #endif // ACL_ARM_COMPUTE_CORE_KERNELDESCRIPTORS_H
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_FUNCTION_INFO_SCALEDDOTPRODUCTATTENTIONINFO_H
+#define ACL_ARM_COMPUTE_FUNCTION_INFO_SCALEDDOTPRODUCTATTENTIONINFO_H
+
+namespace arm_compute
+{
+/** Class for holding information related to the scaled dot-product attention function
+ */
+class ScaledDotProductAttentionInfo
+{
+public:
+    /* Get the factor the scores are multiplied by. 0 stands for 1/sqrt(head size) */
+    float scale() const
+    {
+        return _scale;
+    }
+    /* Get the causal mask flag value */
+    bool is_causal() const
+    {
+        return _is_causal;
+    }
+    /* Set the factor the scores are multiplied by. 0 stands for 1/sqrt(head size) */
+    ScaledDotProductAttentionInfo &scale(float scale)
+    {
+        _scale = scale;
+        return *this;
+    }
+    /* Set the causal mask flag. Query i attends to the keys j <= i + num_keys - num_queries, so that the last
+     * query always attends to all the keys, as when decoding against a cache of the previous keys */
+    ScaledDotProductAttentionInfo &is_causal(bool is_causal)
+    {
+        _is_causal = is_causal;
+        return *this;
+    }
+
+private:
+    float _scale{0.f};
+    bool  _is_causal{false};
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_FUNCTION_INFO_SCALEDDOTPRODUCTATTENTIONINFO_H
@@ -24,6 +24,7 @@
 #ifndef ARM_COMPUTE_GRAPH_ITENSOR_ACCESSOR_H
 #define ARM_COMPUTE_GRAPH_ITENSOR_ACCESSOR_H
 
+#include "arm_compute/core/Error.h"
 #include "arm_compute/core/ITensor.h"
 
 #include <memory>
@@ -53,6 +54,20 @@ public:
     {
         return true;
     }
+    /** Returns memory already holding the tensor data, which the tensor can import instead of allocating its own
+     *
+     * @note Only called on constant tensors, before they are allocated.
+     *
+     * @param[in] info Info of the tensor to be accessed.
+     *
+     * @return A pointer to the tensor data laid out as described by info, which must stay valid for the lifetime of
+     *         the accessor, or nullptr if the tensor must be allocated and filled by @ref access_tensor
+     */
+    virtual void *import_memory(const ITensorInfo &info)
+    {
+        ARM_COMPUTE_UNUSED(info);
+        return nullptr;
+    }
 };
 
 using ITensorAccessorUPtr = std::unique_ptr<ITensorAccessor>;
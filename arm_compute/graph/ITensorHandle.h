@@ -24,12 +24,14 @@
 #ifndef ARM_COMPUTE_GRAPH_ITENSORHANDLE_H
 #define ARM_COMPUTE_GRAPH_ITENSORHANDLE_H
 
+#include "arm_compute/core/Error.h"
 #include "arm_compute/core/ITensor.h"
 #include "arm_compute/graph/Types.h"
 
 namespace arm_compute
 {
 // Forward declarations
+class IAllocator;
 class IMemoryGroup;
 
 namespace graph
@@ -44,6 +46,26 @@ public:
     virtual void allocate() = 0;
     /** Allocates backend memory for the handle */
     virtual void free() = 0;
+    /** Imports existing memory as backend memory for the handle
+     *
+     * @param[in] memory Memory to import, laid out as described by the tensor info. It must outlive the handle.
+     *
+     * @return True if the memory has been imported, false if the backend doesn't support it
+     */
+    virtual bool import_memory(void *memory)
+    {
+        ARM_COMPUTE_UNUSED(memory);
+        return false;
+    }
+    /** Sets the allocator of the backend memory of the handle when it isn't managed by a memory group
+     *
+     * @param[in] allocator Allocator to use, or nullptr for the default allocation of the backend. It must outlive
+     *                      the memory of the handle.
+     */
+    virtual void set_allocator(IAllocator *allocator)
+    {
+        ARM_COMPUTE_UNUSED(allocator);
+    }
     /** Set backend tensor to be managed by a memory group
      *
      * @param[in] mg Memory group
@@ -93,6 +93,11 @@ public:
      * @return True if the accessor was called else false
      */
     bool call_accessor();
+    /** Imports the memory provided by the accessor in place of allocating the backend tensor
+     *
+     * @return True if the memory was imported else false
+     */
+    bool import_accessor_memory();
     /** Binds the tensor with an edge
      *
      * @param[in] eid Edge ID that is bound to the tensor
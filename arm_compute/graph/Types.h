@@ -89,6 +89,8 @@ struct GraphConfig
     bool        use_function_memory_manager{true};   /**< Use a memory manager to manage per-function auxilary memory */
     bool        use_function_weights_manager{true};  /**< Use a weights manager to manage transformed weights */
     bool        use_transition_memory_manager{true}; /**< Use a memory manager to manager transition buffer memory */
+    bool        use_memory_planner{false};           /**< Plan buffer offsets over whole lifetimes (Neon target only) */
+    bool        use_huge_pages{false};               /**< Back tensors and memory pools with huge pages (Neon only) */
     bool        use_tuner{false};                    /**< Use a tuner in tunable backends */
     bool        use_synthetic_type{false};           /**< Convert graph to a synthetic graph for a data type */
     DataType    synthetic_type{DataType::QASYMM8};   /**< The data type of the synthetic graph  */
@@ -98,6 +100,10 @@ struct GraphConfig
     std::string   tuner_file{"acl_tuner.csv"};         /**< File to load/store tuning values from */
     std::string   mlgo_file{"heuristics.mlgo"};        /**< Filename to load MLGO heuristics from */
     CLBackendType backend_type{CLBackendType::Native}; /**< CL backend type to use */
+    unsigned int  num_parallel_branches{
+        1}; /**< Number of independent branches executed concurrently, each on its share of the threads (Neon target only). If greater than 1, transition buffers are not shared. */
+    unsigned int  num_pipeline_stages{
+        1}; /**< Number of pipeline stages the inputs are streamed through, each on its own group of cores (Neon target only). If greater than 1, transition buffers are not shared and num_parallel_branches is ignored. */
 };
 
 /**< Device target types */
@@ -206,7 +212,8 @@ enum class NodeType
 enum class MemoryManagerAffinity
 {
     Buffer, /**< Affinity at buffer level */
-    Offset  /**< Affinity at offset level */
+    Offset, /**< Affinity at offset level */
+    Planned /**< Affinity at offset level, with offsets planned over the complete lifetimes */
 };
 
 /** NodeID-index struct
@@ -28,9 +28,11 @@
 #include "arm_compute/graph/Tensor.h"
 #include "arm_compute/runtime/IFunction.h"
 #include "arm_compute/runtime/IMemoryGroup.h"
+#include "arm_compute/runtime/IScheduler.h"
 
 #include <functional>
 #include <memory>
+#include <utility>
 #include <vector>
 
 namespace arm_compute
@@ -93,14 +95,23 @@ struct ExecutionTask
     void prepare();
 };
 
+/** Pair of a tensor of a pipeline stage and its copy in the next stage */
+using StageTransfer = std::pair<Tensor *, Tensor *>;
+
 /** Execution workload */
 struct ExecutionWorkload
 {
-    std::vector<Tensor *>      inputs  = {};        /**< Input handles */
-    std::vector<Tensor *>      outputs = {};        /**< Output handles */
-    std::vector<ExecutionTask> tasks   = {};        /**< Execution workload */
-    Graph                     *graph   = {nullptr}; /**< Graph bound to the workload */
-    GraphContext              *ctx     = {nullptr}; /**< Graph execution context */
+    std::vector<Tensor *>                    inputs            = {};        /**< Input handles */
+    std::vector<Tensor *>                    outputs           = {};        /**< Output handles */
+    std::vector<ExecutionTask>               tasks             = {};        /**< Execution workload */
+    Graph                                   *graph             = {nullptr}; /**< Graph bound to the workload */
+    GraphContext                            *ctx               = {nullptr}; /**< Graph execution context */
+    std::vector<std::vector<size_t>>         task_dependencies = {};        /**< Indices of the tasks each task depends on (parallel execution only) */
+    std::vector<size_t>                      task_branches     = {};        /**< Branch scheduler running each task (parallel execution only) */
+    std::vector<std::unique_ptr<IScheduler>> branch_schedulers = {};        /**< Schedulers running the branches concurrently (parallel execution only) */
+    std::vector<size_t>                      task_stages       = {};        /**< Pipeline stage running each task (pipelined execution only) */
+    std::vector<std::vector<StageTransfer>>  stage_transfers   = {};        /**< Tensors copied from each stage to the next one (pipelined execution only) */
+    std::vector<std::unique_ptr<IScheduler>> stage_schedulers  = {};        /**< Schedulers running the stages on disjoint groups of cores (pipelined execution only) */
 };
 } // namespace graph
 } // namespace arm_compute
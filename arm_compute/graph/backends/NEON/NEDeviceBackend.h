@@ -26,6 +26,9 @@
 
 #include "arm_compute/graph/IDeviceBackend.h"
 #include "arm_compute/runtime/Allocator.h"
+#include "arm_compute/runtime/HugePageAllocator.h"
+
+#include <memory>
 
 namespace arm_compute
 {
@@ -55,7 +58,8 @@ public:
     void                                          sync() override;
 
 private:
-    Allocator _allocator; /**< Backend allocator */
+    Allocator                          _allocator;           /**< Backend allocator */
+    std::unique_ptr<HugePageAllocator> _huge_page_allocator; /**< Huge page allocator, created on first use */
 };
 } // namespace backends
 } // namespace graph
@@ -52,6 +52,8 @@ public:
     // Inherited overridden methods
     void                        allocate() override;
     void                        free() override;
+    bool                        import_memory(void *memory) override;
+    void                        set_allocator(IAllocator *allocator) override;
     void                        manage(IMemoryGroup *mg) override;
     void                        map(bool blocking) override;
     void                        unmap() override;
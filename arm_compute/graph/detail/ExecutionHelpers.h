@@ -26,6 +26,8 @@
 
 #include "arm_compute/graph/Types.h"
 
+#include <vector>
+
 namespace arm_compute
 {
 namespace graph
@@ -39,6 +41,13 @@ class INode;
 
 namespace detail
 {
+/** Partition of a graph into pipeline stages */
+struct PipelineStages
+{
+    std::vector<unsigned int>        node_stages{};    /**< Stage of each node, indexed by node ID */
+    std::vector<std::vector<NodeID>> transfer_nodes{}; /**< Nodes whose input is copied to their output at the end of each stage */
+};
+
 /** Validates all nodes
  *
  * @param[in] g Graph to validate
@@ -49,6 +58,12 @@ void validate_all_nodes(Graph &g);
  * @param[in] g Graph to configure
  */
 void configure_all_tensors(Graph &g);
+/** Sets the backend allocator of the memory management context of their target to all the tensors of a graph
+ *
+ * @param[in] g   Graph to set the tensor allocators of
+ * @param[in] ctx Graph context
+ */
+void set_all_tensor_allocators(Graph &g, GraphContext &ctx);
 /** Allocates all input tensors of a node.
  *
  * @param[in] node Node to allocate the input tensor of
@@ -59,6 +74,11 @@ void allocate_all_input_tensors(INode &node);
  * @param[in] node Node to allocate the output tensor of
  */
 void allocate_all_output_tensors(INode &node);
+/** Imports the memory of all output tensors of a node from their accessors, or allocates them when it can't be imported
+ *
+ * @param[in] node Node to import or allocate the output tensors of
+ */
+void import_or_allocate_all_output_tensors(INode &node);
 /** Allocates const tensor of a given graph
  *
  * @param[in] g Graph to allocate the tensors
@@ -112,11 +132,57 @@ bool call_all_output_node_accessors(ExecutionWorkload &workload);
  * @param[in] workload Workload to prepare
  */
 void prepare_all_tasks(ExecutionWorkload &workload);
+/** Sets up the concurrent execution of the independent branches of a workload
+ *
+ * Builds the dependencies between the tasks from the edges of the graph, assigns every task to one of
+ * @p num_branches branch schedulers and splits the threads of the active scheduler among them.
+ *
+ * @note Transition buffers must not share memory as tasks are no longer executed in order.
+ *
+ * @param[in, out] workload     Workload to set up
+ * @param[in]      num_branches Maximum number of tasks executed concurrently
+ */
+void configure_parallel_branches(ExecutionWorkload &workload, unsigned int num_branches);
 /** Executes all tasks of a workload
+ *
+ * If the workload has been set up with @ref configure_parallel_branches, independent tasks are executed concurrently
+ * as soon as the tasks they depend on are complete.
  *
  * @param[in] workload Workload to execute
  */
 void call_all_tasks(ExecutionWorkload &workload);
+/** Splits a graph into pipeline stages
+ *
+ * Assigns the nodes, in topological order, to @p num_stages consecutive stages of similar estimated cost. Every stage
+ * gets its own copy of the tensors it reads from the previous stages: a @ref DummyNode is inserted on the edges
+ * crossing each stage boundary, and the copy of its input to its output hands the tensor over to the next stage.
+ *
+ * @note Must be called before the tensors are configured.
+ *
+ * @param[in, out] g          Graph to split
+ * @param[in]      num_stages Number of stages
+ *
+ * @return The partition of the graph
+ */
+PipelineStages split_pipeline_stages(Graph &g, unsigned int num_stages);
+/** Sets up the pipelined execution of a workload
+ *
+ * Assigns the tasks to the stages of @p stages and pins the threads of each stage to its own group of cores.
+ *
+ * @note Transition buffers must not share memory as the stages execute different frames concurrently.
+ *
+ * @param[in, out] workload Workload to set up
+ * @param[in]      stages   Partition returned by @ref split_pipeline_stages
+ */
+void configure_pipeline_stages(ExecutionWorkload &workload, const PipelineStages &stages);
+/** Streams the inputs of a workload through its pipeline stages
+ *
+ * Frame n + 1 enters a stage as soon as the stage is done with frame n and the next stage has taken over the
+ * tensors of frame n, so that all the stages run concurrently on successive frames.
+ *
+ * @param[in] workload Workload to execute, set up with @ref configure_pipeline_stages
+ */
+void call_all_pipeline_stages(ExecutionWorkload &workload);
 } // namespace detail
 } // namespace graph
 } // namespace arm_compute
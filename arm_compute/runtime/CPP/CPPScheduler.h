@@ -38,13 +38,33 @@ namespace arm_compute
  * variable ARM_COMPUTE_CPP_SCHEDULER_MODE. e.g.:
  * ARM_COMPUTE_CPP_SCHEDULER_MODE=linear      # Force select the linear scheduling mode
  * ARM_COMPUTE_CPP_SCHEDULER_MODE=fanout      # Force select the fanout scheduling mode
+ *
+ * On platforms mixing core types (e.g. big.LITTLE), threads pinned with @ref set_num_threads_with_affinity can be
+ * given a share of the STATIC workloads proportional to the capacity of their core (see @ref CapacityPolicy). The
+ * initial policy can be set via an environment variable ARM_COMPUTE_CPP_SCHEDULER_CAPACITY. e.g.:
+ * ARM_COMPUTE_CPP_SCHEDULER_CAPACITY=weighted # Select CapacityPolicy::WEIGHTED
+ * ARM_COMPUTE_CPP_SCHEDULER_CAPACITY=big_only # Select CapacityPolicy::WEIGHTED_BIG_ONLY
+ *
+ * By default, idle threads sleep on a condition variable, which costs a system call to wake them up for every kernel.
+ * For networks made of many small kernels, they can instead spin for a while before sleeping (see
+ * @ref set_spin_wait). The initial spin budget can be set via an environment variable
+ * ARM_COMPUTE_CPP_SCHEDULER_SPIN_US. e.g.:
+ * ARM_COMPUTE_CPP_SCHEDULER_SPIN_US=50        # Spin for up to 50us before sleeping
 */
 class CPPScheduler final : public IScheduler
 {
 public:
+    /** How the capacity of the cores the threads are pinned to is taken into account */
+    enum class CapacityPolicy
+    {
+        UNIFORM,          /**< All the threads are given the same share of the workloads (default) */
+        WEIGHTED,         /**< STATIC workloads are split proportionally to the capacity of the cores */
+        WEIGHTED_BIG_ONLY /**< As WEIGHTED, but latency-critical kernels are kept off the little cores */
+    };
+
     /** Constructor: create a pool of threads. */
     CPPScheduler();
-    /** Default destructor */
+    /** Destructor: run the pending asynchronous tasks before destroying the threads */
     ~CPPScheduler();
 
     /** Access the scheduler singleton
@@ -54,6 +74,32 @@ public:
      */
     static CPPScheduler &get();
 
+    /** Set how the capacity of the cores is taken into account
+     *
+     * @note The capacities are only known for threads pinned with @ref set_num_threads_with_affinity, the threads
+     *       are otherwise considered equivalent.
+     *
+     * @param[in] policy Capacity policy to use.
+     */
+    void set_capacity_policy(CapacityPolicy policy);
+
+    /** Set how long idle threads spin, waiting for work, before sleeping
+     *
+     * The calling thread also spins for up to the same time while waiting for the pool to complete a kernel.
+     *
+     * @param[in] spin_us Spin budget in microseconds. 0 (default) makes the threads sleep straight away.
+     */
+    void set_spin_wait(unsigned int spin_us);
+
+    /** Keep the threads of the pool spinning between kernels, whatever the spin budget
+     *
+     * Meant to be enabled for the duration of a run of a whole network, to remove the cost of waking up the threads
+     * from every kernel, and disabled afterwards to stop the threads from burning CPU time.
+     *
+     * @param[in] keep_hot True to keep the threads spinning, false to return to the spin budget of @ref set_spin_wait.
+     */
+    void set_keep_hot(bool keep_hot);
+
     // Inherited functions overridden
     void         set_num_threads(unsigned int num_threads) override;
     void         set_num_threads_with_affinity(unsigned int num_threads, BindFunc func) override;
@@ -67,6 +113,7 @@ protected:
      * @param[in] workloads Workloads to run
      */
     void run_workloads(std::vector<Workload> &workloads) override;
+    std::vector<unsigned int> thread_weights(unsigned int num_threads, const Hints &hints) const override;
 
 private:
     struct Impl;
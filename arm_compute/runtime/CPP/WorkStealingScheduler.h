@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_CPP_WORKSTEALINGSCHEDULER_H
+#define ACL_ARM_COMPUTE_RUNTIME_CPP_WORKSTEALINGSCHEDULER_H
+
+#include "arm_compute/core/experimental/Types.h"
+#include "arm_compute/runtime/IScheduler.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+/** C++11 implementation of a pool of threads which balances the workloads through work stealing.
+ *
+ * Unlike @ref CPPScheduler, which hands out workloads through a single shared counter, every thread owns a
+ * contiguous range of the workloads. A thread first drains its own range and, once it is empty, steals half of the
+ * remaining range of a victim thread. Victims are visited in order of locality: threads bound to cores of the same
+ * CPU model (i.e. the same cluster) first, then by distance in the thread pool.
+ *
+ * The shared counter of @ref CPPScheduler is therefore never touched by more than two threads at a time, and a slow
+ * core only delays the workloads it is currently executing instead of the whole batch.
+ */
+class WorkStealingScheduler final : public IScheduler
+{
+public:
+    /** Constructor: create a pool of threads. */
+    WorkStealingScheduler();
+    /** Destructor: run the pending asynchronous tasks before destroying the threads */
+    ~WorkStealingScheduler();
+
+    // Inherited functions overridden
+    void         set_num_threads(unsigned int num_threads) override;
+    void         set_num_threads_with_affinity(unsigned int num_threads, BindFunc func) override;
+    unsigned int num_threads() const override;
+    void         schedule(ICPPKernel *kernel, const Hints &hints) override;
+    void schedule_op(ICPPKernel *kernel, const Hints &hints, const Window &window, ITensorPack &tensors) override;
+
+protected:
+    /** Will run the workloads in parallel using num_threads
+     *
+     * @param[in] workloads Workloads to run
+     */
+    void run_workloads(std::vector<Workload> &workloads) override;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_CPP_WORKSTEALINGSCHEDULER_H
@@ -27,6 +27,8 @@
 #include "arm_compute/core/Types.h"
 #include "arm_compute/runtime/CPP/ICPPSimpleFunction.h"
 
+#include <memory>
+
 namespace arm_compute
 {
 class ITensor;
@@ -34,6 +36,9 @@ class ITensor;
 /** CPP Function to generate the detection output based on location and confidence
  * predictions by doing non maximum suppression.
  *
+ * The boxes are decoded with Neon on AArch64, then the non maximum suppression of each class of each image runs in
+ * parallel on the threads of the @ref Scheduler. All the intermediate buffers are allocated at configure time.
+ *
  * @note Intended for use with MultiBox detection method.
  */
 class CPPDetectionOutputLayer : public IFunction
@@ -41,6 +46,8 @@ class CPPDetectionOutputLayer : public IFunction
 public:
     /** Default constructor */
     CPPDetectionOutputLayer();
+    /** Default destructor */
+    ~CPPDetectionOutputLayer();
     /** Configure the detection output layer CPP kernel
      *
      * @param[in]  input_loc      The mbox location input tensor of size [C1, N]. Data types supported: F32.
@@ -79,21 +86,8 @@ public:
     CPPDetectionOutputLayer &operator=(const CPPDetectionOutputLayer &) = delete;
 
 private:
-    const ITensor           *_input_loc;
-    const ITensor           *_input_conf;
-    const ITensor           *_input_priorbox;
-    ITensor                 *_output;
-    DetectionOutputLayerInfo _info;
-
-    int _num_priors;
-    int _num;
-
-    std::vector<LabelBBox>                         _all_location_predictions;
-    std::vector<std::map<int, std::vector<float>>> _all_confidence_scores;
-    std::vector<BBox>                              _all_prior_bboxes;
-    std::vector<std::array<float, 4>>              _all_prior_variances;
-    std::vector<LabelBBox>                         _all_decode_bboxes;
-    std::vector<std::map<int, std::vector<int>>>   _all_indices;
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
 };
 } // namespace arm_compute
 #endif /* ARM_COMPUTE_CPP_DETECTION_OUTPUT_LAYER_H */
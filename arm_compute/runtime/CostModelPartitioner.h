@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_COSTMODELPARTITIONER_H
+#define ACL_ARM_COMPUTE_RUNTIME_COSTMODELPARTITIONER_H
+
+#include "arm_compute/runtime/IWorkloadPartitioner.h"
+
+namespace arm_compute
+{
+/** Workload partitioner using the estimated memory traffic of the kernel and the caches and core types of the CPU
+ *
+ * - Workloads are made large enough to access at least half of the L1 cache, as smaller ones cost more to dispatch
+ *   than to run.
+ * - On platforms mixing core types (e.g. big.LITTLE), STATIC workloads are over-decomposed so that the faster cores
+ *   pick up more of them instead of waiting for the slower ones.
+ * - If the preferred split dimension is too narrow to occupy all the threads, the window is also split along the
+ *   largest of the other dimensions above Window::DimX.
+ *
+ * Set it with @ref IScheduler::set_workload_partitioner.
+ */
+class CostModelPartitioner final : public IWorkloadPartitioner
+{
+public:
+    /** Constructor
+     *
+     * @param[in] workloads_per_thread (Optional) Number of STATIC workloads per thread on platforms mixing core types.
+     */
+    explicit CostModelPartitioner(unsigned int workloads_per_thread = 4);
+
+    // Inherited methods overridden:
+    WorkloadPartition partition(const ICPPKernel        &kernel,
+                                const Window            &window,
+                                const IScheduler::Hints &hints,
+                                const ITensorPack       &tensors,
+                                unsigned int             num_threads,
+                                const CPUInfo           &cpu_info) const override;
+
+private:
+    unsigned int _workloads_per_thread;
+    bool         _is_heterogeneous;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_COSTMODELPARTITIONER_H
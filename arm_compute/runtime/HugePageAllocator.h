@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_HUGEPAGEALLOCATOR_H
+#define ACL_ARM_COMPUTE_RUNTIME_HUGEPAGEALLOCATOR_H
+
+#include "arm_compute/runtime/IAllocator.h"
+#include "arm_compute/runtime/IMemoryRegion.h"
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace arm_compute
+{
+/** Huge pages backing the allocations of @ref HugePageAllocator */
+enum class HugePageMode
+{
+    None,        /**< Regular pages */
+    Transparent, /**< Transparent huge pages, requested with madvise() on huge page aligned mappings */
+    Explicit     /**< Pages of the huge page pool (MAP_HUGETLB), transparent huge pages if the pool is empty */
+};
+
+/** Allocator of large buffers backed by huge pages, optionally bound to a NUMA node
+ *
+ * Buffers of at least @p min_size bytes are mapped directly from the kernel, which reduces the TLB misses of
+ * multi-megabyte weights and memory pool blobs. Smaller buffers are allocated on the heap as @ref Allocator does.
+ *
+ * The pages of the mapped buffers can be bound to a NUMA node and pre-faulted. The pre-faulting is spread over the
+ * threads of the scheduler: with the default first-touch policy of the kernel, the pages are then spread over the
+ * NUMA nodes of the cores the threads run on.
+ *
+ * @note Huge pages and NUMA binding are only available on Linux. They are ignored when not supported.
+ */
+class HugePageAllocator final : public IAllocator
+{
+public:
+    /** Constructor
+     *
+     * @param[in] mode      (Optional) Huge pages backing the buffers.
+     * @param[in] numa_node (Optional) NUMA node to bind the buffers to, or -1 to leave the placement to the kernel.
+     * @param[in] prefault  (Optional) Fault the pages in when the buffers are allocated.
+     * @param[in] min_size  (Optional) Size in bytes from which buffers are mapped rather than allocated on the heap.
+     */
+    HugePageAllocator(HugePageMode mode      = HugePageMode::Transparent,
+                      int          numa_node = -1,
+                      bool         prefault  = true,
+                      size_t       min_size  = 1024 * 1024);
+    /** Prevent instances of this class from being copied */
+    HugePageAllocator(const HugePageAllocator &) = delete;
+    /** Prevent instances of this class from being copied */
+    HugePageAllocator &operator=(const HugePageAllocator &) = delete;
+    /** Destructor: unmaps the buffers which haven't been freed */
+    ~HugePageAllocator();
+
+    /** Size of the huge pages used by the allocator
+     *
+     * @return The size in bytes of a huge page, or of a regular page if huge pages aren't used
+     */
+    size_t page_size() const;
+
+    // Inherited methods overridden:
+    void                          *allocate(size_t size, size_t alignment) override;
+    void                           free(void *ptr) override;
+    std::unique_ptr<IMemoryRegion> make_region(size_t size, size_t alignment) override;
+
+private:
+    HugePageMode                            _mode;
+    int                                     _numa_node;
+    bool                                    _prefault;
+    size_t                                  _min_size;
+    size_t                                  _page_size;
+    std::mutex                              _mtx;
+    std::map<void *, std::shared_ptr<void>> _mappings;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_HUGEPAGEALLOCATOR_H
@@ -30,11 +30,18 @@
 
 #include <functional>
 #include <limits>
+#include <memory>
+#include <vector>
+#ifndef BARE_METAL
+#include <future>
+#endif /* BARE_METAL */
 
 namespace arm_compute
 {
+class AsyncTaskQueue;
 class ICPPKernel;
 class ITensor;
+class IWorkloadPartitioner;
 class Window;
 
 /** Scheduler interface to run kernels */
@@ -125,19 +132,48 @@ public:
         {
             return _threshold;
         }
+        /** Set whether the kernel is on the critical path of the latency of the workload
+         *
+         * Schedulers aware of the capacity of the cores (e.g. @ref CPPScheduler) can keep such kernels off the
+         * slowest cores, whose share of the work would otherwise set the latency of the kernel. The functions set it
+         * for the kernels of incremental decoding steps, which process a single row of queries or activations and
+         * whose latency is the one of every generated token.
+         *
+         * @param[in] latency_critical True if the kernel is latency-critical
+         *
+         * @return the Hints object
+         */
+        Hints &set_latency_critical(bool latency_critical)
+        {
+            _latency_critical = latency_critical;
+            return *this;
+        }
+        /** Return whether the kernel is latency-critical
+         *
+         * @return True if the kernel is latency-critical
+         */
+        bool latency_critical() const
+        {
+            return _latency_critical;
+        }
 
     private:
         unsigned int _split_dimension{};
         StrategyHint _strategy{};
         int          _threshold{};
+        bool         _latency_critical{false};
     };
     /** Signature for the workloads to execute */
     using Workload = std::function<void(const ThreadInfo &)>;
+#ifndef BARE_METAL
+    /** Handle to wait for the completion of an asynchronously submitted kernel or task */
+    using Completion = std::shared_future<void>;
+#endif /* BARE_METAL */
     /** Default constructor. */
     IScheduler();
 
     /** Destructor. */
-    virtual ~IScheduler() = default;
+    virtual ~IScheduler();
 
     /** Sets the number of threads the scheduler will use to run the kernels.
      *
@@ -183,6 +219,47 @@ public:
      */
     virtual void run_tagged_workloads(std::vector<Workload> &workloads, const char *tag);
 
+#ifndef BARE_METAL
+    /** Submit a kernel for execution without blocking the calling thread.
+     *
+     * Kernels submitted to the same scheduler are dispatched in submission order by a dedicated thread, which then
+     * splits them among the threads of the scheduler exactly as @ref schedule_op would. Independent branches can
+     * therefore run concurrently by submitting them to different schedulers configured with disjoint sets of threads,
+     * using the returned completions as dependency edges between them.
+     *
+     * @note The kernel, the window and the tensors of the pack must remain valid until the returned completion is
+     *       ready. The destructor of the scheduler runs the pending kernels before destroying the pool of threads.
+     * @warning Waiting, from within a submitted task, on a completion of the same scheduler deadlocks.
+     *
+     * @param[in] kernel       Kernel to execute.
+     * @param[in] hints        Hints for the scheduler.
+     * @param[in] window       Window to use for kernel execution.
+     * @param[in] tensors      Tensors to operate on. The pack is copied.
+     * @param[in] dependencies (Optional) Completions that must be ready before the kernel starts.
+     *
+     * @return Completion of the kernel. get() rethrows the exception raised by the kernel or its dependencies, if any.
+     */
+    Completion schedule_op_async(ICPPKernel                    *kernel,
+                                 const Hints                   &hints,
+                                 const Window                  &window,
+                                 ITensorPack                   &tensors,
+                                 const std::vector<Completion> &dependencies = {});
+
+    /** Submit an arbitrary task (e.g. IFunction::run()) without blocking the calling thread.
+     *
+     * The task is run by the dispatcher thread of the scheduler, after the tasks previously submitted to it and once
+     * all its dependencies are ready. Kernels scheduled by the task on this scheduler use its pool of threads.
+     *
+     * @note The destructor of the scheduler runs the pending tasks before destroying the pool of threads.
+     *
+     * @param[in] task         Task to execute.
+     * @param[in] dependencies (Optional) Completions that must be ready before the task starts.
+     *
+     * @return Completion of the task.
+     */
+    Completion run_async(std::function<void()> task, const std::vector<Completion> &dependencies = {});
+#endif /* BARE_METAL */
+
     /** Get CPU info.
      *
      * @return CPU info.
@@ -196,6 +273,15 @@ public:
      * @return Best possible number of execution threads to use
      */
     unsigned int num_threads_hint() const;
+    /** Set the object deciding how the execution windows of the kernels are split into workloads
+     *
+     * By default, the windows are split in as many workloads as threads (STATIC) or as the threshold of the hints
+     * (DYNAMIC) along the split dimension of the hints. The partitioner only applies to the kernels returning true
+     * from @ref ICPPKernel::partitions_by_window.
+     *
+     * @param[in] partitioner Partitioner to use, or nullptr to restore the default behaviour.
+     */
+    void set_workload_partitioner(std::shared_ptr<IWorkloadPartitioner> partitioner);
 
 protected:
     /** Execute all the passed workloads
@@ -232,8 +318,31 @@ protected:
                                       const ICPPKernel &kernel,
                                       const CPUInfo    &cpu_info);
 
+    /** Relative compute capacity of the threads running the workloads passed to @ref run_workloads
+     *
+     * When the threads are not equivalent, schedule_common() splits STATIC workloads proportionally to these weights,
+     * so that the workload with index i, run by the thread with id i, is sized to the capacity of its thread.
+     *
+     * @param[in] num_threads Number of threads which will run the workloads.
+     * @param[in] hints       Hints of the kernel to run.
+     *
+     * @return One weight per thread id, 0 meaning the thread must not be given any work, or an empty vector if all
+     *         the threads are equivalent (default).
+     */
+    virtual std::vector<unsigned int> thread_weights(unsigned int num_threads, const Hints &hints) const;
+
+    /** Run the tasks submitted by @ref schedule_op_async and @ref run_async and join their dispatcher thread
+     *
+     * @note The pending tasks call the virtual @ref schedule_op, so every derived scheduler must call this at the
+     *       beginning of its destructor, while it is still complete. Tasks still pending when ~IScheduler() runs are
+     *       dropped and their completions hold a std::future_error.
+     */
+    void drain_async_tasks();
+
 private:
-    unsigned int _num_threads_hint = {};
+    unsigned int                          _num_threads_hint = {};
+    std::shared_ptr<IWorkloadPartitioner> _partitioner{nullptr};
+    std::unique_ptr<AsyncTaskQueue>       _async_queue{nullptr};
 };
 } // namespace arm_compute
 #endif /* ARM_COMPUTE_ISCHEDULER_H */
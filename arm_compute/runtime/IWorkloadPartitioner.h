@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_IWORKLOADPARTITIONER_H
+#define ACL_ARM_COMPUTE_RUNTIME_IWORKLOADPARTITIONER_H
+
+#include "arm_compute/runtime/IScheduler.h"
+
+#include <cstddef>
+
+namespace arm_compute
+{
+/** Description of how the execution window of a kernel is split into workloads
+ *
+ * The window is split in @p num_windows sub-windows along @p split_dimension and, if @p num_windows_2 is greater
+ * than 1, each of them in @p num_windows_2 sub-windows along @p split_dimension_2.
+ */
+struct WorkloadPartition
+{
+    size_t       split_dimension{0};   /**< Main dimension along which the window is split */
+    unsigned int num_windows{1};       /**< Number of sub-windows along the main dimension */
+    size_t       split_dimension_2{0}; /**< Secondary dimension along which the window is split */
+    unsigned int num_windows_2{1};     /**< Number of sub-windows along the secondary dimension */
+};
+
+/** Interface of the objects deciding how @ref IScheduler splits the execution window of a kernel
+ *
+ * @note Partitioners are not used for kernels scheduled with @ref IScheduler::split_dimensions_all, which split
+ *       their window themselves.
+ */
+class IWorkloadPartitioner
+{
+public:
+    /** Default virtual destructor */
+    virtual ~IWorkloadPartitioner() = default;
+    /** Choose how to split the execution window of a kernel
+     *
+     * @param[in] kernel      Kernel to execute.
+     * @param[in] window      Window to split.
+     * @param[in] hints       Hints of the caller for the scheduler.
+     * @param[in] tensors     Tensors the kernel operates on. Empty for kernels holding their own tensors.
+     * @param[in] num_threads Number of threads of the scheduler.
+     * @param[in] cpu_info    The CPU platform the kernel runs on.
+     *
+     * @return The partition of the window. A partition with a single window runs the kernel on the calling thread.
+     */
+    virtual WorkloadPartition partition(const ICPPKernel        &kernel,
+                                        const Window            &window,
+                                        const IScheduler::Hints &hints,
+                                        const ITensorPack       &tensors,
+                                        unsigned int             num_threads,
+                                        const CPUInfo           &cpu_info) const = 0;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_IWORKLOADPARTITIONER_H
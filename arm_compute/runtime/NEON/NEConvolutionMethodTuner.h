@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_NEON_NECONVOLUTIONMETHODTUNER_H
+#define ACL_ARM_COMPUTE_RUNTIME_NEON_NECONVOLUTIONMETHODTUNER_H
+
+#include "arm_compute/core/Types.h"
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace arm_compute
+{
+/** Tuner selecting the fastest convolution method for each convolution shape by timing the candidates
+ *
+ * By default, @ref NEConvolutionLayer chooses between the Winograd, GEMM, GEMM_CONV2D and direct methods with a set of
+ * static heuristics. When a tuner is active (see @ref set_active_tuner), the functions configured afterwards look their
+ * convolution up in the tuner table instead and, if it is not present and tuning of new shapes is enabled, time every
+ * method supporting it and record the fastest one.
+ *
+ * The convolutions are identified by their shapes, data types, convolution parameters and number of threads of
+ * @ref NEScheduler. The table can be saved to a file and loaded back on later runs, so that the tuning cost is only
+ * paid once.
+ */
+class NEConvolutionMethodTuner
+{
+public:
+    /** Constructor
+     *
+     * @param[in] tune_new_convolutions Time the methods of the convolutions which are not present in the table ?
+     * @param[in] num_iterations        (Optional) Number of timed runs of each method. The fastest run is kept.
+     */
+    NEConvolutionMethodTuner(bool tune_new_convolutions = true, unsigned int num_iterations = 3);
+
+    /** Setter for tune_new_convolutions option
+     *
+     * @param[in] tune_new_convolutions Time the methods of the convolutions which are not present in the table ?
+     */
+    void set_tune_new_convolutions(bool tune_new_convolutions);
+
+    /** Tune convolutions that are not in the table
+     *
+     * @return True if tuning of new convolutions is enabled.
+     */
+    bool tune_new_convolutions() const;
+
+    /** Number of timed runs of each method
+     *
+     * @return The number of timed runs
+     */
+    unsigned int num_iterations() const;
+
+    /** Manually add the method to use for a convolution
+     *
+     * @param[in] conv_id Unique identifier of the convolution
+     * @param[in] method  Method to use for the convolution
+     */
+    void add_method(const std::string &conv_id, ConvolutionMethod method);
+
+    /** Look the method to use for a convolution up
+     *
+     * @param[in]  conv_id Unique identifier of the convolution
+     * @param[out] method  Method to use for the convolution, if found
+     *
+     * @return True if the convolution is present in the table
+     */
+    bool find_method(const std::string &conv_id, ConvolutionMethod &method) const;
+
+    /** Give read access to the method table
+     *
+     * @return The method table as unordered_map container
+     */
+    const std::unordered_map<std::string, ConvolutionMethod> &method_table() const;
+
+    /** Load the method table from file
+     *
+     * @param[in] filename Load the method table from this file.(Must exist)
+     */
+    void load_from_file(const std::string &filename);
+
+    /** Save the content of the method table to file
+     *
+     * @param[in] filename Save the method table to this file. (Content will be overwritten)
+     *
+     * @return true if the file was created
+     */
+    bool save_to_file(const std::string &filename) const;
+
+    /** Set the tuner used by the functions configured afterwards
+     *
+     * @param[in] tuner Tuner to use, or nullptr to use the static heuristics (default). It must outlive the
+     *                  configuration of the functions.
+     */
+    static void set_active_tuner(NEConvolutionMethodTuner *tuner);
+
+    /** Get the tuner used by the functions being configured
+     *
+     * @return The active tuner, or nullptr if the static heuristics are used
+     */
+    static NEConvolutionMethodTuner *active_tuner();
+
+private:
+    std::unordered_map<std::string, ConvolutionMethod> _method_table;
+    mutable std::mutex                                 _mtx;
+    bool                                               _tune_new_convolutions;
+    unsigned int                                       _num_iterations;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_NEON_NECONVOLUTIONMETHODTUNER_H
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_NEON_NEGEMMTUNER_H
+#define ACL_ARM_COMPUTE_RUNTIME_NEON_NEGEMMTUNER_H
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace arm_compute
+{
+/** Tuner selecting the fastest assembly GEMM kernel for each GEMM shape by timing the candidates
+ *
+ * By default, the assembly GEMM kernel is chosen by a static performance model. When a tuner is active (see
+ * @ref set_active_tuner), the functions configured afterwards look their GEMM shape up in the tuner table instead and,
+ * if the shape is not present and tuning of new shapes is enabled, time every kernel supporting it and record the
+ * fastest one.
+ *
+ * The table can be saved to a file and loaded back on later runs, so that the tuning cost is only paid once.
+ *
+ * @note Only plain GEMMs are tuned: convolutions using an indirect or im2col-free GEMM and fixed-format kernels keep
+ *       using the static performance model.
+ */
+class NEGEMMTuner
+{
+public:
+    /** Constructor
+     *
+     * @param[in] tune_new_kernels Time the kernels of the GEMM shapes which are not present in the table ?
+     * @param[in] num_iterations   (Optional) Number of timed runs of each kernel. The fastest run is kept.
+     */
+    NEGEMMTuner(bool tune_new_kernels = true, unsigned int num_iterations = 3);
+
+    /** Setter for tune_new_kernels option
+     *
+     * @param[in] tune_new_kernels Time the kernels of the GEMM shapes which are not present in the table ?
+     */
+    void set_tune_new_kernels(bool tune_new_kernels);
+
+    /** Tune GEMM shapes that are not in the table
+     *
+     * @return True if tuning of new GEMM shapes is enabled.
+     */
+    bool tune_new_kernels() const;
+
+    /** Number of timed runs of each kernel
+     *
+     * @return The number of timed runs
+     */
+    unsigned int num_iterations() const;
+
+    /** Manually add the kernel to use for a GEMM shape
+     *
+     * @param[in] gemm_id     Unique identifier of the GEMM shape
+     * @param[in] kernel_name Name of the assembly kernel to use for the shape
+     */
+    void add_kernel(const std::string &gemm_id, const std::string &kernel_name);
+
+    /** Look the kernel to use for a GEMM shape up
+     *
+     * @param[in]  gemm_id     Unique identifier of the GEMM shape
+     * @param[out] kernel_name Name of the assembly kernel to use for the shape, if found
+     *
+     * @return True if the shape is present in the table
+     */
+    bool find_kernel(const std::string &gemm_id, std::string &kernel_name) const;
+
+    /** Give read access to the kernel table
+     *
+     * @return The kernel table as unordered_map container
+     */
+    const std::unordered_map<std::string, std::string> &kernel_table() const;
+
+    /** Load the kernel table from file
+     *
+     * @param[in] filename Load the kernel table from this file.(Must exist)
+     */
+    void load_from_file(const std::string &filename);
+
+    /** Save the content of the kernel table to file
+     *
+     * @param[in] filename Save the kernel table to this file. (Content will be overwritten)
+     *
+     * @return true if the file was created
+     */
+    bool save_to_file(const std::string &filename) const;
+
+    /** Set the tuner used by the functions configured afterwards
+     *
+     * @param[in] tuner Tuner to use, or nullptr to disable tuning (default). It must outlive the configuration of the
+     *                  functions.
+     */
+    static void set_active_tuner(NEGEMMTuner *tuner);
+
+    /** Get the tuner used by the functions being configured
+     *
+     * @return The active tuner, or nullptr if tuning is disabled
+     */
+    static NEGEMMTuner *active_tuner();
+
+private:
+    std::unordered_map<std::string, std::string> _kernel_table;
+    mutable std::mutex                           _mtx;
+    bool                                         _tune_new_kernels;
+    unsigned int                                 _num_iterations;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_NEON_NEGEMMTUNER_H
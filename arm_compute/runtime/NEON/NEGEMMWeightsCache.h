@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_NEON_NEGEMMWEIGHTSCACHE_H
+#define ACL_ARM_COMPUTE_RUNTIME_NEON_NEGEMMWEIGHTSCACHE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+
+namespace arm_compute
+{
+/** Persistent on-disk cache of the reshaped weights of the assembly GEMM kernels
+ *
+ * Preparing a GEMM reshapes (pretransposes) its constant weights into the layout of the selected assembly kernel,
+ * which dominates the start-up time of large models. When a cache is active (see @ref set_active_cache), the
+ * functions configured afterwards look the reshaped weights up in the cache directory when they are prepared and, if
+ * present, memory-map them read-only instead of reshaping again. Otherwise, the reshaped weights are written to the
+ * cache once computed. Either way, the functions run on the mapped entry and don't keep their own copy of the reshaped
+ * weights.
+ *
+ * Entries are keyed by the content of the weights, the GEMM shape and the kernel (including its blocking
+ * parameters), so a cache directory can be shared by several models and is safe to reuse on another platform: the
+ * entries that don't match are simply ignored.
+ *
+ * @note The cache must outlive the functions which have been configured while it was active, as they keep reading the
+ *       mapped weights.
+ * @note Memory-mapping is only available on POSIX platforms. Elsewhere, the cache never finds nor stores any entry.
+ */
+class NEGEMMWeightsCache
+{
+public:
+    /** Constructor
+     *
+     * @param[in] directory Directory holding the cache entries. It must exist and be writable to store new entries.
+     */
+    explicit NEGEMMWeightsCache(std::string directory);
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEGEMMWeightsCache(const NEGEMMWeightsCache &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEGEMMWeightsCache &operator=(const NEGEMMWeightsCache &) = delete;
+    /** Destructor: unmaps all the entries found */
+    ~NEGEMMWeightsCache();
+
+    /** Look an entry up and map it in memory
+     *
+     * @param[in] key  Unique identifier of the entry.
+     * @param[in] size Expected size in bytes of the entry.
+     *
+     * @return A read-only pointer to the content of the entry, aligned to 128 bytes, or nullptr if there is no
+     *         matching entry
+     */
+    const void *find(const std::string &key, size_t size);
+
+    /** Write an entry to the cache directory
+     *
+     * @param[in] key  Unique identifier of the entry.
+     * @param[in] data Content of the entry.
+     * @param[in] size Size in bytes of the content.
+     *
+     * @return True if the entry has been written
+     */
+    bool store(const std::string &key, const void *data, size_t size);
+
+    /** Cache directory accessor
+     *
+     * @return The directory holding the cache entries
+     */
+    const std::string &directory() const;
+
+    /** Non-cryptographic 64-bit hash, used to build the keys of the entries
+     *
+     * @param[in] data Data to hash.
+     * @param[in] size Size in bytes of the data.
+     * @param[in] seed (Optional) Hash to chain with, e.g. the hash of the previous block of data.
+     *
+     * @return The hash of the data
+     */
+    static uint64_t hash(const void *data, size_t size, uint64_t seed = 0);
+
+    /** Set the cache used by the functions configured afterwards
+     *
+     * @param[in] cache Cache to use, or nullptr to disable caching (default).
+     */
+    static void set_active_cache(NEGEMMWeightsCache *cache);
+
+    /** Get the cache used by the functions being configured
+     *
+     * @return The active cache, or nullptr if caching is disabled
+     */
+    static NEGEMMWeightsCache *active_cache();
+
+private:
+    /** Path of the file holding an entry */
+    std::string entry_path(const std::string &key) const;
+
+    struct Mapping
+    {
+        void       *address;   /**< Start of the mapped file */
+        size_t      size;      /**< Size of the mapped file */
+        const void *data;      /**< Content of the entry */
+        size_t      data_size; /**< Size of the content of the entry */
+    };
+    std::string                    _directory;
+    std::map<std::string, Mapping> _mappings;
+    std::mutex                     _mtx;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_NEON_NEGEMMWEIGHTSCACHE_H
@@ -36,15 +36,30 @@ namespace arm_compute
 {
 // Forward declaration
 class ITensor;
+class NEFFTChirpKernel;
 class NEFFTDigitReverseKernel;
 class NEFFTRadixStageKernel;
+class NEFFTRealUnpackKernel;
 class NEFFTScaleKernel;
 
 /** Basic function to execute one dimensional FFT. This function calls the following kernels:
  *
  * -# NEFFTDigitReverseKernel Performs digit reverse
  * -# NEFFTRadixStageKernel   A list of FFT kernels depending on the radix decomposition
+ * -# NEFFTRealUnpackKernel   Computes the spectrum of a real input transformed as a complex input of half length
  * -# NEFFTScaleKernel        Performs output scaling in case of in inverse FFT
+ *
+ * Real inputs of even length along axis 0 are packed as complex inputs of half length, which halves the work.
+ *
+ * Lengths that can not be decomposed with the supported radices are computed with the Bluestein algorithm, which
+ * expresses the FFT as a convolution with a chirp sequence. The convolution is computed with two FFTs of a decomposable
+ * length and this function then calls:
+ *
+ * -# NEFFTChirpKernel Multiplies the input by the chirp and zero-pads it
+ * -# @ref NEFFT1D     Transforms the padded input
+ * -# NEFFTChirpKernel Multiplies the result by the spectrum of the chirp
+ * -# @ref NEFFT1D     Transforms back the product
+ * -# NEFFTChirpKernel Multiplies the result by the chirp and crops it
  */
 class NEFFT1D : public IFunction
 {
@@ -94,15 +109,36 @@ public:
     void run() override;
 
 protected:
+    /** Configure the Bluestein algorithm for sizes that can not be decomposed with the supported radices
+     *
+     * @param[in]  input  Source tensor.
+     * @param[out] output Destination tensor.
+     * @param[in]  config FFT related configuration
+     */
+    void configure_bluestein(const ITensor *input, ITensor *output, const FFT1DInfo &config);
+
+    std::shared_ptr<IMemoryManager>                     _memory_manager;
     MemoryGroup                                         _memory_group;
     std::unique_ptr<NEFFTDigitReverseKernel>            _digit_reverse_kernel;
     std::vector<std::unique_ptr<NEFFTRadixStageKernel>> _fft_kernels;
+    std::unique_ptr<NEFFTRealUnpackKernel>              _real_unpack_kernel;
     std::unique_ptr<NEFFTScaleKernel>                   _scale_kernel;
+    std::unique_ptr<NEFFTChirpKernel>                   _chirp_input_kernel;
+    std::unique_ptr<NEFFTChirpKernel>                   _chirp_product_kernel;
+    std::unique_ptr<NEFFTChirpKernel>                   _chirp_output_kernel;
+    std::unique_ptr<NEFFT1D>                            _chirp_fft;
+    std::unique_ptr<NEFFT1D>                            _product_fft;
     Tensor                                              _digit_reversed_input;
     Tensor                                              _digit_reverse_indices;
+    Tensor                                              _chirp;
+    Tensor                                              _chirp_spectrum;
+    Tensor                                              _chirp_input;
+    Tensor                                              _chirp_product;
     unsigned int                                        _num_ffts;
     unsigned int                                        _axis;
     bool                                                _run_scale;
+    bool                                                _run_real_unpack;
+    bool                                                _run_bluestein;
 };
 } // namespace arm_compute
 #endif // ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEFFT1D_H
@@ -113,15 +113,22 @@ public:
      * |:--------------|:------------------|:------|:--------------|
      * |F16            |F16                |F16    |F16            |
      * |F32            |F32                |F32    |F32            |
+     * |F32            |QASYMM8_SIGNED     |F32    |F32            |
+     * |F32            |QSYMM8             |F32    |F32            |
+     * |F32            |QSYMM8_PER_CHANNEL |F32    |F32            |
      * |QASYMM8        |QASYMM8            |S32    |QASYMM8        |
      * |QASYMM8_SIGNED |QASYMM8_SIGNED     |S32    |QASYMM8_SIGNED |
      *
+     * @note With F32 input and quantized weights, the rows of the input are dynamically quantized to QASYMM8_SIGNED,
+     *       each with its own scale and offset, and the product is computed with integer arithmetic then dequantized
+     *       to F32. The weights must be symmetrically quantized, per tensor or per output channel.
+     *
      * @param[in]  input        Source tensor. Data type supported: QASYMM8/QASYMM8_SIGNED/F16/F32.
      * @param[in]  weights      Weights tensor. The weights must be 2 dimensional.
      *                          If this function is called after a Convolution Layer, the (transposed) weights will have as many rows as the product of the first 3 input's dimensions.
      *                          If it is called after another FullyConnected Layer, the (transposed) weights will have as many rows as the input's first dimension.
-     *                          Data type supported: Same as @p input.
-     * @param[in]  biases       Bias tensor. Can be nullptr. Data type supported: Same as @p weights, S32 if @p weights is QASYMM8/QASYMM8_SIGNED.
+     *                          Data type supported: Same as @p input, or QASYMM8_SIGNED/QSYMM8/QSYMM8_PER_CHANNEL if @p input is F32.
+     * @param[in]  biases       Bias tensor. Can be nullptr. Data type supported: Same as @p input, S32 if @p input is QASYMM8/QASYMM8_SIGNED.
      * @param[out] output       Destination tensor. Its shape should be equal to the output of a matrix multiplication between:
      *                          - The output of im2col on the input and the (transposed) 2D weights, if the function is called after a Convolution Layer
      *                          - The input tensor and the (transposed) 2D weights, if the function is called after another FullyConnected Layer.
@@ -28,22 +28,44 @@
 #include "arm_compute/runtime/common/LSTMParams.h"
 #include "arm_compute/runtime/MemoryManagerOnDemand.h"
 #include "arm_compute/runtime/NEON/functions/NEActivationLayer.h"
-#include "arm_compute/runtime/NEON/functions/NEArithmeticAddition.h"
-#include "arm_compute/runtime/NEON/functions/NEArithmeticSubtraction.h"
 #include "arm_compute/runtime/NEON/functions/NEConcatenateLayer.h"
 #include "arm_compute/runtime/NEON/functions/NECopy.h"
 #include "arm_compute/runtime/NEON/functions/NEFullyConnectedLayer.h"
-#include "arm_compute/runtime/NEON/functions/NEGEMM.h"
-#include "arm_compute/runtime/NEON/functions/NEMeanStdDevNormalizationLayer.h"
-#include "arm_compute/runtime/NEON/functions/NEPixelWiseMultiplication.h"
-#include "arm_compute/runtime/NEON/functions/NETranspose.h"
+#include "arm_compute/runtime/SubTensor.h"
+
+#include <memory>
+#include <vector>
 
 namespace arm_compute
 {
 // Forward declarations
 class ITensor;
+namespace cpu
+{
+class CpuCopy;
+namespace kernels
+{
+class CpuLstmCellKernel;
+} // namespace kernels
+} // namespace cpu
 
-/** Basic function to run @ref NELSTMLayer */
+/** Basic function to run @ref NELSTMLayer
+ *
+ * The gates of all the cells are computed by a single matrix multiplication over the concatenated weights, followed
+ * by a single element-wise kernel applying the activations, peephole connections, layer normalization and clipping.
+ *
+ * When the input holds several timesteps, the input contributions of all of them are computed by one matrix
+ * multiplication up front, so that each timestep only multiplies the output state by the recurrent weights.
+ *
+ * This function calls the following functions/kernels:
+ *
+ * -# @ref NEConcatenateLayer               Concatenation of the weights, and of the input and output state
+ * -# @ref NEFullyConnectedLayer            Matrix multiplications computing the gates and the projection
+ * -# cpu::kernels::CpuLstmCellKernel       Element-wise part of the cell
+ * -# @ref NEActivationLayer                Projection clipping
+ * -# @ref NECopy                           Copy of the output state
+ * -# cpu::CpuCopy                          Copy of the output state of each timestep
+ */
 class NELSTMLayer : public IFunction
 {
 public:
@@ -73,7 +95,9 @@ public:
      * |F16          |F16          |
      * |F32          |F32          |
      *
-     * @param[in]  input                       Source tensor. Input is a 2D tensor with dimensions [input_size, batch_size]. Data types supported: F16/F32.
+     * @param[in]  input                       Source tensor. Input is a 2D tensor with dimensions [input_size, batch_size],
+     *                                         or a 3D tensor with dimensions [input_size, batch_size, num_timesteps] to run several timesteps at once.
+     *                                         Data types supported: F16/F32.
      * @param[in]  input_to_forget_weights     2D weights tensor with dimensions [input_size, num_units]. Data type supported: Same as @p input.
      * @param[in]  input_to_cell_weights       2D weights tensor with dimensions [input_size, num_units]. Data type supported: Same as @p input.
      * @param[in]  input_to_output_weights     2D weights tensor with dimensions [input_size, num_units]. Data type supported: Same as @p input.
@@ -88,7 +112,8 @@ public:
      * @param[out] scratch_buffer              2D tensor with dimensions [num_units * 4, batch_size] with CIFG or [num_units * 3, batch_size] without CIGF. Data type supported: Same as @p input.
      * @param[out] output_state_out            2D weights tensor with dimensions [output_size, batch_size]. Data type supported: Same as @p input.
      * @param[out] cell_state_out              2D tensor with dimensions [num_units, batch_size]. Data type supported: Same as @p input.
-     * @param[out] output                      Destination tensor. Output is a 2D tensor with dimensions [output_size, batch_size].
+     * @param[out] output                      Destination tensor. Output is a 2D tensor with dimensions [output_size, batch_size],
+     *                                         or a 3D tensor with dimensions [output_size, batch_size, num_timesteps] holding the output of every timestep.
      *                                         Data types supported: Same as @p input.
      * @param[in]  lstm_params                 Weights tensors used in peephole optimization:
      *                                         input_to_input_weights     (Optional) 2D weights tensor with dimensions [input_size, num_units]. Data type supported: Same as @p input.
@@ -131,7 +156,9 @@ public:
 
     /** Static function to check if given info will lead to a valid configuration of @ref NELSTMLayer
      *
-     * @param[in] input                       Source tensor. Input is a 2D tensor with dimensions [input_size, batch_size]. Data types supported: F16/F32.
+     * @param[in] input                       Source tensor. Input is a 2D tensor with dimensions [input_size, batch_size],
+     *                                        or a 3D tensor with dimensions [input_size, batch_size, num_timesteps] to run several timesteps at once.
+     *                                        Data types supported: F16/F32.
      * @param[in] input_to_forget_weights     2D weights tensor with dimensions [input_size, num_units]. Data type supported: Same as @p input.
      * @param[in] input_to_cell_weights       2D weights tensor with dimensions [input_size, num_units]. Data type supported: Same as @p input.
      * @param[in] input_to_output_weights     2D weights tensor with dimensions [input_size, num_units]. Data type supported: Same as @p input.
@@ -146,7 +173,8 @@ public:
      * @param[in] scratch_buffer              2D tensor with dimensions [num_units * 4, batch_size] with CIFG or [num_units * 3, batch_size] without CIGF. Data type supported: Same as @p input.
      * @param[in] output_state_out            2D weights tensor with dimensions [output_size, batch_size]. Data type supported: Same as @p input.
      * @param[in] cell_state_out              2D tensor with dimensions [num_units, batch_size]. Data type supported: Same as @p input.
-     * @param[in] output                      Destination tensor. Output is a 2D tensor with dimensions [output_size, batch_size].
+     * @param[in] output                      Destination tensor. Output is a 2D tensor with dimensions [output_size, batch_size],
+     *                                        or a 3D tensor with dimensions [output_size, batch_size, num_timesteps] holding the output of every timestep.
      *                                        Data types supported: Same as @p input.
      * @param[in] lstm_params                 Weights tensors used in peephole optimization:
      *                                        input_to_input_weights     (Optional) 2D weights tensor with dimensions [input_size, num_units]. Data type supported: Same as @p input.
@@ -194,88 +222,55 @@ public:
     void prepare() override;
 
 private:
-    MemoryGroup                    _memory_group;
-    NEFullyConnectedLayer          _fully_connected_input_gate;
-    NEArithmeticAddition           _accum_input_gate1;
-    NEArithmeticSubtraction        _subtract_input_gate;
-    NEPixelWiseMultiplication      _pixelwise_mul_input_gate;
-    NEActivationLayer              _activation_input_gate;
-    NEFullyConnectedLayer          _fully_connected_forget_gate;
-    NEArithmeticAddition           _accum_forget_gate1;
-    NEPixelWiseMultiplication      _pixelwise_mul_forget_gate;
-    NEActivationLayer              _activation_forget_gate;
-    NEFullyConnectedLayer          _fully_connected_cell_state;
-    NEGEMM                         _gemm_cell_state1;
-    NETranspose                    _transpose_cell_state;
-    NEArithmeticAddition           _accum_cell_state1;
-    NEArithmeticAddition           _accum_cell_state2;
-    NEPixelWiseMultiplication      _pixelwise_mul_cell_state1;
-    NEActivationLayer              _activation_cell_state;
-    NEActivationLayer              _cell_clip;
-    NEPixelWiseMultiplication      _pixelwise_mul_cell_state2;
-    NEFullyConnectedLayer          _fully_connected_output;
-    NEPixelWiseMultiplication      _pixelwise_mul_output_state1;
-    NEArithmeticAddition           _accum_output1;
-    NEActivationLayer              _activation_output;
-    NEActivationLayer              _activation_output_state;
-    NEPixelWiseMultiplication      _pixelwise_mul_output_state2;
-    NEFullyConnectedLayer          _fully_connected_output_state;
-    NEActivationLayer              _projection_clip;
-    NECopy                         _copy_cell_state;
-    NECopy                         _copy_output;
-    NEConcatenateLayer             _concat_scratch_buffer;
-    NEConcatenateLayer             _concat_inputs_forget_gate;
-    NEConcatenateLayer             _concat_weights_forget_gate;
-    NEConcatenateLayer             _concat_weights_input_gate;
-    NEConcatenateLayer             _concat_weights_output;
-    NEMeanStdDevNormalizationLayer _mean_std_norm_input_gate;
-    NEPixelWiseMultiplication      _pixelwise_mul_input_gate_coeff;
-    NEArithmeticAddition           _accum_input_gate_bias;
-    NEMeanStdDevNormalizationLayer _mean_std_norm_forget_gate;
-    NEPixelWiseMultiplication      _pixelwise_mul_forget_gate_coeff;
-    NEArithmeticAddition           _accum_forget_gate_bias;
-    NEMeanStdDevNormalizationLayer _mean_std_norm_cell_gate;
-    NEPixelWiseMultiplication      _pixelwise_mul_cell_gate_coeff;
-    NEArithmeticAddition           _accum_cell_gate_bias;
-    NEMeanStdDevNormalizationLayer _mean_std_norm_output_gate;
-    NEPixelWiseMultiplication      _pixelwise_mul_output_gate_coeff;
-    NEArithmeticAddition           _accum_output_gate_bias;
-    Tensor                         _input_gate_out1;
-    Tensor                         _input_gate_out2;
-    Tensor                         _input_gate_out3;
-    Tensor                         _input_gate_out4;
-    Tensor                         _forget_gate_out1;
-    Tensor                         _forget_gate_out2;
-    Tensor                         _forget_gate_out3;
-    Tensor                         _forget_gate_out4;
-    Tensor                         _forget_gate_out5;
-    Tensor                         _cell_state_out1;
-    Tensor                         _cell_state_out2;
-    Tensor                         _cell_state_out3;
-    Tensor                         _cell_state_out4;
-    Tensor                         _cell_state_out5;
-    Tensor                         _output1;
-    Tensor                         _output2;
-    Tensor                         _output3;
-    Tensor                         _output4;
-    Tensor                         _cell_state_activation;
-    Tensor                         _output_state1;
-    Tensor                         _ones;
-    Tensor                         _input_layer_norm_out1;
-    Tensor                         _input_layer_norm_out2;
-    Tensor                         _forget_layer_norm_out1;
-    Tensor                         _forget_layer_norm_out2;
-    Tensor                         _cell_layer_norm_out1;
-    Tensor                         _cell_layer_norm_out2;
-    Tensor                         _output_layer_norm_out1;
-    Tensor                         _output_layer_norm_out2;
-    bool                           _run_peephole_opt;
-    bool                           _run_cifg_opt;
-    bool                           _perform_cell_clipping;
-    bool                           _has_projection_weights;
-    bool                           _perform_projection_clipping;
-    bool                           _is_prepared;
-    bool                           _is_layer_norm_lstm;
+    /** Run the element-wise part of a cell, followed by the projection if any
+     *
+     * @param[in] gates           Pre-activations of the gates computed from the input.
+     * @param[in] recurrent_gates Pre-activations of the gates computed from the output state.
+     *                            nullptr if they are already added to @p gates.
+     * @param[in] cell_state_in   Cell state of the previous timestep.
+     * @param[in] is_last_step    Whether the scratch buffer has to be written.
+     */
+    void
+    run_cell(const ITensor *gates, const ITensor *recurrent_gates, const ITensor *cell_state_in, bool is_last_step);
+
+    MemoryGroup                                      _memory_group;
+    NEConcatenateLayer                               _concat_inputs;
+    NEConcatenateLayer                               _concat_input_weights;
+    NEConcatenateLayer                               _concat_recurrent_weights;
+    NEConcatenateLayer                               _concat_weights;
+    NEConcatenateLayer                               _concat_bias;
+    NEConcatenateLayer                               _concat_cell_params;
+    NEFullyConnectedLayer                            _fully_connected_gates;
+    NEFullyConnectedLayer                            _fully_connected_recurrent_gates;
+    std::unique_ptr<cpu::kernels::CpuLstmCellKernel> _lstm_cell_kernel;
+    NEFullyConnectedLayer                            _fully_connected_projection;
+    NEActivationLayer                                _projection_clip;
+    NECopy                                           _copy_output;
+    std::unique_ptr<cpu::CpuCopy>                    _copy_state;
+    Tensor                                           _input_weights;
+    Tensor                                           _recurrent_weights;
+    Tensor                                           _weights;
+    Tensor                                           _bias;
+    Tensor                                           _cell_params;
+    Tensor                                           _inputs;
+    Tensor                                           _sequence_input;
+    Tensor                                           _gates;
+    Tensor                                           _recurrent_gates;
+    Tensor                                           _cell_output;
+    std::vector<SubTensor>                           _step_gates;
+    std::vector<SubTensor>                           _step_outputs;
+    const ITensor                                   *_input;
+    const ITensor                                   *_output_state_in;
+    const ITensor                                   *_cell_state_in;
+    ITensor                                         *_cell_state_out;
+    ITensor                                         *_output_state_out;
+    ITensor                                         *_scratch_buffer;
+    unsigned int                                     _num_steps;
+    bool                                             _has_bias;
+    bool                                             _has_cell_params;
+    bool                                             _has_projection_weights;
+    bool                                             _perform_projection_clipping;
+    bool                                             _is_prepared;
 };
 } // namespace arm_compute
 #endif // ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NELSTMLAYER_H
@@ -102,13 +102,23 @@ public:
      * |lhs            |rhs                |dst            |
      * |:--------------|:------------------|:--------------|
      * |F32            |F32                |F32            |
+     * |F32            |QASYMM8_SIGNED     |F32            |
+     * |F32            |QSYMM8             |F32            |
+     * |F32            |QSYMM8_PER_CHANNEL |F32            |
      * |F16            |F16                |F16            |
      * |BFLOAT16       |BFLOAT16           |BFLOAT16       |
      * |QASYMM8_SIGNED |QASYMM8_SIGNED     |QASYMM8_SIGNED |
      * |QASYMM8        |QASYMM8            |QASYMM8        |
      *
+     * @note With F32 lhs and quantized rhs, the rows of lhs are dynamically quantized to QASYMM8_SIGNED, each with its
+     *       own scale and offset, and the product is computed with integer arithmetic then dequantized to F32.
+     *       The rhs must be symmetrically quantized, per tensor or per column, 2 dimensional and is broadcast over the
+     *       batches of lhs. It can be constant, in which case it is only reshaped on the first run. adj_lhs and
+     *       dynamic shapes are not supported in this mode.
+     *
      * @param[in]  lhs      Left-hand side tensor info. Data types supported: F16/F32/QASYMM8_SIGNED/QASYMM8.
-     * @param[in]  rhs      Right-hand side tensor info. Data types supported: same as @p lhs.
+     * @param[in]  rhs      Right-hand side tensor info. Data types supported: same as @p lhs, or
+     *                      QASYMM8_SIGNED/QSYMM8/QSYMM8_PER_CHANNEL if @p lhs is F32.
      * @param[out] dst      Output tensor to store the result of the batched matrix multiplication. Data types supported: same as @p lhs / @p rhs.
      * @param[in]  info     Contains MatMul operation information described in @ref MatMulInfo.
      * @param[in]  settings Contains flags for function level settings i.e fast math
@@ -123,7 +133,8 @@ public:
     /** Static function to check if given info will lead to a valid configuration of @ref NEMatMul
      *
      * @param[in]  lhs      Left-hand side tensor info. Data types supported: F16/F32/QASYMM8_SIGNED/QASYMM8.
-     * @param[in]  rhs      Right-hand side tensor info. Data types supported: same as @p lhs.
+     * @param[in]  rhs      Right-hand side tensor info. Data types supported: same as @p lhs, or
+     *                      QASYMM8_SIGNED/QSYMM8/QSYMM8_PER_CHANNEL if @p lhs is F32.
      * @param[out] dst      Output tensor info to store the result of the batched matrix multiplication. Data types supported: same as @p lhs / @p rhs.
      * @param[in]  info     Contains MatMul operation information described in @ref MatMulInfo.
      * @param[in]  settings Contains flags for function level settings i.e fast math
@@ -25,19 +25,23 @@
 #define ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEMEANSTDDEVNORMALIZATIONLAYER_H
 
 #include "arm_compute/core/Types.h"
-#include "arm_compute/runtime/NEON/INESimpleFunctionNoBorder.h"
+#include "arm_compute/runtime/IFunction.h"
+
+#include <memory>
 
 namespace arm_compute
 {
+// Forward declarations
 class ITensor;
 class ITensorInfo;
+class NEMeanStdDevNormalizationKernel;
 
 /** Basic function to execute mean and standard deviation normalization by calling NEMeanStdDevNormalizationKernel */
-class NEMeanStdDevNormalizationLayer : public INESimpleFunctionNoBorder
+class NEMeanStdDevNormalizationLayer : public IFunction
 {
 public:
     /** Constructor */
-    NEMeanStdDevNormalizationLayer() = default;
+    NEMeanStdDevNormalizationLayer();
     /** Prevent instances of this class from being copied (As this class contains pointers) */
     NEMeanStdDevNormalizationLayer(const NEMeanStdDevNormalizationLayer &) = delete;
     /** Prevent instances of this class from being copied (As this class contains pointers) */
@@ -61,6 +65,8 @@ public:
      * |F16      |F16       |
      *
      * @note If the output tensor is a nullptr, the normalization will be performed in-place.
+     * @note If @p input has dynamic dimensions, its configured shape is the largest one the function runs on and the
+     *       execution window is recomputed from the current shape of @p input on each @ref run
      *
      * @param[in, out] input   Input tensor with 2 dimensions. Data types supported: F16/F32.
      * @param[out]     output  (Optional) Destination tensor. It can be nullptr in case of in-place computation. Data type supported: same as @p input
@@ -77,6 +83,13 @@ public:
      * @return a status
      */
     static Status validate(const ITensorInfo *input, const ITensorInfo *output = nullptr, float epsilon = 1e-8f);
+
+    // Inherited methods overridden:
+    void run() override;
+
+private:
+    std::unique_ptr<NEMeanStdDevNormalizationKernel> _kernel;
+    bool                                             _is_dynamic;
 };
 } // namespace arm_compute
 #endif // ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEMEANSTDDEVNORMALIZATIONLAYER_H
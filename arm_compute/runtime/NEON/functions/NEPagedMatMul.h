@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEPAGEDMATMUL_H
+#define ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEPAGEDMATMUL_H
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/function_info/MatMulInfo.h"
+#include "arm_compute/runtime/IFunction.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+// Forward declarations
+class ITensor;
+class ITensorInfo;
+
+/** Basic function to multiply the rows of an incremental decoding step by a paged key or value cache
+ *
+ * The cache is a pool of fixed-size blocks of rows shared by all the sequences. Row i of sequence b is row
+ * i % block_size of block block_table[b][i / block_size], so the caller appends a token by writing its row in the
+ * last block of the sequence, or in a free block added to its row of the block table, and by incrementing its
+ * length. Only the first seq_lens[b] rows of a sequence are read, and since the lengths are read when the function
+ * is run, the function is configured once for the maximum length of the sequences.
+ *
+ * Decoding multiplies few rows (M = 1 to 8) per head by the whole cache, so the function is bound by the loads of
+ * the cache. All the rows of a head are multiplied by each row of the cache while it is loaded, and an 8-bit cache
+ * halves or quarters the bytes read compared to F16 or F32.
+ */
+class NEPagedMatMul : public IFunction
+{
+public:
+    /** Default Constructor */
+    NEPagedMatMul();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEPagedMatMul(const NEPagedMatMul &) = delete;
+    /** Default move constructor */
+    NEPagedMatMul(NEPagedMatMul &&);
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEPagedMatMul &operator=(const NEPagedMatMul &) = delete;
+    /** Default move assignment operator */
+    NEPagedMatMul &operator=(NEPagedMatMul &&);
+    /** Default destructor */
+    ~NEPagedMatMul();
+    /** Set the input and output tensors.
+     *
+     * Valid data layouts:
+     * - All
+     *
+     * Valid data type configurations:
+     * |lhs            |cache          |block_table    |seq_lens       |dst            |
+     * |:--------------|:--------------|:--------------|:--------------|:--------------|
+     * |F32            |F32            |S32            |S32            |F32            |
+     * |F32            |QASYMM8_SIGNED |S32            |S32            |F32            |
+     * |F16            |F16            |S32            |S32            |F16            |
+     * |F16            |QASYMM8_SIGNED |S32            |S32            |F16            |
+     *
+     * @note With @p info adj_rhs set, dst = lhs * cache^T holds the scores of the rows against the cached keys, and
+     *       the columns past the length of a sequence are set to -infinity so that a softmax ignores them.
+     *       Otherwise dst = lhs * cache, where lhs holds e.g. the softmax of the scores, multiplies them by the
+     *       cached values. Several heads can share the same cache head (grouped-query attention), in which case
+     *       head h uses the cache head h / (num_heads / num_kv_heads).
+     * @note A QASYMM8_SIGNED cache is dequantized with its per-tensor quantization information while it is loaded.
+     *
+     * @param[in]  lhs         Left-hand side tensor of shape [K, M, num_heads, num_batches], with
+     *                         K = cache->dimension(0) if @p info adj_rhs is set, and K = max_seq_len otherwise.
+     *                         Data types supported: F32/F16
+     * @param[in]  cache       Cache tensor of shape [row_size, block_size, num_kv_heads, num_blocks], where
+     *                         num_heads is a multiple of num_kv_heads. The row size must not exceed 256.
+     *                         Data types supported: same as @p lhs or QASYMM8_SIGNED
+     * @param[in]  block_table Indices of the blocks of each sequence, of shape [max_blocks_per_seq, num_batches].
+     *                         max_seq_len is max_blocks_per_seq * block_size. Data type supported: S32
+     * @param[in]  seq_lens    Number of valid rows of the cache of each sequence, of shape [num_batches].
+     *                         Data type supported: S32
+     * @param[out] dst         Destination tensor of shape [max_seq_len, M, num_heads, num_batches] if @p info
+     *                         adj_rhs is set, and [row_size, M, num_heads, num_batches] otherwise.
+     *                         Data type supported: same as @p lhs
+     * @param[in]  info        Matrix multiplication information. adj_lhs must be false.
+     */
+    void configure(const ITensor    *lhs,
+                   const ITensor    *cache,
+                   const ITensor    *block_table,
+                   const ITensor    *seq_lens,
+                   ITensor          *dst,
+                   const MatMulInfo &info);
+    /** Static function to check if given info will lead to a valid configuration of @ref NEPagedMatMul
+     *
+     * Similar to @ref NEPagedMatMul::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *lhs,
+                           const ITensorInfo *cache,
+                           const ITensorInfo *block_table,
+                           const ITensorInfo *seq_lens,
+                           const ITensorInfo *dst,
+                           const MatMulInfo  &info);
+
+    // Inherited methods overridden:
+    void run() override;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEPAGEDMATMUL_H
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NESCALEDDOTPRODUCTATTENTION_H
+#define ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NESCALEDDOTPRODUCTATTENTION_H
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/function_info/ScaledDotProductAttentionInfo.h"
+#include "arm_compute/runtime/IFunction.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+// Forward declarations
+class ITensor;
+class ITensorInfo;
+
+/** Basic function to compute the scaled dot-product attention softmax(scale * Q * K^T + mask) * V of several heads
+ *
+ * The scores are computed one tile of keys at a time and normalized with an online softmax, so unlike a
+ * composition of @ref NEMatMul, @ref NESoftmaxLayer and @ref NEArithmeticAddition, the memory traffic does not grow
+ * with the product of the numbers of queries and keys.
+ */
+class NEScaledDotProductAttention : public IFunction
+{
+public:
+    /** Default Constructor */
+    NEScaledDotProductAttention();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEScaledDotProductAttention(const NEScaledDotProductAttention &) = delete;
+    /** Default move constructor */
+    NEScaledDotProductAttention(NEScaledDotProductAttention &&);
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEScaledDotProductAttention &operator=(const NEScaledDotProductAttention &) = delete;
+    /** Default move assignment operator */
+    NEScaledDotProductAttention &operator=(NEScaledDotProductAttention &&);
+    /** Default destructor */
+    ~NEScaledDotProductAttention();
+    /** Set the input and output tensors.
+     *
+     * Valid data layouts:
+     * - All
+     *
+     * Valid data type configurations:
+     * |query    |key      |value    |mask     |dst      |
+     * |:--------|:--------|:--------|:--------|:--------|
+     * |F32      |F32      |F32      |F32      |F32      |
+     * |F16      |F16      |F16      |F16      |F16      |
+     * |BFLOAT16 |BFLOAT16 |BFLOAT16 |BFLOAT16 |BFLOAT16 |
+     *
+     * @note Several query heads can share the same key and value head (grouped-query attention), in which case the
+     *       query head h uses the key and value head h / (num_heads / num_kv_heads).
+     *
+     * @param[in]  query Query tensor of shape [head_size, num_queries, num_heads, num_batches].
+     *                   Data types supported: F32/F16/BFLOAT16. The head size must not exceed 256.
+     * @param[in]  key   Key tensor of shape [head_size, num_keys, num_kv_heads, num_batches], where num_heads
+     *                   is a multiple of num_kv_heads. Data type supported: same as @p query
+     * @param[in]  value Value tensor of shape [value_head_size, num_keys, num_kv_heads, num_batches].
+     *                   Data type supported: same as @p query. The value head size must not exceed 256.
+     * @param[in]  mask  (Optional) Mask tensor of shape [num_keys, num_queries, 1 or num_heads, 1 or num_batches],
+     *                   added to the scaled scores. Can be nullptr. Data type supported: same as @p query
+     * @param[out] dst   Destination tensor of shape [value_head_size, num_queries, num_heads, num_batches].
+     *                   Data type supported: same as @p query
+     * @param[in]  info  (Optional) Attention information, holding the scale of the scores and the causal mask flag
+     */
+    void configure(const ITensor                       *query,
+                   const ITensor                       *key,
+                   const ITensor                       *value,
+                   const ITensor                       *mask,
+                   ITensor                             *dst,
+                   const ScaledDotProductAttentionInfo &info = ScaledDotProductAttentionInfo());
+    /** Static function to check if given info will lead to a valid configuration of @ref NEScaledDotProductAttention
+     *
+     * Similar to @ref NEScaledDotProductAttention::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo                   *query,
+                           const ITensorInfo                   *key,
+                           const ITensorInfo                   *value,
+                           const ITensorInfo                   *mask,
+                           const ITensorInfo                   *dst,
+                           const ScaledDotProductAttentionInfo &info = ScaledDotProductAttentionInfo());
+
+    // Inherited methods overridden:
+    void run() override;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NESCALEDDOTPRODUCTATTENTION_H
@@ -59,17 +59,17 @@ public:
      *
      * @param[in]  src     Source tensor. Values used to fill output. Can be nullptr when zero initialization is true.
      * @param[in]  updates Tensor containing values used to update output tensor. Data types supported: same as @p src
-     * @param[in]  indices Tensor containing Indices to change in the output Tensor. Data types supported : U32
+     * @param[in]  indices Tensor containing Indices to change in the output Tensor. Data types supported : S32
      * @param[out] output  Destination tensor. Data types supported: same as @p src.
      * @param[in]  info    Scatter info object.
      */
     void configure(
         const ITensor *src, const ITensor *updates, const ITensor *indices, ITensor *output, const ScatterInfo &info);
-    /** Static function to check if given info will lead to a valid configuration of @ref CLScatter
+    /** Static function to check if given info will lead to a valid configuration of @ref NEScatter
      *
      * @param[in] src     Source tensor.
      * @param[in] updates Tensor containing values used for updating the output Tensor. Data types supported : same as @p src
-     * @param[in] indices Tensor containing Indices to change in the output Tensor. Data types supported : U32
+     * @param[in] indices Tensor containing Indices to change in the output Tensor. Data types supported : S32
      * @param[in] output  Destination tensor. Data types supported: same as @p src.
      * @param[in] info    Scatter info containing type of scatter.
      *
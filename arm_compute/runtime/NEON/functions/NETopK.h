@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NETOPK_H
+#define ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NETOPK_H
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/runtime/IFunction.h"
+#include "arm_compute/runtime/IMemoryManager.h"
+#include "arm_compute/runtime/MemoryManagerOnDemand.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+class ITensor;
+class ITensorInfo;
+
+/** Basic function to select the k largest values of each row of a tensor, and their indices */
+class NETopK : public IFunction
+{
+public:
+    /** Constructor */
+    NETopK(std::shared_ptr<IMemoryManager> memory_manager);
+    NETopK() : NETopK(MemoryManagerOnDemand::make_default())
+    {
+    }
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NETopK(const NETopK &) = delete;
+    /** Default move constructor */
+    NETopK(NETopK &&);
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NETopK &operator=(const NETopK &) = delete;
+    /** Default move assignment operator */
+    NETopK &operator=(NETopK &&);
+    /** Default destructor */
+    ~NETopK();
+    /** Set the input and output tensors.
+     *
+     * Valid data layouts:
+     * - All
+     *
+     * Valid data type configurations:
+     * |src            |values         |indices |
+     * |:--------------|:--------------|:-------|
+     * |QASYMM8        |QASYMM8        |S32     |
+     * |QASYMM8_SIGNED |QASYMM8_SIGNED |S32     |
+     * |F16            |F16            |S32     |
+     * |F32            |F32            |S32     |
+     *
+     * @param[in]  input   Source tensor. Data types supported: QASYMM8/QASYMM8_SIGNED/F16/F32.
+     * @param[out] values  Destination tensor of the k largest values of each row of @p input, i.e. of shape
+     *                     [k, input->dimension(1), ...]. Data type supported: same as @p input
+     * @param[out] indices Destination tensor of the indices of @p values in the rows of @p input.
+     *                     Data type supported: S32
+     * @param[in]  k       Number of values to select in each row, in the range [1, input->dimension(0)]
+     * @param[in]  sorted  (Optional) True to return the values in descending order, false to return them in the order
+     *                     of the row. Equal values are ordered by index in both cases. Defaults to true
+     */
+    void configure(const ITensor *input, ITensor *values, ITensor *indices, unsigned int k, bool sorted = true);
+    /** Static function to check if given info will lead to a valid configuration of @ref NETopK
+     *
+     * Similar to @ref NETopK::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *input,
+                           const ITensorInfo *values,
+                           const ITensorInfo *indices,
+                           unsigned int       k,
+                           bool               sorted = true);
+
+    // Inherited methods overridden:
+    void run() override;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NETOPK_H
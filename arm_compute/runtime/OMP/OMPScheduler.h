@@ -34,6 +34,8 @@ class OMPScheduler final : public IScheduler
 public:
     /** Constructor. */
     OMPScheduler();
+    /** Destructor: run the pending asynchronous tasks */
+    ~OMPScheduler();
     /** Sets the number of threads the scheduler will use to run the kernels.
      *
      * @param[in] num_threads If set to 0, then the number returned by omp_get_max_threads() will be used, otherwise the number of threads specified.
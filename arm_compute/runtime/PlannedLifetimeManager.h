@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_PLANNEDLIFETIMEMANAGER_H
+#define ACL_ARM_COMPUTE_RUNTIME_PLANNEDLIFETIMEMANAGER_H
+
+#include "arm_compute/runtime/ISimpleLifetimeManager.h"
+#include "arm_compute/runtime/Types.h"
+
+#include <cstddef>
+#include <map>
+#include <utility>
+
+namespace arm_compute
+{
+// Forward declarations
+class IMemoryPool;
+
+/** Concrete class that records the complete lifetime of the registered tensors and plans their offsets in a single
+ *  blob ahead of time
+ *
+ * Unlike @ref OffsetLifetimeManager, which lays the reused blobs out one after the other, the offsets are assigned
+ * once all the lifetimes of a group are known. The tensors are placed one at a time at the best fitting gap left by
+ * the tensors they are alive with. Several placement orders are tried (decreasing size, decreasing lifetime and
+ * increasing start, the latter being the colouring order of the interval graph) and the one with the smallest blob is
+ * kept.
+ *
+ * The blob can't be smaller than the largest sum of the sizes of the tensors alive at the same time, which is
+ * reported by @ref lower_bound alongside the achieved @ref peak_size.
+ */
+class PlannedLifetimeManager : public ISimpleLifetimeManager
+{
+public:
+    using info_type = BlobInfo;
+
+public:
+    /** Constructor */
+    PlannedLifetimeManager();
+    /** Prevent instances of this class to be copy constructed */
+    PlannedLifetimeManager(const PlannedLifetimeManager &) = delete;
+    /** Prevent instances of this class to be copied */
+    PlannedLifetimeManager &operator=(const PlannedLifetimeManager &) = delete;
+    /** Allow instances of this class to be move constructed */
+    PlannedLifetimeManager(PlannedLifetimeManager &&) = default;
+    /** Allow instances of this class to be moved */
+    PlannedLifetimeManager &operator=(PlannedLifetimeManager &&) = default;
+    /** Accessor to the pool internal configuration meta-data
+     *
+     * @return Lifetime manager internal configuration meta-data
+     */
+    const info_type &info() const;
+    /** Size of the blob required by the planned offsets
+     *
+     * @return The largest blob size over the finalized groups
+     */
+    size_t peak_size() const;
+    /** Smallest blob size any offset assignment could achieve
+     *
+     * @return The largest sum of the sizes of the objects alive at the same time over the finalized groups
+     */
+    size_t lower_bound() const;
+
+    // Inherited methods overridden:
+    void                         start_lifetime(void *obj) override;
+    void                         end_lifetime(void *obj, IMemory &obj_memory, size_t size, size_t alignment) override;
+    std::unique_ptr<IMemoryPool> create_pool(IAllocator *allocator) override;
+    MappingType                  mapping_type() const override;
+
+private:
+    // Inherited methods overridden:
+    void update_blobs_and_mappings() override;
+
+private:
+    BlobInfo                                    _blob;        /**< Memory blob size */
+    size_t                                      _lower_bound; /**< Lower bound of the blob size */
+    size_t                                      _clock;       /**< Number of lifetime events of the active group */
+    std::map<void *, std::pair<size_t, size_t>> _intervals;   /**< Lifetime intervals of the active elements */
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_PLANNEDLIFETIMEMANAGER_H
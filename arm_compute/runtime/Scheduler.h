@@ -72,11 +72,21 @@ public:
      * @return true if the given scheduler type is supported. False otherwise.
      */
     static bool is_available(Type t);
+    /** Sets the scheduler returned by @ref get() to the calling thread only.
+     *
+     * This allows a thread to run functions on its own pool of threads (e.g. one branch of a graph executed
+     * concurrently with other branches) while the other threads keep using the active scheduler.
+     *
+     * @param[in] scheduler Scheduler to use from the calling thread, nullptr to use the active scheduler again.
+     *                      The scheduler must outlive its use by the calling thread.
+     */
+    static void set_thread_scheduler(IScheduler *scheduler);
 
 private:
     static Type                                        _scheduler_type;
     static std::shared_ptr<IScheduler>                 _custom_scheduler;
     static std::map<Type, std::unique_ptr<IScheduler>> _schedulers;
+    static thread_local IScheduler                    *_thread_scheduler;
 
     Scheduler();
 };
@@ -40,6 +40,7 @@ public:
         ST,  /**< Single thread. */
         CPP, /**< C++11 threads. */
         OMP, /**< OpenMP. */
+        WS,  /**< C++11 threads with per-thread work stealing. */
     };
 
 public:
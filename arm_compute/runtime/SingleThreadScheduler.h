@@ -34,6 +34,8 @@ class SingleThreadScheduler final : public IScheduler
 public:
     /** Constructor. */
     SingleThreadScheduler() = default;
+    /** Destructor: run the pending asynchronous tasks */
+    ~SingleThreadScheduler();
     /** Sets the number of threads the scheduler will use to run the kernels.
      *
      * @param[in] num_threads This is ignored for this scheduler as the number of threads is always one.
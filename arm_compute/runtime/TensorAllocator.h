@@ -35,6 +35,7 @@ namespace arm_compute
 {
 // Forward declaration
 class Coordinates;
+class IAllocator;
 class TensorInfo;
 
 /** Basic implementation of a CPU memory tensor allocator. */
@@ -111,6 +112,12 @@ public:
      * @param[in] associated_memory_group Memory group to associate the tensor with
      */
     void set_associated_memory_group(IMemoryGroup *associated_memory_group);
+    /** Set the allocator the memory of the tensor is allocated with when it isn't managed by a memory group
+     *
+     * @param[in] allocator Allocator to use, or nullptr to allocate on the heap (default). It must outlive the
+     *                      memory of the tensor.
+     */
+    void set_allocator(IAllocator *allocator);
 
 protected:
     /** No-op for CPU memory
@@ -125,6 +132,7 @@ protected:
 private:
     IMemoryManageable *_owner;                   /**< Memory manageable object that owns the allocator */
     IMemoryGroup      *_associated_memory_group; /**< Registered memory manager */
+    IAllocator        *_allocator;               /**< Allocator of the unmanaged memory, nullptr for the heap */
     Memory             _memory;                  /**< CPU memory */
 };
 } // namespace arm_compute
@@ -77,6 +77,25 @@ bool model_supports_dot(CpuModel model)
     }
 }
 
+uint32_t model_capacity(CpuModel model)
+{
+    switch (model)
+    {
+        // In-order little cores
+        case CpuModel::A53:
+        case CpuModel::A55r0:
+        case CpuModel::A55r1:
+        case CpuModel::A35:
+        case CpuModel::A510:
+            return 384;
+        // Previous generation of big cores
+        case CpuModel::A73:
+            return 768;
+        default:
+            return 1024;
+    }
+}
+
 CpuModel midr_to_model(uint32_t midr)
 {
     CpuModel model = CpuModel::GENERIC;
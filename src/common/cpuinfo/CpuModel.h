@@ -66,6 +66,17 @@ bool model_supports_fp16(CpuModel model);
  * @param[in] model Model to check for allowlisted capabilities
  */
 bool model_supports_dot(CpuModel model);
+
+/** Estimate the relative compute capacity of a model
+ *
+ * Capacities follow the convention of the Linux scheduler: the fastest cores have a capacity of 1024. Models we
+ * can't classify (e.g. GENERIC) are assumed to be big cores.
+ *
+ * @param[in] model Model to estimate the capacity of
+ *
+ * @return The relative capacity of the model, in the range [1, 1024]
+ */
+uint32_t model_capacity(CpuModel model);
 } // namespace cpuinfo
 } // namespace arm_compute
 #endif /* SRC_COMMON_CPUINFO_CPUMODEL_H */
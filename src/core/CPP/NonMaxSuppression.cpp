@@ -0,0 +1,271 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/core/CPP/NonMaxSuppression.h"
+
+#include <algorithm>
+#if defined(__aarch64__)
+#include <arm_neon.h>
+#endif // defined(__aarch64__)
+
+namespace arm_compute
+{
+namespace cpp
+{
+namespace
+{
+// Number of boxes tracked by each word of the suppression bitmask
+constexpr size_t tile_size = 64;
+
+struct Intersection
+{
+    float xmin;
+    float ymin;
+    float width;
+    float height;
+};
+
+inline float overlap(const NMSBoxes  &ref,
+                     size_t           i,
+                     const NMSBoxes  &boxes,
+                     size_t           j,
+                     const NMSConfig &config,
+                     Intersection    &inter)
+{
+    inter.xmin        = std::max(boxes.xmin[j], ref.xmin[i]);
+    inter.ymin        = std::max(boxes.ymin[j], ref.ymin[i]);
+    const float xmax  = std::min(boxes.xmax[j], ref.xmax[i]);
+    const float ymax  = std::min(boxes.ymax[j], ref.ymax[i]);
+    inter.width       = std::max(xmax - inter.xmin + config.offset, 0.f);
+    inter.height      = std::max(ymax - inter.ymin + config.offset, 0.f);
+    const float inter_area = inter.width * inter.height;
+
+    if (config.skip_empty && (ref.area[i] <= 0.f || boxes.area[j] <= 0.f))
+    {
+        return 0.f;
+    }
+    return inter_area / (ref.area[i] + boxes.area[j] - inter_area);
+}
+
+inline bool is_suppressed(float iou, const Intersection &inter, const NMSConfig &config)
+{
+    if (!(iou <= config.iou_threshold))
+    {
+        return true;
+    }
+    return config.suppress_size &&
+           !(inter.width >= config.min_size && inter.height >= config.min_size &&
+             inter.xmin + (inter.width / 2) < config.im_width && inter.ymin + (inter.height / 2) < config.im_height);
+}
+
+#if defined(__aarch64__)
+struct RefBox
+{
+    float32x4_t xmin;
+    float32x4_t ymin;
+    float32x4_t xmax;
+    float32x4_t ymax;
+    float32x4_t area;
+};
+
+inline RefBox load_ref(const NMSBoxes &ref, size_t i)
+{
+    return RefBox{vdupq_n_f32(ref.xmin[i]), vdupq_n_f32(ref.ymin[i]), vdupq_n_f32(ref.xmax[i]),
+                  vdupq_n_f32(ref.ymax[i]), vdupq_n_f32(ref.area[i])};
+}
+
+inline float32x4_t overlap_f32x4(const RefBox      &ref,
+                                 const NMSBoxes    &boxes,
+                                 size_t             j,
+                                 const NMSConfig   &config,
+                                 float32x4_t       &xx1,
+                                 float32x4_t       &yy1,
+                                 float32x4_t       &w,
+                                 float32x4_t       &h)
+{
+    const float32x4_t zero   = vdupq_n_f32(0.f);
+    const float32x4_t offset = vdupq_n_f32(config.offset);
+    const float32x4_t area   = vld1q_f32(boxes.area.data() + j);
+
+    xx1                     = vmaxq_f32(vld1q_f32(boxes.xmin.data() + j), ref.xmin);
+    yy1                     = vmaxq_f32(vld1q_f32(boxes.ymin.data() + j), ref.ymin);
+    const float32x4_t xx2   = vminq_f32(vld1q_f32(boxes.xmax.data() + j), ref.xmax);
+    const float32x4_t yy2   = vminq_f32(vld1q_f32(boxes.ymax.data() + j), ref.ymax);
+    w                       = vmaxq_f32(vaddq_f32(vsubq_f32(xx2, xx1), offset), zero);
+    h                       = vmaxq_f32(vaddq_f32(vsubq_f32(yy2, yy1), offset), zero);
+    const float32x4_t inter = vmulq_f32(w, h);
+    const float32x4_t iou   = vdivq_f32(inter, vsubq_f32(vaddq_f32(ref.area, area), inter));
+
+    if (config.skip_empty)
+    {
+        const uint32x4_t non_empty = vandq_u32(vcgtq_f32(ref.area, zero), vcgtq_f32(area, zero));
+        return vbslq_f32(non_empty, iou, zero);
+    }
+    return iou;
+}
+
+inline uint64_t movemask_u32x4(uint32x4_t mask)
+{
+    static const uint32_t lane_bits[] = {1, 2, 4, 8};
+    return vaddvq_u32(vandq_u32(mask, vld1q_u32(lane_bits)));
+}
+#endif // defined(__aarch64__)
+
+/** Bitmask of the boxes in [begin, end) suppressed by box @p i, bit 0 corresponding to @p begin */
+uint64_t suppression_mask(const NMSBoxes &boxes, size_t i, size_t begin, size_t end, const NMSConfig &config)
+{
+    uint64_t mask = 0;
+    size_t   j    = begin;
+
+#if defined(__aarch64__)
+    const RefBox      ref       = load_ref(boxes, i);
+    const float32x4_t threshold = vdupq_n_f32(config.iou_threshold);
+    const float32x4_t min_size  = vdupq_n_f32(config.min_size);
+    const float32x4_t im_width  = vdupq_n_f32(config.im_width);
+    const float32x4_t im_height = vdupq_n_f32(config.im_height);
+    for (; j + 4 <= end; j += 4)
+    {
+        float32x4_t xx1, yy1, w, h;
+        const float32x4_t iou        = overlap_f32x4(ref, boxes, j, config, xx1, yy1, w, h);
+        uint32x4_t        suppressed = vmvnq_u32(vcleq_f32(iou, threshold));
+        if (config.suppress_size)
+        {
+            uint32x4_t keep_size = vandq_u32(vcgeq_f32(w, min_size), vcgeq_f32(h, min_size));
+            keep_size            = vandq_u32(keep_size, vcltq_f32(vfmaq_n_f32(xx1, w, 0.5f), im_width));
+            keep_size            = vandq_u32(keep_size, vcltq_f32(vfmaq_n_f32(yy1, h, 0.5f), im_height));
+            suppressed           = vorrq_u32(suppressed, vmvnq_u32(keep_size));
+        }
+        mask |= movemask_u32x4(suppressed) << (j - begin);
+    }
+#endif // defined(__aarch64__)
+
+    for (; j < end; ++j)
+    {
+        Intersection inter{};
+        const float  iou = overlap(boxes, i, boxes, j, config, inter);
+        if (is_suppressed(iou, inter, config))
+        {
+            mask |= uint64_t(1) << (j - begin);
+        }
+    }
+    return mask;
+}
+} // namespace
+
+void NMSBoxes::resize(size_t num_boxes)
+{
+    xmin.resize(num_boxes);
+    ymin.resize(num_boxes);
+    xmax.resize(num_boxes);
+    ymax.resize(num_boxes);
+    area.resize(num_boxes);
+}
+
+void NMSBoxes::set(size_t idx, float x1, float y1, float x2, float y2, float offset)
+{
+    xmin[idx] = x1;
+    ymin[idx] = y1;
+    xmax[idx] = x2;
+    ymax[idx] = y2;
+    // The product is exact in double precision, so the area is rounded only once
+    area[idx] = static_cast<float>((static_cast<double>(x2 - x1) + offset) * (static_cast<double>(y2 - y1) + offset));
+}
+
+void nms_gather_boxes(const NMSBoxes &src, const int *indices, size_t count, NMSBoxes &dst)
+{
+    dst.resize(count);
+    for (size_t k = 0; k < count; ++k)
+    {
+        const size_t idx = indices[k];
+        dst.xmin[k]      = src.xmin[idx];
+        dst.ymin[k]      = src.ymin[idx];
+        dst.xmax[k]      = src.xmax[idx];
+        dst.ymax[k]      = src.ymax[idx];
+        dst.area[k]      = src.area[idx];
+    }
+}
+
+void nms_compute_overlaps(
+    const NMSBoxes &ref, size_t ref_idx, const NMSBoxes &boxes, const NMSConfig &config, float *overlaps)
+{
+    const size_t num_boxes = boxes.size();
+    size_t       j         = 0;
+
+#if defined(__aarch64__)
+    const RefBox ref_box = load_ref(ref, ref_idx);
+    for (; j + 4 <= num_boxes; j += 4)
+    {
+        float32x4_t xx1, yy1, w, h;
+        vst1q_f32(overlaps + j, overlap_f32x4(ref_box, boxes, j, config, xx1, yy1, w, h));
+    }
+#endif // defined(__aarch64__)
+
+    for (; j < num_boxes; ++j)
+    {
+        Intersection inter{};
+        overlaps[j] = overlap(ref, ref_idx, boxes, j, config, inter);
+    }
+}
+
+void nms_sorted(const NMSBoxes &boxes, const NMSConfig &config, size_t max_keep, std::vector<unsigned int> &keep)
+{
+    keep.clear();
+
+    const size_t num_boxes = boxes.size();
+    const size_t num_tiles = (num_boxes + tile_size - 1) / tile_size;
+
+    // Mark the padding of the last tile as suppressed so that every tile can become full and be skipped
+    std::vector<uint64_t> suppressed(num_tiles, 0);
+    if (num_boxes % tile_size != 0)
+    {
+        suppressed[num_tiles - 1] = ~uint64_t(0) << (num_boxes % tile_size);
+    }
+
+    for (size_t i = 0; i < num_boxes && keep.size() < max_keep; ++i)
+    {
+        if ((suppressed[i / tile_size] >> (i % tile_size)) & 1)
+        {
+            continue;
+        }
+
+        keep.push_back(i);
+        if (keep.size() == max_keep)
+        {
+            break;
+        }
+
+        // Suppress the following boxes overlapping with the kept one
+        for (size_t t = (i + 1) / tile_size; t < num_tiles; ++t)
+        {
+            if (suppressed[t] == ~uint64_t(0))
+            {
+                continue;
+            }
+            const size_t begin = std::max(t * tile_size, i + 1);
+            const size_t end   = std::min(num_boxes, (t + 1) * tile_size);
+            suppressed[t] |= suppression_mask(boxes, i, begin, end, config) << (begin - t * tile_size);
+        }
+    }
+}
+} // namespace cpp
+} // namespace arm_compute
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CORE_CPP_NONMAXSUPPRESSION_H
+#define ACL_SRC_CORE_CPP_NONMAXSUPPRESSION_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace arm_compute
+{
+namespace cpp
+{
+/** Axis-aligned boxes stored as a structure of arrays, so that the overlap of one box with many others can be
+ * computed with contiguous vector loads.
+ */
+struct NMSBoxes
+{
+    /** Resize all the coordinate arrays
+     *
+     * @param[in] num_boxes Number of boxes
+     */
+    void resize(size_t num_boxes);
+    /** Number of boxes */
+    size_t size() const
+    {
+        return xmin.size();
+    }
+    /** Set the corners of a box and compute its area
+     *
+     * @param[in] idx    Index of the box
+     * @param[in] x1     Left coordinate
+     * @param[in] y1     Top coordinate
+     * @param[in] x2     Right coordinate
+     * @param[in] y2     Bottom coordinate
+     * @param[in] offset Offset added to the width and height, 1 for inclusive pixel coordinates.
+     */
+    void set(size_t idx, float x1, float y1, float x2, float y2, float offset);
+
+    std::vector<float> xmin{}; /**< Left coordinates */
+    std::vector<float> ymin{}; /**< Top coordinates */
+    std::vector<float> xmax{}; /**< Right coordinates */
+    std::vector<float> ymax{}; /**< Bottom coordinates */
+    std::vector<float> area{}; /**< Areas */
+};
+
+/** Overlap criterion of the non-maximum suppression */
+struct NMSConfig
+{
+    float iou_threshold{0.f}; /**< Boxes whose IoU with a kept box is above this threshold are suppressed */
+    float offset{0.f};        /**< Offset added to the intersection width and height, 1 for inclusive pixel coordinates */
+    bool  skip_empty{false};  /**< Boxes with a non-positive area never overlap */
+    bool  suppress_size{false}; /**< Also suppress boxes whose intersection with a kept box is too small or out of the image */
+    float min_size{0.f};        /**< Minimum width and height of the intersection when @ref suppress_size is set */
+    float im_width{0.f};        /**< Image width when @ref suppress_size is set */
+    float im_height{0.f};       /**< Image height when @ref suppress_size is set */
+};
+
+/** Gather boxes into a new structure of arrays
+ *
+ * @param[in]  src     Source boxes
+ * @param[in]  indices Indices of the boxes to gather
+ * @param[in]  count   Number of indices
+ * @param[out] dst     Gathered boxes, resized to @p count
+ */
+void nms_gather_boxes(const NMSBoxes &src, const int *indices, size_t count, NMSBoxes &dst);
+
+/** Compute the IoU of a reference box with a set of boxes
+ *
+ * @param[in]  ref      Set containing the reference box
+ * @param[in]  ref_idx  Index of the reference box in @p ref
+ * @param[in]  boxes    Boxes to compare with
+ * @param[in]  config   Overlap criterion, only @ref NMSConfig::offset and @ref NMSConfig::skip_empty are used
+ * @param[out] overlaps IoU of each box of @p boxes, must have room for boxes.size() values
+ */
+void nms_compute_overlaps(
+    const NMSBoxes &ref, size_t ref_idx, const NMSBoxes &boxes, const NMSConfig &config, float *overlaps);
+
+/** Greedy non-maximum suppression of boxes sorted by descending score
+ *
+ * The suppressed boxes are tracked in a bitmask. Each kept box computes the IoU with the following boxes one 64-box
+ * tile at a time, vectorised on Neon, and tiles that are already fully suppressed are skipped.
+ *
+ * @param[in]  boxes    Boxes sorted by descending score
+ * @param[in]  config   Overlap criterion
+ * @param[in]  max_keep Maximum number of boxes to keep
+ * @param[out] keep     Positions in @p boxes of the kept boxes, in selection order
+ */
+void nms_sorted(const NMSBoxes &boxes, const NMSConfig &config, size_t max_keep, std::vector<unsigned int> &keep);
+} // namespace cpp
+} // namespace arm_compute
+#endif // ACL_SRC_CORE_CPP_NONMAXSUPPRESSION_H
@@ -25,6 +25,7 @@
 
 #include "arm_compute/core/Helpers.h"
 
+#include "src/core/CPP/NonMaxSuppression.h"
 #include "src/core/helpers/WindowHelpers.h"
 
 #include <algorithm>
@@ -34,6 +35,24 @@ namespace arm_compute
 {
 namespace
 {
+template <typename T>
+cpp::NMSBoxes LoadClassBoxes(const ITensor *proposals, int class_id)
+{
+    const int     proposals_width = proposals->info()->dimension(1);
+    cpp::NMSBoxes boxes;
+    boxes.resize(proposals_width);
+
+    for (int i = 0; i < proposals_width; ++i)
+    {
+        const float x1 = *reinterpret_cast<T *>(proposals->ptr_to_element(Coordinates(class_id * 4, i)));
+        const float y1 = *reinterpret_cast<T *>(proposals->ptr_to_element(Coordinates(class_id * 4 + 1, i)));
+        const float x2 = *reinterpret_cast<T *>(proposals->ptr_to_element(Coordinates(class_id * 4 + 2, i)));
+        const float y2 = *reinterpret_cast<T *>(proposals->ptr_to_element(Coordinates(class_id * 4 + 3, i)));
+        boxes.set(i, x1, y1, x2, y2, 1.f);
+    }
+    return boxes;
+}
+
 template <typename T>
 std::vector<int> SoftNMS(const ITensor               *proposals,
                          std::vector<std::vector<T>> &scores_in,
@@ -41,23 +60,14 @@ std::vector<int> SoftNMS(const ITensor               *proposals,
                          const BoxNMSLimitInfo       &info,
                          int                          class_id)
 {
-    std::vector<int> keep;
-    const int        proposals_width = proposals->info()->dimension(1);
+    std::vector<int>    keep;
+    const cpp::NMSBoxes boxes = LoadClassBoxes<T>(proposals, class_id);
 
-    std::vector<T> x1(proposals_width);
-    std::vector<T> y1(proposals_width);
-    std::vector<T> x2(proposals_width);
-    std::vector<T> y2(proposals_width);
-    std::vector<T> areas(proposals_width);
+    cpp::NMSConfig config{};
+    config.offset = 1.f;
 
-    for (int i = 0; i < proposals_width; ++i)
-    {
-        x1[i]    = *reinterpret_cast<T *>(proposals->ptr_to_element(Coordinates(class_id * 4, i)));
-        y1[i]    = *reinterpret_cast<T *>(proposals->ptr_to_element(Coordinates(class_id * 4 + 1, i)));
-        x2[i]    = *reinterpret_cast<T *>(proposals->ptr_to_element(Coordinates(class_id * 4 + 2, i)));
-        y2[i]    = *reinterpret_cast<T *>(proposals->ptr_to_element(Coordinates(class_id * 4 + 3, i)));
-        areas[i] = (x2[i] - x1[i] + 1.0) * (y2[i] - y1[i] + 1.0);
-    }
+    cpp::NMSBoxes      candidates;
+    std::vector<float> overlaps;
 
     // Note: Soft NMS scores have already been initialized with input scores
 
@@ -78,19 +88,15 @@ std::vector<int> SoftNMS(const ITensor               *proposals,
 
         // Remove first element and compute IoU of the remaining boxes with identified max box
         inds.erase(inds.begin());
+        cpp::nms_gather_boxes(boxes, inds.data(), inds.size(), candidates);
+        overlaps.resize(inds.size());
+        cpp::nms_compute_overlaps(boxes, element, candidates, config, overlaps.data());
 
         std::vector<int> sorted_indices_temp;
-        for (auto idx : inds)
+        for (unsigned int k = 0; k < inds.size(); ++k)
         {
-            const auto xx1 = std::max(x1[idx], x1[element]);
-            const auto yy1 = std::max(y1[idx], y1[element]);
-            const auto xx2 = std::min(x2[idx], x2[element]);
-            const auto yy2 = std::min(y2[idx], y2[element]);
-
-            const auto w     = std::max((xx2 - xx1 + 1.f), 0.f);
-            const auto h     = std::max((yy2 - yy1 + 1.f), 0.f);
-            const auto inter = w * h;
-            const auto ovr   = inter / (areas[element] + areas[idx] - inter);
+            const int   idx = inds[k];
+            const float ovr = overlaps[k];
 
             // Update scores based on computed IoU, overlap threshold and NMS method
             T weight;
@@ -128,66 +134,27 @@ std::vector<int> NonMaximaSuppression(const ITensor         *proposals,
                                       const BoxNMSLimitInfo &info,
                                       int                    class_id)
 {
-    std::vector<int> keep;
-
-    const int proposals_width = proposals->info()->dimension(1);
-
-    std::vector<T> x1(proposals_width);
-    std::vector<T> y1(proposals_width);
-    std::vector<T> x2(proposals_width);
-    std::vector<T> y2(proposals_width);
-    std::vector<T> areas(proposals_width);
-
-    for (int i = 0; i < proposals_width; ++i)
-    {
-        x1[i]    = *reinterpret_cast<T *>(proposals->ptr_to_element(Coordinates(class_id * 4, i)));
-        y1[i]    = *reinterpret_cast<T *>(proposals->ptr_to_element(Coordinates(class_id * 4 + 1, i)));
-        x2[i]    = *reinterpret_cast<T *>(proposals->ptr_to_element(Coordinates(class_id * 4 + 2, i)));
-        y2[i]    = *reinterpret_cast<T *>(proposals->ptr_to_element(Coordinates(class_id * 4 + 3, i)));
-        areas[i] = (x2[i] - x1[i] + 1.0) * (y2[i] - y1[i] + 1.0);
-    }
-
-    while (!sorted_indices.empty())
+    cpp::NMSBoxes sorted_boxes;
+    cpp::nms_gather_boxes(LoadClassBoxes<T>(proposals, class_id), sorted_indices.data(), sorted_indices.size(),
+                          sorted_boxes);
+
+    // If suppress_size is specified, also filter the boxes based on their size and position
+    cpp::NMSConfig config{};
+    config.iou_threshold = info.nms();
+    config.offset        = 1.f;
+    config.suppress_size = info.suppress_size();
+    config.min_size      = info.min_size();
+    config.im_width      = info.im_width();
+    config.im_height     = info.im_height();
+
+    std::vector<unsigned int> kept_pos;
+    cpp::nms_sorted(sorted_boxes, config, sorted_indices.size(), kept_pos);
+
+    std::vector<int> keep(kept_pos.size());
+    for (unsigned int k = 0; k < kept_pos.size(); ++k)
     {
-        int i = sorted_indices.at(0);
-        keep.push_back(i);
-
-        std::vector<int> sorted_indices_temp = sorted_indices;
-        std::vector<int> new_indices;
-        sorted_indices_temp.erase(sorted_indices_temp.begin());
-
-        for (unsigned int j = 0; j < sorted_indices_temp.size(); ++j)
-        {
-            const float xx1 = std::max(x1[sorted_indices_temp.at(j)], x1[i]);
-            const float yy1 = std::max(y1[sorted_indices_temp.at(j)], y1[i]);
-            const float xx2 = std::min(x2[sorted_indices_temp.at(j)], x2[i]);
-            const float yy2 = std::min(y2[sorted_indices_temp.at(j)], y2[i]);
-
-            const float w     = std::max((xx2 - xx1 + 1.f), 0.f);
-            const float h     = std::max((yy2 - yy1 + 1.f), 0.f);
-            const float inter = w * h;
-            const float ovr   = inter / (areas[i] + areas[sorted_indices_temp.at(j)] - inter);
-            const float ctr_x = xx1 + (w / 2);
-            const float ctr_y = yy1 + (h / 2);
-
-            // If suppress_size is specified, filter the boxes based on their size and position
-            const bool keep_size = !info.suppress_size() || (w >= info.min_size() && h >= info.min_size() &&
-                                                             ctr_x < info.im_width() && ctr_y < info.im_height());
-            if (ovr <= info.nms() && keep_size)
-            {
-                new_indices.push_back(j);
-            }
-        }
-
-        const unsigned int new_indices_size = new_indices.size();
-        std::vector<int>   new_sorted_indices(new_indices_size);
-        for (unsigned int i = 0; i < new_indices_size; ++i)
-        {
-            new_sorted_indices[i] = sorted_indices[new_indices[i] + 1];
-        }
-        sorted_indices = new_sorted_indices;
+        keep[k] = sorted_indices[kept_pos[k]];
     }
-
     return keep;
 }
 } // namespace
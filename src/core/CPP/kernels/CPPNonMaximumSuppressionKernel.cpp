@@ -26,10 +26,12 @@
 #include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/Validate.h"
 
+#include "src/core/CPP/NonMaxSuppression.h"
 #include "src/core/helpers/AutoConfiguration.h"
 #include "src/core/helpers/WindowHelpers.h"
 
 #include <algorithm>
+#include <numeric>
 
 namespace arm_compute
 {
@@ -141,85 +143,34 @@ void CPPNonMaximumSuppressionKernel::run(const Window &window, const ThreadInfo
               [&](unsigned int first, unsigned int second)
               { return scores_above_thd[first] > scores_above_thd[second]; });
 
+    // Gather the boxes in score order, box-corner format: xmin, ymin, xmax, ymax
+    const size_t  stride = _input_bboxes->info()->strides_in_bytes()[0] / sizeof(float);
+    cpp::NMSBoxes sorted_boxes;
+    sorted_boxes.resize(num_above_thd);
+    for (unsigned int i = 0; i < num_above_thd; ++i)
+    {
+        const auto box = reinterpret_cast<const float *>(
+            _input_bboxes->ptr_to_element(Coordinates(0, indices_above_thd[sorted_indices[i]])));
+        sorted_boxes.set(i, box[0], box[stride], box[2 * stride], box[3 * stride], 0.f);
+    }
+
     // Number of output is the minimum between max_detection and the scores above the threshold
     const unsigned int num_output = std::min(_max_output_size, num_above_thd);
-    unsigned int       output_idx = 0;
-    std::vector<bool>  visited(num_above_thd, false);
 
-    // Keep only boxes with small IoU
-    for (unsigned int i = 0; i < num_above_thd; ++i)
-    {
-        // Check if the output is full
-        if (output_idx >= num_output)
-        {
-            break;
-        }
+    cpp::NMSConfig config{};
+    config.iou_threshold = _iou_threshold;
+    config.skip_empty    = true;
 
-        // Check if it was already visited, if not add it to the output and update the indices counter
-        if (!visited[sorted_indices[i]])
-        {
-            *(reinterpret_cast<int *>(_output_indices->ptr_to_element(Coordinates(output_idx)))) =
-                indices_above_thd[sorted_indices[i]];
-            visited[sorted_indices[i]] = true;
-            ++output_idx;
-        }
-        else
-        {
-            continue;
-        }
+    std::vector<unsigned int> keep;
+    cpp::nms_sorted(sorted_boxes, config, num_output, keep);
 
-        // Once added one element at the output check if the next ones overlap and can be skipped
-        for (unsigned int j = i + 1; j < num_above_thd; ++j)
-        {
-            if (!visited[sorted_indices[j]])
-            {
-                // Calculate IoU
-                const unsigned int i_index = indices_above_thd[sorted_indices[i]];
-                const unsigned int j_index = indices_above_thd[sorted_indices[j]];
-                // Box-corner format: xmin, ymin, xmax, ymax
-                const auto box_i_xmin =
-                    *(reinterpret_cast<float *>(_input_bboxes->ptr_to_element(Coordinates(0, i_index))));
-                const auto box_i_ymin =
-                    *(reinterpret_cast<float *>(_input_bboxes->ptr_to_element(Coordinates(1, i_index))));
-                const auto box_i_xmax =
-                    *(reinterpret_cast<float *>(_input_bboxes->ptr_to_element(Coordinates(2, i_index))));
-                const auto box_i_ymax =
-                    *(reinterpret_cast<float *>(_input_bboxes->ptr_to_element(Coordinates(3, i_index))));
-
-                const auto box_j_xmin =
-                    *(reinterpret_cast<float *>(_input_bboxes->ptr_to_element(Coordinates(0, j_index))));
-                const auto box_j_ymin =
-                    *(reinterpret_cast<float *>(_input_bboxes->ptr_to_element(Coordinates(1, j_index))));
-                const auto box_j_xmax =
-                    *(reinterpret_cast<float *>(_input_bboxes->ptr_to_element(Coordinates(2, j_index))));
-                const auto box_j_ymax =
-                    *(reinterpret_cast<float *>(_input_bboxes->ptr_to_element(Coordinates(3, j_index))));
-
-                const float area_i = (box_i_xmax - box_i_xmin) * (box_i_ymax - box_i_ymin);
-                const float area_j = (box_j_xmax - box_j_xmin) * (box_j_ymax - box_j_ymin);
-                float       overlap;
-                if (area_i <= 0 || area_j <= 0)
-                {
-                    overlap = 0.0f;
-                }
-                else
-                {
-                    const auto y_min_intersection = std::max<float>(box_i_ymin, box_j_ymin);
-                    const auto x_min_intersection = std::max<float>(box_i_xmin, box_j_xmin);
-                    const auto y_max_intersection = std::min<float>(box_i_ymax, box_j_ymax);
-                    const auto x_max_intersection = std::min<float>(box_i_xmax, box_j_xmax);
-                    const auto area_intersection  = std::max<float>(y_max_intersection - y_min_intersection, 0.0f) *
-                                                   std::max<float>(x_max_intersection - x_min_intersection, 0.0f);
-                    overlap = area_intersection / (area_i + area_j - area_intersection);
-                }
-
-                if (overlap > _iou_threshold)
-                {
-                    visited[sorted_indices[j]] = true;
-                }
-            }
-        }
+    unsigned int output_idx = 0;
+    for (; output_idx < keep.size(); ++output_idx)
+    {
+        *(reinterpret_cast<int *>(_output_indices->ptr_to_element(Coordinates(output_idx)))) =
+            indices_above_thd[sorted_indices[keep[output_idx]]];
     }
+
     // The output could be full but not the output indices tensor
     // Instead return values not valid we put -1
     for (; output_idx < _max_output_size; ++output_idx)
@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/core/NEON/kernels/NEFFTChirpKernel.h"
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/core/helpers/WindowHelpers.h"
+
+#include <arm_neon.h>
+#include <cstring>
+#include <set>
+
+namespace arm_compute
+{
+namespace
+{
+/** Multiply a sequence by a complex sequence, or by a single complex value when @p is_broadcast is true */
+template <bool is_input_complex, bool is_output_complex, bool is_conj, bool is_broadcast>
+void chirp_sequence(const float *in, float *out, const float *w, size_t len)
+{
+    const float32x4_t w_re_broadcast = vdupq_n_f32(w[0]);
+    const float32x4_t w_im_broadcast = vdupq_n_f32(w[1]);
+
+    size_t x = 0;
+    for (; x + 4 <= len; x += 4)
+    {
+        float32x4_t w_re = w_re_broadcast;
+        float32x4_t w_im = w_im_broadcast;
+        if (!is_broadcast)
+        {
+            const float32x4x2_t w_val = vld2q_f32(w + 2 * x);
+            w_re                      = w_val.val[0];
+            w_im                      = w_val.val[1];
+        }
+
+        float32x4_t res_re;
+        float32x4_t res_im;
+        if (is_input_complex)
+        {
+            const float32x4x2_t a    = vld2q_f32(in + 2 * x);
+            const float32x4_t   a_im = is_conj ? vnegq_f32(a.val[1]) : a.val[1];
+            res_re                   = vmlsq_f32(vmulq_f32(a.val[0], w_re), a_im, w_im);
+            res_im                   = vmlaq_f32(vmulq_f32(a.val[0], w_im), a_im, w_re);
+        }
+        else
+        {
+            const float32x4_t a = vld1q_f32(in + x);
+            res_re              = vmulq_f32(a, w_re);
+            res_im              = vmulq_f32(a, w_im);
+        }
+
+        if (is_output_complex)
+        {
+            float32x4x2_t res;
+            res.val[0] = res_re;
+            res.val[1] = res_im;
+            vst2q_f32(out + 2 * x, res);
+        }
+        else
+        {
+            vst1q_f32(out + x, res_re);
+        }
+    }
+
+    // Left-over elements
+    for (; x < len; ++x)
+    {
+        const float w_re = is_broadcast ? w[0] : w[2 * x];
+        const float w_im = is_broadcast ? w[1] : w[2 * x + 1];
+        const float a_re = is_input_complex ? in[2 * x] : in[x];
+        const float a_im = is_input_complex ? (is_conj ? -in[2 * x + 1] : in[2 * x + 1]) : 0.f;
+        if (is_output_complex)
+        {
+            out[2 * x]     = a_re * w_re - a_im * w_im;
+            out[2 * x + 1] = a_re * w_im + a_im * w_re;
+        }
+        else
+        {
+            out[x] = a_re * w_re - a_im * w_im;
+        }
+    }
+}
+
+Status validate_arguments(const ITensorInfo        *input,
+                          const ITensorInfo        *output,
+                          const ITensorInfo        *weights,
+                          const FFTChirpKernelInfo &config)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, output, weights);
+    ARM_COMPUTE_RETURN_ERROR_ON(input->data_type() != DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON(input->num_channels() != 1 && input->num_channels() != 2);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(weights, 2, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON(weights->num_dimensions() > 1);
+    ARM_COMPUTE_RETURN_ERROR_ON(std::set<unsigned int>({0, 1}).count(config.axis) == 0);
+    ARM_COMPUTE_RETURN_ERROR_ON(weights->dimension(0) > input->dimension(config.axis));
+
+    ARM_COMPUTE_RETURN_ERROR_ON(output->num_channels() != 1 && output->num_channels() != 2);
+    ARM_COMPUTE_RETURN_ERROR_ON(input->num_channels() == 1 && output->num_channels() == 1);
+    ARM_COMPUTE_RETURN_ERROR_ON(weights->dimension(0) > output->dimension(config.axis));
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+    for (size_t d = 0; d < TensorShape::num_max_dimensions; ++d)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON(d != config.axis && input->dimension(d) != output->dimension(d));
+    }
+
+    return Status{};
+}
+} // namespace
+
+NEFFTChirpKernel::NEFFTChirpKernel() : _func(nullptr), _input(nullptr), _output(nullptr), _weights(nullptr), _axis(0)
+{
+}
+
+void NEFFTChirpKernel::configure(const ITensor            *input,
+                                 ITensor                  *output,
+                                 const ITensor            *weights,
+                                 const FFTChirpKernelInfo &config)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, output, weights);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(input->info(), output->info(), weights->info(), config));
+
+    _input   = input;
+    _output  = output;
+    _weights = weights;
+    _axis    = config.axis;
+
+    const bool is_input_complex  = input->info()->num_channels() == 2;
+    const bool is_output_complex = output->info()->num_channels() == 2;
+
+    if (!is_input_complex)
+    {
+        _func = &NEFFTChirpKernel::chirp_kernel<false, true, false>;
+    }
+    else if (is_output_complex)
+    {
+        _func = config.conjugate ? &NEFFTChirpKernel::chirp_kernel<true, true, true>
+                                 : &NEFFTChirpKernel::chirp_kernel<true, true, false>;
+    }
+    else
+    {
+        _func = config.conjugate ? &NEFFTChirpKernel::chirp_kernel<true, false, true>
+                                 : &NEFFTChirpKernel::chirp_kernel<true, false, false>;
+    }
+
+    // Configure kernel window: each row along the X axis is processed at once
+    Window win = calculate_max_window(*output->info(), Steps());
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    INEKernel::configure(win);
+}
+
+Status NEFFTChirpKernel::validate(const ITensorInfo        *input,
+                                  const ITensorInfo        *output,
+                                  const ITensorInfo        *weights,
+                                  const FFTChirpKernelInfo &config)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(input, output, weights, config));
+    return Status{};
+}
+
+template <bool is_input_complex, bool is_output_complex, bool is_conj>
+void NEFFTChirpKernel::chirp_kernel(const Window &window)
+{
+    const size_t n               = _weights->info()->dimension(0);
+    const size_t len_x           = _output->info()->dimension(0);
+    const size_t out_elem_floats = is_output_complex ? 2 : 1;
+    const auto  *w_ptr           = reinterpret_cast<const float *>(_weights->ptr_to_element(Coordinates(0)));
+
+    Iterator out(_output, window);
+
+    execute_window_loop(
+        window,
+        [&](const Coordinates &id)
+        {
+            auto *out_ptr = reinterpret_cast<float *>(out.ptr());
+
+            if (_axis == 0)
+            {
+                const auto *in_ptr = reinterpret_cast<const float *>(_input->ptr_to_element(id));
+                chirp_sequence<is_input_complex, is_output_complex, is_conj, false>(in_ptr, out_ptr, w_ptr, n);
+                std::memset(out_ptr + n * out_elem_floats, 0, (len_x - n) * out_elem_floats * sizeof(float));
+            }
+            else if (static_cast<size_t>(id.y()) < n)
+            {
+                // Along axis 1 the whole row is multiplied by the same value
+                const auto *in_ptr = reinterpret_cast<const float *>(_input->ptr_to_element(id));
+                chirp_sequence<is_input_complex, is_output_complex, is_conj, true>(in_ptr, out_ptr, w_ptr + 2 * id.y(),
+                                                                                   len_x);
+            }
+            else
+            {
+                std::memset(out_ptr, 0, len_x * out_elem_floats * sizeof(float));
+            }
+        },
+        out);
+}
+
+void NEFFTChirpKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+    ARM_COMPUTE_UNUSED(info);
+    (this->*_func)(window);
+}
+} // namespace arm_compute
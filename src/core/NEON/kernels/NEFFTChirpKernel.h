@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CORE_NEON_KERNELS_NEFFTCHIRPKERNEL_H
+#define ACL_SRC_CORE_NEON_KERNELS_NEFFTCHIRPKERNEL_H
+
+#include "arm_compute/core/KernelDescriptors.h"
+
+#include "src/core/NEON/INEKernel.h"
+
+namespace arm_compute
+{
+// Forward declarations
+class ITensor;
+
+/** Interface for the kernel multiplying the sequences along the FFT axis by a complex sequence.
+ *
+ * Used by the Bluestein algorithm, the kernel computes dst[i] = src[i] * weights[i] for the first N elements along the
+ * axis, where N is the length of @p weights, and zero-fills the remaining elements of dst. This fuses the chirp
+ * multiplication with the zero-padding of the input and with the cropping of the output.
+ */
+class NEFFTChirpKernel : public INEKernel
+{
+public:
+    const char *name() const override
+    {
+        return "NEFFTChirpKernel";
+    }
+    /** Constructor */
+    NEFFTChirpKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEFFTChirpKernel(const NEFFTChirpKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEFFTChirpKernel &operator=(const NEFFTChirpKernel &) = delete;
+    /** Default Move Constructor. */
+    NEFFTChirpKernel(NEFFTChirpKernel &&) = default;
+    /** Default move assignment operator */
+    NEFFTChirpKernel &operator=(NEFFTChirpKernel &&) = default;
+    /** Default destructor */
+    ~NEFFTChirpKernel() = default;
+    /** Set the input and output tensors.
+     *
+     * @param[in]  input   Source tensor. Data types supported: F32. Number of channels supported: 1 (real tensor) or 2 (complex tensor).
+     * @param[out] output  Destination tensor. Data type supported: same as @p input. Number of channels supported: 1 (real tensor) or 2 (complex tensor).
+     *                     Can be @p input to run in-place. If real, only the real part of the product is stored.
+     * @param[in]  weights 1D complex sequence to multiply by. Data type supported: same as @p input. Number of channels supported: 2 (complex tensor).
+     *                     Its length can not exceed the length of @p input and @p output along the FFT axis.
+     * @param[in]  config  Kernel configuration.
+     */
+    void configure(const ITensor *input, ITensor *output, const ITensor *weights, const FFTChirpKernelInfo &config);
+    /** Static function to check if given info will lead to a valid configuration of @ref NEFFTChirpKernel
+     *
+     * @param[in] input   Source tensor info. Data types supported: F32. Number of channels supported: 1 (real tensor) or 2 (complex tensor).
+     * @param[in] output  Destination tensor info. Data type supported: same as @p input. Number of channels supported: 1 (real tensor) or 2 (complex tensor).
+     * @param[in] weights Sequence to multiply by info. Data type supported: same as @p input. Number of channels supported: 2 (complex tensor).
+     * @param[in] config  Kernel configuration.
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo        *input,
+                           const ITensorInfo        *output,
+                           const ITensorInfo        *weights,
+                           const FFTChirpKernelInfo &config);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    using NEFFTChirpKernelFunctionPtr = void (NEFFTChirpKernel::*)(const Window &window);
+
+    template <bool is_input_complex, bool is_output_complex, bool is_conj>
+    void chirp_kernel(const Window &window);
+
+    NEFFTChirpKernelFunctionPtr _func;
+    const ITensor              *_input;
+    ITensor                    *_output;
+    const ITensor              *_weights;
+    unsigned int                _axis;
+};
+} // namespace arm_compute
+#endif // ACL_SRC_CORE_NEON_KERNELS_NEFFTCHIRPKERNEL_H
@@ -47,14 +47,33 @@ Status validate_arguments(const ITensorInfo               *input,
     ARM_COMPUTE_RETURN_ERROR_ON(input->num_channels() > 2);
     ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(idx, 1, DataType::U32);
     ARM_COMPUTE_RETURN_ERROR_ON(std::set<unsigned int>({0, 1}).count(config.axis) == 0);
-    ARM_COMPUTE_RETURN_ERROR_ON(input->tensor_shape()[config.axis] != idx->tensor_shape().x());
+
+    if (config.pack_real)
+    {
+        // Pairs of real values along axis 0 are packed as a single complex value
+        ARM_COMPUTE_RETURN_ERROR_ON(config.axis != 0 || input->num_channels() != 1);
+        ARM_COMPUTE_RETURN_ERROR_ON(input->dimension(0) % 2 != 0);
+        ARM_COMPUTE_RETURN_ERROR_ON(input->dimension(0) / 2 != idx->tensor_shape().x());
+    }
+    else
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON(input->tensor_shape()[config.axis] != idx->tensor_shape().x());
+    }
 
     // Checks performed when output is configured
     if ((output != nullptr) && (output->total_size() != 0))
     {
         ARM_COMPUTE_RETURN_ERROR_ON(output->num_channels() != 2);
-        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(input, output);
         ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+        if (config.pack_real)
+        {
+            const TensorShape packed_shape = TensorShape(input->tensor_shape()).set(0, input->dimension(0) / 2);
+            ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(output->tensor_shape(), packed_shape);
+        }
+        else
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(input, output);
+        }
     }
 
     return Status{};
@@ -65,9 +84,14 @@ std::pair<Status, Window> validate_and_configure_window(ITensorInfo
                                                         ITensorInfo                     *idx,
                                                         const FFTDigitReverseKernelInfo &config)
 {
-    ARM_COMPUTE_UNUSED(idx, config);
+    ARM_COMPUTE_UNUSED(idx);
 
-    auto_init_if_empty(*output, input->clone()->set_num_channels(2));
+    TensorShape output_shape = input->tensor_shape();
+    if (config.pack_real)
+    {
+        output_shape.set(0, input->dimension(0) / 2);
+    }
+    auto_init_if_empty(*output, input->clone()->set_num_channels(2).set_tensor_shape(output_shape));
 
     Window win = calculate_max_window(*input, Steps());
 
@@ -100,7 +124,11 @@ void NEFFTDigitReverseKernel::configure(const ITensor                   *input,
     ARM_COMPUTE_ERROR_THROW_ON(win_config.first);
     INEKernel::configure(win_config.second);
 
-    if (axis == 0)
+    if (config.pack_real)
+    {
+        _func = &NEFFTDigitReverseKernel::digit_reverse_kernel_axis_0_packed;
+    }
+    else if (axis == 0)
     {
         if (is_input_complex)
         {
@@ -208,6 +236,37 @@ void NEFFTDigitReverseKernel::digit_reverse_kernel_axis_0(const Window &window)
         in, out);
 }
 
+void NEFFTDigitReverseKernel::digit_reverse_kernel_axis_0_packed(const Window &window)
+{
+    const size_t N = _output->info()->dimension(0);
+
+    // Copy the look-up buffer to a local array
+    std::vector<unsigned int> buffer_idx(N);
+    std::copy_n(reinterpret_cast<unsigned int *>(_idx->buffer()), N, buffer_idx.data());
+
+    // Input/output iterators
+    Window slice = window;
+    slice.set(0, Window::DimX);
+    Iterator in(_input, slice);
+    Iterator out(_output, slice);
+
+    execute_window_loop(
+        slice,
+        [&](const Coordinates &)
+        {
+            // The real row is read as a complex row of half length
+            const auto *in_ptr  = reinterpret_cast<const float *>(in.ptr());
+            auto       *out_ptr = reinterpret_cast<float *>(out.ptr());
+            for (size_t x = 0; x < N; ++x)
+            {
+                const size_t idx   = buffer_idx[x];
+                out_ptr[2 * x]     = in_ptr[2 * idx];
+                out_ptr[2 * x + 1] = in_ptr[2 * idx + 1];
+            }
+        },
+        in, out);
+}
+
 template <bool is_input_complex, bool is_conj>
 void NEFFTDigitReverseKernel::digit_reverse_kernel_axis_1(const Window &window)
 {
@@ -58,6 +58,7 @@ public:
      * @param[in]  input  Source tensor. Data types supported: F32. Number of channels supported: 1 (real tensor) or 2 (complex tensor).
      * @param[out] output Destination tensor. Data type supported: same as @p input. Number of channels supported: 2 (complex tensor).
      * @param[in]  idx    Digit reverse index tensor. Data type supported: U32
+     *                    Half the length of @p input along axis 0 when @p config packs a real input.
      * @param[in]  config Kernel configuration.
      */
     void configure(const ITensor *input, ITensor *output, const ITensor *idx, const FFTDigitReverseKernelInfo &config);
@@ -67,6 +68,7 @@ public:
      * @param[in] input  Source tensor info. Data types supported: F32. Number of channels supported: 1 (real tensor) or 2 (complex tensor).
      * @param[in] output Destination tensor info. Data type supported: same as @p input. Number of channels supported: 2 (complex tensor).
      * @param[in] idx    Digit reverse index tensor info. Data type supported: U32
+     *                   Half the length of @p input along axis 0 when @p config packs a real input.
      * @param[in] config Kernel configuration
      *
      * @return a status
@@ -88,6 +90,8 @@ private:
     template <bool is_input_complex, bool is_conj>
     void digit_reverse_kernel_axis_1(const Window &window);
 
+    void digit_reverse_kernel_axis_0_packed(const Window &window);
+
     NEFFTDigitReverseKernelFunctionPtr _func;
     const ITensor                     *_input;
     ITensor                           *_output;
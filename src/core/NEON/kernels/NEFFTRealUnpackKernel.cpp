@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/core/NEON/kernels/NEFFTRealUnpackKernel.h"
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/WindowHelpers.h"
+
+#include <cmath>
+
+namespace arm_compute
+{
+namespace
+{
+Status validate_arguments(const ITensorInfo *input, const ITensorInfo *output)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 2, DataType::F32);
+
+    // Checks performed when output is configured
+    if ((output != nullptr) && (output->total_size() != 0))
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON(output->num_channels() != 2);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+        const TensorShape unpacked_shape = TensorShape(input->tensor_shape()).set(0, 2 * input->dimension(0));
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(output->tensor_shape(), unpacked_shape);
+    }
+
+    return Status{};
+}
+
+std::pair<Status, Window> validate_and_configure_window(ITensorInfo *input, ITensorInfo *output)
+{
+    auto_init_if_empty(*output, input->clone()->set_tensor_shape(
+                                    TensorShape(input->tensor_shape()).set(0, 2 * input->dimension(0))));
+
+    // Each row along the X axis is processed at once
+    Window win = calculate_max_window(*output, Steps());
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    return std::make_pair(Status{}, win);
+}
+} // namespace
+
+NEFFTRealUnpackKernel::NEFFTRealUnpackKernel()
+    : _input(nullptr), _output(nullptr), _twiddles(), _scale(1.f), _is_conj(false)
+{
+}
+
+void NEFFTRealUnpackKernel::configure(const ITensor *input, ITensor *output, const FFTRealUnpackKernelInfo &config)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(input->info(), output->info()));
+
+    _input   = input;
+    _output  = output;
+    _scale   = config.scale;
+    _is_conj = config.conjugate;
+
+    // Twiddle factors exp(-i * 2 * pi * k / N), for k in [0, N / 2]
+    const size_t N = 2 * input->info()->dimension(0);
+    _twiddles.resize(N + 2);
+    for (size_t k = 0; k <= N / 2; ++k)
+    {
+        const double angle   = -2.0 * M_PI * static_cast<double>(k) / static_cast<double>(N);
+        _twiddles[2 * k]     = static_cast<float>(std::cos(angle));
+        _twiddles[2 * k + 1] = static_cast<float>(std::sin(angle));
+    }
+
+    // Configure kernel window
+    auto win_config = validate_and_configure_window(input->info(), output->info());
+    ARM_COMPUTE_ERROR_THROW_ON(win_config.first);
+    INEKernel::configure(win_config.second);
+}
+
+Status NEFFTRealUnpackKernel::validate(const ITensorInfo             *input,
+                                       const ITensorInfo             *output,
+                                       const FFTRealUnpackKernelInfo &config)
+{
+    ARM_COMPUTE_UNUSED(config);
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(input, output));
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_and_configure_window(input->clone().get(), output->clone().get()).first);
+
+    return Status{};
+}
+
+void NEFFTRealUnpackKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+    ARM_COMPUTE_UNUSED(info);
+
+    const size_t M         = _input->info()->dimension(0);
+    const size_t N         = 2 * M;
+    const float  inv_scale = 1.f / _scale;
+    const float  conj_sign = _is_conj ? -1.f : 1.f;
+
+    Iterator out(_output, window);
+
+    execute_window_loop(
+        window,
+        [&](const Coordinates &id)
+        {
+            const auto *in_ptr  = reinterpret_cast<const float *>(_input->ptr_to_element(id));
+            auto       *out_ptr = reinterpret_cast<float *>(out.ptr());
+
+            for (size_t k = 0; k <= M; ++k)
+            {
+                // Z[k] and conj(Z[M - k]), with indices taken modulo M
+                const size_t kz   = (k == M) ? 0 : k;
+                const size_t kc   = (k == 0) ? 0 : M - k;
+                const float  z_re = in_ptr[2 * kz];
+                const float  z_im = in_ptr[2 * kz + 1];
+                const float  c_re = in_ptr[2 * kc];
+                const float  c_im = -in_ptr[2 * kc + 1];
+
+                // Spectra of the even samples, E = (Z[k] + conj(Z[M - k])) / 2,
+                // and of the odd samples, O = -i * (Z[k] - conj(Z[M - k])) / 2
+                const float e_re = 0.5f * (z_re + c_re);
+                const float e_im = 0.5f * (z_im + c_im);
+                const float o_re = 0.5f * (z_im - c_im);
+                const float o_im = -0.5f * (z_re - c_re);
+
+                // X[k] = E + exp(-i * 2 * pi * k / N) * O
+                const float w_re = _twiddles[2 * k];
+                const float w_im = _twiddles[2 * k + 1];
+                const float x_re = (e_re + w_re * o_re - w_im * o_im) * inv_scale;
+                const float x_im = (e_im + w_re * o_im + w_im * o_re) * inv_scale * conj_sign;
+
+                out_ptr[2 * k]     = x_re;
+                out_ptr[2 * k + 1] = x_im;
+
+                // The spectrum of a real sequence is hermitian
+                if (k != 0 && k != M)
+                {
+                    out_ptr[2 * (N - k)]     = x_re;
+                    out_ptr[2 * (N - k) + 1] = -x_im;
+                }
+            }
+        },
+        out);
+}
+} // namespace arm_compute
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CORE_NEON_KERNELS_NEFFTREALUNPACKKERNEL_H
+#define ACL_SRC_CORE_NEON_KERNELS_NEFFTREALUNPACKKERNEL_H
+
+#include "arm_compute/core/KernelDescriptors.h"
+
+#include "src/core/NEON/INEKernel.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+// Forward declarations
+class ITensor;
+
+/** Interface for the kernel computing the spectrum of a real sequence from the FFT of its packed form.
+ *
+ * A real sequence x of even length N packed as the complex sequence z[n] = x[2n] + i * x[2n + 1] is transformed with
+ * an FFT of length N / 2. The kernel splits the result in the spectra of the even and odd samples, recombines them
+ * with the twiddle factors of length N and writes the full, hermitian, spectrum of x along axis 0.
+ */
+class NEFFTRealUnpackKernel : public INEKernel
+{
+public:
+    const char *name() const override
+    {
+        return "NEFFTRealUnpackKernel";
+    }
+    /** Constructor */
+    NEFFTRealUnpackKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEFFTRealUnpackKernel(const NEFFTRealUnpackKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEFFTRealUnpackKernel &operator=(const NEFFTRealUnpackKernel &) = delete;
+    /** Default Move Constructor. */
+    NEFFTRealUnpackKernel(NEFFTRealUnpackKernel &&) = default;
+    /** Default move assignment operator */
+    NEFFTRealUnpackKernel &operator=(NEFFTRealUnpackKernel &&) = default;
+    /** Default destructor */
+    ~NEFFTRealUnpackKernel() = default;
+    /** Set the input and output tensors.
+     *
+     * @param[in]  input  Source tensor holding the FFT of the packed sequence. Data types supported: F32. Number of channels supported: 2 (complex tensor).
+     * @param[out] output Destination tensor, twice as long as @p input along axis 0. Data type supported: same as @p input.
+     *                    Number of channels supported: 2 (complex tensor).
+     * @param[in]  config Kernel configuration.
+     */
+    void configure(const ITensor *input, ITensor *output, const FFTRealUnpackKernelInfo &config);
+    /** Static function to check if given info will lead to a valid configuration of @ref NEFFTRealUnpackKernel
+     *
+     * @param[in] input  Source tensor info. Data types supported: F32. Number of channels supported: 2 (complex tensor).
+     * @param[in] output Destination tensor info. Data type supported: same as @p input. Number of channels supported: 2 (complex tensor).
+     * @param[in] config Kernel configuration.
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *input, const ITensorInfo *output, const FFTRealUnpackKernelInfo &config);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    const ITensor     *_input;
+    ITensor           *_output;
+    std::vector<float> _twiddles;
+    float              _scale;
+    bool               _is_conj;
+};
+} // namespace arm_compute
+#endif // ACL_SRC_CORE_NEON_KERNELS_NEFFTREALUNPACKKERNEL_H
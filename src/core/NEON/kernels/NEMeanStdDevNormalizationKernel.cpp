@@ -150,6 +150,13 @@ Status NEMeanStdDevNormalizationKernel::validate(const ITensorInfo *input, const
     return Status{};
 }
 
+void NEMeanStdDevNormalizationKernel::update_window()
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_SHAPES(_input->info(), _output->info());
+    ICPPKernel::configure(calculate_max_window(*_input->info(), Steps()));
+}
+
 void NEMeanStdDevNormalizationKernel::run(const Window &window, const ThreadInfo &info)
 {
     ARM_COMPUTE_UNUSED(info);
@@ -74,6 +74,11 @@ public:
      * @return a status
      */
     static Status validate(const ITensorInfo *input, const ITensorInfo *output = nullptr, float epsilon = 1e-8f);
+    /** Recompute the execution window from the current shape of the input
+     *
+     * Used to run on a dynamic input whose shape differs from the configured one, which is the largest it can take.
+     */
+    void update_window();
 
     // Inherited methods overridden:
     void run(const Window &window, const ThreadInfo &info) override;
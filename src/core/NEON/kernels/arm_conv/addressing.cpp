@@ -95,7 +95,8 @@ void fill_pointer_array_generic_kernel(
   void *base_ptr_raw, size_t ld_row, size_t ld_col,
   void *pad_buffer_raw,
   const unsigned int pad_top, const unsigned int valid_rows,
-  const unsigned int pad_left, const unsigned int valid_cols
+  const unsigned int pad_left, const unsigned int valid_cols,
+  const unsigned int dilation_rows, const unsigned int dilation_cols
 )
 {
   auto dest = reinterpret_cast<char **>(dest_raw);
@@ -117,44 +118,21 @@ void fill_pointer_array_generic_kernel(
       auto point_dest = dest;
       dest++;
 
-      // Iterate over kernel points and fill in the pointer array.
-      unsigned int ki = 0, ii = oi*stride_rows;
-      for (; ii < pad_top && ki < kernel_rows; ii++, ki++)
+      // Iterate over kernel points and fill in the pointer array; kernel
+      // points which fall outside the valid region read from the padding.
+      for (unsigned int ki = 0; ki < kernel_rows; ki++)
       {
-        // Fill with padding
-        for (unsigned int j = 0; j < kernel_cols; j++)
-        {
-          *point_dest = pad_buffer;
-          point_dest += point_stride;
-        }
-      }
-      for (; ii < last_valid_row && ki < kernel_rows; ii++, ki++)
-      {
-        unsigned int kj = 0, ij = oj*stride_cols;
-        for (; ij < pad_left && kj < kernel_cols; ij++, kj++)
-        {
-          // Padding
-          *point_dest = pad_buffer;
-          point_dest += point_stride;
-        }
-        for (; ij < last_valid_col && kj < kernel_cols; ij++, kj++)
-        {
-          *point_dest = base_ptr + (ii - pad_top)*ld_row + (ij - pad_left)*ld_col;
-          point_dest += point_stride;
-        }
-        for (; kj < kernel_cols; kj++)
-        {
-          // Padding
-          *point_dest = pad_buffer;
-          point_dest += point_stride;
-        }
-      }
-      for (; ki < kernel_rows; ki++)
-      {
-        // Fill with padding
-        for (unsigned int j = 0; j < kernel_cols; j++)
+        const auto ii = oi*stride_rows + ki*dilation_rows;
+        const bool valid_row = pad_top <= ii && ii < last_valid_row;
+
+        for (unsigned int kj = 0; kj < kernel_cols; kj++)
         {
-          *point_dest = pad_buffer;
+          const auto ij = oj*stride_cols + kj*dilation_cols;
+          const bool valid_col = pad_left <= ij && ij < last_valid_col;
+
+          *point_dest = (valid_row && valid_col) ?
+            base_ptr + (ii - pad_top)*ld_row + (ij - pad_left)*ld_col :
+            pad_buffer;
           point_dest += point_stride;
         }
       }
@@ -75,7 +75,8 @@ void fill_pointer_array(
  *       for kj in kernel_cols:
  *           for oi in output_rows:
  *               for oj in output_cols:
- *                   get pointer for point (oi*stride_rows + ki, oj*stride_cols + kj)
+ *                   get pointer for point (oi*stride_rows + ki*dilation_rows,
+ *                                          oj*stride_cols + kj*dilation_cols)
  *
  * Other arguments are as for `fill_pointer_array`.
  *
@@ -91,7 +92,8 @@ void fill_pointer_array_generic_kernel(
   void *base_ptr, size_t ld_row, size_t ld_col,
   void *pad_buffer,
   unsigned int pad_top, unsigned int valid_rows,
-  unsigned int pad_left, unsigned int valid_cols
+  unsigned int pad_left, unsigned int valid_cols,
+  unsigned int dilation_rows = 1, unsigned int dilation_cols = 1
 );
 
 /* NCHW-patch addressed by row
@@ -193,7 +195,8 @@ inline void fill_pointer_array_generic_kernel(
   T *base_ptr, size_t ld_row, size_t ld_col,
   T *pad_buffer,
   unsigned int pad_top, unsigned int valid_rows,
-  unsigned int pad_left, unsigned int valid_cols
+  unsigned int pad_left, unsigned int valid_cols,
+  unsigned int dilation_rows = 1, unsigned int dilation_cols = 1
 )
 {
   addressing::fill_pointer_array_generic_kernel(
@@ -205,7 +208,8 @@ inline void fill_pointer_array_generic_kernel(
     (void *) base_ptr, ld_row, ld_col,
     (void *) pad_buffer,
     pad_top, valid_rows,
-    pad_left, valid_cols
+    pad_left, valid_cols,
+    dilation_rows, dilation_cols
   );
 }
 
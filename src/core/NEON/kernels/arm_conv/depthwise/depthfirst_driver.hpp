@@ -48,6 +48,10 @@ class IDepthfirstStrategy
 
   virtual unsigned int get_output_rows() const = 0;
   virtual unsigned int get_output_cols() const = 0;
+
+  // Strategies which address a dilated input directly should override this;
+  // the input rows and columns should then cover the dilated kernel.
+  virtual bool applies_dilation() const { return false; }
 };
 
 
@@ -71,6 +75,11 @@ class DepthfirstDriver : public DepthwiseCommon<TInput, TWeight, TOutput>
   // The strategy which we're applying to solve the depthwise convolution.
   std::unique_ptr<const IDepthfirstStrategy> m_strat;
 
+  bool applies_dilation() const override
+  {
+    return m_strat->applies_dilation();
+  }
+
   /* Compute the amount of working space required for a single thread. */
   virtual size_t get_working_size_per_thread() const = 0;
 
@@ -127,6 +127,48 @@ class GenericDepthfirstStrategy : public DepthwiseDepthfirstStrategyCommon<TInpu
   const typename KernelStrategyType::KernelType get_kernel() const { return m_strategy->get_kernel(); }
 };
 
+/* Generic strategy which addresses a dilated input directly.
+ *
+ * Rather than decomposing the problem into one undilated problem per dilation
+ * offset (each of which is tiled, padded and parallelised separately), the
+ * pointers presented to the kernel are spaced `dilation` points apart and the
+ * whole output is computed in a single pass. This is of most benefit for
+ * large dilations of small feature maps, where the undilated problems would
+ * consist almost entirely of padded tiles.
+ */
+template <typename TInput,
+          typename TWeight=TInput,
+          typename TOutput=TInput,
+          typename TAccum=typename DefaultTAccum<TInput>::Type,
+          typename OutputStage=typename DefaultOutputStage<TOutput>::Type>
+class GenericDilatedDepthfirstStrategy : public GenericDepthfirstStrategy<TInput, TWeight, TOutput, TAccum, OutputStage>
+{
+  using Parent = GenericDepthfirstStrategy<TInput, TWeight, TOutput, TAccum, OutputStage>;
+  unsigned int m_dilation_rows, m_dilation_cols;
+
+  public:
+  GenericDilatedDepthfirstStrategy(
+    typename Parent::KernelStrategyType *strat, unsigned int n_output_rows, unsigned int n_output_cols,
+    const DepthwiseArgs &args
+  )
+  : Parent(strat, n_output_rows, n_output_cols, args),
+    m_dilation_rows(args.dilation_rows), m_dilation_cols(args.dilation_cols)
+  {
+  }
+
+  unsigned int get_input_rows() const override
+  {
+    return (this->get_kernel_rows() - 1) * m_dilation_rows + 1 + (this->get_output_rows() - 1) * this->get_stride_rows();
+  }
+
+  unsigned int get_input_cols() const override
+  {
+    return (this->get_kernel_cols() - 1) * m_dilation_cols + 1 + (this->get_output_cols() - 1) * this->get_stride_cols();
+  }
+
+  bool applies_dilation() const override { return true; }
+};
+
 // Use a templated function to marshal arguments when executing the kernel.
 template <typename OutputStage> struct DepthwiseDepthfirstGenericKernelCall;
 
@@ -261,7 +303,8 @@ class DepthwiseDepthfirstGeneric : public DepthwiseDepthfirstCommon<TInput, TWei
       input.ld_row, input.ld_col,
       input_buffer,
       input_pad_top, args.input_rows - input_i,
-      input_pad_left, args.input_cols - input_j
+      input_pad_left, args.input_cols - input_j,
+      args.dilation_rows, args.dilation_cols
     );
   }
 
@@ -57,6 +57,8 @@
 #include "kernels/a64_fp16_nhwc_3x3_s2_output2x2_mla_depthfirst.hpp"
 #include "kernels/a64_fp16_nhwc_5x5_s1_output2x2_mla_depthfirst.hpp"
 #include "kernels/a64_fp16_nhwc_generic_output9_mla_depthfirst.hpp"
+#include "kernels/cpp_nhwc_7x7_s1_output2x2_mla_depthfirst.hpp"
+#include "kernels/cpp_nhwc_7x7_s2_output2x2_mla_depthfirst.hpp"
 #include "kernels/a64_fp16_packed_to_nhwc_generic_with_multiplier_output2x8_mla_depthfirst.hpp"
 #endif  // defined(ENABLE_FP16_KERNELS) && defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC)
 #endif  // defined(__aarch64__)
@@ -108,14 +110,22 @@ namespace
     }
 
     // First-pass: compute the number of output pixels which will be computed.
-    return arm_gemm::roundup(args.output_rows, Strategy::output_rows) *
-           arm_gemm::roundup(args.output_cols, Strategy::output_cols) *
+    return get_decomposed_output_points(args, Strategy::output_rows, Strategy::output_cols) *
            arm_gemm::iceildiv(
             (long unsigned) args.input_channels * args.channel_multiplier,
             arm_gemm::utils::get_vector_length<typename Strategy::return_type>(Strategy::vl_type)
           );
   }
 
+  unsigned int dilated_cycle_estimate(const DepthwiseArgs &args, const Nothing &)
+  {
+    return get_dilation_aware_output_points(args) *
+           arm_gemm::iceildiv(
+            (long unsigned) args.input_channels * args.channel_multiplier,
+            arm_gemm::utils::get_vector_length<__fp16>(arm_gemm::VLType::None)
+          );
+  }
+
   template <class Strategy>
   unsigned int planar_cycle_estimate(const DepthwiseArgs &args, const Nothing &)
   {
@@ -314,6 +324,42 @@ static const DepthwiseImplementation<__fp16, __fp16> depthwise_fp16_methods[] =
       return new DepthwiseDepthfirst<__fp16>(strat, args);
     },
   },
+  {
+    DepthwiseMethod::DEPTHFIRST,
+    "a64_fp16_nhwc_3x3_dilated_output3x3_mla_depthfirst",
+    constraint(has_kernel_size<3, 3>,
+               has_dilation,
+               has_no_channel_multiplier,
+               cpu_has_fp16),
+    dilated_cycle_estimate,
+    [] (const DepthwiseArgs &args, const Nothing &) -> DepthwiseCommon<__fp16, __fp16, __fp16> * {
+      auto kern = new a64_fp16_nhwc_generic_output9_mla_depthfirst(args.cpu_info);
+      auto strat = new GenericDilatedDepthfirstStrategy<__fp16>(kern, 3, 3, args);
+      return new DepthwiseDepthfirstGeneric<__fp16>(strat, args);
+    },
+  },
+  {
+    DepthwiseMethod::DEPTHFIRST,
+    "cpp_fp16_nhwc_7x7_s1_output2x2_mla_depthfirst",
+    constraint(is_supported<cpp_nhwc_7x7_s1_output2x2_mla_depthfirst<__fp16>>,
+               cpu_has_fp16),
+    cycle_estimate<cpp_nhwc_7x7_s1_output2x2_mla_depthfirst<__fp16>>,
+    [] (const DepthwiseArgs &args, const Nothing &) -> DepthwiseCommon<__fp16, __fp16, __fp16> * {
+      auto strat = new cpp_nhwc_7x7_s1_output2x2_mla_depthfirst<__fp16>(args.cpu_info);
+      return new DepthwiseDepthfirst<__fp16>(strat, args);
+    },
+  },
+  {
+    DepthwiseMethod::DEPTHFIRST,
+    "cpp_fp16_nhwc_7x7_s2_output2x2_mla_depthfirst",
+    constraint(is_supported<cpp_nhwc_7x7_s2_output2x2_mla_depthfirst<__fp16>>,
+               cpu_has_fp16),
+    cycle_estimate<cpp_nhwc_7x7_s2_output2x2_mla_depthfirst<__fp16>>,
+    [] (const DepthwiseArgs &args, const Nothing &) -> DepthwiseCommon<__fp16, __fp16, __fp16> * {
+      auto strat = new cpp_nhwc_7x7_s2_output2x2_mla_depthfirst<__fp16>(args.cpu_info);
+      return new DepthwiseDepthfirst<__fp16>(strat, args);
+    },
+  },
   {
     DepthwiseMethod::DEPTHFIRST,
     "a64_fp16_nhwc_generic_output3x3_mla_depthfirst",
@@ -69,6 +69,8 @@
 #include "kernels/a64_fp32_nhwc_3x3_s2_output2x2_mla_depthfirst.hpp"
 #include "kernels/a64_fp32_nhwc_5x5_s1_output2x2_mla_depthfirst.hpp"
 #include "kernels/a64_fp32_nhwc_generic_output9_mla_depthfirst.hpp"
+#include "kernels/cpp_nhwc_7x7_s1_output2x2_mla_depthfirst.hpp"
+#include "kernels/cpp_nhwc_7x7_s2_output2x2_mla_depthfirst.hpp"
 #include "kernels/a64_fp32_packed_to_nhwc_3x3_s2_with_multiplier_output3x3_mla_depthfirst.hpp"
 #include "kernels/a64_fp32_packed_to_nhwc_5x5_s1_with_multiplier_output2x4_mla_depthfirst.hpp"
 #include "kernels/a64_fp32_packed_to_nhwc_generic_with_multiplier_output2x8_mla_depthfirst.hpp"
@@ -120,14 +122,22 @@ namespace
     }
 
     // First-pass: compute the number of output pixels which will be computed.
-    return arm_gemm::roundup(args.output_rows, Strategy::output_rows) *
-           arm_gemm::roundup(args.output_cols, Strategy::output_cols) *
+    return get_decomposed_output_points(args, Strategy::output_rows, Strategy::output_cols) *
            arm_gemm::iceildiv(
             (long unsigned) args.input_channels * args.channel_multiplier,
             arm_gemm::utils::get_vector_length<typename Strategy::return_type>(Strategy::vl_type)
           );
   }
 
+  unsigned int dilated_cycle_estimate(const DepthwiseArgs &args, const Nothing &)
+  {
+    return get_dilation_aware_output_points(args) *
+           arm_gemm::iceildiv(
+            (long unsigned) args.input_channels * args.channel_multiplier,
+            arm_gemm::utils::get_vector_length<float>(arm_gemm::VLType::None)
+          );
+  }
+
   template <class Strategy>
   unsigned int planar_cycle_estimate(const DepthwiseArgs &args, const Nothing &)
   {
@@ -478,6 +488,39 @@ static const DepthwiseImplementation<float, float> depthwise_fp32_methods[] = {
       return new DepthwiseDepthfirst<float>(strat, args);
     },
   },
+  {
+    DepthwiseMethod::DEPTHFIRST,
+    "a64_fp32_nhwc_3x3_dilated_output3x3_mla_depthfirst",
+    constraint(has_kernel_size<3, 3>,
+               has_dilation,
+               has_no_channel_multiplier),
+    dilated_cycle_estimate,
+    [] (const DepthwiseArgs &args, const Nothing &) -> DepthwiseCommon<float, float, float> * {
+      auto kern = new a64_fp32_nhwc_generic_output9_mla_depthfirst(args.cpu_info);
+      auto strat = new GenericDilatedDepthfirstStrategy<float>(kern, 3, 3, args);
+      return new DepthwiseDepthfirstGeneric<float>(strat, args);
+    },
+  },
+  {
+    DepthwiseMethod::DEPTHFIRST,
+    "cpp_fp32_nhwc_7x7_s1_output2x2_mla_depthfirst",
+    constraint(is_supported<cpp_nhwc_7x7_s1_output2x2_mla_depthfirst<float>>),
+    cycle_estimate<cpp_nhwc_7x7_s1_output2x2_mla_depthfirst<float>>,
+    [] (const DepthwiseArgs &args, const Nothing &) -> DepthwiseCommon<float, float, float> * {
+      auto strat = new cpp_nhwc_7x7_s1_output2x2_mla_depthfirst<float>(args.cpu_info);
+      return new DepthwiseDepthfirst<float>(strat, args);
+    },
+  },
+  {
+    DepthwiseMethod::DEPTHFIRST,
+    "cpp_fp32_nhwc_7x7_s2_output2x2_mla_depthfirst",
+    constraint(is_supported<cpp_nhwc_7x7_s2_output2x2_mla_depthfirst<float>>),
+    cycle_estimate<cpp_nhwc_7x7_s2_output2x2_mla_depthfirst<float>>,
+    [] (const DepthwiseArgs &args, const Nothing &) -> DepthwiseCommon<float, float, float> * {
+      auto strat = new cpp_nhwc_7x7_s2_output2x2_mla_depthfirst<float>(args.cpu_info);
+      return new DepthwiseDepthfirst<float>(strat, args);
+    },
+  },
   {
     DepthwiseMethod::DEPTHFIRST,
     "a64_fp32_nhwc_generic_output3x3_mla_depthfirst",
@@ -34,6 +34,9 @@
 
 #include "arm_gemm.hpp"
 #include "depthwise.hpp"
+#include "utils.hpp"
+
+#include <algorithm>
 
 namespace arm_conv
 {
@@ -127,6 +130,60 @@ bool has_channel_multiplier(const DepthwiseArgs &args, const void *)
   return args.channel_multiplier > 1;
 }
 
+template <unsigned int KernelRows, unsigned int KernelCols>
+bool has_kernel_size(const DepthwiseArgs &args, const void *) __attribute__ ((unused));
+template <unsigned int KernelRows, unsigned int KernelCols>
+bool has_kernel_size(const DepthwiseArgs &args, const void *)
+{
+  return args.kernel_rows == KernelRows && args.kernel_cols == KernelCols;
+}
+
+bool has_dilation(const DepthwiseArgs &args, const void *) __attribute__ ((unused));
+bool has_dilation(const DepthwiseArgs &args, const void *)
+{
+  return args.dilation_rows > 1 || args.dilation_cols > 1;
+}
+
+// Unless a kernel applies the dilation itself, a dilated problem is
+// decomposed into `dilation_rows * dilation_cols` undilated problems, each of
+// which is rounded up to a whole number of tiles. Get the number of output
+// points which will be computed as a result.
+unsigned long get_decomposed_output_points(const DepthwiseArgs &args, unsigned int tile_rows, unsigned int tile_cols) __attribute__ ((unused));
+unsigned long get_decomposed_output_points(const DepthwiseArgs &args, unsigned int tile_rows, unsigned int tile_cols)
+{
+  const auto rounded_size = [] (unsigned int size, unsigned int dilation, unsigned int tile) -> unsigned long
+  {
+    unsigned long total = 0;
+    for (unsigned int d = 0; d < std::min(size, dilation); d++)
+    {
+      total += arm_gemm::roundup(arm_gemm::iceildiv(size - d, dilation), tile);
+    }
+    return total;
+  };
+
+  return rounded_size(args.output_rows, std::max(args.dilation_rows, 1u), tile_rows) *
+         rounded_size(args.output_cols, std::max(args.dilation_cols, 1u), tile_cols);
+}
+
+// Dilation-aware generic kernels compute the whole of a dilated problem in a
+// single pass, nine output points at a time. As they don't share input loads
+// between neighbouring output points they cost roughly 3/2 as much per point
+// as the specialised kernels; they're preferred when the decomposition would
+// waste more than this on padded tiles.
+unsigned long get_dilation_aware_output_points(const DepthwiseArgs &args) __attribute__ ((unused));
+unsigned long get_dilation_aware_output_points(const DepthwiseArgs &args)
+{
+  return arm_gemm::roundup((unsigned long) args.output_rows * args.output_cols, 9ul) * 3 / 2;
+}
+
+bool prefer_dilation_aware(const DepthwiseArgs &args, const void *) __attribute__ ((unused));
+bool prefer_dilation_aware(const DepthwiseArgs &args, const void *)
+{
+  // Compare against the 2x2 tiles used by the specialised quantized kernels
+  return has_dilation(args, nullptr) &&
+         get_dilation_aware_output_points(args) < get_decomposed_output_points(args, 2, 2);
+}
+
 // Planar kernels require a "priming" step before the main processing loop.  The kernels can prime with left padding
 // or input data, but not right padding - which could be needed in some extreme cases such as a 5x5 kernel, width 1
 // padding 2.  These are rare enough and can be handled with other kernels anyway, so filter them out with this.
@@ -48,6 +48,8 @@
 #include "kernels/a64_u8s8u8q_nhwc_3x3_s2_output2x2_mla_depthfirst.hpp"
 #include "kernels/a64_u8s8u8q_nhwc_5x5_s1_output2x2_mla_depthfirst.hpp"
 #include "kernels/a64_u8s8u8q_nhwc_generic_output9_mla_depthfirst.hpp"
+#include "kernels/cpp_nhwc_7x7_s1_output2x2_mla_depthfirst.hpp"
+#include "kernels/cpp_nhwc_7x7_s2_output2x2_mla_depthfirst.hpp"
 #include "kernels/a64_u8s8u8q_packed_to_nhwc_generic_with_multiplier_output2x8_mla_depthfirst.hpp"
 #endif  // defined(__aarch64__)
 
@@ -70,6 +72,19 @@ uint64_t not_preferred(const DepthwiseArgs &, const Requantize32 &)
 
 static const DepthwiseImplementation<uint8_t, int8_t, uint8_t, Requantize32> depthwise_u8q_methods[] = {
 #if defined(__aarch64__)
+  {
+    DepthwiseMethod::DEPTHFIRST,
+    "a64_u8s8u8q_nhwc_3x3_dilated_output3x3_mla_depthfirst",
+    constraint<Requantize32>(has_kernel_size<3, 3>,
+                             has_no_channel_multiplier,
+                             prefer_dilation_aware),
+    nullptr,
+    [] (const DepthwiseArgs &args, const Requantize32 &qp) -> DepthwiseCommon<uint8_t, int8_t, uint8_t> * {
+      auto kernel = new a64_u8s8u8q_nhwc_generic_output9_mla_depthfirst(args.cpu_info);
+      auto strat = new GenericDilatedDepthfirstStrategy<uint8_t, int8_t>(kernel, 3, 3, args);
+      return new DepthwiseDepthfirstGeneric<uint8_t, int8_t>(strat, args, qp);
+    },
+  },
 #if defined(ARM_COMPUTE_ENABLE_SVE)
 #if defined(ARM_COMPUTE_ENABLE_SME2)
   {
@@ -195,6 +210,28 @@ static const DepthwiseImplementation<uint8_t, int8_t, uint8_t, Requantize32> dep
       return new DepthwiseDepthfirst<uint8_t, int8_t>(strat, args, qp);
     },
   },
+  {
+    DepthwiseMethod::DEPTHFIRST,
+    "cpp_u8s8u8q_nhwc_7x7_s1_output2x2_mla_depthfirst",
+    constraint<Requantize32>(is_supported<cpp_nhwc_7x7_s1_output2x2_mla_depthfirst<uint8_t, int8_t>>,
+                             qp_has_no_left_shift),
+    nullptr,
+    [] (const DepthwiseArgs &args, const Requantize32 &qp) -> DepthwiseCommon<uint8_t, int8_t, uint8_t> * {
+      auto strat = new cpp_nhwc_7x7_s1_output2x2_mla_depthfirst<uint8_t, int8_t>(args.cpu_info);
+      return new DepthwiseDepthfirst<uint8_t, int8_t>(strat, args, qp);
+    },
+  },
+  {
+    DepthwiseMethod::DEPTHFIRST,
+    "cpp_u8s8u8q_nhwc_7x7_s2_output2x2_mla_depthfirst",
+    constraint<Requantize32>(is_supported<cpp_nhwc_7x7_s2_output2x2_mla_depthfirst<uint8_t, int8_t>>,
+                             qp_has_no_left_shift),
+    nullptr,
+    [] (const DepthwiseArgs &args, const Requantize32 &qp) -> DepthwiseCommon<uint8_t, int8_t, uint8_t> * {
+      auto strat = new cpp_nhwc_7x7_s2_output2x2_mla_depthfirst<uint8_t, int8_t>(args.cpu_info);
+      return new DepthwiseDepthfirst<uint8_t, int8_t>(strat, args, qp);
+    },
+  },
   {
     DepthwiseMethod::DEPTHFIRST,
     "a64_u8s8u8q_nhwc_generic_output3x3_mla_depthfirst",
@@ -0,0 +1,383 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* Portable implementations of specialised depthfirst kernels.
+ *
+ * The kernels are written in terms of compile-time shapes and fixed-width
+ * channel blocks so that the compiler can fully unroll the kernel and output
+ * loops and vectorise over the channels. Every input point is loaded once per
+ * tile and applied to each output point whose receptive field contains it.
+ */
+
+#pragma once
+
+#include "src/core/NEON/kernels/arm_conv/depthwise/depthwise_depthfirst.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+
+namespace arm_conv {
+namespace depthwise {
+namespace cpp_depthfirst {
+
+template <unsigned int KernelRows, unsigned int KernelCols,
+          unsigned int StrideRows, unsigned int StrideCols,
+          unsigned int OutputRows, unsigned int OutputCols>
+struct Shape
+{
+  constexpr static unsigned int kernel_rows = KernelRows;
+  constexpr static unsigned int kernel_cols = KernelCols;
+
+  constexpr static unsigned int stride_rows = StrideRows;
+  constexpr static unsigned int stride_cols = StrideCols;
+
+  constexpr static unsigned int output_rows = OutputRows;
+  constexpr static unsigned int output_cols = OutputCols;
+
+  constexpr static unsigned int input_rows = (OutputRows - 1) * StrideRows + KernelRows;
+  constexpr static unsigned int input_cols = (OutputCols - 1) * StrideCols + KernelCols;
+  constexpr static unsigned int kernel_points = KernelRows * KernelCols;
+  constexpr static unsigned int output_points = OutputRows * OutputCols;
+};
+
+/* Accumulate the contribution of one input point, `in`, into every output
+ * point of the tile which it affects. `weights` contains `Lanes` values per
+ * kernel point, in row-major order.
+ */
+template <class S, unsigned int Lanes, typename TIn, typename TWeight, typename TAccum>
+inline void accumulate_point(
+  const unsigned int i, const unsigned int j,
+  const TIn (&in)[Lanes], const TWeight *weights,
+  TAccum (&acc)[S::output_points][Lanes]
+)
+{
+  for (unsigned int oi = 0; oi < S::output_rows; oi++)
+  {
+    if (i < oi * S::stride_rows || i - oi * S::stride_rows >= S::kernel_rows)
+    {
+      continue;
+    }
+    const auto ki = i - oi * S::stride_rows;
+
+    for (unsigned int oj = 0; oj < S::output_cols; oj++)
+    {
+      if (j < oj * S::stride_cols || j - oj * S::stride_cols >= S::kernel_cols)
+      {
+        continue;
+      }
+      const auto kj = j - oj * S::stride_cols;
+
+      const TWeight *w = weights + (ki * S::kernel_cols + kj) * Lanes;
+      for (unsigned int l = 0; l < Lanes; l++)
+      {
+        acc[oi * S::output_cols + oj][l] += static_cast<TAccum>(in[l]) * static_cast<TAccum>(w[l]);
+      }
+    }
+  }
+}
+
+/* Compute a block of (at most) `Lanes` channels, starting at channel `c`, of
+ * a floating-point tile. `params` points at the packed bias and weights for
+ * the block.
+ */
+template <class S, unsigned int Lanes, typename T>
+inline void fp_block(
+  const unsigned int n_lanes, const unsigned int c,
+  const T *const *const inptrs, T *const *const outptrs,
+  const T *params, const T activation_min, const T activation_max
+)
+{
+  T acc[S::output_points][Lanes];
+  for (unsigned int o = 0; o < S::output_points; o++)
+  {
+    for (unsigned int l = 0; l < Lanes; l++)
+    {
+      acc[o][l] = params[l];
+    }
+  }
+
+  for (unsigned int i = 0; i < S::input_rows; i++)
+  {
+    for (unsigned int j = 0; j < S::input_cols; j++)
+    {
+      T in[Lanes] = {};
+      const T *inptr = inptrs[i * S::input_cols + j] + c;
+      for (unsigned int l = 0; l < n_lanes; l++)
+      {
+        in[l] = inptr[l];
+      }
+      accumulate_point<S, Lanes>(i, j, in, params + Lanes, acc);
+    }
+  }
+
+  for (unsigned int o = 0; o < S::output_points; o++)
+  {
+    T *outptr = outptrs[o] + c;
+    for (unsigned int l = 0; l < n_lanes; l++)
+    {
+      outptr[l] = std::min(std::max(acc[o][l], activation_min), activation_max);
+    }
+  }
+}
+
+template <class S, unsigned int Lanes, typename T>
+void fp_indirect(
+  const T *const *const inptrs, T *const *const outptrs,
+  const void *params, const unsigned int n_channels,
+  const T activation_min, const T activation_max
+)
+{
+  auto packed = static_cast<const T *>(params);
+  constexpr auto block_size = (1 + S::kernel_points) * Lanes;
+
+  unsigned int c = 0;
+  for (; c + Lanes <= n_channels; c += Lanes, packed += block_size)
+  {
+    fp_block<S, Lanes>(Lanes, c, inptrs, outptrs, packed, activation_min, activation_max);
+  }
+  if (c < n_channels)
+  {
+    fp_block<S, Lanes>(n_channels - c, c, inptrs, outptrs, packed, activation_min, activation_max);
+  }
+}
+
+template <class S, unsigned int Lanes, typename T>
+void fp_direct(
+  const unsigned int n_tile_rows, const unsigned int n_tile_cols,
+  const T *inptr, int64_t ld_input_row, int64_t ld_input_col,
+  T *outptr, int64_t ld_output_row, int64_t ld_output_col,
+  const void *params, const unsigned int n_channels,
+  const T activation_min, const T activation_max
+)
+{
+  const T *inptrs[S::input_rows * S::input_cols];
+  T *outptrs[S::output_points];
+
+  for (unsigned int tile_i = 0; tile_i < n_tile_rows; tile_i++)
+  {
+    for (unsigned int tile_j = 0; tile_j < n_tile_cols; tile_j++)
+    {
+      const T *tile_inptr = inptr + tile_i * S::output_rows * S::stride_rows * ld_input_row +
+                                    tile_j * S::output_cols * S::stride_cols * ld_input_col;
+      for (unsigned int i = 0; i < S::input_rows; i++)
+      {
+        for (unsigned int j = 0; j < S::input_cols; j++)
+        {
+          inptrs[i * S::input_cols + j] = tile_inptr + i * ld_input_row + j * ld_input_col;
+        }
+      }
+
+      T *tile_outptr = outptr + tile_i * S::output_rows * ld_output_row + tile_j * S::output_cols * ld_output_col;
+      for (unsigned int i = 0; i < S::output_rows; i++)
+      {
+        for (unsigned int j = 0; j < S::output_cols; j++)
+        {
+          outptrs[i * S::output_cols + j] = tile_outptr + i * ld_output_row + j * ld_output_col;
+        }
+      }
+
+      fp_indirect<S, Lanes>(inptrs, outptrs, params, n_channels, activation_min, activation_max);
+    }
+  }
+}
+
+/* Saturating rounding doubling multiply returning the high half, followed by
+ * a rounding shift right (where `shift` is zero or negative) which rounds
+ * halves away from zero; i.e., the requantization performed by the assembly
+ * kernels.
+ */
+inline int32_t requantize(const int32_t acc, const int32_t mul, const int32_t shift)
+{
+  int32_t x = std::numeric_limits<int32_t>::max();
+  if (acc != std::numeric_limits<int32_t>::min() || mul != std::numeric_limits<int32_t>::min())
+  {
+    x = static_cast<int32_t>((static_cast<int64_t>(acc) * mul + (int64_t(1) << 30)) >> 31);
+  }
+
+  if (shift < 0)
+  {
+    if (x < 0 && x != std::numeric_limits<int32_t>::min())
+    {
+      x--;
+    }
+    x = static_cast<int32_t>((static_cast<int64_t>(x) + (int64_t(1) << (-shift - 1))) >> -shift);
+  }
+  return x;
+}
+
+template <class S, unsigned int Lanes, typename TInput, typename TWeight, typename TOutput>
+inline void quantized_block(
+  const unsigned int n_lanes, const unsigned int c,
+  const TInput *const *const inptrs, const TWeight *weights,
+  const int32_t *const bias, const arm_gemm::Requantize32 &qp,
+  const int32_t *const requant_muls, const int32_t *const requant_shifts,
+  TOutput *const *const outptrs
+)
+{
+  // Remove the weight offset once per block rather than once per product
+  int32_t w[S::kernel_points * Lanes];
+  for (unsigned int k = 0; k < S::kernel_points * Lanes; k++)
+  {
+    w[k] = static_cast<int32_t>(weights[k]) - qp.b_offset;
+  }
+
+  int32_t acc[S::output_points][Lanes];
+  for (unsigned int o = 0; o < S::output_points; o++)
+  {
+    for (unsigned int l = 0; l < Lanes; l++)
+    {
+      acc[o][l] = (l < n_lanes) ? bias[c + l] : 0;
+    }
+  }
+
+  for (unsigned int i = 0; i < S::input_rows; i++)
+  {
+    for (unsigned int j = 0; j < S::input_cols; j++)
+    {
+      int32_t in[Lanes] = {};
+      const TInput *inptr = inptrs[i * S::input_cols + j] + c;
+      for (unsigned int l = 0; l < n_lanes; l++)
+      {
+        in[l] = static_cast<int32_t>(inptr[l]) - qp.a_offset;
+      }
+      accumulate_point<S, Lanes>(i, j, in, w, acc);
+    }
+  }
+
+  for (unsigned int o = 0; o < S::output_points; o++)
+  {
+    TOutput *outptr = outptrs[o] + c;
+    for (unsigned int l = 0; l < n_lanes; l++)
+    {
+      const auto v = requantize(acc[o][l], requant_muls[c + l], requant_shifts[c + l]) + qp.c_offset;
+      outptr[l] = static_cast<TOutput>(std::min(std::max(v, qp.minval), qp.maxval));
+    }
+  }
+}
+
+template <class S, unsigned int Lanes, typename TInput, typename TWeight, typename TOutput>
+void quantized(
+  const unsigned int n_channels,
+  const TInput *const *const inptrs,
+  const TWeight *weights,
+  const int32_t *const bias,
+  const arm_gemm::Requantize32 &qp,
+  const int32_t *const requant_muls,
+  const int32_t *const requant_shifts,
+  TOutput *const *const outptrs
+)
+{
+  unsigned int c = 0;
+  for (; c + Lanes <= n_channels; c += Lanes, weights += S::kernel_points * Lanes)
+  {
+    quantized_block<S, Lanes>(Lanes, c, inptrs, weights, bias, qp, requant_muls, requant_shifts, outptrs);
+  }
+  if (c < n_channels)
+  {
+    quantized_block<S, Lanes>(n_channels - c, c, inptrs, weights, bias, qp, requant_muls, requant_shifts, outptrs);
+  }
+}
+
+}  // namespace cpp_depthfirst
+
+/* Strategy wrapping the portable kernels.
+ *
+ * Each block of channels is `accumulator_depth_vl` 128-bit vectors of
+ * accumulators wide, which gives the compiler enough independent accumulators
+ * to hide the latency of the multiply-accumulates.
+ */
+template <class S, typename TInput, typename TWeight = TInput, typename TOutput = TInput,
+          typename TAccum = typename DefaultTAccum<TInput>::Type>
+class cpp_nhwc_mla_depthfirst : public DepthwiseDepthfirstStrategy<TInput, TWeight, TOutput, TAccum>
+{
+  using Parent = DepthwiseDepthfirstStrategy<TInput, TWeight, TOutput, TAccum>;
+
+  public:
+  using return_type = TOutput;
+  constexpr static auto vl_type = arm_gemm::VLType::None;
+  constexpr static unsigned int accumulator_depth_vl = 2;
+  constexpr static unsigned int lanes = accumulator_depth_vl * 16 / sizeof(TAccum);
+
+  constexpr static unsigned int kernel_rows = S::kernel_rows;
+  constexpr static unsigned int kernel_cols = S::kernel_cols;
+
+  constexpr static unsigned int stride_rows = S::stride_rows;
+  constexpr static unsigned int stride_cols = S::stride_cols;
+
+  constexpr static unsigned int output_rows = S::output_rows;
+  constexpr static unsigned int output_cols = S::output_cols;
+
+  cpp_nhwc_mla_depthfirst(const CPUInfo *)
+  : Parent(output_rows, output_cols, kernel_rows, kernel_cols, stride_rows, stride_cols) {}
+
+  arm_gemm::VLType get_vl_type(void) const override { return vl_type; }
+  unsigned int get_accumulator_depth_vl(void) const override { return accumulator_depth_vl; }
+
+  typename Parent::IndirectKernelType get_indirect_kernel() const override
+  {
+    return cpp_depthfirst::fp_indirect<S, lanes, TInput>;
+  }
+
+  typename Parent::DirectKernelType get_direct_kernel() const override
+  {
+    return cpp_depthfirst::fp_direct<S, lanes, TInput>;
+  }
+};
+
+template <class S, typename TInput, typename TWeight, typename TOutput>
+class cpp_nhwc_mla_depthfirst<S, TInput, TWeight, TOutput, int32_t>
+: public DepthwiseDepthfirstStrategy<TInput, TWeight, TOutput, int32_t>
+{
+  using Parent = DepthwiseDepthfirstStrategy<TInput, TWeight, TOutput, int32_t>;
+
+  public:
+  using return_type = TOutput;
+  constexpr static auto vl_type = arm_gemm::VLType::None;
+  constexpr static unsigned int accumulator_depth_vl = 4;
+  constexpr static unsigned int lanes = accumulator_depth_vl * 16 / sizeof(int32_t);
+
+  constexpr static unsigned int kernel_rows = S::kernel_rows;
+  constexpr static unsigned int kernel_cols = S::kernel_cols;
+
+  constexpr static unsigned int stride_rows = S::stride_rows;
+  constexpr static unsigned int stride_cols = S::stride_cols;
+
+  constexpr static unsigned int output_rows = S::output_rows;
+  constexpr static unsigned int output_cols = S::output_cols;
+
+  cpp_nhwc_mla_depthfirst(const CPUInfo *)
+  : Parent(output_rows, output_cols, kernel_rows, kernel_cols, stride_rows, stride_cols) {}
+
+  arm_gemm::VLType get_vl_type(void) const override { return vl_type; }
+  unsigned int get_accumulator_depth_vl(void) const override { return accumulator_depth_vl; }
+
+  typename Parent::KernelType get_kernel() const override
+  {
+    return cpp_depthfirst::quantized<S, lanes, TInput, TWeight, TOutput>;
+  }
+};
+
+}  // namespace depthwise
+}  // namespace arm_conv
@@ -277,6 +277,17 @@ public:
         args.output_rows    = output_height;
         args.output_cols    = output_width;
         args.padding        = padding;
+
+        if (this->applies_dilation())
+        {
+            // The implementation addresses the dilated input directly, so the
+            // problem can be solved in a single pass.
+            this->execute_internal(args, input, ld_input_col, ld_input_row, ld_input_batch, parameters, output,
+                                   ld_output_col, ld_output_row, ld_output_batch, working_space, thread_id,
+                                   n_threads);
+            return;
+        }
+
         args.dilation_rows = args.dilation_cols = 1;
 
         auto ld_input_col_d  = ld_input_col * m_args.dilation_cols;
@@ -336,6 +347,14 @@ protected:
     {
         return true;
     }
+
+    // Whether the implementation applies the dilation itself; otherwise the
+    // problem is decomposed into `dilation_rows * dilation_cols` undilated
+    // problems.
+    virtual bool applies_dilation() const
+    {
+        return false;
+    }
 };
 
 template <typename TInput, typename TWeight = TInput, typename TOutput = TInput>
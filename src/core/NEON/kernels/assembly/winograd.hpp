@@ -26,6 +26,7 @@
 
 #include "arm_gemm.hpp"
 #include <cstddef>
+#include <cstdint>
 
 namespace arm_conv
 {
@@ -34,6 +35,23 @@ struct Shape2D
     unsigned int rows, cols;
 };
 
+/* Quantization of an 8-bit Winograd convolution.
+ *
+ * The input and weight transforms remove the zero points and produce 16-bit
+ * values, which are multiplied by a 16-bit GEMM with 32-bit accumulators. The
+ * output transform rescales each Winograd point, transforms the result back
+ * to the spatial domain and requantizes it.
+ */
+struct WinogradQuantization
+{
+    int32_t      input_offset;       // Zero point of the input
+    int32_t      weight_offset;      // Zero point of the weights
+    int32_t      output_offset;      // Zero point of the output
+    int32_t      minval, maxval;     // Range of the output, including any fused activation
+    const float *output_multipliers; // Input scale times weight scale over output scale, per output channel
+    float       *point_scales;       // Scale of each Winograd point of the GEMM output, set by the weight transform
+};
+
 struct ConvolutionArgs
 {
     unsigned int         n_batches;
@@ -45,6 +63,9 @@ struct ConvolutionArgs
     Shape2D              kernel_shape;
     arm_gemm::Activation activation;
 
+    // Required by the 8-bit transforms, ignored otherwise
+    const WinogradQuantization *quantization = nullptr;
+
     ConvolutionArgs(unsigned int                n_batches,
                     const Shape2D              &input_shape,
                     unsigned int                n_input_channels,
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+
+namespace arm_conv {
+namespace winograd {
+
+/* Share the bits of the 32-bit GEMM accumulators of an 8-bit Winograd
+ * convolution between the transformed inputs and the transformed weights.
+ *
+ * `input_bits` is the number of bits of the magnitude of the exact transformed
+ * inputs. The transformed inputs are shifted right by `input_shift` bits and
+ * the magnitude of the transformed weights is limited to `weight_bits` bits,
+ * so that a sum of `n_channels` products can't overflow. The bits are shared
+ * evenly when there aren't enough for exact inputs and 16-bit weights.
+ */
+inline void get_fixed_point_bits(
+  const unsigned int input_bits, const unsigned int n_channels,
+  unsigned int &input_shift, unsigned int &weight_bits
+)
+{
+  // Bits left for the magnitude of each product
+  unsigned int product_bits = 31;
+  for (unsigned int n = 1; n < n_channels && product_bits > 2; n *= 2)
+  {
+    product_bits--;
+  }
+
+  const auto shifted_input_bits = std::min(input_bits, std::max(product_bits / 2, product_bits - std::min(product_bits, 15u)));
+  input_shift = input_bits - shifted_input_bits;
+  weight_bits = std::min(15u, product_bits - shifted_input_bits);
+}
+
+/* Shift right, rounding to nearest. */
+inline int32_t rounding_shift_right(const int32_t value, const unsigned int shift)
+{
+  const int32_t round = shift ? (1 << (shift - 1)) : 0;
+  return (value + round) >> shift;
+}
+
+}  // namespace winograd
+}  // namespace arm_conv
@@ -25,6 +25,7 @@
 #pragma once
 
 #include "winograd.hpp"
+#include "fixed_point.hpp"
 
 #include "src/core/NEON/kernels/arm_conv/addressing.hpp"
 #include <algorithm>
@@ -376,6 +377,111 @@ class TransformUnpadded : public TransformBase<TIn, TOut>
   }
 };
 
+/* Driver for the transforms of 8-bit quantized inputs.
+ *
+ * Kernels are given tiles without padding: the padding is filled with the
+ * zero point of the input. They subtract the zero point, transform the tile
+ * exactly and shift the transformed values right, rounding to nearest, by
+ * the amount which keeps the GEMM accumulators from overflowing.
+ */
+template <typename TIn, typename TOut=int16_t>
+class TransformQuantized : public TransformBase<TIn, TOut>
+{
+  using Kernel = std::function<void(
+    unsigned int,  // Number of channels
+    const TIn *,  size_t, size_t,  // Pointer to first input element, row and column stride
+    int32_t, unsigned int,  // Zero point of the input, right shift of the transformed values
+    TOut *, size_t // Base output pointer, stride between matrices
+  )>;
+  const Kernel m_kernel;
+  const unsigned int m_transformed_bits;  // Bits of the magnitude of the exact transformed values
+
+  struct Workspace
+  {
+    int32_t input_offset;
+    unsigned int shift;
+  };
+
+  protected:
+  size_t get_working_space_per_thread(const ConvolutionArgs &args) const override
+  {
+    const auto input_points = this->get_input_rows() * this->get_input_cols();
+    return sizeof(Workspace) + sizeof(TIn) * input_points * args.n_input_channels;
+  }
+
+  void initialise_thread_working_space(const ConvolutionArgs &args, void *buffer) const override
+  {
+    Workspace *ws = reinterpret_cast<Workspace *>(buffer);
+    ws->input_offset = args.quantization->input_offset;
+
+    unsigned int weight_bits;
+    get_fixed_point_bits(m_transformed_bits, args.n_input_channels, ws->shift, weight_bits);
+  }
+
+  void execute_tile(
+    unsigned int n_channels,
+    const TIn *inptr, size_t ld_in_row, size_t ld_in_col,
+    TOut *const outptr, const size_t ld_out_matrix,
+    const unsigned int pad_top, const unsigned int valid_rows,
+    const unsigned int pad_left, const unsigned int valid_cols,
+    void *const working_space
+  ) const override
+  {
+    const auto ws = reinterpret_cast<Workspace *>(working_space);
+
+    // If there's any padding, then copy the valid portion of the tensor into
+    // a patch filled with the zero point and reset the pointer, row and
+    // column strides to point at this copy of the data.
+    if (pad_top || valid_rows < this->get_input_rows() ||
+        pad_left || valid_cols < this->get_input_cols())
+    {
+      const auto patch_base = reinterpret_cast<TIn *>(ws + 1);
+      const auto patch_ld_col = n_channels;
+      const auto patch_ld_row = patch_ld_col * this->get_input_cols();
+      auto patch = patch_base + pad_top*patch_ld_row + pad_left*patch_ld_col;
+
+      // Fill the input patch with padding
+      memset(patch_base, static_cast<unsigned char>(ws->input_offset), sizeof(TIn) * this->get_input_rows() * patch_ld_row);
+
+      // Determine the bounds for which to copy
+      const auto last_i = std::min(valid_rows + pad_top, this->get_input_rows());
+      const auto last_j = std::min(valid_cols + pad_left, this->get_input_cols());
+
+      // Copy across the valid portion of the patch
+      for (auto i = pad_top; i < last_i; i++)
+      {
+        auto inptr_col = inptr;
+        inptr += ld_in_row;
+
+        auto patch_col = patch;
+        patch += patch_ld_row;
+
+        for (auto j = pad_left; j < last_j; j++)
+        {
+          memcpy(patch_col, inptr_col, n_channels * sizeof(TIn));
+          inptr_col += ld_in_col;
+          patch_col += patch_ld_col;
+        }
+      }
+
+      // Override the input pointer and strides
+      inptr = patch_base;
+      ld_in_col = patch_ld_col;
+      ld_in_row = patch_ld_row;
+    }
+
+    // Call the kernel
+    m_kernel(n_channels, inptr, ld_in_row, ld_in_col, ws->input_offset, ws->shift, outptr, ld_out_matrix);
+  }
+
+  public:
+  TransformQuantized(const std::string &name, unsigned int input_rows, unsigned int input_cols,
+                     Kernel kernel, unsigned int transformed_bits)
+  : TransformBase<TIn, TOut>(name, input_rows, input_cols), m_kernel(kernel), m_transformed_bits(transformed_bits)
+  {
+  }
+};
+
 }  // namespace input_transform
 }  // namespace winograd
 }  // namespace arm_conv
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "fixed_point.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+namespace arm_conv {
+namespace winograd {
+namespace input_transform {
+
+/* Input transform of F(2x2, 3x3) for 8-bit quantized inputs.
+ *
+ * The transformed values have magnitudes of at most 4 * 255, i.e. 10 bits.
+ * Channels are transformed in blocks so that the compiler can vectorise the
+ * arithmetic over the channels.
+ */
+template <typename TIn>
+void cpp_q8_4x4(
+  const unsigned int n_channels,
+  const TIn *const input_base,
+  const size_t input_row_stride,
+  const size_t input_col_stride,
+  const int32_t input_offset,
+  const unsigned int shift,
+  int16_t *const outptr,
+  const size_t matrix_stride
+)
+{
+  constexpr int inner_tile_rows = 4, inner_tile_cols = 4;
+  constexpr unsigned int block = 16;
+
+  // Matrices used/computed in this kernel.
+  int16_t x[inner_tile_rows][inner_tile_cols][block];
+  int16_t XTx[inner_tile_rows][inner_tile_cols][block];
+  int16_t U[inner_tile_rows][inner_tile_cols][block];
+
+  for (unsigned int c0 = 0; c0 < n_channels; c0 += block)
+  {
+    const unsigned int n = std::min(block, n_channels - c0);
+
+    // Load x, removing the zero point
+    for (int i = 0; i < inner_tile_rows; i++)
+    {
+      for (int j = 0; j < inner_tile_cols; j++)
+      {
+        const TIn *const x_ptr = input_base + i*input_row_stride + j*input_col_stride + c0;
+        for (unsigned int c = 0; c < n; c++)
+        {
+          x[i][j][c] = static_cast<int16_t>(x_ptr[c] - input_offset);
+        }
+      }
+    }
+
+    // Compute XT . x
+    for (int j = 0; j < inner_tile_cols; j++)
+    {
+      for (unsigned int c = 0; c < n; c++)
+      {
+        XTx[0][j][c] = x[0][j][c] - x[2][j][c];
+        XTx[1][j][c] = x[1][j][c] + x[2][j][c];
+        XTx[2][j][c] = x[2][j][c] - x[1][j][c];
+        XTx[3][j][c] = x[1][j][c] - x[3][j][c];
+      }
+    }
+
+    // Compute U = XT . x . X
+    for (int i = 0; i < inner_tile_rows; i++)
+    {
+      for (unsigned int c = 0; c < n; c++)
+      {
+        U[i][0][c] = XTx[i][0][c] - XTx[i][2][c];
+        U[i][1][c] = XTx[i][1][c] + XTx[i][2][c];
+        U[i][2][c] = XTx[i][2][c] - XTx[i][1][c];
+        U[i][3][c] = XTx[i][1][c] - XTx[i][3][c];
+      }
+    }
+
+    // Store the transformed matrix
+    for (int i = 0, m = 0; i < inner_tile_rows; i++)
+    {
+      for (int j = 0; j < inner_tile_cols; j++, m++)
+      {
+        int16_t *const u_ptr = outptr + m*matrix_stride + c0;
+        for (unsigned int c = 0; c < n; c++)
+        {
+          u_ptr[c] = static_cast<int16_t>(rounding_shift_right(U[i][j][c], shift));
+        }
+      }
+    }
+  }
+}
+
+template void cpp_q8_4x4(unsigned int, const uint8_t *, size_t, size_t, int32_t, unsigned int, int16_t *, size_t);
+template void cpp_q8_4x4(unsigned int, const int8_t *, size_t, size_t, int32_t, unsigned int, int16_t *, size_t);
+
+}  // namespace input_transform
+}  // namespace winograd
+}  // namespace arm_conv
@@ -32,11 +32,48 @@
 #include <cstring>
 #include <functional>
 #include <limits>
+#include <type_traits>
 
 namespace arm_conv {
 namespace winograd {
 namespace output_transform {
 
+namespace {
+
+/* Get the output range of a fused activation. Quantized transforms clamp
+ * their outputs themselves, so integer outputs just get the range of the type.
+ */
+template <typename TOut>
+typename std::enable_if<std::is_integral<TOut>::value>::type get_activation_range(
+  const arm_gemm::Activation &, TOut &activation_min, TOut &activation_max
+)
+{
+  activation_min = std::numeric_limits<TOut>::lowest();
+  activation_max = std::numeric_limits<TOut>::max();
+}
+
+template <typename TOut>
+typename std::enable_if<!std::is_integral<TOut>::value>::type get_activation_range(
+  const arm_gemm::Activation &activation, TOut &activation_min, TOut &activation_max
+)
+{
+  activation_min = static_cast<TOut>(-std::numeric_limits<float>::infinity());
+  activation_max = static_cast<TOut>(+std::numeric_limits<float>::infinity());
+  switch (activation.type)
+  {
+    case arm_gemm::Activation::Type::BoundedReLU:
+      activation_max = static_cast<TOut>(activation.param1);
+      // Fall through
+    case arm_gemm::Activation::Type::ReLU:
+      activation_min = static_cast<TOut>(0);
+      break;
+    default:
+      break;
+  }
+}
+
+}  // namespace
+
 /* Driver class for the Winograd output transforms.
  *
  * This provides a base implementation which handles iteration over the output
@@ -85,19 +122,8 @@ class TransformBase : public ITransform
     this->initialise_thread_working_space(args, working_space);
 
     // Get the activation values
-    auto activation_min = static_cast<TOut>(-std::numeric_limits<float>::infinity());
-    auto activation_max = static_cast<TOut>(+std::numeric_limits<float>::infinity());
-    switch (args.activation.type)
-    {
-      case arm_gemm::Activation::Type::BoundedReLU:
-        activation_max = static_cast<TOut>(args.activation.param1);
-        // Fall through
-      case arm_gemm::Activation::Type::ReLU:
-        activation_min = static_cast<TOut>(0);
-        break;
-      default:
-        break;
-    }
+    TOut activation_min, activation_max;
+    get_activation_range(args.activation, activation_min, activation_max);
 
     // Determine the number of tiles in a row, we use this to get the right
     // offset into the input data.
@@ -297,6 +323,113 @@ class TransformUnpadded : public TransformBase<TIn, TOut>
   }
 };
 
+/* Driver for the output transforms of 8-bit quantized convolutions.
+ *
+ * Kernels rescale each Winograd point of the 32-bit GEMM output, transform
+ * the tile back to the spatial domain, add the bias and requantize the result
+ * into the range given by the quantization parameters.
+ */
+template <typename TIn, typename TOut>
+class TransformQuantized : public TransformBase<TIn, TOut>
+{
+  using Kernel = std::function<void(
+    unsigned int n_channels,
+    const TIn *inptr, size_t ld_in_matrix,
+    const TIn *bias,
+    TOut *outptr, size_t ld_out_row, size_t ld_out_col,
+    const WinogradQuantization &qp
+  )>;
+  const Kernel m_kernel;
+
+  struct Workspace
+  {
+    const WinogradQuantization *qp;
+  };
+
+  protected:
+  size_t get_working_space_per_thread(const ConvolutionArgs &args) const override
+  {
+    // We create a buffer the size of the output tile
+    const auto n_output_points = this->get_output_rows() * this->get_output_cols();
+    return sizeof(Workspace) + sizeof(TOut) * n_output_points * args.n_output_channels;
+  }
+
+  void initialise_thread_working_space(const ConvolutionArgs &args, void *buffer) const override
+  {
+    reinterpret_cast<Workspace *>(buffer)->qp = args.quantization;
+  }
+
+  void execute_tile(
+    unsigned int n_channels,
+    const TIn *inptr, size_t ld_in_matrix,
+    const TIn *bias,
+    TOut *outptr, size_t ld_out_row, size_t ld_out_col,
+    TOut, TOut,
+    unsigned int valid_rows, unsigned int valid_cols,
+    void *working_space
+  ) const override final
+  {
+    const auto ws = reinterpret_cast<Workspace *>(working_space);
+
+    // Get copies of the output tensor parameters
+    auto kernel_outptr = outptr;
+    auto kernel_ld_out_row = ld_out_row, kernel_ld_out_col = ld_out_col;
+
+    // If there's padding on either the left or the right, then we execute the
+    // kernel into the output buffer and then perform a copy.
+    if (valid_rows < this->get_output_rows() ||
+        valid_cols < this->get_output_cols())
+    {
+      // Override the kernel output parameters
+      kernel_outptr = reinterpret_cast<TOut *>(ws + 1);
+      kernel_ld_out_col = n_channels;
+      kernel_ld_out_row = kernel_ld_out_col * this->get_output_cols();
+    }
+
+    // Execute the kernel
+    m_kernel(
+      n_channels,
+      inptr, ld_in_matrix,
+      bias,
+      kernel_outptr, kernel_ld_out_row, kernel_ld_out_col,
+      *ws->qp
+    );
+
+    // If necessary, copy from the working space into the destination tensor.
+    if (valid_rows < this->get_output_rows() ||
+        valid_cols < this->get_output_cols())
+    {
+      const auto last_row = std::min(valid_rows, this->get_output_rows());
+      const auto last_col = std::min(valid_cols, this->get_output_cols());
+
+      for (auto i = 0u; i < last_row; i++)
+      {
+        auto patch_tile = kernel_outptr;
+        auto out_tile = outptr;
+        kernel_outptr += kernel_ld_out_row;
+        outptr += ld_out_row;
+
+        for (auto j = 0u; j < last_col; j++)
+        {
+          memcpy(out_tile, patch_tile, sizeof(TOut) * n_channels);
+          patch_tile += kernel_ld_out_col;
+          out_tile += ld_out_col;
+        }
+      }
+    }
+  }
+
+  public:
+  TransformQuantized(const std::string &name,
+                     unsigned int output_rows, unsigned int output_cols,
+                     unsigned int kernel_rows, unsigned int kernel_cols,
+                     const Kernel kernel)
+  : TransformBase<TIn, TOut>(name, output_rows, output_cols, kernel_rows, kernel_cols),
+    m_kernel(kernel)
+  {
+  }
+};
+
 }  // namespace output_transform
 }  // namespace winograd
 }  // namespace arm_conv
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "winograd.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace arm_conv {
+namespace winograd {
+namespace output_transform {
+
+/* Output transform of F(4x4, 3x3) for 8-bit quantized convolutions.
+ *
+ * As for F(2x2, 3x3), but for the larger tile.
+ */
+template <typename TOut>
+void cpp_q8_4x4_3x3(
+  const unsigned int n_channels,
+  const int32_t *const inptr,
+  const size_t matrix_stride,
+  const int32_t *const bptr,
+  TOut *const outptr,
+  const size_t output_row_stride,
+  const size_t output_col_stride,
+  const WinogradQuantization &qp
+)
+{
+  constexpr int inner_tile_rows = 6, inner_tile_cols = 6;
+  constexpr int output_tile_rows = 4, output_tile_cols = 4;
+  constexpr unsigned int block = 16;
+
+  const auto output_min = static_cast<float>(qp.minval);
+  const auto output_max = static_cast<float>(qp.maxval);
+  const auto output_offset = static_cast<float>(qp.output_offset);
+
+  // Matrices used/computed in this kernel.
+  float F[inner_tile_rows][inner_tile_cols][block];
+  float FZ[inner_tile_rows][output_tile_cols][block];
+  float f[output_tile_rows][output_tile_cols][block];
+  float b[block];
+
+  for (unsigned int c0 = 0; c0 < n_channels; c0 += block)
+  {
+    const unsigned int n = std::min(block, n_channels - c0);
+
+    // Read the tile in the Winograd domain, rescaling each point
+    for (int i = 0, m = 0; i < inner_tile_rows; i++)
+    {
+      for (int j = 0; j < inner_tile_cols; j++, m++)
+      {
+        const int32_t *const F_ptr = inptr + m*matrix_stride + c0;
+        const float scale = qp.point_scales[m];
+        for (unsigned int c = 0; c < n; c++)
+        {
+          F[i][j][c] = static_cast<float>(F_ptr[c]) * scale;
+        }
+      }
+    }
+
+    // Compute the matrix F Z
+    for (int i = 0; i < inner_tile_rows; i++)
+    {
+      for (unsigned int c = 0; c < n; c++)
+      {
+        FZ[i][0][c] = F[i][0][c] + F[i][1][c] + F[i][2][c] + F[i][3][c] + F[i][4][c];
+        FZ[i][1][c] = F[i][1][c] - F[i][2][c] + 2*F[i][3][c] - 2*F[i][4][c];
+        FZ[i][2][c] = F[i][1][c] + F[i][2][c] + 4*F[i][3][c] + 4*F[i][4][c];
+        FZ[i][3][c] = F[i][1][c] - F[i][2][c] + 8*F[i][3][c] - 8*F[i][4][c] + F[i][5][c];
+      }
+    }
+
+    // Compute the output tile f = ZT F Z
+    for (int j = 0; j < output_tile_cols; j++)
+    {
+      for (unsigned int c = 0; c < n; c++)
+      {
+        f[0][j][c] = FZ[0][j][c] + FZ[1][j][c] + FZ[2][j][c] + FZ[3][j][c] + FZ[4][j][c];
+        f[1][j][c] = FZ[1][j][c] - FZ[2][j][c] + 2*FZ[3][j][c] - 2*FZ[4][j][c];
+        f[2][j][c] = FZ[1][j][c] + FZ[2][j][c] + 4*FZ[3][j][c] + 4*FZ[4][j][c];
+        f[3][j][c] = FZ[1][j][c] - FZ[2][j][c] + 8*FZ[3][j][c] - 8*FZ[4][j][c] + FZ[5][j][c];
+      }
+    }
+
+    // Load the bias
+    for (unsigned int c = 0; c < n; c++)
+    {
+      b[c] = (bptr != nullptr) ? static_cast<float>(bptr[c0 + c]) : 0.0f;
+    }
+
+    // Requantize and write out the output tile
+    for (int i = 0; i < output_tile_rows; i++)
+    {
+      for (int j = 0; j < output_tile_cols; j++)
+      {
+        TOut *const y_ptr = outptr + i*output_row_stride + j*output_col_stride + c0;
+        for (unsigned int c = 0; c < n; c++)
+        {
+          const float y = (f[i][j][c] + b[c]) * qp.output_multipliers[c0 + c] + output_offset;
+          y_ptr[c] = static_cast<TOut>(std::round(std::min(std::max(y, output_min), output_max)));
+        }
+      }
+    }
+  }
+}
+
+template void cpp_q8_4x4_3x3(unsigned int, const int32_t *, size_t, const int32_t *, uint8_t *, size_t, size_t, const WinogradQuantization &);
+template void cpp_q8_4x4_3x3(unsigned int, const int32_t *, size_t, const int32_t *, int8_t *, size_t, size_t, const WinogradQuantization &);
+
+}  // namespace output_transform
+}  // namespace winograd
+}  // namespace arm_conv
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#if defined(__aarch64__)
+
+#include "output_transform.hpp"
+#include "winograd_implementations.hpp"
+
+#include <cstdint>
+
+namespace arm_conv {
+namespace winograd {
+namespace output_transform {
+
+template <typename TOut>
+void cpp_q8_4x4_3x3(unsigned int, const int32_t *, size_t, const int32_t *, TOut *, size_t, size_t, const WinogradQuantization &);
+template <typename TOut>
+void cpp_q8_2x2_3x3(unsigned int, const int32_t *, size_t, const int32_t *, TOut *, size_t, size_t, const WinogradQuantization &);
+
+#define IMPL(OUT_HEIGHT, OUT_WIDTH, KERN_HEIGHT, KERN_WIDTH, TYPE, NAME, FUNC) \
+  new TransformQuantized<int32_t, TYPE>(NAME, OUT_HEIGHT, OUT_WIDTH, KERN_HEIGHT, KERN_WIDTH, FUNC<TYPE>)
+
+static const TransformImplementation<int32_t, uint8_t> transforms_u8[] = {
+  { IMPL(4, 4, 3, 3, uint8_t, "cpp_u8q_4x4_3x3", cpp_q8_4x4_3x3), MethodConstraints::LargerShape },
+  { IMPL(2, 2, 3, 3, uint8_t, "cpp_u8q_2x2_3x3", cpp_q8_2x2_3x3) },
+  { nullptr }
+};
+
+static const TransformImplementation<int32_t, int8_t> transforms_s8[] = {
+  { IMPL(4, 4, 3, 3, int8_t, "cpp_s8q_4x4_3x3", cpp_q8_4x4_3x3), MethodConstraints::LargerShape },
+  { IMPL(2, 2, 3, 3, int8_t, "cpp_s8q_2x2_3x3", cpp_q8_2x2_3x3) },
+  { nullptr }
+};
+
+template <>
+const TransformImplementation<int32_t, uint8_t> *implementation_list(void)
+{
+  return transforms_u8;
+}
+
+template <>
+const TransformImplementation<int32_t, int8_t> *implementation_list(void)
+{
+  return transforms_s8;
+}
+
+}  // namespace output_transform
+}  // namespace winograd
+}  // namespace arm_conv
+
+#endif  // defined(__aarch64__)
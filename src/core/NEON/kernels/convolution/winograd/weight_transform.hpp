@@ -25,8 +25,13 @@
 #pragma once
 
 #include "winograd.hpp"
+#include "fixed_point.hpp"
+
 #include <algorithm>
+#include <cmath>
+#include <cstdlib>
 #include <functional>
+#include <vector>
 
 namespace arm_conv {
 namespace winograd {
@@ -140,6 +145,127 @@ class Transform : public ITransform
   }
 };
 
+/* Driver class for the transforms of 8-bit quantized weights.
+ *
+ * Kernels subtract the zero point and compute transformed weights which are
+ * exact integer multiples of the real ones. The driver then scales every
+ * Winograd point to the 16-bit range left by the transformed inputs, and
+ * records the scales for the output transform.
+ *
+ * The scales depend on all the weights, so the whole transform is executed by
+ * the first thread.
+ */
+template <typename TIn, typename TOut=int16_t>
+class TransformQuantized : public ITransform
+{
+  using Kernel = std::function<void(
+    unsigned int n_channels,  // Number of channels to transform
+    const TIn *inptr, size_t ld_in_row, size_t ld_in_col,
+    int32_t weight_offset,
+    int32_t *outptr, size_t ld_out_matrix
+  )>;
+
+  const std::string m_name;
+  const unsigned int m_kernel_rows, m_kernel_cols;
+  const unsigned int m_transformed_tile_rows, m_transformed_tile_cols;
+  const Kernel m_kernel;
+  const float m_kernel_scale;  // Ratio of the transformed weights computed by the kernel to the real ones
+  const unsigned int m_input_bits;  // Bits of the magnitude of the exact transformed inputs
+
+  void execute_internal(
+    const ConvolutionArgs &args,
+    const TIn *inptr, size_t ld_in_row, size_t ld_in_col, size_t ld_input_channel,
+    TOut *outptr, size_t ld_out_matrix, size_t ld_out_row
+  ) const
+  {
+    const auto &qp = *args.quantization;
+    const auto n_points = m_transformed_tile_rows * m_transformed_tile_cols;
+    std::vector<int32_t> transformed(n_points * args.n_output_channels);
+
+    // Find the largest magnitude of each Winograd point
+    std::vector<int32_t> max_magnitude(n_points, 0);
+    for (auto ic = 0u; ic < args.n_input_channels; ic++)
+    {
+      m_kernel(args.n_output_channels, inptr + ic * ld_input_channel, ld_in_row, ld_in_col,
+               qp.weight_offset, transformed.data(), args.n_output_channels);
+      for (auto p = 0u; p < n_points; p++)
+      {
+        for (auto oc = 0u; oc < args.n_output_channels; oc++)
+        {
+          max_magnitude[p] = std::max(max_magnitude[p], std::abs(transformed[p * args.n_output_channels + oc]));
+        }
+      }
+    }
+
+    // Scale down the points which don't fit in the bits left by the inputs
+    unsigned int input_shift, weight_bits;
+    get_fixed_point_bits(m_input_bits, args.n_input_channels, input_shift, weight_bits);
+    const int32_t max_weight = (1 << weight_bits) - 1;
+
+    std::vector<float> rescale(n_points);
+    for (auto p = 0u; p < n_points; p++)
+    {
+      const float scale = max_magnitude[p] > max_weight ? static_cast<float>(max_magnitude[p]) / max_weight : 1.0f;
+      rescale[p] = 1.0f / scale;
+      qp.point_scales[p] = scale * static_cast<float>(1 << input_shift) / m_kernel_scale;
+    }
+
+    for (auto ic = 0u; ic < args.n_input_channels; ic++)
+    {
+      m_kernel(args.n_output_channels, inptr + ic * ld_input_channel, ld_in_row, ld_in_col,
+               qp.weight_offset, transformed.data(), args.n_output_channels);
+      for (auto p = 0u; p < n_points; p++)
+      {
+        for (auto oc = 0u; oc < args.n_output_channels; oc++)
+        {
+          const auto value = std::lround(transformed[p * args.n_output_channels + oc] * rescale[p]);
+          outptr[p * ld_out_matrix + ic * ld_out_row + oc] =
+            static_cast<TOut>(std::max<long>(-max_weight, std::min<long>(max_weight, value)));
+        }
+      }
+    }
+  }
+
+  public:
+  TransformQuantized(
+    const std::string &name,
+    unsigned int kernel_rows, unsigned int kernel_cols,
+    unsigned int transformed_tile_rows, unsigned int transformed_tile_cols,
+    const Kernel kernel, float kernel_scale, unsigned int input_bits
+  )
+  : m_name(name),
+    m_kernel_rows(kernel_rows), m_kernel_cols(kernel_cols),
+    m_transformed_tile_rows(transformed_tile_rows), m_transformed_tile_cols(transformed_tile_cols),
+    m_kernel(kernel), m_kernel_scale(kernel_scale), m_input_bits(input_bits)
+  {
+  }
+
+  const std::string &get_name(void) const override { return m_name; }
+
+  unsigned int get_kernel_rows(void) const override { return m_kernel_rows; }
+  unsigned int get_kernel_cols(void) const override { return m_kernel_cols; }
+
+  unsigned int get_transformed_tile_rows(void) const override { return m_transformed_tile_rows; }
+  unsigned int get_transformed_tile_cols(void) const override { return m_transformed_tile_cols; }
+
+  void execute(
+    const ConvolutionArgs &args,
+    const void *inptr, size_t ld_in_row, size_t ld_in_col, size_t ld_input_channel,
+    void *outptr, size_t ld_out_matrix, size_t ld_out_row,
+    unsigned int thread_id, unsigned int
+  ) const override
+  {
+    if (thread_id == 0)
+    {
+      execute_internal(
+        args,
+        reinterpret_cast<const TIn *>(inptr), ld_in_row, ld_in_col, ld_input_channel,
+        reinterpret_cast<TOut *>(outptr), ld_out_matrix, ld_out_row
+      );
+    }
+  }
+};
+
 }  // namespace weight_transform
 }  // namespace winograd
 }  // namespace arm_conv
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+namespace arm_conv {
+namespace winograd {
+namespace weight_transform {
+
+/* Weight transform of F(2x2, 3x3) for 8-bit quantized weights.
+ *
+ * Computes the exact transform using 2G in place of G, so the transformed
+ * weights are 4 times the real ones.
+ */
+template <typename TIn>
+void cpp_q8_2x2_3x3(
+  unsigned int n_channels,
+  const TIn *inptr, const size_t ld_weight_row, const size_t ld_weight_col,
+  const int32_t weight_offset,
+  int32_t *outptr, const size_t matrix_stride
+)
+{
+  constexpr auto inner_tile_i = 4u;
+  constexpr auto inner_tile_j = 4u;
+
+  // For each output channel
+  for (; n_channels; n_channels--)
+  {
+    // Matrices used and computed in this kernel
+    int32_t w[3][3], Ww[inner_tile_i][3], V[inner_tile_i][inner_tile_j];
+
+    // Read weights, removing the zero point
+    for (int i = 0; i < 3; i++)
+    {
+      for (int j = 0; j < 3; j++)
+      {
+        w[i][j] = static_cast<int32_t>(*(inptr + i*ld_weight_row + j*ld_weight_col)) - weight_offset;
+      }
+    }
+
+    // Compute the matrix W w
+    for (int j = 0; j < 3; j++)
+    {
+      Ww[0][j] = 2*w[0][j];
+      Ww[1][j] = w[0][j] + w[1][j] + w[2][j];
+      Ww[2][j] = w[0][j] - w[1][j] + w[2][j];
+      Ww[3][j] = 2*w[2][j];
+    }
+
+    // Compute V = W w WT
+    for (auto i = 0u; i < inner_tile_i; i++)
+    {
+      V[i][0] = 2*Ww[i][0];
+      V[i][1] = Ww[i][0] + Ww[i][1] + Ww[i][2];
+      V[i][2] = Ww[i][0] - Ww[i][1] + Ww[i][2];
+      V[i][3] = 2*Ww[i][2];
+    }
+
+    // Store the transformed weights
+    for (auto i = 0u, m = 0u; i < inner_tile_i; i++)
+    {
+      for (auto j = 0u; j < inner_tile_j; j++, m++)
+      {
+        *(outptr + m*matrix_stride) = V[i][j];
+      }
+    }
+
+    inptr++;
+    outptr++;
+  }
+}
+
+template void cpp_q8_2x2_3x3(unsigned int, const uint8_t *, size_t, size_t, int32_t, int32_t *, size_t);
+template void cpp_q8_2x2_3x3(unsigned int, const int8_t *, size_t, size_t, int32_t, int32_t *, size_t);
+
+}  // namespace weight_transform
+}  // namespace winograd
+}  // namespace arm_conv
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#if defined(__aarch64__)
+
+#include "winograd_implementations.hpp"
+#include "weight_transform.hpp"
+
+#include <cstdint>
+
+namespace arm_conv {
+namespace winograd {
+namespace weight_transform {
+
+template <typename TIn>
+void cpp_q8_4x4_3x3(unsigned int, const TIn *, size_t, size_t, int32_t, int32_t *, size_t);
+template <typename TIn>
+void cpp_q8_2x2_3x3(unsigned int, const TIn *, size_t, size_t, int32_t, int32_t *, size_t);
+
+// The kernels compute 24G and 2G respectively in place of G
+#define IMPL(KERN_ROWS, KERN_COLS, TRANS_ROWS, TRANS_COLS, TYPE, NAME, KERN, SCALE, INPUT_BITS) \
+  new TransformQuantized<TYPE, int16_t>(NAME, KERN_ROWS, KERN_COLS, TRANS_ROWS, TRANS_COLS, KERN<TYPE>, SCALE, INPUT_BITS)
+
+static const TransformImplementation<uint8_t, int16_t> transforms_u8[] = {
+  { IMPL(3, 3, 6, 6, uint8_t, "cpp_u8q_4x4_3x3", cpp_q8_4x4_3x3, 576.0f, 15) },
+  { IMPL(3, 3, 4, 4, uint8_t, "cpp_u8q_2x2_3x3", cpp_q8_2x2_3x3, 4.0f, 10) },
+  { nullptr }
+};
+
+static const TransformImplementation<int8_t, int16_t> transforms_s8[] = {
+  { IMPL(3, 3, 6, 6, int8_t, "cpp_s8q_4x4_3x3", cpp_q8_4x4_3x3, 576.0f, 15) },
+  { IMPL(3, 3, 4, 4, int8_t, "cpp_s8q_2x2_3x3", cpp_q8_2x2_3x3, 4.0f, 10) },
+  { nullptr }
+};
+
+template <>
+const TransformImplementation<uint8_t, int16_t> *implementation_list(void)
+{
+  return transforms_u8;
+}
+
+template <>
+const TransformImplementation<int8_t, int16_t> *implementation_list(void)
+{
+  return transforms_s8;
+}
+
+}  // namespace weight_transform
+}  // namespace winograd
+}  // namespace arm_conv
+
+#endif  // defined(__aarch64__)
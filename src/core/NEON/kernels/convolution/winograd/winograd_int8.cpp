@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#if defined(__aarch64__)
+
+#include "winograd_implementations.hpp"
+
+#include <cstdint>
+
+namespace arm_conv {
+namespace winograd {
+
+// 8-bit inputs and weights are transformed into 16-bit matrices, which are
+// multiplied into 32-bit matrices.
+template bool get_implementation<uint8_t, uint8_t, uint8_t, int16_t, int32_t>(
+  WinogradImpl &,
+  const CPUInfo *,
+  const ConvolutionArgs &,
+  int max_threads,
+  bool fast_mode,
+  const WinogradConfig *,
+  const arm_gemm::GemmConfig *
+);
+
+template bool get_implementation<uint8_t, int8_t, uint8_t, int16_t, int32_t>(
+  WinogradImpl &,
+  const CPUInfo *,
+  const ConvolutionArgs &,
+  int max_threads,
+  bool fast_mode,
+  const WinogradConfig *,
+  const arm_gemm::GemmConfig *
+);
+
+template bool get_implementation<int8_t, int8_t, int8_t, int16_t, int32_t>(
+  WinogradImpl &,
+  const CPUInfo *,
+  const ConvolutionArgs &,
+  int max_threads,
+  bool fast_mode,
+  const WinogradConfig *,
+  const arm_gemm::GemmConfig *
+);
+
+}  // namespace winograd
+}  // namespace arm_conv
+
+#endif  // defined(__aarch64__)
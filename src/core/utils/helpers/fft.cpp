@@ -23,6 +23,10 @@
  */
 #include "src/core/utils/helpers/fft.h"
 
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstdint>
 #include <numeric>
 
 namespace arm_compute
@@ -31,6 +35,50 @@ namespace helpers
 {
 namespace fft
 {
+namespace
+{
+/** Angle 2 * pi * num / den, with the numerator reduced modulo the denominator first to keep the precision */
+double twiddle_angle(uint64_t num, uint64_t den)
+{
+    return 2.0 * M_PI * static_cast<double>(num % den) / static_cast<double>(den);
+}
+
+/** Mixed radix decimation in time DFT used to pre-compute constant spectra */
+void dft_recursive(const std::complex<double> *in, size_t stride, std::complex<double> *out, size_t n)
+{
+    if (n == 1)
+    {
+        out[0] = in[0];
+        return;
+    }
+
+    // Split on the smallest prime factor, falling back to a plain DFT for prime sizes
+    size_t p = 2;
+    while (n % p != 0)
+    {
+        ++p;
+    }
+    const size_t m = n / p;
+
+    for (size_t r = 0; r < p; ++r)
+    {
+        dft_recursive(in + r * stride, stride * p, out + r * m, m);
+    }
+
+    std::vector<std::complex<double>> res(n);
+    for (size_t k = 0; k < n; ++k)
+    {
+        std::complex<double> acc = 0;
+        for (size_t r = 0; r < p; ++r)
+        {
+            acc += out[r * m + k % m] * std::polar(1.0, -twiddle_angle(r * k, n));
+        }
+        res[k] = acc;
+    }
+    std::copy(res.begin(), res.end(), out);
+}
+} // namespace
+
 std::vector<unsigned int> decompose_stages(unsigned int N, const std::set<unsigned int> &supported_factors)
 {
     std::vector<unsigned int> stages;
@@ -120,6 +168,73 @@ std::vector<unsigned int> digit_reverse_indices(unsigned int N, const std::vecto
 
     return idx_digit_reverse;
 }
+
+unsigned int bluestein_convolution_size(unsigned int N, const std::set<unsigned int> &supported_factors)
+{
+    if (supported_factors.empty())
+    {
+        return 0;
+    }
+
+    // Note: sizes up to 4 * N always contain a power of two
+    for (unsigned int M = std::max(2 * N - 1, 2U); M <= 4 * N; ++M)
+    {
+        if (!decompose_stages(M, supported_factors).empty())
+        {
+            return M;
+        }
+    }
+    return 0;
+}
+
+std::vector<float> bluestein_chirp(unsigned int N, bool is_inverse)
+{
+    std::vector<float> chirp(2 * N);
+    const double       sign = is_inverse ? 1.0 : -1.0;
+
+    for (uint64_t n = 0; n < N; ++n)
+    {
+        // exp(sign * i * pi * n^2 / N) = exp(sign * i * 2 * pi * n^2 / (2 * N))
+        const double angle = sign * twiddle_angle(n * n, 2 * static_cast<uint64_t>(N));
+        chirp[2 * n]       = static_cast<float>(std::cos(angle));
+        chirp[2 * n + 1]   = static_cast<float>(std::sin(angle));
+    }
+
+    return chirp;
+}
+
+std::vector<float> bluestein_kernel_spectrum(unsigned int N, unsigned int M, bool is_inverse)
+{
+    std::vector<float> spectrum;
+
+    // Early exit in case the kernel does not fit the cyclic convolution
+    if (N == 0 || M < 2 * N - 1)
+    {
+        return spectrum;
+    }
+
+    // Kernel b[m] = conj(chirp[|m|]) for m in (-N, N), wrapped around M
+    const double                      sign = is_inverse ? -1.0 : 1.0;
+    std::vector<std::complex<double>> kernel(M);
+    for (uint64_t n = 0; n < N; ++n)
+    {
+        const auto value    = std::polar(1.0, sign * twiddle_angle(n * n, 2 * static_cast<uint64_t>(N)));
+        kernel[n]           = value;
+        kernel[(M - n) % M] = value;
+    }
+
+    std::vector<std::complex<double>> kernel_spectrum(M);
+    dft_recursive(kernel.data(), 1, kernel_spectrum.data(), M);
+
+    spectrum.resize(2 * M);
+    for (unsigned int m = 0; m < M; ++m)
+    {
+        spectrum[2 * m]     = static_cast<float>(kernel_spectrum[m].real());
+        spectrum[2 * m + 1] = static_cast<float>(kernel_spectrum[m].imag());
+    }
+
+    return spectrum;
+}
 } // namespace fft
 } // namespace helpers
 } // namespace arm_compute
@@ -49,6 +49,35 @@ std::vector<unsigned int> decompose_stages(unsigned int N, const std::set<unsign
  * @return A vector with the digit reverse indices. Will be empty if it failed.
  */
 std::vector<unsigned int> digit_reverse_indices(unsigned int N, const std::vector<unsigned int> &fft_stages);
+/** Calculate the length of the cyclic convolution used by the Bluestein algorithm
+ *
+ * @param N                 Input size of the FFT
+ * @param supported_factors Supported factors that can be used for decomposition.
+ *
+ * @return The smallest size greater or equal to 2 * N - 1 that can be decomposed with @p supported_factors.
+ *         Will be 0 if no such size exists.
+ */
+unsigned int bluestein_convolution_size(unsigned int N, const std::set<unsigned int> &supported_factors);
+/** Calculate the chirp sequence w[n] = exp(-i * pi * n^2 / N) of the Bluestein algorithm
+ *
+ * @param N          Input size of the FFT
+ * @param is_inverse True to compute the chirp of the inverse FFT, w[n] = exp(i * pi * n^2 / N)
+ *
+ * @return A vector with the N complex values of the chirp, interleaved as real and imaginary parts.
+ */
+std::vector<float> bluestein_chirp(unsigned int N, bool is_inverse);
+/** Calculate the spectrum of the convolution kernel of the Bluestein algorithm
+ *
+ * The kernel is the conjugate of the chirp, wrapped around a sequence of length M so that the
+ * cyclic convolution of length M computes the linear convolution with the chirp.
+ *
+ * @param N          Input size of the FFT
+ * @param M          Length of the cyclic convolution. Must be greater or equal to 2 * N - 1.
+ * @param is_inverse True to compute the kernel of the inverse FFT
+ *
+ * @return A vector with the M complex values of the forward DFT of the kernel, interleaved as real and imaginary parts.
+ */
+std::vector<float> bluestein_kernel_spectrum(unsigned int N, unsigned int M, bool is_inverse);
 } // namespace fft
 } // namespace helpers
 } // namespace arm_compute
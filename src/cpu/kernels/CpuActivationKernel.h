@@ -86,6 +86,17 @@ public:
         return _heuristics.scheduler_hint().split_dimension();
     }
 
+    /** Compute the execution window for a source whose dynamic dimensions differ from the configured ones.
+     *
+     * @param[in] src Source tensor info with the shape to run on.
+     *
+     * @return The execution window and the dimension in which the scheduler splits it.
+     */
+    std::pair<Window, size_t> compute_window(const ITensorInfo &src) const
+    {
+        return _heuristics.compute_window(src);
+    }
+
 private:
     ActivationLayerInfo                       _act_info{};
     std::string                               _name{};
@@ -304,6 +304,33 @@ CpuElementwiseKernel<CpuArithmeticKernel>::run_op(ITensorPack &tensors, const Wi
 template void
 CpuElementwiseKernel<CpuComparisonKernel>::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info);
 
+template <class Derived>
+size_t CpuElementwiseKernel<Derived>::estimate_bytes_accessed(const ITensorPack &tensors) const
+{
+    const ITensor *src0 = tensors.get_const_tensor(TensorType::ACL_SRC_0);
+    const ITensor *src1 = tensors.get_const_tensor(TensorType::ACL_SRC_1);
+    const ITensor *dst  = tensors.get_const_tensor(TensorType::ACL_DST);
+    if (src0 == nullptr || src1 == nullptr || dst == nullptr)
+    {
+        return 0;
+    }
+
+    // Every destination element reads an element of each source, including the broadcast ones
+    const size_t bytes_per_element =
+        src0->info()->element_size() + src1->info()->element_size() + dst->info()->element_size();
+    return dst->info()->tensor_shape().total_size() * bytes_per_element;
+}
+template size_t CpuElementwiseKernel<CpuArithmeticKernel>::estimate_bytes_accessed(const ITensorPack &tensors) const;
+template size_t CpuElementwiseKernel<CpuComparisonKernel>::estimate_bytes_accessed(const ITensorPack &tensors) const;
+
+template <class Derived>
+bool CpuElementwiseKernel<Derived>::partitions_by_window() const
+{
+    return true;
+}
+template bool CpuElementwiseKernel<CpuArithmeticKernel>::partitions_by_window() const;
+template bool CpuElementwiseKernel<CpuComparisonKernel>::partitions_by_window() const;
+
 template <class Derived>
 const char *CpuElementwiseKernel<Derived>::name() const
 {
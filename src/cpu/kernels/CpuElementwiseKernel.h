@@ -52,7 +52,9 @@ public:
 
     using ElementwiseFunction = void(const ITensor *, const ITensor *, ITensor *, const Window &);
     // Inherited methods overridden:
-    void run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    void   run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    size_t estimate_bytes_accessed(const ITensorPack &tensors) const override;
+    bool   partitions_by_window() const override;
 
     const char *name() const override;
 
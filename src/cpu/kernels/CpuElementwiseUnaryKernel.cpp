@@ -255,6 +255,24 @@ void CpuElementwiseUnaryKernel::run_op(ITensorPack &tensors, const Window &windo
     _run_method(src, dst, window, _op, _lut.get());
 }
 
+size_t CpuElementwiseUnaryKernel::estimate_bytes_accessed(const ITensorPack &tensors) const
+{
+    const ITensor *src = tensors.get_const_tensor(TensorType::ACL_SRC);
+    const ITensor *dst = tensors.get_const_tensor(TensorType::ACL_DST);
+    if (src == nullptr || dst == nullptr)
+    {
+        return 0;
+    }
+
+    // Every destination element reads an element of the source, the look-up table stays in the cache
+    return dst->info()->tensor_shape().total_size() * (src->info()->element_size() + dst->info()->element_size());
+}
+
+bool CpuElementwiseUnaryKernel::partitions_by_window() const
+{
+    return true;
+}
+
 const char *CpuElementwiseUnaryKernel::name() const
 {
     return _name.c_str();
@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/CpuGemmLowpDequantizeRowsKernel.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/WindowHelpers.h"
+
+#include <arm_neon.h>
+#include <algorithm>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+Status validate_arguments(const ITensorInfo *mm_result,
+                          const ITensorInfo *row_qinfo,
+                          const ITensorInfo *weights,
+                          const ITensorInfo *weights_sum,
+                          const ITensorInfo *bias,
+                          const ITensorInfo *dst)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(mm_result, row_qinfo, weights, weights_sum, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(mm_result, 1, DataType::S32);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(row_qinfo, 1, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(weights, 1, DataType::QASYMM8_SIGNED, DataType::QSYMM8,
+                                                         DataType::QSYMM8_PER_CHANNEL);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(weights_sum, 1, DataType::S32);
+
+    const unsigned int n = mm_result->dimension(0);
+
+    const std::vector<int32_t> weights_offset = weights->quantization_info().offset();
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(
+        std::any_of(weights_offset.begin(), weights_offset.end(), [](int32_t offset) { return offset != 0; }),
+        "Only symmetrically quantized weights are supported");
+    ARM_COMPUTE_RETURN_ERROR_ON(weights->quantization_info().scale().empty());
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(is_data_type_quantized_per_channel(weights->data_type()) &&
+                                        weights->quantization_info().scale().size() != n,
+                                    "Per channel weights must have one scale per output column");
+
+    TensorShape row_qinfo_shape = mm_result->tensor_shape();
+    row_qinfo_shape.set(0, 2);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(row_qinfo->tensor_shape(), row_qinfo_shape);
+    ARM_COMPUTE_RETURN_ERROR_ON(weights_sum->num_dimensions() > 1 || weights_sum->dimension(0) != n);
+
+    if (bias != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(bias, 1, DataType::F32);
+        ARM_COMPUTE_RETURN_ERROR_ON(bias->num_dimensions() > 1 || bias->dimension(0) != n);
+    }
+
+    if (dst->total_size() > 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(dst, 1, DataType::F32);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(mm_result, dst);
+    }
+
+    return Status{};
+}
+
+void dequantize_row(const int32_t *mm_result,
+                    const int32_t *weights_sum,
+                    const float   *weights_scale,
+                    const float   *bias,
+                    float         *dst,
+                    float          scale,
+                    int32_t        offset,
+                    int            len)
+{
+    int x = 0;
+    for (; x <= (len - 4); x += 4)
+    {
+        const int32_t *in  = mm_result + x;
+        const int32_t *sum = weights_sum + x;
+
+        // Remove the contribution of the row offset, which is the offset times the sum of the column
+        const int32x4_t   acc        = vmlsq_s32(vld1q_s32(in), vld1q_s32(sum), vdupq_n_s32(offset));
+        const float32x4_t dequantize = vmulq_n_f32(vld1q_f32(weights_scale + x), scale);
+        const float32x4_t b          = bias != nullptr ? vld1q_f32(bias + x) : vdupq_n_f32(0.f);
+        vst1q_f32(dst + x, vmlaq_f32(b, vcvtq_f32_s32(acc), dequantize));
+    }
+
+    for (; x < len; ++x)
+    {
+        const int32_t acc = mm_result[x] - offset * weights_sum[x];
+        dst[x]            = static_cast<float>(acc) * scale * weights_scale[x] + (bias != nullptr ? bias[x] : 0.f);
+    }
+}
+} // namespace
+
+void CpuGemmLowpDequantizeRowsKernel::configure(const ITensorInfo *mm_result,
+                                                const ITensorInfo *row_qinfo,
+                                                const ITensorInfo *weights,
+                                                const ITensorInfo *weights_sum,
+                                                const ITensorInfo *bias,
+                                                ITensorInfo       *dst)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(mm_result, row_qinfo, weights, weights_sum, dst);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(mm_result, row_qinfo, weights, weights_sum, bias, dst));
+
+    // Output auto initialization if not yet initialized
+    auto_init_if_empty(*dst, mm_result->clone()->set_data_type(DataType::F32));
+
+    // Expand a per tensor scale to all the columns, so that both kinds of weights share the same loop
+    const std::vector<float> scale = weights->quantization_info().scale();
+    if (is_data_type_quantized_per_channel(weights->data_type()))
+    {
+        _weights_scale = scale;
+    }
+    else
+    {
+        _weights_scale = std::vector<float>(mm_result->dimension(0), scale[0]);
+    }
+
+    // Each row is dequantized by a single thread, so dimension 0 is not split
+    Window win = calculate_max_window(*mm_result, Steps());
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    ICpuKernel::configure(win);
+}
+
+Status CpuGemmLowpDequantizeRowsKernel::validate(const ITensorInfo *mm_result,
+                                                 const ITensorInfo *row_qinfo,
+                                                 const ITensorInfo *weights,
+                                                 const ITensorInfo *weights_sum,
+                                                 const ITensorInfo *bias,
+                                                 const ITensorInfo *dst)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(mm_result, row_qinfo, weights, weights_sum, bias, dst));
+    return Status{};
+}
+
+void CpuGemmLowpDequantizeRowsKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel::window(), window);
+
+    const ITensor *mm_result   = tensors.get_const_tensor(TensorType::ACL_SRC_0);
+    const ITensor *row_qinfo   = tensors.get_const_tensor(TensorType::ACL_SRC_1);
+    const ITensor *weights_sum = tensors.get_const_tensor(TensorType::ACL_SRC_2);
+    const ITensor *bias        = tensors.get_const_tensor(TensorType::ACL_SRC_3);
+    ITensor       *dst         = tensors.get_tensor(TensorType::ACL_DST);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(mm_result, row_qinfo, weights_sum, dst);
+
+    const int len = static_cast<int>(mm_result->info()->dimension(0));
+
+    const auto *weights_sum_ptr =
+        reinterpret_cast<const int32_t *>(weights_sum->buffer() + weights_sum->info()->offset_first_element_in_bytes());
+    const float *bias_ptr = nullptr;
+    if (bias != nullptr)
+    {
+        bias_ptr = reinterpret_cast<const float *>(bias->buffer() + bias->info()->offset_first_element_in_bytes());
+    }
+
+    Iterator mm_result_it(mm_result, window);
+    Iterator row_qinfo_it(row_qinfo, window);
+    Iterator dst_it(dst, window);
+
+    execute_window_loop(
+        window,
+        [&](const Coordinates &)
+        {
+            const auto *qinfo = reinterpret_cast<const float *>(row_qinfo_it.ptr());
+            dequantize_row(reinterpret_cast<const int32_t *>(mm_result_it.ptr()), weights_sum_ptr,
+                           _weights_scale.data(), bias_ptr, reinterpret_cast<float *>(dst_it.ptr()), qinfo[0],
+                           static_cast<int32_t>(qinfo[1]), len);
+        },
+        mm_result_it, row_qinfo_it, dst_it);
+}
+
+const char *CpuGemmLowpDequantizeRowsKernel::name() const
+{
+    return "CpuGemmLowpDequantizeRowsKernel";
+}
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_CPUGEMMLOWPDEQUANTIZEROWSKERNEL_H
+#define ACL_SRC_CPU_KERNELS_CPUGEMMLOWPDEQUANTIZEROWSKERNEL_H
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Kernel to dequantize to F32 the int32 result of a matrix multiplication whose LHS rows were quantized by
+ * @ref CpuGemmLowpQuantizeRowsKernel and whose RHS is symmetrically quantized, per tensor or per channel
+ *
+ * The final result is:
+ *
+ * dst[i][k] = (mm_result[i][k] - offset[i] * weights_sum[k]) * scale[i] * weights_scale[k] + bias[k]
+ *
+ * where scale[i] and offset[i] are the quantization parameters of row i of the LHS and weights_sum[k] is
+ * the sum of column k of the RHS.
+ */
+class CpuGemmLowpDequantizeRowsKernel : public ICpuKernel<CpuGemmLowpDequantizeRowsKernel>
+{
+public:
+    /** Default constructor */
+    CpuGemmLowpDequantizeRowsKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuGemmLowpDequantizeRowsKernel);
+    /** Initialise the kernel's inputs and output.
+     *
+     * @param[in]  mm_result   Input tensor info containing the result of the matrix multiplication.
+     *                         Data type supported: S32
+     * @param[in]  row_qinfo   Input tensor info with the scale and offset of each row of the LHS, as computed by
+     *                         @ref CpuGemmLowpQuantizeRowsKernel. Data type supported: F32
+     * @param[in]  weights     RHS tensor info of the matrix multiplication, only used for its quantization info.
+     *                         Data type supported: QASYMM8_SIGNED/QSYMM8/QSYMM8_PER_CHANNEL, with a zero offset
+     * @param[in]  weights_sum Input row-vector of sums of all the entries in each column of the RHS.
+     *                         Data type supported: S32
+     * @param[in]  bias        Biases tensor info. Can be nullptr. Data type supported: F32
+     * @param[out] dst         Output tensor info. Data type supported: F32
+     */
+    void configure(const ITensorInfo *mm_result,
+                   const ITensorInfo *row_qinfo,
+                   const ITensorInfo *weights,
+                   const ITensorInfo *weights_sum,
+                   const ITensorInfo *bias,
+                   ITensorInfo       *dst);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuGemmLowpDequantizeRowsKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *mm_result,
+                           const ITensorInfo *row_qinfo,
+                           const ITensorInfo *weights,
+                           const ITensorInfo *weights_sum,
+                           const ITensorInfo *bias,
+                           const ITensorInfo *dst);
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+private:
+    std::vector<float> _weights_scale{}; // Scale of each column of the RHS
+};
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_CPUGEMMLOWPDEQUANTIZEROWSKERNEL_H
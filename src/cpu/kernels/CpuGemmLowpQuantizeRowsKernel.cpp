@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/CpuGemmLowpQuantizeRowsKernel.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/QuantizationInfo.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/core/utils/misc/Utility.h"
+
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/WindowHelpers.h"
+#include "src/core/NEON/NEAsymm.h"
+
+#include <arm_neon.h>
+#include <algorithm>
+#include <cmath>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+TensorShape compute_row_qinfo_shape(const ITensorInfo &src)
+{
+    TensorShape shape = src.tensor_shape();
+    shape.set(0, 2);
+    return shape;
+}
+
+Status validate_arguments(const ITensorInfo *src, const ITensorInfo *dst, const ITensorInfo *row_qinfo)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, dst, row_qinfo);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::F32);
+
+    if (dst->total_size() > 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(dst, 1, DataType::QASYMM8_SIGNED);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(src, dst);
+    }
+
+    if (row_qinfo->total_size() > 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(row_qinfo, 1, DataType::F32);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(row_qinfo->tensor_shape(), compute_row_qinfo_shape(*src));
+    }
+
+    return Status{};
+}
+
+inline float horizontal_min(float32x4_t v)
+{
+    float32x2_t res = vpmin_f32(vget_low_f32(v), vget_high_f32(v));
+    res             = vpmin_f32(res, res);
+    return vget_lane_f32(res, 0);
+}
+
+inline float horizontal_max(float32x4_t v)
+{
+    float32x2_t res = vpmax_f32(vget_low_f32(v), vget_high_f32(v));
+    res             = vpmax_f32(res, res);
+    return vget_lane_f32(res, 0);
+}
+
+void quantize_row(const float *src, int8_t *dst, float *row_qinfo, int len)
+{
+    // Start the range from 0 so that it is always included, and thus exactly representable
+    float32x4_t vmin = vdupq_n_f32(0.f);
+    float32x4_t vmax = vdupq_n_f32(0.f);
+
+    int x = 0;
+    for (; x <= (len - 4); x += 4)
+    {
+        const float32x4_t v = vld1q_f32(src + x);
+        vmin                = vminq_f32(vmin, v);
+        vmax                = vmaxq_f32(vmax, v);
+    }
+
+    float min = horizontal_min(vmin);
+    float max = horizontal_max(vmax);
+    for (; x < len; ++x)
+    {
+        min = std::min(min, src[x]);
+        max = std::max(max, src[x]);
+    }
+
+    const float   scale  = (max > min) ? (max - min) / 255.f : 1.f;
+    const int32_t offset = utility::clamp<int32_t>(-128 - static_cast<int32_t>(std::lround(min / scale)), -128, 127);
+
+    const UniformQuantizationInfo qinfo(scale, offset);
+
+    x = 0;
+    for (; x <= (len - 16); x += 16)
+    {
+        const float32x4x4_t v = {{
+            vld1q_f32(src + x),
+            vld1q_f32(src + x + 4),
+            vld1q_f32(src + x + 8),
+            vld1q_f32(src + x + 12),
+        }};
+        vst1q_s8(dst + x, vquantize_signed(v, qinfo));
+    }
+
+    for (; x < len; ++x)
+    {
+        dst[x] = quantize_qasymm8_signed(src[x], qinfo);
+    }
+
+    row_qinfo[0] = scale;
+    row_qinfo[1] = static_cast<float>(offset);
+}
+} // namespace
+
+void CpuGemmLowpQuantizeRowsKernel::configure(const ITensorInfo *src, ITensorInfo *dst, ITensorInfo *row_qinfo)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, dst, row_qinfo);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(src, dst, row_qinfo));
+
+    // Output auto initialization if not yet initialized
+    auto_init_if_empty(*dst, src->clone()->set_data_type(DataType::QASYMM8_SIGNED));
+    auto_init_if_empty(*row_qinfo, compute_row_qinfo_shape(*src), 1, DataType::F32);
+
+    // Each row is quantized by a single thread, so dimension 0 is not split
+    Window win = calculate_max_window(*src, Steps());
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    ICpuKernel::configure(win);
+}
+
+Status CpuGemmLowpQuantizeRowsKernel::validate(const ITensorInfo *src,
+                                               const ITensorInfo *dst,
+                                               const ITensorInfo *row_qinfo)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(src, dst, row_qinfo));
+    return Status{};
+}
+
+void CpuGemmLowpQuantizeRowsKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel::window(), window);
+
+    const ITensor *src       = tensors.get_const_tensor(TensorType::ACL_SRC);
+    ITensor       *dst       = tensors.get_tensor(TensorType::ACL_DST_0);
+    ITensor       *row_qinfo = tensors.get_tensor(TensorType::ACL_DST_1);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, dst, row_qinfo);
+
+    const int len = static_cast<int>(src->info()->dimension(0));
+
+    Iterator src_it(src, window);
+    Iterator dst_it(dst, window);
+    Iterator row_qinfo_it(row_qinfo, window);
+
+    execute_window_loop(
+        window,
+        [&](const Coordinates &)
+        {
+            quantize_row(reinterpret_cast<const float *>(src_it.ptr()), reinterpret_cast<int8_t *>(dst_it.ptr()),
+                         reinterpret_cast<float *>(row_qinfo_it.ptr()), len);
+        },
+        src_it, dst_it, row_qinfo_it);
+}
+
+const char *CpuGemmLowpQuantizeRowsKernel::name() const
+{
+    return "CpuGemmLowpQuantizeRowsKernel";
+}
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
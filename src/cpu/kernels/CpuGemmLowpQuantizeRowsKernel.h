@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_CPUGEMMLOWPQUANTIZEROWSKERNEL_H
+#define ACL_SRC_CPU_KERNELS_CPUGEMMLOWPQUANTIZEROWSKERNEL_H
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Kernel to quantize each row of a floating point matrix to QASYMM8_SIGNED with its own scale and offset
+ *
+ * The quantization parameters of a row are computed from its range, widened to include 0 so that 0 is exactly
+ * representable:
+ *
+ * scale  = (max(row) - min(row)) / 255
+ * offset = -128 - round(min(row) / scale)
+ *
+ * and are written along with the quantized row, as a pair of floats (scale, offset), to @p row_qinfo.
+ */
+class CpuGemmLowpQuantizeRowsKernel : public ICpuKernel<CpuGemmLowpQuantizeRowsKernel>
+{
+public:
+    /** Default constructor */
+    CpuGemmLowpQuantizeRowsKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuGemmLowpQuantizeRowsKernel);
+    /** Initialise the kernel's input and outputs.
+     *
+     * @param[in]  src       Input tensor info. Data type supported: F32
+     * @param[out] dst       Output tensor info with the quantized rows of @p src. Data type supported: QASYMM8_SIGNED
+     * @param[out] row_qinfo Output tensor info with the scale and offset of each row of @p src, stored along
+     *                       dimension 0. Shape: [2, src->dimension(1), ...]. Data type supported: F32
+     */
+    void configure(const ITensorInfo *src, ITensorInfo *dst, ITensorInfo *row_qinfo);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuGemmLowpQuantizeRowsKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *src, const ITensorInfo *dst, const ITensorInfo *row_qinfo);
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+};
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_CPUGEMMLOWPQUANTIZEROWSKERNEL_H
@@ -116,6 +116,13 @@ struct ScatterKernelDataTypeISASelectorData
     unsigned long       sme2_vector_length;
 };
 
+struct PagedMatMulKernelDataTypeISASelectorData
+{
+    DataType            dt;
+    DataType            cache_dt;
+    cpuinfo::CpuIsaInfo isa;
+};
+
 // Selector pointer types
 using DataTypeISASelectorPtr            = std::add_pointer<bool(const DataTypeISASelectorData &data)>::type;
 using DataTypeDataLayoutSelectorPtr     = std::add_pointer<bool(const DataTypeDataLayoutISASelectorData &data)>::type;
@@ -134,6 +141,8 @@ using SoftmaxKernelDataTypeISASelectorDataPtr =
     std::add_pointer<bool(const SoftmaxKernelDataTypeISASelectorData &data)>::type;
 using ScatterKernelDataTypeISASelectorDataPtr =
     std::add_pointer<bool(const ScatterKernelDataTypeISASelectorData &data)>::type;
+using PagedMatMulKernelDataTypeISASelectorDataPtr =
+    std::add_pointer<bool(const PagedMatMulKernelDataTypeISASelectorData &data)>::type;
 } // namespace kernels
 } // namespace cpu
 } // namespace arm_compute
@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/CpuLstmCellKernel.h"
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+
+#include "src/core/common/Registrars.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/WindowHelpers.h"
+#include "src/cpu/kernels/lstm_cell/list.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+static const std::vector<CpuLstmCellKernel::LstmCellKernel> available_kernels = {
+    {"neon_fp32_lstm_cell", [](const DataTypeISASelectorData &data) { return data.dt == DataType::F32; },
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_lstm_cell)},
+    {"neon_fp16_lstm_cell",
+     [](const DataTypeISASelectorData &data) { return data.dt == DataType::F16 && data.isa.fp16; },
+     REGISTER_FP16_NEON(arm_compute::cpu::neon_fp16_lstm_cell)},
+};
+
+Status validate_arguments(const ITensorInfo        *gates,
+                          const ITensorInfo        *recurrent_gates,
+                          const ITensorInfo        *cell_state_in,
+                          const ITensorInfo        *params,
+                          const ITensorInfo        *cell_state_out,
+                          const ITensorInfo        *output_state,
+                          const ITensorInfo        *scratch_buffer,
+                          const LSTMCellKernelInfo &info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(gates, cell_state_in, cell_state_out, output_state);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(gates);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(gates, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(gates, cell_state_in);
+
+    const auto *uk =
+        CpuLstmCellKernel::get_implementation(DataTypeISASelectorData{gates->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_RETURN_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    ARM_COMPUTE_RETURN_ERROR_ON(gates->num_dimensions() > 2);
+    ARM_COMPUTE_RETURN_ERROR_ON(cell_state_in->num_dimensions() > 2);
+
+    const unsigned int num_units   = cell_state_in->dimension(0);
+    const unsigned int num_batches = cell_state_in->dimension(1);
+    const unsigned int num_gates   = info.has_cifg ? 3 : 4;
+    const TensorShape  gates_shape(num_gates * num_units, num_batches);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(gates->tensor_shape(), gates_shape);
+
+    if (recurrent_gates != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(gates, recurrent_gates);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(gates, recurrent_gates);
+    }
+
+    const unsigned int num_rows = CpuLstmCellKernel::num_param_rows(info);
+    if (num_rows > 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(params);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(gates, params);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(params->tensor_shape(), TensorShape(num_units, num_rows));
+    }
+
+    // Validate in case of configured outputs
+    for (const ITensorInfo *dst : {cell_state_out, output_state})
+    {
+        if (dst->total_size() > 0)
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(gates, dst);
+            ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(cell_state_in, dst);
+        }
+    }
+    if (scratch_buffer != nullptr && scratch_buffer->total_size() > 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(gates, scratch_buffer);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(scratch_buffer->tensor_shape(), gates_shape);
+    }
+
+    return Status{};
+}
+} // namespace
+
+void CpuLstmCellKernel::configure(const ITensorInfo        *gates,
+                                  const ITensorInfo        *recurrent_gates,
+                                  const ITensorInfo        *cell_state_in,
+                                  const ITensorInfo        *params,
+                                  ITensorInfo              *cell_state_out,
+                                  ITensorInfo              *output_state,
+                                  ITensorInfo              *scratch_buffer,
+                                  const LSTMCellKernelInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(gates, cell_state_in, cell_state_out, output_state);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(gates, recurrent_gates, cell_state_in, params, cell_state_out,
+                                                  output_state, scratch_buffer, info));
+
+    auto_init_if_empty(*cell_state_out, *cell_state_in->clone());
+    auto_init_if_empty(*output_state, *cell_state_in->clone());
+    if (scratch_buffer != nullptr)
+    {
+        auto_init_if_empty(*scratch_buffer, *gates->clone());
+    }
+
+    const auto *uk =
+        CpuLstmCellKernel::get_implementation(DataTypeISASelectorData{gates->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_ERROR_ON_NULLPTR(uk);
+
+    _run_method = uk->ukernel;
+    _name       = std::string("CpuLstmCellKernel").append("/").append(uk->name);
+    _info       = info;
+
+    // Each batch is processed by a single thread, so that the layer normalization can be computed in one go
+    Window win = calculate_max_window(*cell_state_in, Steps());
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    ICpuKernel::configure(win);
+}
+
+Status CpuLstmCellKernel::validate(const ITensorInfo        *gates,
+                                   const ITensorInfo        *recurrent_gates,
+                                   const ITensorInfo        *cell_state_in,
+                                   const ITensorInfo        *params,
+                                   const ITensorInfo        *cell_state_out,
+                                   const ITensorInfo        *output_state,
+                                   const ITensorInfo        *scratch_buffer,
+                                   const LSTMCellKernelInfo &info)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(gates, recurrent_gates, cell_state_in, params, cell_state_out,
+                                                   output_state, scratch_buffer, info));
+    return Status{};
+}
+
+unsigned int CpuLstmCellKernel::num_param_rows(const LSTMCellKernelInfo &info)
+{
+    const unsigned int num_gates = info.has_cifg ? 3 : 4;
+    unsigned int       num_rows  = 0;
+    if (info.has_peephole)
+    {
+        num_rows += num_gates - 1;
+    }
+    if (info.use_layer_norm)
+    {
+        num_rows += 2 * num_gates;
+    }
+    return num_rows;
+}
+
+void CpuLstmCellKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(IKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_run_method == nullptr);
+
+    const ITensor *gates           = tensors.get_const_tensor(TensorType::ACL_SRC_0);
+    const ITensor *recurrent_gates = tensors.get_const_tensor(TensorType::ACL_SRC_1);
+    const ITensor *cell_state_in   = tensors.get_const_tensor(TensorType::ACL_SRC_2);
+    const ITensor *params          = tensors.get_const_tensor(TensorType::ACL_SRC_3);
+    ITensor       *cell_state_out  = tensors.get_tensor(TensorType::ACL_DST_0);
+    ITensor       *output_state    = tensors.get_tensor(TensorType::ACL_DST_1);
+    ITensor       *scratch_buffer  = tensors.get_tensor(TensorType::ACL_DST_2);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(gates, cell_state_in, cell_state_out, output_state);
+    ARM_COMPUTE_ERROR_ON(params == nullptr && num_param_rows(_info) > 0);
+
+    _run_method(gates, recurrent_gates, cell_state_in, params, cell_state_out, output_state, scratch_buffer, _info,
+                window);
+}
+
+const char *CpuLstmCellKernel::name() const
+{
+    return _name.c_str();
+}
+
+const std::vector<CpuLstmCellKernel::LstmCellKernel> &CpuLstmCellKernel::get_available_kernels()
+{
+    return available_kernels;
+}
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
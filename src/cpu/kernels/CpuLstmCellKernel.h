@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_CPULSTMCELLKERNEL_H
+#define ACL_SRC_CPU_KERNELS_CPULSTMCELLKERNEL_H
+
+#include "arm_compute/core/KernelDescriptors.h"
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Kernel computing the element-wise part of an LSTM cell from the output of its matrix multiplications
+ *
+ * The gates tensor holds, for each batch, the pre-activations of the gates [input, forget, cell, output] one after
+ * the other along dimension 0, the input gate being omitted with CIFG. Activations, peephole connections, layer
+ * normalization and cell clipping are applied in a single pass over the gates:
+ *
+ * -# forget_gate = sigmoid(norm(gates_f + recurrent_gates_f + cell_state_in * cell_to_forget_weights))
+ * -# input_gate  = 1 - forget_gate with CIFG, and is computed like the forget gate otherwise
+ * -# cell_state  = clip(act(norm(gates_c + recurrent_gates_c)) * input_gate + forget_gate * cell_state_in)
+ * -# output_gate = sigmoid(norm(gates_o + recurrent_gates_o + cell_state * cell_to_output_weights))
+ * -# output      = act(cell_state) * output_gate
+ *
+ * where norm(x) = mean_stddev_normalization(x) * layer_norm_weights + bias with layer normalization, and is the
+ * identity otherwise, the bias being then expected to be already added to the gates.
+ */
+class CpuLstmCellKernel : public ICpuKernel<CpuLstmCellKernel>
+{
+private:
+    using LstmCellKernelPtr = std::add_pointer<void(const ITensor *,
+                                                    const ITensor *,
+                                                    const ITensor *,
+                                                    const ITensor *,
+                                                    ITensor *,
+                                                    ITensor *,
+                                                    ITensor *,
+                                                    const LSTMCellKernelInfo &,
+                                                    const Window &)>::type;
+
+public:
+    CpuLstmCellKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuLstmCellKernel);
+    /** Configure kernel for a given list of arguments
+     *
+     * @param[in]  gates           Pre-activations of the gates with dimensions [num_gates * num_units, batch_size],
+     *                             where num_gates is 3 with CIFG and 4 otherwise. Data types supported: F16/F32.
+     * @param[in]  recurrent_gates (Optional) Pre-activations added to @p gates, for instance the contribution of the
+     *                             output state. Same shape as @p gates. Data type supported: same as @p gates
+     * @param[in]  cell_state_in   Cell state with dimensions [num_units, batch_size].
+     *                             Data type supported: same as @p gates
+     * @param[in]  params          (Optional) Rows of dimension [num_units] holding, in order, the peephole weights
+     *                             [input, forget, output], then the layer normalization weights and the biases
+     *                             [input, forget, cell, output]. The input gate rows are omitted with CIFG.
+     *                             Only needed with peephole or layer normalization, see @ref num_param_rows.
+     *                             Data type supported: same as @p gates
+     * @param[out] cell_state_out  New cell state. Same shape as @p cell_state_in, which it can alias.
+     *                             Data type supported: same as @p gates
+     * @param[out] output_state    Output of the cell with dimensions [num_units, batch_size].
+     *                             Data type supported: same as @p gates
+     * @param[out] scratch_buffer  (Optional) Activated gates [input, cell state, forget, output] with dimensions
+     *                             [num_gates * num_units, batch_size], the input gate being omitted with CIFG.
+     *                             Data type supported: same as @p gates
+     * @param[in]  info            Kernel descriptor
+     */
+    void configure(const ITensorInfo        *gates,
+                   const ITensorInfo        *recurrent_gates,
+                   const ITensorInfo        *cell_state_in,
+                   const ITensorInfo        *params,
+                   ITensorInfo              *cell_state_out,
+                   ITensorInfo              *output_state,
+                   ITensorInfo              *scratch_buffer,
+                   const LSTMCellKernelInfo &info);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuLstmCellKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo        *gates,
+                           const ITensorInfo        *recurrent_gates,
+                           const ITensorInfo        *cell_state_in,
+                           const ITensorInfo        *params,
+                           const ITensorInfo        *cell_state_out,
+                           const ITensorInfo        *output_state,
+                           const ITensorInfo        *scratch_buffer,
+                           const LSTMCellKernelInfo &info);
+    /** Number of rows of the parameters tensor expected for a given configuration
+     *
+     * @param[in] info Kernel descriptor
+     *
+     * @return the number of rows, 0 if the parameters tensor is not needed
+     */
+    static unsigned int num_param_rows(const LSTMCellKernelInfo &info);
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+    struct LstmCellKernel
+    {
+        const char                  *name;
+        const DataTypeISASelectorPtr is_selected;
+        LstmCellKernelPtr            ukernel;
+    };
+
+    static const std::vector<LstmCellKernel> &get_available_kernels();
+
+private:
+    LstmCellKernelPtr  _run_method{nullptr};
+    LSTMCellKernelInfo _info{};
+    std::string        _name{};
+};
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_CPULSTMCELLKERNEL_H
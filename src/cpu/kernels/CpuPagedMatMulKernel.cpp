@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/CpuPagedMatMulKernel.h"
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+
+#include "src/core/common/Registrars.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/cpu/kernels/paged_matmul/list.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+static const std::vector<CpuPagedMatMulKernel::PagedMatMulKernel> available_kernels = {
+    {"neon_fp32_paged_matmul",
+     [](const PagedMatMulKernelDataTypeISASelectorData &data)
+     { return data.dt == DataType::F32 && data.cache_dt == DataType::F32; },
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_paged_matmul)},
+    {"neon_fp32_qasymm8_signed_paged_matmul",
+     [](const PagedMatMulKernelDataTypeISASelectorData &data)
+     { return data.dt == DataType::F32 && data.cache_dt == DataType::QASYMM8_SIGNED; },
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_qasymm8_signed_paged_matmul)},
+    {"neon_fp16_paged_matmul",
+     [](const PagedMatMulKernelDataTypeISASelectorData &data)
+     { return data.dt == DataType::F16 && data.cache_dt == DataType::F16 && data.isa.fp16; },
+     REGISTER_FP16_NEON(arm_compute::cpu::neon_fp16_paged_matmul)},
+    {"neon_fp16_qasymm8_signed_paged_matmul",
+     [](const PagedMatMulKernelDataTypeISASelectorData &data)
+     { return data.dt == DataType::F16 && data.cache_dt == DataType::QASYMM8_SIGNED && data.isa.fp16; },
+     REGISTER_FP16_NEON(arm_compute::cpu::neon_fp16_qasymm8_signed_paged_matmul)},
+};
+
+TensorShape compute_paged_matmul_shape(const ITensorInfo &lhs,
+                                       const ITensorInfo &cache,
+                                       const ITensorInfo &block_table,
+                                       const MatMulInfo  &info)
+{
+    TensorShape shape = lhs.tensor_shape();
+    shape.set(0, info.adj_rhs() ? block_table.dimension(0) * cache.dimension(1) : cache.dimension(0));
+    return shape;
+}
+
+Status validate_arguments(const ITensorInfo *lhs,
+                          const ITensorInfo *cache,
+                          const ITensorInfo *block_table,
+                          const ITensorInfo *seq_lens,
+                          const ITensorInfo *dst,
+                          const MatMulInfo  &info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(lhs, cache, block_table, seq_lens, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(lhs);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(lhs, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(cache->data_type() != lhs->data_type() &&
+                                        cache->data_type() != DataType::QASYMM8_SIGNED,
+                                    "The cache must have the data type of lhs or be QASYMM8_SIGNED");
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(block_table, 1, DataType::S32);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(seq_lens, 1, DataType::S32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(info.adj_lhs(), "Transposed lhs is not supported");
+
+    const auto *uk = CpuPagedMatMulKernel::get_implementation(PagedMatMulKernelDataTypeISASelectorData{
+        lhs->data_type(), cache->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_RETURN_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    ARM_COMPUTE_RETURN_ERROR_ON(lhs->num_dimensions() > 4);
+    ARM_COMPUTE_RETURN_ERROR_ON(cache->num_dimensions() > 4);
+    ARM_COMPUTE_RETURN_ERROR_ON(block_table->num_dimensions() > 2);
+    ARM_COMPUTE_RETURN_ERROR_ON(seq_lens->num_dimensions() > 1);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(cache->dimension(0) > paged_matmul::max_head_size,
+                                    "Cache rows larger than 256 are not supported");
+
+    // Heads and batches
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(lhs->dimension(2) % cache->dimension(2) != 0,
+                                    "The number of lhs heads must be a multiple of the number of cache heads");
+    ARM_COMPUTE_RETURN_ERROR_ON(block_table->dimension(1) != lhs->dimension(3));
+    ARM_COMPUTE_RETURN_ERROR_ON(seq_lens->dimension(0) != lhs->dimension(3));
+
+    const size_t max_seq_len = block_table->dimension(0) * cache->dimension(1);
+    ARM_COMPUTE_RETURN_ERROR_ON(lhs->dimension(0) != (info.adj_rhs() ? cache->dimension(0) : max_seq_len));
+
+    // Validate in case of configured output
+    if (dst->total_size() > 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(lhs, dst);
+        const TensorShape dst_shape = compute_paged_matmul_shape(*lhs, *cache, *block_table, info);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(dst->tensor_shape(), dst_shape);
+    }
+
+    return Status{};
+}
+} // namespace
+
+void CpuPagedMatMulKernel::configure(const ITensorInfo *lhs,
+                                     const ITensorInfo *cache,
+                                     const ITensorInfo *block_table,
+                                     const ITensorInfo *seq_lens,
+                                     ITensorInfo       *dst,
+                                     const MatMulInfo  &info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(lhs, cache, block_table, seq_lens, dst);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(lhs, cache, block_table, seq_lens, dst, info));
+
+    const TensorShape dst_shape = compute_paged_matmul_shape(*lhs, *cache, *block_table, info);
+    auto_init_if_empty(*dst, lhs->clone()->set_tensor_shape(dst_shape));
+
+    const auto *uk = CpuPagedMatMulKernel::get_implementation(PagedMatMulKernelDataTypeISASelectorData{
+        lhs->data_type(), cache->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_ERROR_ON_NULLPTR(uk);
+
+    _run_method = uk->ukernel;
+    _name       = std::string("CpuPagedMatMulKernel").append("/").append(uk->name);
+    _adj_rhs    = info.adj_rhs();
+
+    // The rows of the left-hand side of a head are processed together, so that each row of the cache is loaded once.
+    // The columns of lhs * cache^T can be split over the entries of the block table, while lhs * cache reduces over
+    // all of them. The heads of all the batches are collapsed in dimension Z.
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, _adj_rhs ? block_table->dimension(0) : 1, 1));
+    win.set(Window::DimY, Window::Dimension(0, 1, 1));
+    win.set(Window::DimZ, Window::Dimension(0, lhs->dimension(2) * lhs->dimension(3), 1));
+    ICpuKernel::configure(win);
+}
+
+Status CpuPagedMatMulKernel::validate(const ITensorInfo *lhs,
+                                      const ITensorInfo *cache,
+                                      const ITensorInfo *block_table,
+                                      const ITensorInfo *seq_lens,
+                                      const ITensorInfo *dst,
+                                      const MatMulInfo  &info)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(lhs, cache, block_table, seq_lens, dst, info));
+    return Status{};
+}
+
+void CpuPagedMatMulKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(IKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_run_method == nullptr);
+
+    const ITensor *lhs         = tensors.get_const_tensor(TensorType::ACL_SRC_0);
+    const ITensor *cache       = tensors.get_const_tensor(TensorType::ACL_SRC_1);
+    const ITensor *block_table = tensors.get_const_tensor(TensorType::ACL_SRC_2);
+    const ITensor *seq_lens    = tensors.get_const_tensor(TensorType::ACL_SRC_3);
+    ITensor       *dst         = tensors.get_tensor(TensorType::ACL_DST);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(lhs, cache, block_table, seq_lens, dst);
+
+    _run_method(lhs, cache, block_table, seq_lens, dst, _adj_rhs, window);
+}
+
+const char *CpuPagedMatMulKernel::name() const
+{
+    return _name.c_str();
+}
+
+const std::vector<CpuPagedMatMulKernel::PagedMatMulKernel> &CpuPagedMatMulKernel::get_available_kernels()
+{
+    return available_kernels;
+}
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
@@ -436,6 +436,28 @@ void CpuPool2dKernel::run_op(ITensorPack &tensors, const Window &window, const T
     _run_method(src, dst, indices, _pool_info, window_src, window);
 }
 
+size_t CpuPool2dKernel::estimate_bytes_accessed(const ITensorPack &tensors) const
+{
+    const ITensor *src     = tensors.get_const_tensor(TensorType::ACL_SRC_0);
+    const ITensor *dst     = tensors.get_const_tensor(TensorType::ACL_DST_0);
+    const ITensor *indices = tensors.get_const_tensor(TensorType::ACL_DST_1);
+    if (src == nullptr || dst == nullptr)
+    {
+        return 0;
+    }
+
+    // Every destination element reads a pooling region of the source, which overlap when the stride is smaller than
+    // the pool size
+    const size_t bytes_per_element = _pool_size.area() * src->info()->element_size() + dst->info()->element_size();
+    const size_t indices_bytes     = (indices != nullptr) ? indices->info()->total_size() : 0;
+    return dst->info()->tensor_shape().total_size() * bytes_per_element + indices_bytes;
+}
+
+bool CpuPool2dKernel::partitions_by_window() const
+{
+    return true;
+}
+
 const char *CpuPool2dKernel::name() const
 {
     return _name.c_str();
@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/CpuScaledDotProductAttentionKernel.h"
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+
+#include "src/core/common/Registrars.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/cpu/kernels/sdpa/list.h"
+
+#include <cmath>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+static const std::vector<CpuScaledDotProductAttentionKernel::SdpaKernel> available_kernels = {
+    {"neon_fp32_sdpa", [](const DataTypeISASelectorData &data) { return data.dt == DataType::F32; },
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_sdpa)},
+    {"neon_fp16_sdpa", [](const DataTypeISASelectorData &data) { return data.dt == DataType::F16 && data.isa.fp16; },
+     REGISTER_FP16_NEON(arm_compute::cpu::neon_fp16_sdpa)},
+    {"neon_bf16_sdpa",
+     [](const DataTypeISASelectorData &data) { return data.dt == DataType::BFLOAT16 && data.isa.bf16; },
+     REGISTER_BF16_NEON(arm_compute::cpu::neon_bf16_sdpa)},
+};
+
+TensorShape compute_sdpa_shape(const ITensorInfo &query, const ITensorInfo &value)
+{
+    TensorShape shape = query.tensor_shape();
+    shape.set(0, value.dimension(0));
+    return shape;
+}
+
+Status validate_arguments(const ITensorInfo                   *query,
+                          const ITensorInfo                   *key,
+                          const ITensorInfo                   *value,
+                          const ITensorInfo                   *mask,
+                          const ITensorInfo                   *dst,
+                          const ScaledDotProductAttentionInfo &info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(query, key, value, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(query);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_BF16_UNSUPPORTED(query);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(query, 1, DataType::F16, DataType::F32, DataType::BFLOAT16);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(query, key, value);
+    ARM_COMPUTE_RETURN_ERROR_ON(info.scale() < 0.f);
+
+    const auto *uk = CpuScaledDotProductAttentionKernel::get_implementation(
+        DataTypeISASelectorData{query->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_RETURN_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    ARM_COMPUTE_RETURN_ERROR_ON(query->num_dimensions() > 4);
+    ARM_COMPUTE_RETURN_ERROR_ON(key->num_dimensions() > 4);
+    ARM_COMPUTE_RETURN_ERROR_ON(value->num_dimensions() > 4);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(query->dimension(0) > sdpa::max_head_size ||
+                                        value->dimension(0) > sdpa::max_head_size,
+                                    "Head sizes larger than 256 are not supported");
+
+    // Heads and batches
+    ARM_COMPUTE_RETURN_ERROR_ON(key->dimension(0) != query->dimension(0));
+    ARM_COMPUTE_RETURN_ERROR_ON(key->dimension(1) != value->dimension(1));
+    ARM_COMPUTE_RETURN_ERROR_ON(key->dimension(2) != value->dimension(2));
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(query->dimension(2) % key->dimension(2) != 0,
+                                    "The number of query heads must be a multiple of the number of key heads");
+    ARM_COMPUTE_RETURN_ERROR_ON(key->dimension(3) != query->dimension(3));
+    ARM_COMPUTE_RETURN_ERROR_ON(value->dimension(3) != query->dimension(3));
+
+    if (mask != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(query, mask);
+        ARM_COMPUTE_RETURN_ERROR_ON(mask->num_dimensions() > 4);
+        ARM_COMPUTE_RETURN_ERROR_ON(mask->dimension(0) != key->dimension(1));
+        ARM_COMPUTE_RETURN_ERROR_ON(mask->dimension(1) != query->dimension(1));
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(mask->dimension(2) != 1 && mask->dimension(2) != query->dimension(2),
+                                        "The mask must be broadcast over the heads or have one plane per head");
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(mask->dimension(3) != 1 && mask->dimension(3) != query->dimension(3),
+                                        "The mask must be broadcast over the batches or have one plane per batch");
+    }
+
+    // Validate in case of configured output
+    if (dst->total_size() > 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(query, dst);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(dst->tensor_shape(), compute_sdpa_shape(*query, *value));
+    }
+
+    return Status{};
+}
+} // namespace
+
+void CpuScaledDotProductAttentionKernel::configure(const ITensorInfo                   *query,
+                                                   const ITensorInfo                   *key,
+                                                   const ITensorInfo                   *value,
+                                                   const ITensorInfo                   *mask,
+                                                   ITensorInfo                         *dst,
+                                                   const ScaledDotProductAttentionInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(query, key, value, dst);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(query, key, value, mask, dst, info));
+
+    auto_init_if_empty(*dst, query->clone()->set_tensor_shape(compute_sdpa_shape(*query, *value)));
+
+    const auto *uk = CpuScaledDotProductAttentionKernel::get_implementation(
+        DataTypeISASelectorData{query->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_ERROR_ON_NULLPTR(uk);
+
+    _run_method = uk->ukernel;
+    _name       = std::string("CpuScaledDotProductAttentionKernel").append("/").append(uk->name);
+    _scale      = info.scale() > 0.f ? info.scale() : 1.f / std::sqrt(static_cast<float>(query->dimension(0)));
+    _is_causal  = info.is_causal();
+
+    // Each query is processed by a single thread against all the keys. The heads of all the batches are
+    // collapsed in dimension Z, so that the decoding of a single query can still be split across the heads.
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    win.set(Window::DimY, Window::Dimension(0, dst->dimension(1), 1));
+    win.set(Window::DimZ, Window::Dimension(0, dst->dimension(2) * dst->dimension(3), 1));
+    ICpuKernel::configure(win);
+}
+
+Status CpuScaledDotProductAttentionKernel::validate(const ITensorInfo                   *query,
+                                                    const ITensorInfo                   *key,
+                                                    const ITensorInfo                   *value,
+                                                    const ITensorInfo                   *mask,
+                                                    const ITensorInfo                   *dst,
+                                                    const ScaledDotProductAttentionInfo &info)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(query, key, value, mask, dst, info));
+    return Status{};
+}
+
+void CpuScaledDotProductAttentionKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(IKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_run_method == nullptr);
+
+    const ITensor *query = tensors.get_const_tensor(TensorType::ACL_SRC_0);
+    const ITensor *key   = tensors.get_const_tensor(TensorType::ACL_SRC_1);
+    const ITensor *value = tensors.get_const_tensor(TensorType::ACL_SRC_2);
+    const ITensor *mask  = tensors.get_const_tensor(TensorType::ACL_SRC_3);
+    ITensor       *dst   = tensors.get_tensor(TensorType::ACL_DST);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(query, key, value, dst);
+
+    _run_method(query, key, value, mask, dst, _scale, _is_causal, window);
+}
+
+const char *CpuScaledDotProductAttentionKernel::name() const
+{
+    return _name.c_str();
+}
+
+const std::vector<CpuScaledDotProductAttentionKernel::SdpaKernel> &
+CpuScaledDotProductAttentionKernel::get_available_kernels()
+{
+    return available_kernels;
+}
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_CPUSCALEDDOTPRODUCTATTENTIONKERNEL_H
+#define ACL_SRC_CPU_KERNELS_CPUSCALEDDOTPRODUCTATTENTIONKERNEL_H
+
+#include "arm_compute/function_info/ScaledDotProductAttentionInfo.h"
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Kernel to compute the scaled dot-product attention softmax(scale * Q * K^T + mask) * V
+ *
+ * The queries are processed in blocks against tiles of the keys and values, with an online softmax, so that
+ * the scores of all the queries against all the keys are never stored in memory.
+ */
+class CpuScaledDotProductAttentionKernel : public ICpuKernel<CpuScaledDotProductAttentionKernel>
+{
+private:
+    using SdpaKernelPtr = std::add_pointer<void(const ITensor *,
+                                                const ITensor *,
+                                                const ITensor *,
+                                                const ITensor *,
+                                                ITensor *,
+                                                float,
+                                                bool,
+                                                const Window &)>::type;
+
+public:
+    CpuScaledDotProductAttentionKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuScaledDotProductAttentionKernel);
+    /** Configure kernel for a given list of arguments
+     *
+     * @param[in]  query Query tensor info of shape [head_size, num_queries, num_heads, num_batches].
+     *                   Data types supported: F32/F16/BFLOAT16. The head size must not exceed 256.
+     * @param[in]  key   Key tensor info of shape [head_size, num_keys, num_kv_heads, num_batches], where num_heads
+     *                   is a multiple of num_kv_heads. Data type supported: same as @p query
+     * @param[in]  value Value tensor info of shape [value_head_size, num_keys, num_kv_heads, num_batches].
+     *                   Data type supported: same as @p query. The value head size must not exceed 256.
+     * @param[in]  mask  (Optional) Mask tensor info of shape [num_keys, num_queries, 1 or num_heads, 1 or num_batches],
+     *                   added to the scaled scores. Can be nullptr. Data type supported: same as @p query
+     * @param[out] dst   Destination tensor info of shape [value_head_size, num_queries, num_heads, num_batches].
+     *                   Data type supported: same as @p query
+     * @param[in]  info  Attention information, holding the scale of the scores and the causal mask flag
+     */
+    void configure(const ITensorInfo                   *query,
+                   const ITensorInfo                   *key,
+                   const ITensorInfo                   *value,
+                   const ITensorInfo                   *mask,
+                   ITensorInfo                         *dst,
+                   const ScaledDotProductAttentionInfo &info);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuScaledDotProductAttentionKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo                   *query,
+                           const ITensorInfo                   *key,
+                           const ITensorInfo                   *value,
+                           const ITensorInfo                   *mask,
+                           const ITensorInfo                   *dst,
+                           const ScaledDotProductAttentionInfo &info);
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+    struct SdpaKernel
+    {
+        const char                  *name;
+        const DataTypeISASelectorPtr is_selected;
+        SdpaKernelPtr                ukernel;
+    };
+
+    static const std::vector<SdpaKernel> &get_available_kernels();
+
+private:
+    SdpaKernelPtr _run_method{nullptr};
+    float         _scale{1.f};
+    bool          _is_causal{false};
+    std::string   _name{};
+};
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_CPUSCALEDDOTPRODUCTATTENTIONKERNEL_H
@@ -24,8 +24,16 @@
 #include "src/cpu/kernels/CpuScatterKernel.h"
 
 #include "arm_compute/core/Error.h"
+#include "arm_compute/core/ITensor.h"
 #include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
 
+#include "src/common/utils/Log.h"
+#include "src/core/common/Registrars.h"
+#include "src/core/CPP/Validate.h"
+#include "src/cpu/kernels/scatter/list.h"
+
+#include <algorithm>
 #include <vector>
 
 namespace arm_compute
@@ -36,12 +44,58 @@ namespace kernels
 {
 namespace
 {
+constexpr int max_index_length = 5;
 
 /* Scatter */
 static const std::vector<typename CpuScatterKernel::ScatterKernel> available_kernels = {
-
+    {"neon_fp32_scatter", [](const DataTypeISASelectorData &data) { return data.dt == DataType::F32; },
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_scatter)},
+    {"neon_fp16_scatter", [](const DataTypeISASelectorData &data) { return data.dt == DataType::F16 && data.isa.fp16; },
+     REGISTER_FP16_NEON(arm_compute::cpu::neon_fp16_scatter)},
+    {"neon_s32_scatter", [](const DataTypeISASelectorData &data) { return data.dt == DataType::S32; },
+     REGISTER_INTEGER_NEON(arm_compute::cpu::neon_s32_scatter)},
+    {"neon_s16_scatter", [](const DataTypeISASelectorData &data) { return data.dt == DataType::S16; },
+     REGISTER_INTEGER_NEON(arm_compute::cpu::neon_s16_scatter)},
+    {"neon_s8_scatter", [](const DataTypeISASelectorData &data) { return data.dt == DataType::S8; },
+     REGISTER_INTEGER_NEON(arm_compute::cpu::neon_s8_scatter)},
+    {"neon_u32_scatter", [](const DataTypeISASelectorData &data) { return data.dt == DataType::U32; },
+     REGISTER_INTEGER_NEON(arm_compute::cpu::neon_u32_scatter)},
+    {"neon_u16_scatter", [](const DataTypeISASelectorData &data) { return data.dt == DataType::U16; },
+     REGISTER_INTEGER_NEON(arm_compute::cpu::neon_u16_scatter)},
+    {"neon_u8_scatter", [](const DataTypeISASelectorData &data) { return data.dt == DataType::U8; },
+     REGISTER_INTEGER_NEON(arm_compute::cpu::neon_u8_scatter)},
 };
 
+/** Offset in bytes of the row @p row of a block spanning the dimensions [0, @p num_data_dims) of @p info */
+size_t block_row_offset(const ITensorInfo &info, size_t row, size_t num_data_dims)
+{
+    size_t offset = 0;
+    for (size_t d = 1; d < num_data_dims; ++d)
+    {
+        offset += (row % info.dimension(d)) * info.strides_in_bytes()[d];
+        row /= info.dimension(d);
+    }
+    return offset;
+}
+
+/** Whether the block spanning the dimensions [0, @p num_data_dims) of @p info is contiguous in memory */
+bool is_block_contiguous(const ITensorInfo &info, size_t num_data_dims)
+{
+    for (size_t d = 1; d < num_data_dims; ++d)
+    {
+        if (info.strides_in_bytes()[d] != info.strides_in_bytes()[d - 1] * info.dimension(d - 1))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/** Order the entries by destination, with the out of bounds entries last */
+bool dst_offset_less(const CpuScatterKernel::ScatterEntry &a, const CpuScatterKernel::ScatterEntry &b)
+{
+    return static_cast<uint64_t>(a.dst_offset) < static_cast<uint64_t>(b.dst_offset);
+}
 } // namespace
 
 const std::vector<typename CpuScatterKernel::ScatterKernel> &CpuScatterKernel::get_available_kernels()
@@ -49,43 +103,212 @@ const std::vector<typename CpuScatterKernel::ScatterKernel> &CpuScatterKernel::g
     return available_kernels;
 }
 
-void CpuScatterKernel::configure(const ITensorInfo *src,
-                                 const ITensorInfo *updates,
+void CpuScatterKernel::configure(const ITensorInfo *updates,
                                  const ITensorInfo *indices,
                                  ITensorInfo       *dst,
                                  const ScatterInfo &info)
 {
-    ARM_COMPUTE_UNUSED(src);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(updates, indices, dst);
     ARM_COMPUTE_UNUSED(updates);
-    ARM_COMPUTE_UNUSED(indices);
-    ARM_COMPUTE_UNUSED(dst);
-    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_LOG_PARAMS(updates, indices, dst, info);
+    ARM_COMPUTE_ERROR_THROW_ON(validate(updates, indices, dst, info));
 
-    ARM_COMPUTE_UNUSED(_run_method);
+    const auto *uk =
+        CpuScatterKernel::get_implementation(DataTypeISASelectorData{dst->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_ERROR_ON_NULLPTR(uk);
+
+    _run_method = uk->ukernel;
+    _name       = std::string("CpuScatterKernel").append("/").append(uk->name);
+    _function   = info.func;
+
+    // Each column of the indices tensor selects a block spanning the lowest data dimensions of dst
+    const size_t index_len = indices->dimension(0);
+    _num_data_dims         = dst->num_dimensions() - index_len;
+    _num_entries           = indices->tensor_shape().total_size_upper(1);
+
+    size_t block_size = 1;
+    for (size_t d = 0; d < _num_data_dims; ++d)
+    {
+        block_size *= dst->dimension(d);
+    }
+
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, block_size, 1));
+    win.set(Window::DimY, Window::Dimension(0, _num_entries, 1));
+    ICpuKernel::configure(win);
 }
 
-Status CpuScatterKernel::validate(const ITensorInfo *src,
-                                  const ITensorInfo *updates,
+Status CpuScatterKernel::validate(const ITensorInfo *updates,
                                   const ITensorInfo *indices,
                                   const ITensorInfo *dst,
                                   const ScatterInfo &info)
 {
-    ARM_COMPUTE_UNUSED(src);
-    ARM_COMPUTE_UNUSED(updates);
-    ARM_COMPUTE_UNUSED(indices);
-    ARM_COMPUTE_UNUSED(dst);
     ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(updates, indices, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(updates, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_NOT_IN(indices, DataType::S32);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_NOT_IN(dst, DataType::F32, DataType::F16, DataType::S32, DataType::S16,
+                                                 DataType::S8, DataType::U32, DataType::U16, DataType::U8);
+
+    const TensorShape &ind_shape = indices->tensor_shape();
+    const TensorShape &upt_shape = updates->tensor_shape();
+    const TensorShape &dst_shape = dst->tensor_shape();
+
+    const int32_t upt_dims  = upt_shape.num_dimensions();
+    const int32_t dst_dims  = dst_shape.num_dimensions();
+    const int32_t ind_dims  = ind_shape.num_dimensions();
+    const int32_t data_dim  = upt_dims - (ind_dims - 1); // Number of batch dims is the number of indices dims - 1
+    const int32_t index_len = ind_shape[0];
+
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG((ind_dims < 2), "Shape of Indices tensor must be at least 2D");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(index_len > max_index_length, "Maximum supported index length is 5!");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(
+        data_dim >= dst_dims, "Update tensor cannot have more dims than output tensor. (Excluding batch dimensions)");
+    ARM_COMPUTE_RETURN_ERROR_ON(data_dim < 0 || index_len != dst_dims - data_dim);
+
+    // Check data dims in update tensor and output tensor are equal
+    for (int32_t i = 0; i < data_dim; i++)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(upt_shape[i] != dst_shape[i],
+                                        "Data dims should be same size in both updates and ouput tensor.");
+    }
+
+    // Check if batch dims in indices and updates tensor are equal.
+    for (int32_t i = 0; i < ind_dims - 1; i++)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(upt_shape[data_dim + i] != ind_shape[i + 1],
+                                        "Batch dimensions should be the same in updates and indices tensor.");
+    }
 
-    return Status{ErrorCode::RUNTIME_ERROR, "No configuration implemented yet."};
+    return Status{};
+}
+
+void CpuScatterKernel::prepare_entries(const ITensor *updates,
+                                       const ITensor *indices,
+                                       const ITensor *dst,
+                                       ScatterEntry  *entries,
+                                       bool           group_by_destination) const
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(updates, indices, dst, entries);
+
+    const ITensorInfo &upt_info = *updates->info();
+    const ITensorInfo &ind_info = *indices->info();
+    const ITensorInfo &dst_info = *dst->info();
+
+    const size_t index_len = ind_info.dimension(0);
+    const size_t num_dims  = dst_info.num_dimensions();
+
+    for (size_t i = 0; i < _num_entries; ++i)
+    {
+        // The batch dimensions of the indices and updates tensors have the same shape
+        size_t ind_offset = ind_info.offset_first_element_in_bytes();
+        size_t upt_offset = upt_info.offset_first_element_in_bytes();
+        size_t batch      = i;
+        for (size_t d = 1; d < ind_info.num_dimensions(); ++d)
+        {
+            const size_t coord = batch % ind_info.dimension(d);
+            batch /= ind_info.dimension(d);
+            ind_offset += coord * ind_info.strides_in_bytes()[d];
+            upt_offset += coord * upt_info.strides_in_bytes()[_num_data_dims + d - 1];
+        }
+
+        // The first index selects the highest dimension of dst
+        const auto *index      = reinterpret_cast<const int32_t *>(indices->buffer() + ind_offset);
+        int64_t     dst_offset = dst_info.offset_first_element_in_bytes();
+        for (size_t j = 0; j < index_len; ++j)
+        {
+            const size_t dim = num_dims - 1 - j;
+            if (index[j] < 0 || index[j] >= static_cast<int32_t>(dst_info.dimension(dim)))
+            {
+                dst_offset = -1;
+                break;
+            }
+            dst_offset += index[j] * static_cast<int64_t>(dst_info.strides_in_bytes()[dim]);
+        }
+
+        entries[i] = {dst_offset, static_cast<int64_t>(upt_offset)};
+    }
+
+    // Sorted indices, and in particular unique sorted indices, need no reordering
+    if (group_by_destination && !std::is_sorted(entries, entries + _num_entries, dst_offset_less))
+    {
+        std::stable_sort(entries, entries + _num_entries, dst_offset_less);
+    }
+}
+
+size_t CpuScatterKernel::num_entries() const
+{
+    return _num_entries;
 }
 
 void CpuScatterKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
 {
-    ARM_COMPUTE_UNUSED(tensors);
-    ARM_COMPUTE_UNUSED(window);
     ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_run_method == nullptr);
+
+    const ITensor *updates = tensors.get_const_tensor(TensorType::ACL_SRC_0);
+    ITensor       *dst     = tensors.get_tensor(TensorType::ACL_DST);
+    ITensor       *scratch = tensors.get_tensor(TensorType::ACL_INT_0);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(updates, dst, scratch);
+
+    const ITensorInfo  &dst_info     = *dst->info();
+    const ITensorInfo  &upt_info     = *updates->info();
+    const size_t        element_size = dst_info.element_size();
+    const ScatterEntry *entries      = reinterpret_cast<const ScatterEntry *>(scratch->buffer());
+
+    // Blocks are processed as rows along dimension 0, or as a single row when neither tensor is padded
+    const size_t block_size = ICpuKernel::window().x().end();
+    const bool   contiguous =
+        is_block_contiguous(dst_info, _num_data_dims) && is_block_contiguous(upt_info, _num_data_dims);
+    const size_t row_len = (contiguous || _num_data_dims == 0) ? block_size : dst_info.dimension(0);
+
+    const size_t x_start = window.x().start();
+    const size_t x_end   = window.x().end();
+
+    // Only process the runs of entries with the same destination which start in this window
+    size_t start = window.y().start();
+    size_t end   = window.y().end();
+    while (start > 0 && start < _num_entries && entries[start].dst_offset == entries[start - 1].dst_offset)
+    {
+        ++start;
+    }
+    while (end > start && end < _num_entries && entries[end].dst_offset == entries[end - 1].dst_offset)
+    {
+        ++end;
+    }
+
+    for (size_t i = start; i < end; ++i)
+    {
+        const ScatterEntry &entry = entries[i];
+        if (entry.dst_offset < 0)
+        {
+            continue;
+        }
+
+        // Only the last of consecutive updates to the same block is visible
+        if (_function == ScatterFunction::Update && i + 1 < _num_entries &&
+            entries[i + 1].dst_offset == entry.dst_offset)
+        {
+            continue;
+        }
+
+        uint8_t       *dst_block = dst->buffer() + entry.dst_offset;
+        const uint8_t *upt_block = updates->buffer() + entry.updates_offset;
+        for (size_t row = x_start / row_len; row * row_len < x_end; ++row)
+        {
+            const size_t x0 = std::max(x_start, row * row_len) - row * row_len;
+            const size_t x1 = std::min(x_end, (row + 1) * row_len) - row * row_len;
+
+            const size_t dst_row = contiguous ? 0 : block_row_offset(dst_info, row, _num_data_dims);
+            const size_t upt_row = contiguous ? 0 : block_row_offset(upt_info, row, _num_data_dims);
 
-    ARM_COMPUTE_UNUSED(_run_method);
+            _run_method(dst_block + dst_row + x0 * element_size, upt_block + upt_row + x0 * element_size, x1 - x0,
+                        _function);
+        }
+    }
 }
 
 const char *CpuScatterKernel::name() const
@@ -29,60 +29,96 @@
 #include "src/core/common/Macros.h"
 #include "src/cpu/ICpuKernel.h"
 
+#include <cstdint>
+
 namespace arm_compute
 {
 namespace cpu
 {
 namespace kernels
 {
-/** Arm(R) Neon(TM) kernel to perform the ScatterND operation */
+/** Arm(R) Neon(TM) kernel to perform the ScatterND operation
+ *
+ * The kernel runs in two steps:
+ * -# @ref CpuScatterKernel::prepare_entries resolves the indices into the byte offsets of the destination and update
+ *    blocks. When the kernel is split along the entries, the entries are also stably sorted by destination, unless the
+ *    indices are already sorted.
+ * -# @ref CpuScatterKernel::run_op reduces the update blocks into the destination. Window::DimY iterates over the
+ *    entries and Window::DimX over the elements of a block. When the kernel is split along Window::DimY, a thread
+ *    processes the runs of entries with the same destination which start in its range, so the threads write to
+ *    disjoint blocks without atomics. When it is split along Window::DimX, every thread applies all
+ *    the entries to its own slice of the blocks.
+ *
+ * In both cases, the updates to a given element are applied in the order of the indices tensor.
+ */
 class CpuScatterKernel : public ICpuKernel<CpuScatterKernel>
 {
 private:
-    using ScatterKernelPtr = std::add_pointer<void(
-        const ITensor *, const ITensor *, const ITensor *, ITensor *, const ScatterInfo, const Window &)>::type;
+    using ScatterKernelPtr = std::add_pointer<void(uint8_t *, const uint8_t *, size_t, ScatterFunction)>::type;
 
 public:
+    /** Destination and update blocks of an entry of the indices tensor, as byte offsets from the tensor buffers */
+    struct ScatterEntry
+    {
+        int64_t dst_offset;     /**< Offset of the destination block, or -1 if the entry is out of bounds */
+        int64_t updates_offset; /**< Offset of the update block */
+    };
+
     CpuScatterKernel() = default;
     ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuScatterKernel);
     /** Initialise the kernel's input and output.
      *
-     * @param[in]  src     Input tensor info for the source matrix.
-     * @param[in]  updates Input tensor info for the Update matrix. Data type supported: same as @p src
-     * @param[in]  indices Input tensor info for the Indices matrix. Data type supported: U32.
-     * @param[out] dst     Output tensor info. Data type supported: same as @p src
+     * @param[in]  updates Input tensor info for the Update matrix. Data type supported: same as @p dst
+     * @param[in]  indices Input tensor info for the Indices matrix. Data type supported: S32.
+     * @param[in]  dst     Output tensor info. Data types supported: F32/F16/S32/S16/S8/U32/U16/U8.
      * @param[in]  info    Attributes for Scatter Kernel
      */
-    void configure(const ITensorInfo *src,
-                   const ITensorInfo *updates,
-                   const ITensorInfo *indices,
-                   ITensorInfo       *dst,
-                   const ScatterInfo &info);
+    void configure(const ITensorInfo *updates, const ITensorInfo *indices, ITensorInfo *dst, const ScatterInfo &info);
     /** Static function to check if given info will lead to a valid configuration
      *
      * Similar to @ref CpuScatterKernel::configure()
      *
      * @return a status
      */
-    static Status validate(const ITensorInfo *src,
-                           const ITensorInfo *updates,
-                           const ITensorInfo *indices,
-                           const ITensorInfo *dst,
-                           const ScatterInfo &info);
+    static Status
+    validate(const ITensorInfo *updates, const ITensorInfo *indices, const ITensorInfo *dst, const ScatterInfo &info);
+    /** Resolve the indices into the entries passed as ACL_INT_0 to @ref run_op
+     *
+     * @param[in]  updates               Update tensor.
+     * @param[in]  indices               Indices tensor.
+     * @param[in]  dst                   Destination tensor.
+     * @param[out] entries               Array of @ref num_entries() entries.
+     * @param[in]  group_by_destination  True if the kernel is going to be split along Window::DimY, in which case the
+     *                                   entries are stably sorted by destination.
+     */
+    void prepare_entries(const ITensor *updates,
+                         const ITensor *indices,
+                         const ITensor *dst,
+                         ScatterEntry  *entries,
+                         bool           group_by_destination) const;
+    /** Number of entries, i.e. of update blocks, in the indices tensor
+     *
+     * @return the number of entries
+     */
+    size_t num_entries() const;
 
     // Inherited methods overridden:
     void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
     const char *name() const override;
     struct ScatterKernel
     {
-        const char      *name;
-        ScatterKernelPtr ukernel;
+        const char                  *name;
+        const DataTypeISASelectorPtr is_selected;
+        ScatterKernelPtr             ukernel;
     };
 
     static const std::vector<ScatterKernel> &get_available_kernels();
 
 private:
     ScatterKernelPtr _run_method{nullptr};
+    ScatterFunction  _function{ScatterFunction::Update};
+    size_t           _num_data_dims{0};
+    size_t           _num_entries{0};
     std::string      _name{};
 };
 } // namespace kernels
@@ -191,33 +191,7 @@ void CpuSoftmaxKernel::configure(
     _run_method = uk->ukernel;
     _name       = kernel_name.append("/").append(uk->name);
 
-    Window win;
-
-    int vec_size = 16 / dst->element_size();
-
-    if (_axis == 0)
-    {
-        win = calculate_max_window(*dst, Steps());
-
-        /// TODO:Check dimensions > 0 for holes only. For this, we need
-        /// a utility function checking if there are holes after some dimension.
-        if (!has_holes(*dst, dst->num_dimensions() - 1))
-        {
-            win = win.collapse(win, Window::DimY);
-        }
-    }
-    else if (_axis > 0 && _axis <= 3)
-    {
-        win = calculate_max_window(*dst, Steps(vec_size));
-    }
-    else
-    {
-        ARM_COMPUTE_ERROR("Invalid axis");
-    }
-
-    win.set(_axis, Window::Dimension(0, 1, 1));
-
-    ICpuKernel<CpuSoftmaxKernel>::configure(win);
+    ICpuKernel<CpuSoftmaxKernel>::configure(compute_window(*dst));
 
 #ifdef __aarch64__
     const std::string uk_name = uk->name;
@@ -242,6 +216,37 @@ void CpuSoftmaxKernel::configure(
 #endif // __aarch64__
 }
 
+Window CpuSoftmaxKernel::compute_window(const ITensorInfo &dst) const
+{
+    Window win;
+
+    int vec_size = 16 / dst.element_size();
+
+    if (_axis == 0)
+    {
+        win = calculate_max_window(dst, Steps());
+
+        /// TODO:Check dimensions > 0 for holes only. For this, we need
+        /// a utility function checking if there are holes after some dimension.
+        if (!has_holes(dst, dst.num_dimensions() - 1))
+        {
+            win = win.collapse(win, Window::DimY);
+        }
+    }
+    else if (_axis > 0 && _axis <= 3)
+    {
+        win = calculate_max_window(dst, Steps(vec_size));
+    }
+    else
+    {
+        ARM_COMPUTE_ERROR("Invalid axis");
+    }
+
+    win.set(_axis, Window::Dimension(0, 1, 1));
+
+    return win;
+}
+
 Status CpuSoftmaxKernel::validate(
     const ITensorInfo *src, const ITensorInfo *dst, float beta, int axis, bool is_log, const ITensorInfo *tmp)
 {
@@ -64,6 +64,15 @@ public:
      */
     static Status
     validate(const ITensorInfo *src, const ITensorInfo *dst, float beta, int axis, bool is_log, const ITensorInfo *tmp);
+    /** Compute the execution window for a destination of a given shape
+     *
+     * Used to run on tensors whose dynamic dimensions differ from the configured ones.
+     *
+     * @param[in] dst Destination tensor info with the shape to run on.
+     *
+     * @return The execution window
+     */
+    Window compute_window(const ITensorInfo &dst) const;
 
     // Inherited methods overridden:
     void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/CpuTopKKernel.h"
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+
+#include "src/core/common/Registrars.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/Utils.h"
+#include "src/core/helpers/WindowHelpers.h"
+#include "src/cpu/kernels/topk/list.h"
+
+#include <algorithm>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+// Size in bytes of a candidate: its value, padded to 4 bytes, and its index
+constexpr size_t candidate_size = 2 * sizeof(int32_t);
+
+static const std::vector<CpuTopKKernel::TopKKernel> available_kernels = {
+    {"neon_fp32_topk", [](const DataTypeISASelectorData &data) { return data.dt == DataType::F32; },
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_topk)},
+    {"neon_fp16_topk", [](const DataTypeISASelectorData &data) { return data.dt == DataType::F16 && data.isa.fp16; },
+     REGISTER_FP16_NEON(arm_compute::cpu::neon_fp16_topk)},
+    {"neon_qu8_topk", [](const DataTypeISASelectorData &data) { return data.dt == DataType::QASYMM8; },
+     REGISTER_QASYMM8_NEON(arm_compute::cpu::neon_qasymm8_topk)},
+    {"neon_qs8_topk", [](const DataTypeISASelectorData &data) { return data.dt == DataType::QASYMM8_SIGNED; },
+     REGISTER_QASYMM8_SIGNED_NEON(arm_compute::cpu::neon_qasymm8_signed_topk)},
+};
+
+TensorShape compute_topk_shape(const ITensorInfo &src, unsigned int k)
+{
+    TensorShape shape = src.tensor_shape();
+    shape.set(0, k);
+    return shape;
+}
+
+Status validate_arguments(const ITensorInfo *src, const ITensorInfo *values, const ITensorInfo *indices, unsigned int k)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, values, indices);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(src);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::QASYMM8, DataType::QASYMM8_SIGNED,
+                                                         DataType::F16, DataType::F32);
+
+    const auto *uk =
+        CpuTopKKernel::get_implementation(DataTypeISASelectorData{src->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_RETURN_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(k == 0 || k > src->dimension(0), "k must be in the range [1, src->dimension(0)]");
+
+    // Validate in case of configured outputs
+    if (values->total_size() > 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, values);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_QUANTIZATION_INFO(src, values);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(values->tensor_shape(), compute_topk_shape(*src, k));
+    }
+    if (indices->total_size() > 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(indices, 1, DataType::S32);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(indices->tensor_shape(), compute_topk_shape(*src, k));
+    }
+
+    return Status{};
+}
+} // namespace
+
+void CpuTopKKernel::configure(
+    const ITensorInfo *src, ITensorInfo *values, ITensorInfo *indices, unsigned int k, bool sorted)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, values, indices);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(src, values, indices, k));
+
+    const TensorShape dst_shape = compute_topk_shape(*src, k);
+    auto_init_if_empty(*values, dst_shape, 1, src->data_type(), src->quantization_info());
+    auto_init_if_empty(*indices, dst_shape, 1, DataType::S32);
+
+    const auto *uk =
+        CpuTopKKernel::get_implementation(DataTypeISASelectorData{src->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_ERROR_ON_NULLPTR(uk);
+
+    _run_method = uk->ukernel;
+    _name       = std::string("CpuTopKKernel").append("/").append(uk->name);
+    _k          = k;
+    _sorted     = sorted;
+
+    // The candidates buffer holds at least twice the selected values, so that the partial selection run when it is
+    // full is amortised over many elements, and never more than a whole row
+    _capacity = std::min<unsigned int>(std::max(2 * k, k + 1024), src->dimension(0));
+
+    // Each row is processed by a single thread, so dimension 0 is not split. The rows of all the higher dimensions are
+    // collapsed into dimension 1 when possible so that they can all be split among the threads.
+    Window win = calculate_max_window(*src, Steps());
+    if (!has_holes(*src) && !has_holes(*values) && !has_holes(*indices))
+    {
+        win = win.collapse(win, Window::DimY);
+    }
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    ICpuKernel::configure(win);
+}
+
+Status CpuTopKKernel::validate(
+    const ITensorInfo *src, const ITensorInfo *values, const ITensorInfo *indices, unsigned int k, bool sorted)
+{
+    ARM_COMPUTE_UNUSED(sorted);
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(src, values, indices, k));
+    return Status{};
+}
+
+size_t CpuTopKKernel::get_scratch_size_per_thread() const
+{
+    return _capacity * candidate_size;
+}
+
+void CpuTopKKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(IKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_run_method == nullptr);
+
+    const ITensor *src     = tensors.get_const_tensor(TensorType::ACL_SRC);
+    ITensor       *values  = tensors.get_tensor(TensorType::ACL_DST_0);
+    ITensor       *indices = tensors.get_tensor(TensorType::ACL_DST_1);
+    ITensor       *scratch = tensors.get_tensor(TensorType::ACL_INT_0);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, values, indices, scratch);
+
+    // Checked in all builds, as a thread past the end of the scratch would write out of bounds
+    if ((info.thread_id + 1) * get_scratch_size_per_thread() > scratch->info()->total_size())
+    {
+        ARM_COMPUTE_ERROR("Scratch buffer too small for the number of threads");
+    }
+    void *scratch_for_thread = scratch->buffer() + info.thread_id * get_scratch_size_per_thread();
+    _run_method(src, values, indices, scratch_for_thread, _capacity, _k, _sorted, window);
+}
+
+const char *CpuTopKKernel::name() const
+{
+    return _name.c_str();
+}
+
+const std::vector<CpuTopKKernel::TopKKernel> &CpuTopKKernel::get_available_kernels()
+{
+    return available_kernels;
+}
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_CPUTOPKKERNEL_H
+#define ACL_SRC_CPU_KERNELS_CPUTOPKKERNEL_H
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Kernel to select the k largest values of each row of a tensor, along with their indices */
+class CpuTopKKernel : public ICpuKernel<CpuTopKKernel>
+{
+private:
+    using TopKKernelPtr = std::add_pointer<void(
+        const ITensor *, ITensor *, ITensor *, void *, unsigned int, unsigned int, bool, const Window &)>::type;
+
+public:
+    CpuTopKKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuTopKKernel);
+    /** Configure kernel for a given list of arguments
+     *
+     * @param[in]  src     Source tensor info. Data types supported: QASYMM8/QASYMM8_SIGNED/F16/F32.
+     * @param[out] values  Destination tensor info of the k largest values of each row of @p src.
+     *                     Data type supported: same as @p src
+     * @param[out] indices Destination tensor info of the indices of @p values in the rows of @p src.
+     *                     Data type supported: S32
+     * @param[in]  k       Number of values to select in each row, in the range [1, src->dimension(0)]
+     * @param[in]  sorted  True to return the values in descending order, false to return them in the order of the row.
+     *                     Equal values are ordered by index in both cases.
+     */
+    void configure(const ITensorInfo *src, ITensorInfo *values, ITensorInfo *indices, unsigned int k, bool sorted);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuTopKKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(
+        const ITensorInfo *src, const ITensorInfo *values, const ITensorInfo *indices, unsigned int k, bool sorted);
+    /** Size in bytes of the scratch buffer needed by each thread, passed as ACL_INT_0 to @ref run_op
+     *
+     * @return the scratch size in bytes
+     */
+    size_t get_scratch_size_per_thread() const;
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+    struct TopKKernel
+    {
+        const char                  *name;
+        const DataTypeISASelectorPtr is_selected;
+        TopKKernelPtr                ukernel;
+    };
+
+    static const std::vector<TopKKernel> &get_available_kernels();
+
+private:
+    TopKKernelPtr _run_method{nullptr};
+    unsigned int  _k{0};
+    unsigned int  _capacity{0};
+    bool          _sorted{true};
+    std::string   _name{};
+};
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_CPUTOPKKERNEL_H
@@ -743,15 +743,8 @@ void CpuTransposeKernel::configure(const ITensorInfo *src, ITensorInfo *dst)
     // Perform validation step
     ARM_COMPUTE_ERROR_THROW_ON(validate(src, dst));
 
-    // Note: This kernel performs 16 elements per iteration.
-    // However, since we use a left-over for loop on both dimensions (X and Y), we cannot have any read or write out of memory
-    // For this reason num_elems_processed_per_iteration_x is set to 1
-    const unsigned int num_elems_processed_per_iteration_x = 1;
-    const unsigned int num_elems_processed_per_iteration_y = num_elems_processed(src->element_size());
-
     // Configure kernel window
-    Window win =
-        calculate_max_window(*src, Steps(num_elems_processed_per_iteration_x, num_elems_processed_per_iteration_y));
+    Window win = compute_window(*src);
 
     // The CpuTranspose doesn't need padding so update_window_and_padding() can be skipped
     Coordinates coord;
@@ -761,6 +754,17 @@ void CpuTransposeKernel::configure(const ITensorInfo *src, ITensorInfo *dst)
     ICpuKernel::configure(win);
 }
 
+Window CpuTransposeKernel::compute_window(const ITensorInfo &src)
+{
+    // Note: This kernel performs 16 elements per iteration.
+    // However, since we use a left-over for loop on both dimensions (X and Y), we cannot have any read or write out of memory
+    // For this reason num_elems_processed_per_iteration_x is set to 1
+    const unsigned int num_elems_processed_per_iteration_x = 1;
+    const unsigned int num_elems_processed_per_iteration_y = num_elems_processed(src.element_size());
+
+    return calculate_max_window(src, Steps(num_elems_processed_per_iteration_x, num_elems_processed_per_iteration_y));
+}
+
 Status CpuTransposeKernel::validate(const ITensorInfo *src, const ITensorInfo *dst)
 {
     ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src);
@@ -52,6 +52,15 @@ public:
      * @return a status
      */
     static Status validate(const ITensorInfo *src, const ITensorInfo *dst);
+    /** Compute the execution window for a source of a given shape
+     *
+     * Used to run on tensors whose dynamic dimensions differ from the configured ones.
+     *
+     * @param[in] src Source tensor info with the shape to run on.
+     *
+     * @return The execution window
+     */
+    static Window compute_window(const ITensorInfo &src);
 
     // Inherited methods overridden:
     void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
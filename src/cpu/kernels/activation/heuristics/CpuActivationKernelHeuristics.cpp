@@ -190,14 +190,8 @@ CpuActivationKernelHeuristics::CpuActivationKernelHeuristics(const ITensorInfo
     choose_kernel(selector);
 
     // Set window and scheduling hint
-    int split_dim;
-    std::tie(_window, split_dim) = calculate_squashed_or_max_window(*src);
-
-    // Collapse window with SME kernels in Y-Dim
-    if (std::string(_kernel->name) == "sme2_fp32_logistic")
-    {
-        _window = _window.collapse(_window, Window::DimY);
-    }
+    size_t split_dim;
+    std::tie(_window, split_dim) = compute_window(*src);
 
     _hint = IScheduler::Hints(split_dim);
 
@@ -237,6 +231,20 @@ const CpuActivationKernelHeuristics::ActivationKernel *CpuActivationKernelHeuris
     return _kernel;
 }
 
+std::pair<Window, size_t> CpuActivationKernelHeuristics::compute_window(const ITensorInfo &src) const
+{
+    Window win;
+    size_t split_dim;
+    std::tie(win, split_dim) = calculate_squashed_or_max_window(src);
+
+    // Collapse window with SME kernels in Y-Dim
+    if (std::string(_kernel->name) == "sme2_fp32_logistic")
+    {
+        win = win.collapse(win, Window::DimY);
+    }
+    return std::make_pair(win, split_dim);
+}
+
 /** Return the scheduling hint e.g. dimension(s) to split
  *
  * @return an instance of @ref IScheduler::Hints to describe the scheduling hints
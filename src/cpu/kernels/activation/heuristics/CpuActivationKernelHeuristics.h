@@ -91,6 +91,16 @@ public:
      */
     const IScheduler::Hints &scheduler_hint() const;
 
+    /** Compute the execution window of the chosen kernel for a given source
+     *
+     * Used to run the kernel on a source whose dynamic dimensions differ from the configured ones.
+     *
+     * @param[in] src Source tensor info
+     *
+     * @return the execution window and the dimension in which the scheduler splits it
+     */
+    std::pair<Window, size_t> compute_window(const ITensorInfo &src) const;
+
 private:
     /** Chooses a kernel to run and saves it into _kernel data member
      *
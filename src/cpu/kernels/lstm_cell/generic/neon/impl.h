@@ -0,0 +1,403 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_LSTM_CELL_GENERIC_NEON_IMPL_H
+#define ACL_SRC_CPU_KERNELS_LSTM_CELL_GENERIC_NEON_IMPL_H
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/KernelDescriptors.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/core/NEON/NEMath.h"
+
+#include <arm_neon.h>
+#include <algorithm>
+#include <cmath>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace lstm_cell
+{
+/** Gates of the cell, in the order they are stored in the gates tensors */
+enum Gate
+{
+    INPUT  = 0,
+    FORGET = 1,
+    CELL   = 2,
+    OUTPUT = 3
+};
+
+/** Number of values computed per iteration */
+constexpr int step = 4;
+
+inline float32x4_t load4(const float *ptr)
+{
+    return vld1q_f32(ptr);
+}
+
+inline void store4(float *ptr, float32x4_t value)
+{
+    vst1q_f32(ptr, value);
+}
+
+#if defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS)
+inline float32x4_t load4(const float16_t *ptr)
+{
+    return vcvt_f32_f16(vld1_f16(ptr));
+}
+
+inline void store4(float16_t *ptr, float32x4_t value)
+{
+    vst1_f16(ptr, vcvt_f16_f32(value));
+}
+#endif /* defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS) */
+
+/** Load @p n values, with 0 < n <= step, as floats. The missing lanes are set to zero. */
+template <typename T>
+inline float32x4_t load(const T *ptr, int n)
+{
+    if (n == step)
+    {
+        return load4(ptr);
+    }
+    float tmp[step] = {0.f, 0.f, 0.f, 0.f};
+    for (int i = 0; i < n; ++i)
+    {
+        tmp[i] = static_cast<float>(ptr[i]);
+    }
+    return vld1q_f32(tmp);
+}
+
+/** Store the first @p n lanes of @p value, with 0 < n <= step */
+template <typename T>
+inline void store(T *ptr, float32x4_t value, int n)
+{
+    if (n == step)
+    {
+        store4(ptr, value);
+        return;
+    }
+    float tmp[step];
+    vst1q_f32(tmp, value);
+    for (int i = 0; i < n; ++i)
+    {
+        ptr[i] = static_cast<T>(tmp[i]);
+    }
+}
+
+inline float horizontal_add(float32x4_t value)
+{
+    const float32x2_t sum = vpadd_f32(vget_high_f32(value), vget_low_f32(value));
+    return vget_lane_f32(vpadd_f32(sum, sum), 0);
+}
+
+inline float32x4_t sigmoid(float32x4_t x)
+{
+    return vinvq_f32(vaddq_f32(vdupq_n_f32(1.f), vexpq_f32(vnegq_f32(x))));
+}
+
+/** Scalar activation, used for the functions without a vector implementation */
+inline float activate(float x, const ActivationLayerInfo &act)
+{
+    const float a = act.a();
+    switch (act.activation())
+    {
+        case ActivationLayerInfo::ActivationFunction::ABS:
+            return std::abs(x);
+        case ActivationLayerInfo::ActivationFunction::LEAKY_RELU:
+            return (x > 0) ? x : a * x;
+        case ActivationLayerInfo::ActivationFunction::SOFT_RELU:
+            return (x > 12.f) ? x : std::log(1.f + std::exp(x));
+        case ActivationLayerInfo::ActivationFunction::ELU:
+            return (x >= 0) ? x : a * (std::exp(x) - 1);
+        case ActivationLayerInfo::ActivationFunction::SQRT:
+            return std::sqrt(x);
+        case ActivationLayerInfo::ActivationFunction::SQUARE:
+            return x * x;
+        case ActivationLayerInfo::ActivationFunction::HARD_SWISH:
+            return x * ((std::min(std::max((x + 3), 0.0f), 6.0f)) * 0.166666667f);
+        case ActivationLayerInfo::ActivationFunction::SWISH:
+            return x / (1.f + std::exp(-a * x));
+        case ActivationLayerInfo::ActivationFunction::GELU:
+            return x * 0.5f * (1.0f + std::erf(x / 1.41421356237f));
+        default:
+            ARM_COMPUTE_ERROR("Unsupported activation function");
+    }
+    return x;
+}
+
+inline float32x4_t activate(float32x4_t x, const ActivationLayerInfo &act)
+{
+    if (!act.enabled())
+    {
+        return x;
+    }
+    switch (act.activation())
+    {
+        case ActivationLayerInfo::ActivationFunction::LOGISTIC:
+            return sigmoid(x);
+        case ActivationLayerInfo::ActivationFunction::TANH:
+            return vmulq_f32(vdupq_n_f32(act.a()), vtanhq_f32(vmulq_f32(vdupq_n_f32(act.b()), x)));
+        case ActivationLayerInfo::ActivationFunction::RELU:
+            return vmaxq_f32(vdupq_n_f32(0.f), x);
+        case ActivationLayerInfo::ActivationFunction::BOUNDED_RELU:
+            return vminq_f32(vdupq_n_f32(act.a()), vmaxq_f32(vdupq_n_f32(0.f), x));
+        case ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU:
+            return vminq_f32(vdupq_n_f32(act.a()), vmaxq_f32(vdupq_n_f32(act.b()), x));
+        case ActivationLayerInfo::ActivationFunction::LINEAR:
+            return vmlaq_f32(vdupq_n_f32(act.b()), vdupq_n_f32(act.a()), x);
+        case ActivationLayerInfo::ActivationFunction::IDENTITY:
+            return x;
+        default:
+        {
+            float tmp[step];
+            vst1q_f32(tmp, x);
+            for (float &value : tmp)
+            {
+                value = activate(value, act);
+            }
+            return vld1q_f32(tmp);
+        }
+    }
+}
+
+/** Pointer to the first element of the row @p y of a 2D tensor, nullptr if the tensor is not given */
+template <typename T>
+inline T *row_ptr(const ITensor *tensor, int y)
+{
+    return tensor != nullptr ? reinterpret_cast<T *>(tensor->ptr_to_element(Coordinates(0, y))) : nullptr;
+}
+
+/** Running mean and variance of the pre-activations of a gate */
+struct GateStats
+{
+    float32x4_t sum{vdupq_n_f32(0.f)};
+    float32x4_t sum_sq{vdupq_n_f32(0.f)};
+    float       mean{0.f};
+    float       inv_stddev{0.f};
+
+    void accumulate(float32x4_t value)
+    {
+        sum    = vaddq_f32(sum, value);
+        sum_sq = vmlaq_f32(sum_sq, value, value);
+    }
+
+    void finalize(int num_units, float epsilon)
+    {
+        mean            = horizontal_add(sum) / num_units;
+        const float var = horizontal_add(sum_sq) / num_units - mean * mean;
+        inv_stddev      = 1.f / std::sqrt(var + epsilon);
+    }
+};
+
+/** Element-wise part of an LSTM cell applied to the gates computed by the matrix multiplications
+ *
+ * Every row of the window is a batch, processed as a whole so that the layer normalization statistics never leave
+ * the registers. The layout of the tensors is described in @ref kernels::CpuLstmCellKernel.
+ */
+template <typename T>
+void neon_lstm_cell(const ITensor            *gates,
+                    const ITensor            *recurrent_gates,
+                    const ITensor            *cell_state_in,
+                    const ITensor            *params,
+                    ITensor                  *cell_state_out,
+                    ITensor                  *output_state,
+                    ITensor                  *scratch_buffer,
+                    const LSTMCellKernelInfo &info,
+                    const Window             &window)
+{
+    const int                  num_units = static_cast<int>(cell_state_in->info()->dimension(0));
+    const ActivationLayerInfo &act       = info.activation_info;
+    const bool                 has_clip  = info.cell_threshold != 0.f;
+    const float32x4_t          clip_max  = vdupq_n_f32(info.cell_threshold);
+    const float32x4_t          clip_min  = vdupq_n_f32(-info.cell_threshold);
+    const float32x4_t          one       = vdupq_n_f32(1.f);
+
+    // Offsets of the gates in a row of the gates tensors and of the scratch buffer, which does not hold the forget
+    // gate first
+    int gate_offset[4]    = {0, 0, 0, 0};
+    int scratch_offset[4] = {0, 0, 0, 0};
+    int offset            = 0;
+    for (int gate = info.has_cifg ? FORGET : INPUT; gate <= OUTPUT; ++gate, offset += num_units)
+    {
+        gate_offset[gate] = offset;
+    }
+    scratch_offset[CELL]   = info.has_cifg ? 0 : num_units;
+    scratch_offset[FORGET] = scratch_offset[CELL] + num_units;
+    scratch_offset[OUTPUT] = scratch_offset[FORGET] + num_units;
+
+    // Rows of the parameters, shared by all the batches
+    const T *peephole[4]     = {nullptr, nullptr, nullptr, nullptr};
+    const T *norm_weights[4] = {nullptr, nullptr, nullptr, nullptr};
+    const T *bias[4]         = {nullptr, nullptr, nullptr, nullptr};
+    int      row             = 0;
+    auto     next_row        = [&]() { return row_ptr<const T>(params, row++); };
+    if (info.has_peephole)
+    {
+        for (int gate : {INPUT, FORGET, OUTPUT})
+        {
+            if (gate != INPUT || !info.has_cifg)
+            {
+                peephole[gate] = next_row();
+            }
+        }
+    }
+    if (info.use_layer_norm)
+    {
+        for (auto rows : {norm_weights, bias})
+        {
+            for (int gate = info.has_cifg ? FORGET : INPUT; gate <= OUTPUT; ++gate)
+            {
+                rows[gate] = next_row();
+            }
+        }
+    }
+
+    Window win = window;
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    execute_window_loop(
+        win,
+        [&](const Coordinates &id)
+        {
+            const auto gates_ptr     = row_ptr<const T>(gates, id.y());
+            const auto recurrent_ptr = row_ptr<const T>(recurrent_gates, id.y());
+            const auto cell_in_ptr   = row_ptr<const T>(cell_state_in, id.y());
+            const auto cell_out_ptr  = row_ptr<T>(cell_state_out, id.y());
+            const auto output_ptr    = row_ptr<T>(output_state, id.y());
+            const auto scratch_ptr   = row_ptr<T>(scratch_buffer, id.y());
+
+            // Pre-activation of a gate: sum of the matrix multiplications and of the peephole connection
+            auto gate_input = [&](int gate, int x, int n, float32x4_t cell)
+            {
+                float32x4_t value = load(gates_ptr + gate_offset[gate] + x, n);
+                if (recurrent_ptr != nullptr)
+                {
+                    value = vaddq_f32(value, load(recurrent_ptr + gate_offset[gate] + x, n));
+                }
+                if (peephole[gate] != nullptr)
+                {
+                    value = vmlaq_f32(value, cell, load(peephole[gate] + x, n));
+                }
+                return value;
+            };
+
+            GateStats stats[4];
+            auto      normalize = [&](float32x4_t value, int gate, int x, int n)
+            {
+                if (!info.use_layer_norm)
+                {
+                    return value;
+                }
+                value = vmulq_f32(vsubq_f32(value, vdupq_n_f32(stats[gate].mean)),
+                                  vdupq_n_f32(stats[gate].inv_stddev));
+                return vmlaq_f32(load(bias[gate] + x, n), value, load(norm_weights[gate] + x, n));
+            };
+
+            auto store_gate = [&](int gate, int x, int n, float32x4_t value)
+            {
+                if (scratch_ptr != nullptr)
+                {
+                    store(scratch_ptr + scratch_offset[gate] + x, value, n);
+                }
+            };
+
+            // The layer normalization of the input, forget and cell gates needs their statistics over the whole row
+            if (info.use_layer_norm)
+            {
+                for (int x = 0; x < num_units; x += step)
+                {
+                    const int         n       = std::min(step, num_units - x);
+                    const float32x4_t cell_in = load(cell_in_ptr + x, n);
+                    for (int gate = info.has_cifg ? FORGET : INPUT; gate <= CELL; ++gate)
+                    {
+                        stats[gate].accumulate(gate_input(gate, x, n, cell_in));
+                    }
+                }
+                for (int gate = info.has_cifg ? FORGET : INPUT; gate <= CELL; ++gate)
+                {
+                    stats[gate].finalize(num_units, info.epsilon);
+                }
+            }
+
+            // Compute the new cell state and, without layer normalization, the output state in the same pass
+            for (int x = 0; x < num_units; x += step)
+            {
+                const int         n       = std::min(step, num_units - x);
+                const float32x4_t cell_in = load(cell_in_ptr + x, n);
+
+                const float32x4_t forget_gate = sigmoid(normalize(gate_input(FORGET, x, n, cell_in), FORGET, x, n));
+                const float32x4_t input_gate =
+                    info.has_cifg ? vsubq_f32(one, forget_gate)
+                                  : sigmoid(normalize(gate_input(INPUT, x, n, cell_in), INPUT, x, n));
+                const float32x4_t cell_gate = activate(normalize(gate_input(CELL, x, n, cell_in), CELL, x, n), act);
+
+                float32x4_t cell = vmlaq_f32(vmulq_f32(forget_gate, cell_in), cell_gate, input_gate);
+                if (has_clip)
+                {
+                    cell = vminq_f32(clip_max, vmaxq_f32(clip_min, cell));
+                }
+                store(cell_out_ptr + x, cell, n);
+
+                if (!info.has_cifg)
+                {
+                    store_gate(INPUT, x, n, input_gate);
+                }
+                store_gate(FORGET, x, n, forget_gate);
+                store_gate(CELL, x, n, cell);
+
+                const float32x4_t output_input = gate_input(OUTPUT, x, n, cell);
+                if (info.use_layer_norm)
+                {
+                    stats[OUTPUT].accumulate(output_input);
+                }
+                else
+                {
+                    const float32x4_t output_gate = sigmoid(output_input);
+                    store(output_ptr + x, vmulq_f32(activate(cell, act), output_gate), n);
+                    store_gate(OUTPUT, x, n, output_gate);
+                }
+            }
+
+            // With layer normalization, the output gate needs the statistics of the whole new cell state
+            if (info.use_layer_norm)
+            {
+                stats[OUTPUT].finalize(num_units, info.epsilon);
+                for (int x = 0; x < num_units; x += step)
+                {
+                    const int         n           = std::min(step, num_units - x);
+                    const float32x4_t cell        = load(cell_out_ptr + x, n);
+                    const float32x4_t output_gate = sigmoid(normalize(gate_input(OUTPUT, x, n, cell), OUTPUT, x, n));
+                    store(output_ptr + x, vmulq_f32(activate(cell, act), output_gate), n);
+                    store_gate(OUTPUT, x, n, output_gate);
+                }
+            }
+        });
+}
+} // namespace lstm_cell
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_LSTM_CELL_GENERIC_NEON_IMPL_H
@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/paged_matmul/generic/neon/impl.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+void neon_fp32_paged_matmul(const ITensor *lhs,
+                            const ITensor *cache,
+                            const ITensor *block_table,
+                            const ITensor *seq_lens,
+                            ITensor       *dst,
+                            bool           adj_rhs,
+                            const Window  &window)
+{
+    return paged_matmul::neon_paged_matmul<float, float>(lhs, cache, block_table, seq_lens, dst, adj_rhs, window);
+}
+
+void neon_fp32_qasymm8_signed_paged_matmul(const ITensor *lhs,
+                                           const ITensor *cache,
+                                           const ITensor *block_table,
+                                           const ITensor *seq_lens,
+                                           ITensor       *dst,
+                                           bool           adj_rhs,
+                                           const Window  &window)
+{
+    return paged_matmul::neon_paged_matmul<float, int8_t>(lhs, cache, block_table, seq_lens, dst, adj_rhs, window);
+}
+} // namespace cpu
+} // namespace arm_compute
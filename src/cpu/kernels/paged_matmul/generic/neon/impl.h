@@ -0,0 +1,380 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_PAGED_MATMUL_GENERIC_NEON_IMPL_H
+#define ACL_SRC_CPU_KERNELS_PAGED_MATMUL_GENERIC_NEON_IMPL_H
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/cpu/kernels/paged_matmul/list.h"
+
+#include <arm_neon.h>
+#include <algorithm>
+#include <limits>
+#include <type_traits>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace paged_matmul
+{
+/** Number of rows of the left-hand side sharing each load of the cache */
+constexpr int block_rows = 8;
+/** Number of values of the cache loaded per iteration */
+constexpr int step = 8;
+
+/** Quantization of the cache, ignored for floating-point caches */
+struct Dequantization
+{
+    float   scale{1.f};
+    int32_t offset{0};
+};
+
+inline float32x4x2_t load8(const float *ptr, const Dequantization &)
+{
+    return {{vld1q_f32(ptr), vld1q_f32(ptr + 4)}};
+}
+
+inline float load1(const float *ptr, const Dequantization &)
+{
+    return *ptr;
+}
+
+#if defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS)
+inline float32x4x2_t load8(const float16_t *ptr, const Dequantization &)
+{
+    const float16x8_t values = vld1q_f16(ptr);
+    return {{vcvt_f32_f16(vget_low_f16(values)), vcvt_f32_f16(vget_high_f16(values))}};
+}
+
+inline float load1(const float16_t *ptr, const Dequantization &)
+{
+    return static_cast<float>(*ptr);
+}
+#endif /* defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS) */
+
+inline float32x4x2_t load8(const int8_t *ptr, const Dequantization &dq)
+{
+    const int16x8_t   values = vmovl_s8(vld1_s8(ptr));
+    const int32x4_t   offset = vdupq_n_s32(dq.offset);
+    const float32x4_t scale  = vdupq_n_f32(dq.scale);
+    return {{vmulq_f32(vcvtq_f32_s32(vsubq_s32(vmovl_s16(vget_low_s16(values)), offset)), scale),
+             vmulq_f32(vcvtq_f32_s32(vsubq_s32(vmovl_s16(vget_high_s16(values)), offset)), scale)}};
+}
+
+inline float load1(const int8_t *ptr, const Dequantization &dq)
+{
+    return static_cast<float>(static_cast<int32_t>(*ptr) - dq.offset) * dq.scale;
+}
+
+inline float horizontal_add(float32x4_t value)
+{
+    const float32x2_t sum = vpadd_f32(vget_high_f32(value), vget_low_f32(value));
+    return vget_lane_f32(vpadd_f32(sum, sum), 0);
+}
+
+/** Address of the row @p y of the plane (@p z, @p w) of a tensor */
+template <typename T>
+inline T *row_ptr(const ITensor *tensor, int y, int z, int w)
+{
+    const ITensorInfo *info    = tensor->info();
+    const Strides     &strides = info->strides_in_bytes();
+    return reinterpret_cast<T *>(tensor->buffer() + info->offset_first_element_in_bytes() + y * strides[1] +
+                                 z * strides[2] + w * strides[3]);
+}
+
+/** Call @p func with the number of rows, between 1 and block_rows, as a compile-time constant
+ *
+ * The number of rows of the left-hand side is the number of tokens decoded at once, so this avoids computing a full
+ * block of rows for the common single token case.
+ */
+template <typename F>
+inline void dispatch_rows(int num_rows, F &&func)
+{
+    switch (num_rows)
+    {
+        case 1:
+            func(std::integral_constant<int, 1>());
+            break;
+        case 2:
+            func(std::integral_constant<int, 2>());
+            break;
+        case 3:
+            func(std::integral_constant<int, 3>());
+            break;
+        case 4:
+            func(std::integral_constant<int, 4>());
+            break;
+        case 5:
+            func(std::integral_constant<int, 5>());
+            break;
+        case 6:
+            func(std::integral_constant<int, 6>());
+            break;
+        case 7:
+            func(std::integral_constant<int, 7>());
+            break;
+        default:
+            func(std::integral_constant<int, block_rows>());
+            break;
+    }
+}
+
+/** Compute the dot products of the row @p c of the cache with the @p R rows of @p lhs */
+template <int R, typename TC>
+inline void dot_rows(const float (*lhs)[max_head_size], const TC *c, int size, const Dequantization &dq, float *out)
+{
+    float32x4_t acc[R];
+    for (int r = 0; r < R; ++r)
+    {
+        acc[r] = vdupq_n_f32(0.f);
+    }
+
+    int i = 0;
+    for (; i <= size - step; i += step)
+    {
+        const float32x4x2_t c8 = load8(c + i, dq);
+        for (int r = 0; r < R; ++r)
+        {
+            acc[r] = vmlaq_f32(acc[r], vld1q_f32(lhs[r] + i), c8.val[0]);
+            acc[r] = vmlaq_f32(acc[r], vld1q_f32(lhs[r] + i + 4), c8.val[1]);
+        }
+    }
+    for (int r = 0; r < R; ++r)
+    {
+        out[r] = horizontal_add(acc[r]);
+    }
+    for (; i < size; ++i)
+    {
+        const float c1 = load1(c + i, dq);
+        for (int r = 0; r < R; ++r)
+        {
+            out[r] += lhs[r][i] * c1;
+        }
+    }
+}
+
+/** Accumulate the row @p c of the cache weighted by @p p into the @p R rows of @p acc */
+template <int R, typename TC>
+inline void
+accumulate_rows(float (*acc)[max_head_size], const TC *c, int size, const Dequantization &dq, const float *p)
+{
+    float32x4_t p4[R];
+    for (int r = 0; r < R; ++r)
+    {
+        p4[r] = vdupq_n_f32(p[r]);
+    }
+
+    int i = 0;
+    for (; i <= size - step; i += step)
+    {
+        const float32x4x2_t c8 = load8(c + i, dq);
+        for (int r = 0; r < R; ++r)
+        {
+            vst1q_f32(acc[r] + i, vmlaq_f32(vld1q_f32(acc[r] + i), p4[r], c8.val[0]));
+            vst1q_f32(acc[r] + i + 4, vmlaq_f32(vld1q_f32(acc[r] + i + 4), p4[r], c8.val[1]));
+        }
+    }
+    for (; i < size; ++i)
+    {
+        const float c1 = load1(c + i, dq);
+        for (int r = 0; r < R; ++r)
+        {
+            acc[r][i] += p[r] * c1;
+        }
+    }
+}
+
+/** Rows of one head of the cache, spread over the blocks listed in a row of the block table */
+struct PagedHead
+{
+    const ITensor *cache;
+    const int32_t *table;
+    int            kv_head;
+    int            block_size;
+    int            seq_len;
+    size_t         row_stride;
+    Dequantization dq;
+
+    /** Address of the first row of the block in position @p i of the block table */
+    const uint8_t *block(int i) const
+    {
+        ARM_COMPUTE_ERROR_ON(table[i] < 0 || static_cast<size_t>(table[i]) >= cache->info()->dimension(3));
+        return row_ptr<const uint8_t>(cache, 0, kv_head, table[i]);
+    }
+};
+
+/** Compute out = lhs * cache^T for the entries [@p begin, @p end) of the block table. The columns past the end of
+ *  the sequence are set to -inf, so that a softmax over the whole rows ignores them. */
+template <int R, typename T, typename TC>
+void paged_scores(
+    const float (*lhs)[max_head_size], int row_size, const PagedHead &head, T *const *out, int begin, int end)
+{
+    const T lowest = static_cast<T>(-std::numeric_limits<float>::infinity());
+
+    for (int i = begin; i < end; ++i)
+    {
+        const int first = i * head.block_size;
+        const int valid = std::max(0, std::min(head.block_size, head.seq_len - first));
+
+        const uint8_t *c = valid > 0 ? head.block(i) : nullptr;
+        for (int t = 0; t < valid; ++t)
+        {
+            float s[R];
+            dot_rows<R>(lhs, reinterpret_cast<const TC *>(c + t * head.row_stride), row_size, head.dq, s);
+            for (int r = 0; r < R; ++r)
+            {
+                out[r][first + t] = static_cast<T>(s[r]);
+            }
+        }
+        for (int r = 0; r < R; ++r)
+        {
+            std::fill(out[r] + first + valid, out[r] + first + head.block_size, lowest);
+        }
+    }
+}
+
+/** Compute acc = lhs * cache over the valid rows of the cache */
+template <int R, typename T, typename TC>
+void paged_values(const T *const *lhs, int row_size, const PagedHead &head, float (*acc)[max_head_size])
+{
+    for (int r = 0; r < R; ++r)
+    {
+        std::fill_n(acc[r], row_size, 0.f);
+    }
+
+    for (int first = 0, i = 0; first < head.seq_len; first += head.block_size, ++i)
+    {
+        const int      valid = std::min(head.block_size, head.seq_len - first);
+        const uint8_t *c     = head.block(i);
+        for (int t = 0; t < valid; ++t)
+        {
+            float p[R];
+            for (int r = 0; r < R; ++r)
+            {
+                p[r] = static_cast<float>(lhs[r][first + t]);
+            }
+            accumulate_rows<R>(acc, reinterpret_cast<const TC *>(c + t * head.row_stride), row_size, head.dq, p);
+        }
+    }
+}
+
+/** Matrix multiplication of a few rows per head against a paged cache
+ *
+ * The rows of each sequence are spread over the blocks of the cache listed in its row of the block table, and only
+ * the first seq_lens[b] rows are valid. With @p adj_rhs, dst = lhs * cache^T and the columns past the end of the
+ * sequence are set to -inf. Otherwise, dst = lhs * cache over the valid rows of the cache.
+ *
+ * Dimension X of the window iterates over the entries of the block table when @p adj_rhs is set, and dimension Z
+ * over the heads of all the batches. The computations are carried out in fp32 whatever the data types.
+ */
+template <typename T, typename TC>
+void neon_paged_matmul(const ITensor *lhs,
+                       const ITensor *cache,
+                       const ITensor *block_table,
+                       const ITensor *seq_lens,
+                       ITensor       *dst,
+                       bool           adj_rhs,
+                       const Window  &window)
+{
+    const int num_rows     = lhs->info()->dimension(1);
+    const int num_heads    = lhs->info()->dimension(2);
+    const int row_size     = cache->info()->dimension(0);
+    const int block_size   = cache->info()->dimension(1);
+    const int num_kv_heads = cache->info()->dimension(2);
+    const int max_seq_len  = block_table->info()->dimension(0) * block_size;
+
+    // Several heads of the left-hand side can share the same head of the cache
+    const int group_size = num_heads / num_kv_heads;
+
+    const UniformQuantizationInfo qinfo = cache->info()->quantization_info().uniform();
+
+    float lhs_block[block_rows][max_head_size];
+    float acc[block_rows][max_head_size];
+
+    for (int z = window.z().start(); z < window.z().end(); ++z)
+    {
+        const int head  = z % num_heads;
+        const int batch = z / num_heads;
+
+        const int32_t len = *reinterpret_cast<const int32_t *>(seq_lens->ptr_to_element(Coordinates(batch)));
+
+        PagedHead paged_head{};
+        paged_head.cache      = cache;
+        paged_head.table      = reinterpret_cast<const int32_t *>(block_table->ptr_to_element(Coordinates(0, batch)));
+        paged_head.kv_head    = head / group_size;
+        paged_head.block_size = block_size;
+        paged_head.seq_len    = std::max(0, std::min<int>(len, max_seq_len));
+        paged_head.row_stride = cache->info()->strides_in_bytes()[1];
+        paged_head.dq         = Dequantization{qinfo.scale, qinfo.offset};
+
+        for (int r0 = 0; r0 < num_rows; r0 += block_rows)
+        {
+            const int rows = std::min(block_rows, num_rows - r0);
+
+            const T *l[block_rows];
+            T       *out[block_rows];
+            for (int r = 0; r < rows; ++r)
+            {
+                l[r]   = row_ptr<const T>(lhs, r0 + r, head, batch);
+                out[r] = row_ptr<T>(dst, r0 + r, head, batch);
+            }
+
+            if (adj_rhs)
+            {
+                for (int r = 0; r < rows; ++r)
+                {
+                    for (int i = 0; i < row_size; ++i)
+                    {
+                        lhs_block[r][i] = static_cast<float>(l[r][i]);
+                    }
+                }
+                dispatch_rows(rows,
+                              [&](auto num_block_rows)
+                              {
+                                  paged_scores<decltype(num_block_rows)::value, T, TC>(
+                                      lhs_block, row_size, paged_head, out, window.x().start(), window.x().end());
+                              });
+            }
+            else
+            {
+                dispatch_rows(rows, [&](auto num_block_rows)
+                              { paged_values<decltype(num_block_rows)::value, T, TC>(l, row_size, paged_head, acc); });
+                for (int r = 0; r < rows; ++r)
+                {
+                    for (int i = 0; i < row_size; ++i)
+                    {
+                        out[r][i] = static_cast<T>(acc[r][i]);
+                    }
+                }
+            }
+        }
+    }
+}
+} // namespace paged_matmul
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_PAGED_MATMUL_GENERIC_NEON_IMPL_H
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_SCATTER_GENERIC_NEON_IMPL_H
+#define ACL_SRC_CPU_KERNELS_SCATTER_GENERIC_NEON_IMPL_H
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/function_info/ScatterInfo.h"
+
+#include "src/core/NEON/wrapper/wrapper.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace arm_compute
+{
+namespace cpu
+{
+/** Reduce a row of @p updates into a row of @p dst, element by element */
+template <typename T, typename VectorOp, typename ScalarOp>
+inline void scatter_reduce_row(T *dst, const T *updates, size_t len, VectorOp &&vec_op, ScalarOp &&scalar_op)
+{
+    constexpr size_t step = 16 / sizeof(T);
+
+    size_t x = 0;
+    for (; x + 2 * step <= len; x += 2 * step)
+    {
+        const auto a0 = wrapper::vloadq(dst + x);
+        const auto a1 = wrapper::vloadq(dst + x + step);
+        const auto b0 = wrapper::vloadq(updates + x);
+        const auto b1 = wrapper::vloadq(updates + x + step);
+        wrapper::vstore(dst + x, vec_op(a0, b0));
+        wrapper::vstore(dst + x + step, vec_op(a1, b1));
+    }
+    for (; x + step <= len; x += step)
+    {
+        wrapper::vstore(dst + x, vec_op(wrapper::vloadq(dst + x), wrapper::vloadq(updates + x)));
+    }
+
+    // Compute left-over elements
+    for (; x < len; ++x)
+    {
+        dst[x] = scalar_op(dst[x], updates[x]);
+    }
+}
+
+template <typename T>
+void scatter_row(uint8_t *dst_ptr, const uint8_t *updates_ptr, size_t len, ScatterFunction function)
+{
+    auto       *dst     = reinterpret_cast<T *>(dst_ptr);
+    const auto *updates = reinterpret_cast<const T *>(updates_ptr);
+
+    switch (function)
+    {
+        case ScatterFunction::Update:
+            std::memcpy(dst, updates, len * sizeof(T));
+            break;
+        case ScatterFunction::Add:
+            scatter_reduce_row(
+                dst, updates, len, [](auto a, auto b) { return wrapper::vadd(a, b); },
+                [](T a, T b) { return static_cast<T>(a + b); });
+            break;
+        case ScatterFunction::Sub:
+            scatter_reduce_row(
+                dst, updates, len, [](auto a, auto b) { return wrapper::vsub(a, b); },
+                [](T a, T b) { return static_cast<T>(a - b); });
+            break;
+        case ScatterFunction::Max:
+            scatter_reduce_row(
+                dst, updates, len, [](auto a, auto b) { return wrapper::vmax(a, b); },
+                [](T a, T b) { return std::max(a, b); });
+            break;
+        case ScatterFunction::Min:
+            scatter_reduce_row(
+                dst, updates, len, [](auto a, auto b) { return wrapper::vmin(a, b); },
+                [](T a, T b) { return std::min(a, b); });
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Unsupported Scatter function");
+    }
+}
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_SCATTER_GENERIC_NEON_IMPL_H
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/scatter/generic/neon/impl.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+void neon_s32_scatter(uint8_t *dst, const uint8_t *updates, size_t len, ScatterFunction function)
+{
+    return scatter_row<int32_t>(dst, updates, len, function);
+}
+void neon_s16_scatter(uint8_t *dst, const uint8_t *updates, size_t len, ScatterFunction function)
+{
+    return scatter_row<int16_t>(dst, updates, len, function);
+}
+void neon_s8_scatter(uint8_t *dst, const uint8_t *updates, size_t len, ScatterFunction function)
+{
+    return scatter_row<int8_t>(dst, updates, len, function);
+}
+void neon_u32_scatter(uint8_t *dst, const uint8_t *updates, size_t len, ScatterFunction function)
+{
+    return scatter_row<uint32_t>(dst, updates, len, function);
+}
+void neon_u16_scatter(uint8_t *dst, const uint8_t *updates, size_t len, ScatterFunction function)
+{
+    return scatter_row<uint16_t>(dst, updates, len, function);
+}
+void neon_u8_scatter(uint8_t *dst, const uint8_t *updates, size_t len, ScatterFunction function)
+{
+    return scatter_row<uint8_t>(dst, updates, len, function);
+}
+} // namespace cpu
+} // namespace arm_compute
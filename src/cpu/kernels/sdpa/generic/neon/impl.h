@@ -0,0 +1,401 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_SDPA_GENERIC_NEON_IMPL_H
+#define ACL_SRC_CPU_KERNELS_SDPA_GENERIC_NEON_IMPL_H
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/core/NEON/NEMath.h"
+#include "src/cpu/kernels/sdpa/list.h"
+#include "support/Bfloat16.h"
+
+#include <arm_neon.h>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace sdpa
+{
+/** Number of query rows sharing each tile of keys and values */
+constexpr int block_rows = 4;
+/** Number of keys in each tile */
+constexpr int block_keys = 64;
+/** Number of values computed per iteration */
+constexpr int step = 4;
+
+inline float32x4_t load4(const float *ptr)
+{
+    return vld1q_f32(ptr);
+}
+
+inline void store4(float *ptr, float32x4_t value)
+{
+    vst1q_f32(ptr, value);
+}
+
+#if defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS)
+inline float32x4_t load4(const float16_t *ptr)
+{
+    return vcvt_f32_f16(vld1_f16(ptr));
+}
+
+inline void store4(float16_t *ptr, float32x4_t value)
+{
+    vst1_f16(ptr, vcvt_f16_f32(value));
+}
+#endif /* defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS) */
+
+inline float32x4_t load4(const bfloat16 *ptr)
+{
+    // A bfloat16 holds the upper half of the float it represents
+    return vreinterpretq_f32_u32(vshll_n_u16(vld1_u16(reinterpret_cast<const uint16_t *>(ptr)), 16));
+}
+
+inline void store4(bfloat16 *ptr, float32x4_t value)
+{
+    float tmp[step];
+    vst1q_f32(tmp, value);
+    for (int i = 0; i < step; ++i)
+    {
+        ptr[i] = bfloat16(tmp[i]);
+    }
+}
+
+inline float horizontal_add(float32x4_t value)
+{
+    const float32x2_t sum = vpadd_f32(vget_high_f32(value), vget_low_f32(value));
+    return vget_lane_f32(vpadd_f32(sum, sum), 0);
+}
+
+inline float horizontal_max(float32x4_t value)
+{
+    const float32x2_t max = vpmax_f32(vget_high_f32(value), vget_low_f32(value));
+    return vget_lane_f32(vpmax_f32(max, max), 0);
+}
+
+/** Address of the row @p y of the plane (@p z, @p w) of a tensor */
+template <typename T>
+inline T *row_ptr(const ITensor *tensor, int y, int z, int w)
+{
+    const ITensorInfo *info    = tensor->info();
+    const Strides     &strides = info->strides_in_bytes();
+    return reinterpret_cast<T *>(tensor->buffer() + info->offset_first_element_in_bytes() + y * strides[1] +
+                                 z * strides[2] + w * strides[3]);
+}
+
+/** Compute the dot products of the key @p k with the rows of the query block @p q
+ *
+ * The key is loaded once for all the rows, which stay in registers.
+ */
+template <typename T>
+inline void compute_scores(const float (*q)[max_head_size], const T *k, int head_size, float *scores)
+{
+    float32x4_t acc[block_rows];
+    for (int r = 0; r < block_rows; ++r)
+    {
+        acc[r] = vdupq_n_f32(0.f);
+    }
+
+    int i = 0;
+    for (; i <= head_size - step; i += step)
+    {
+        const float32x4_t k4 = load4(k + i);
+        for (int r = 0; r < block_rows; ++r)
+        {
+            acc[r] = vmlaq_f32(acc[r], vld1q_f32(q[r] + i), k4);
+        }
+    }
+    for (int r = 0; r < block_rows; ++r)
+    {
+        scores[r] = horizontal_add(acc[r]);
+    }
+    for (; i < head_size; ++i)
+    {
+        const float k1 = static_cast<float>(k[i]);
+        for (int r = 0; r < block_rows; ++r)
+        {
+            scores[r] += q[r][i] * k1;
+        }
+    }
+}
+
+/** Accumulate the value @p v weighted by the probabilities @p p into the rows of the output block @p acc */
+template <typename T>
+inline void accumulate_value(float (*acc)[max_head_size], const T *v, int value_head_size, const float *p)
+{
+    float32x4_t p4[block_rows];
+    for (int r = 0; r < block_rows; ++r)
+    {
+        p4[r] = vdupq_n_f32(p[r]);
+    }
+
+    int i = 0;
+    for (; i <= value_head_size - step; i += step)
+    {
+        const float32x4_t v4 = load4(v + i);
+        for (int r = 0; r < block_rows; ++r)
+        {
+            vst1q_f32(acc[r] + i, vmlaq_f32(vld1q_f32(acc[r] + i), p4[r], v4));
+        }
+    }
+    for (; i < value_head_size; ++i)
+    {
+        const float v1 = static_cast<float>(v[i]);
+        for (int r = 0; r < block_rows; ++r)
+        {
+            acc[r][i] += p[r] * v1;
+        }
+    }
+}
+
+/** Update the running maximum and sum of a row with a tile of scores, and turn the scores into the
+ *  unnormalized probabilities exp(score - maximum)
+ *
+ * @return the factor the previous accumulations of the row have to be multiplied by
+ */
+inline float online_softmax(float *scores, int num_keys, float &row_max, float &row_sum)
+{
+    const float lowest = -std::numeric_limits<float>::infinity();
+
+    float32x4_t max4 = vdupq_n_f32(lowest);
+    int         j    = 0;
+    for (; j <= num_keys - step; j += step)
+    {
+        max4 = vmaxq_f32(max4, vld1q_f32(scores + j));
+    }
+    float tile_max = horizontal_max(max4);
+    for (; j < num_keys; ++j)
+    {
+        tile_max = std::max(tile_max, scores[j]);
+    }
+
+    // Every key of the tile is masked out
+    if (tile_max == lowest)
+    {
+        std::fill_n(scores, num_keys, 0.f);
+        return 1.f;
+    }
+
+    const float new_max    = std::max(row_max, tile_max);
+    const float correction = std::exp(row_max - new_max);
+
+    const float32x4_t new_max4 = vdupq_n_f32(new_max);
+    float32x4_t       sum4     = vdupq_n_f32(0.f);
+    for (j = 0; j <= num_keys - step; j += step)
+    {
+        const float32x4_t p4 = vexpq_f32(vsubq_f32(vld1q_f32(scores + j), new_max4));
+        vst1q_f32(scores + j, p4);
+        sum4 = vaddq_f32(sum4, p4);
+    }
+    float sum = horizontal_add(sum4);
+    for (; j < num_keys; ++j)
+    {
+        scores[j] = std::exp(scores[j] - new_max);
+        sum += scores[j];
+    }
+
+    row_max = new_max;
+    row_sum = row_sum * correction + sum;
+    return correction;
+}
+
+/** Scaled dot-product attention, computed one block of queries at a time against tiles of keys, so that the
+ *  matrix of the scores is never materialized
+ *
+ * Dimension Y of the window iterates over the queries and dimension Z over the heads of all the batches.
+ * The computations are carried out in fp32 whatever the data type.
+ */
+template <typename T>
+void neon_scaled_dot_product_attention(const ITensor *query,
+                                       const ITensor *key,
+                                       const ITensor *value,
+                                       const ITensor *mask,
+                                       ITensor       *dst,
+                                       float          scale,
+                                       bool           is_causal,
+                                       const Window  &window)
+{
+    const int head_size       = query->info()->dimension(0);
+    const int num_queries     = query->info()->dimension(1);
+    const int num_heads       = query->info()->dimension(2);
+    const int num_keys        = key->info()->dimension(1);
+    const int num_kv_heads    = key->info()->dimension(2);
+    const int value_head_size = value->info()->dimension(0);
+
+    // Several query heads can share the same key and value head
+    const int group_size = num_heads / num_kv_heads;
+    // The causal mask is aligned on the last query and the last key
+    const int causal_offset = num_keys - num_queries;
+
+    const size_t key_stride   = key->info()->strides_in_bytes()[1];
+    const size_t value_stride = value->info()->strides_in_bytes()[1];
+    const bool   mask_heads   = mask != nullptr && mask->info()->dimension(2) > 1;
+    const bool   mask_batches = mask != nullptr && mask->info()->dimension(3) > 1;
+
+    const float lowest = -std::numeric_limits<float>::infinity();
+
+    float q_block[block_rows][max_head_size];
+    float acc[block_rows][max_head_size];
+    float scores[block_rows][block_keys];
+    float row_max[block_rows];
+    float row_sum[block_rows];
+
+    for (int z = window.z().start(); z < window.z().end(); ++z)
+    {
+        const int head    = z % num_heads;
+        const int batch   = z / num_heads;
+        const int kv_head = head / group_size;
+
+        const uint8_t *k_base = row_ptr<uint8_t>(key, 0, kv_head, batch);
+        const uint8_t *v_base = row_ptr<uint8_t>(value, 0, kv_head, batch);
+
+        for (int y0 = window.y().start(); y0 < window.y().end(); y0 += block_rows)
+        {
+            const int num_rows = std::min(block_rows, window.y().end() - y0);
+
+            // Load the queries premultiplied by the scale. The missing rows of the block are set to zero.
+            for (int r = 0; r < block_rows; ++r)
+            {
+                if (r < num_rows)
+                {
+                    const T *q = row_ptr<T>(query, y0 + r, head, batch);
+                    for (int i = 0; i < head_size; ++i)
+                    {
+                        q_block[r][i] = static_cast<float>(q[i]) * scale;
+                    }
+                }
+                else
+                {
+                    std::fill_n(q_block[r], head_size, 0.f);
+                }
+                std::fill_n(acc[r], value_head_size, 0.f);
+                row_max[r] = lowest;
+                row_sum[r] = 0.f;
+            }
+
+            // The keys after the last one visible from the block are skipped altogether
+            const int keys_end = is_causal ? std::min(num_keys, y0 + num_rows + causal_offset) : num_keys;
+
+            for (int k0 = 0; k0 < keys_end; k0 += block_keys)
+            {
+                const int tile_size = std::min(block_keys, keys_end - k0);
+
+                for (int j = 0; j < tile_size; ++j)
+                {
+                    float s[block_rows];
+                    compute_scores(q_block, reinterpret_cast<const T *>(k_base + (k0 + j) * key_stride), head_size,
+                                   s);
+                    for (int r = 0; r < block_rows; ++r)
+                    {
+                        scores[r][j] = s[r];
+                    }
+                }
+
+                for (int r = 0; r < block_rows; ++r)
+                {
+                    const int y = y0 + r;
+
+                    // Number of keys of the tile visible from the query
+                    int num_visible = r < num_rows ? tile_size : 0;
+                    if (is_causal)
+                    {
+                        num_visible = std::max(0, std::min(num_visible, y + causal_offset + 1 - k0));
+                    }
+
+                    if (num_visible > 0 && mask != nullptr)
+                    {
+                        const T *m = row_ptr<T>(mask, y, mask_heads ? head : 0, mask_batches ? batch : 0) + k0;
+                        int      j = 0;
+                        for (; j <= num_visible - step; j += step)
+                        {
+                            vst1q_f32(scores[r] + j, vaddq_f32(vld1q_f32(scores[r] + j), load4(m + j)));
+                        }
+                        for (; j < num_visible; ++j)
+                        {
+                            scores[r][j] += static_cast<float>(m[j]);
+                        }
+                    }
+
+                    if (num_visible > 0)
+                    {
+                        const float correction = online_softmax(scores[r], num_visible, row_max[r], row_sum[r]);
+                        if (correction != 1.f)
+                        {
+                            const float32x4_t correction4 = vdupq_n_f32(correction);
+                            int               i           = 0;
+                            for (; i <= value_head_size - step; i += step)
+                            {
+                                vst1q_f32(acc[r] + i, vmulq_f32(vld1q_f32(acc[r] + i), correction4));
+                            }
+                            for (; i < value_head_size; ++i)
+                            {
+                                acc[r][i] *= correction;
+                            }
+                        }
+                    }
+                    // The keys which are not visible do not contribute to the output
+                    std::fill(scores[r] + num_visible, scores[r] + tile_size, 0.f);
+                }
+
+                for (int j = 0; j < tile_size; ++j)
+                {
+                    float p[block_rows];
+                    for (int r = 0; r < block_rows; ++r)
+                    {
+                        p[r] = scores[r][j];
+                    }
+                    accumulate_value(acc, reinterpret_cast<const T *>(v_base + (k0 + j) * value_stride),
+                                     value_head_size, p);
+                }
+            }
+
+            // Normalize the outputs. A query which cannot see any key outputs zeros.
+            for (int r = 0; r < num_rows; ++r)
+            {
+                const float       inv_sum  = row_sum[r] > 0.f ? 1.f / row_sum[r] : 0.f;
+                const float32x4_t inv_sum4 = vdupq_n_f32(inv_sum);
+                T                *out      = row_ptr<T>(dst, y0 + r, head, batch);
+                int               i        = 0;
+                for (; i <= value_head_size - step; i += step)
+                {
+                    store4(out + i, vmulq_f32(vld1q_f32(acc[r] + i), inv_sum4));
+                }
+                for (; i < value_head_size; ++i)
+                {
+                    out[i] = static_cast<T>(acc[r][i] * inv_sum);
+                }
+            }
+        }
+    }
+}
+} // namespace sdpa
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_SDPA_GENERIC_NEON_IMPL_H
@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_TOPK_GENERIC_NEON_IMPL_H
+#define ACL_SRC_CPU_KERNELS_TOPK_GENERIC_NEON_IMPL_H
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/core/NEON/wrapper/wrapper.h"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace arm_compute
+{
+namespace cpu
+{
+/** Element of a row selected as a top-k candidate */
+template <typename T>
+struct TopKCandidate
+{
+    T       value;
+    int32_t index;
+};
+
+/** Greater values rank first and, among equal values, lower indices rank first */
+template <typename T>
+inline bool topk_ranks_before(const TopKCandidate<T> &a, const TopKCandidate<T> &b)
+{
+    return (a.value > b.value) || (!(b.value > a.value) && a.index < b.index);
+}
+
+/** Keep the best k candidates at the front of the buffer and return the value of the k-th one */
+template <typename T>
+inline T topk_compact(TopKCandidate<T> *candidates, unsigned int num_candidates, unsigned int k)
+{
+    std::nth_element(candidates, candidates + k - 1, candidates + num_candidates, topk_ranks_before<T>);
+    return candidates[k - 1].value;
+}
+
+/** Compute the top-k values and indices of a row
+ *
+ * The first k elements seed the candidates, whose k-th value is the selection threshold. The rest of the row is then
+ * scanned 4 vectors at a time: blocks whose maximum does not exceed the threshold are skipped, otherwise the
+ * elements above it are appended to the candidates. When the buffer is full, it is partially selected back to the
+ * best k candidates, which raises the threshold.
+ *
+ * As the elements are visited in order, an element equal to the threshold always ranks after the k-th candidate and
+ * can be discarded. NaN values are not supported.
+ */
+template <typename T>
+void topk_row(const T          *src,
+              unsigned int      len,
+              unsigned int      k,
+              bool              sorted,
+              TopKCandidate<T> *candidates,
+              unsigned int      capacity,
+              T                *values,
+              int32_t          *indices)
+{
+    constexpr unsigned int vec_size = 16 / sizeof(T);
+    constexpr unsigned int step     = 4 * vec_size;
+
+    unsigned int num_candidates = 0;
+    for (; num_candidates < k; ++num_candidates)
+    {
+        candidates[num_candidates] = {src[num_candidates], static_cast<int32_t>(num_candidates)};
+    }
+    T threshold = topk_compact(candidates, num_candidates, k);
+
+    auto append = [&](unsigned int x)
+    {
+        if (src[x] > threshold)
+        {
+            candidates[num_candidates++] = {src[x], static_cast<int32_t>(x)};
+            if (num_candidates == capacity)
+            {
+                threshold      = topk_compact(candidates, num_candidates, k);
+                num_candidates = k;
+            }
+        }
+    };
+
+    unsigned int x = k;
+    for (; x + step <= len; x += step)
+    {
+        const auto v0 = wrapper::vmax(wrapper::vloadq(src + x), wrapper::vloadq(src + x + vec_size));
+        const auto v1 = wrapper::vmax(wrapper::vloadq(src + x + 2 * vec_size), wrapper::vloadq(src + x + 3 * vec_size));
+        const auto vec_max = wrapper::vmax(v0, v1);
+#ifdef __aarch64__
+        const T block_max = wrapper::vmaxv(vec_max);
+#else  // __aarch64__
+        auto carry_max = wrapper::vpmax(wrapper::vgethigh(vec_max), wrapper::vgetlow(vec_max));
+        for (unsigned int i = 2; i < vec_size; i *= 2)
+        {
+            carry_max = wrapper::vpmax(carry_max, carry_max);
+        }
+        const T block_max = wrapper::vgetlane(carry_max, 0);
+#endif // __aarch64__
+
+        if (block_max > threshold)
+        {
+            for (unsigned int i = 0; i < step; ++i)
+            {
+                append(x + i);
+            }
+        }
+    }
+
+    // Compute left-over elements
+    for (; x < len; ++x)
+    {
+        append(x);
+    }
+
+    if (sorted)
+    {
+        std::partial_sort(candidates, candidates + k, candidates + num_candidates, topk_ranks_before<T>);
+    }
+    else
+    {
+        // Return the selected elements in the order of the row
+        topk_compact(candidates, num_candidates, k);
+        std::sort(candidates, candidates + k,
+                  [](const TopKCandidate<T> &a, const TopKCandidate<T> &b) { return a.index < b.index; });
+    }
+
+    for (unsigned int i = 0; i < k; ++i)
+    {
+        values[i]  = candidates[i].value;
+        indices[i] = candidates[i].index;
+    }
+}
+
+template <typename T>
+void neon_topk(const ITensor *src,
+               ITensor       *values,
+               ITensor       *indices,
+               void          *scratch,
+               unsigned int   capacity,
+               unsigned int   k,
+               bool           sorted,
+               const Window  &window)
+{
+    static_assert(sizeof(TopKCandidate<T>) <= 2 * sizeof(int32_t), "Candidates must fit in the scratch buffer");
+
+    const unsigned int len        = src->info()->dimension(0);
+    auto              *candidates = reinterpret_cast<TopKCandidate<T> *>(scratch);
+
+    Window win = window;
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    Iterator src_it(src, win);
+    Iterator values_it(values, win);
+    Iterator indices_it(indices, win);
+
+    execute_window_loop(
+        win,
+        [&](const Coordinates &)
+        {
+            topk_row(reinterpret_cast<const T *>(src_it.ptr()), len, k, sorted, candidates, capacity,
+                     reinterpret_cast<T *>(values_it.ptr()), reinterpret_cast<int32_t *>(indices_it.ptr()));
+        },
+        src_it, values_it, indices_it);
+}
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_TOPK_GENERIC_NEON_IMPL_H
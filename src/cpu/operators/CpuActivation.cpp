@@ -40,7 +40,8 @@ void CpuActivation::configure(const ITensorInfo *input, ITensorInfo *output, con
     ARM_COMPUTE_LOG_PARAMS(input, output, activation_info);
     auto k = std::make_unique<kernels::CpuActivationKernel>();
     k->configure(input, output, activation_info);
-    _kernel = std::move(k);
+    _kernel     = std::move(k);
+    _is_dynamic = input->is_dynamic();
 }
 
 Status
@@ -52,8 +53,19 @@ CpuActivation::validate(const ITensorInfo *input, const ITensorInfo *output, con
 void CpuActivation::run(ITensorPack &tensors)
 {
     ARM_COMPUTE_ERROR_ON_MSG(tensors.empty(), "No inputs provided");
-    auto split_dimension = static_cast<kernels::CpuActivationKernel *>(_kernel.get())->get_split_dimension_hint();
-    NEScheduler::get().schedule_op(_kernel.get(), split_dimension, _kernel->window(), tensors);
+    auto *kernel = static_cast<kernels::CpuActivationKernel *>(_kernel.get());
+    if (_is_dynamic)
+    {
+        const ITensor *src = tensors.get_const_tensor(TensorType::ACL_SRC);
+        ARM_COMPUTE_ERROR_ON_NULLPTR(src);
+
+        Window win;
+        size_t split_dimension;
+        std::tie(win, split_dimension) = kernel->compute_window(*src->info());
+        NEScheduler::get().schedule_op(kernel, split_dimension, win, tensors);
+        return;
+    }
+    NEScheduler::get().schedule_op(kernel, kernel->get_split_dimension_hint(), _kernel->window(), tensors);
 }
 
 std::tuple<IOperator *, StatusCode> CpuContext::create_activation(const AclTensorDescriptor     &src,
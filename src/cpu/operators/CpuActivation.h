@@ -37,6 +37,9 @@ class CpuActivation : public ICpuOperator
 {
 public:
     /** Configure operator for a given list of arguments
+     *
+     * @note If @p input has dynamic dimensions, its configured shape is the largest one the operator runs on and the
+     *       execution window is recomputed from the shape of the tensors passed to @ref run
      *
      * @param[in]  input           Source tensor info. Data types supported: QASYMM8/QASYMM8_SIGNED/QSYMM16/F16/F32.
      * @param[out] output          Destination tensor info. Data type supported: same as @p src
@@ -53,6 +56,9 @@ public:
 
     // Inherited methods overridden:
     void run(ITensorPack &tensors) override;
+
+private:
+    bool _is_dynamic{false};
 };
 } // namespace cpu
 } // namespace arm_compute
@@ -23,102 +23,89 @@
  */
 #include "src/cpu/operators/CpuConv2d.h"
 
+#include "arm_compute/core/utils/DataLayoutUtils.h"
+#include "arm_compute/core/utils/DataTypeUtils.h"
+#include "arm_compute/runtime/MemoryGroup.h"
 #include "arm_compute/runtime/NEON/functions/NEFFTConvolutionLayer.h"
+#include "arm_compute/runtime/NEON/NEConvolutionMethodTuner.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
+#include "arm_compute/runtime/Tensor.h"
 
 #include "src/common/utils/Log.h"
+#include "src/core/helpers/MemoryHelpers.h"
 #include "src/cpu/operators/CpuDirectConv2d.h"
 #include "src/cpu/operators/CpuGemm.h"
 #include "src/cpu/operators/CpuGemmConv2d.h"
 #include "src/cpu/operators/CpuGemmDirectConv2d.h"
 #include "src/cpu/operators/CpuWinogradConv2d.h"
 
+#include <chrono>
+#include <cstring>
+#include <sstream>
+#include <vector>
+
 namespace arm_compute
 {
 namespace cpu
 {
-CpuConv2d::CpuConv2d() : _function()
+namespace
 {
-}
-
-CpuConv2d::~CpuConv2d() = default;
-
-void CpuConv2d::configure(ITensorInfo               *input,
-                          ITensorInfo               *weights,
-                          const ITensorInfo         *biases,
-                          ITensorInfo               *output,
-                          const PadStrideInfo       &conv_info,
-                          const WeightsInfo         &weights_info,
-                          const Size2D              &dilation,
-                          const ActivationLayerInfo &act_info,
-                          bool                       enable_fast_math,
-                          unsigned int               num_groups)
+std::unique_ptr<ICpuOperator> create_function(ConvolutionMethod          method,
+                                              ITensorInfo               *input,
+                                              ITensorInfo               *weights,
+                                              const ITensorInfo         *biases,
+                                              ITensorInfo               *output,
+                                              const PadStrideInfo       &conv_info,
+                                              const WeightsInfo         &weights_info,
+                                              const Size2D              &dilation,
+                                              const ActivationLayerInfo &act_info,
+                                              bool                       enable_fast_math)
 {
-    // Perform validate step
-    ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, output);
-    ARM_COMPUTE_UNUSED(num_groups);
-    ARM_COMPUTE_ERROR_THROW_ON(CpuConv2d::validate(input, weights, biases, output, conv_info, weights_info, dilation,
-                                                   act_info, enable_fast_math, num_groups));
-
-    ARM_COMPUTE_LOG_PARAMS(input, weights, biases, output, conv_info, weights_info, dilation, act_info,
-                           enable_fast_math, num_groups);
-
-    const Conv2dInfo info(conv_info, dilation, act_info, enable_fast_math, num_groups);
-    switch (CpuConv2d::get_convolution_method(input, weights, output, conv_info, weights_info, dilation, act_info,
-                                              enable_fast_math))
+    switch (method)
     {
         case ConvolutionMethod::WINOGRAD:
         {
             auto f = std::make_unique<CpuWinogradConv2d>();
             f->configure(input, weights, biases, output, conv_info, act_info, enable_fast_math);
-            _function = std::move(f);
-            break;
+            return f;
         }
         case ConvolutionMethod::GEMM:
         {
             auto f = std::make_unique<CpuGemmConv2d>();
             f->configure(input, weights, biases, output, conv_info, weights_info, dilation, act_info, enable_fast_math);
-            _function = std::move(f);
-            break;
+            return f;
         }
         case ConvolutionMethod::GEMM_CONV2D:
         {
             auto f = std::make_unique<CpuGemmDirectConv2d>();
+            const Conv2dInfo info(conv_info, dilation, act_info, enable_fast_math, 1);
             f->configure(input, weights, biases, output, info);
-            _function = std::move(f);
-            break;
+            return f;
         }
         case ConvolutionMethod::DIRECT:
         {
             auto f = std::make_unique<CpuDirectConv2d>();
             f->configure(input, weights, biases, output, conv_info, act_info);
-            _function = std::move(f);
-            break;
+            return f;
         }
         default:
             ARM_COMPUTE_ERROR("Not supported.");
-            break;
+            return nullptr;
     }
-
-    _aux_mem = _function->workspace();
 }
 
-Status CpuConv2d::validate(const ITensorInfo         *input,
-                           const ITensorInfo         *weights,
-                           const ITensorInfo         *biases,
-                           const ITensorInfo         *output,
-                           const PadStrideInfo       &conv_info,
-                           const WeightsInfo         &weights_info,
-                           const Size2D              &dilation,
-                           const ActivationLayerInfo &act_info,
-                           bool                       enable_fast_math,
-                           unsigned int               num_groups)
+Status validate_method(ConvolutionMethod          method,
+                       const ITensorInfo         *input,
+                       const ITensorInfo         *weights,
+                       const ITensorInfo         *biases,
+                       const ITensorInfo         *output,
+                       const PadStrideInfo       &conv_info,
+                       const WeightsInfo         &weights_info,
+                       const Size2D              &dilation,
+                       const ActivationLayerInfo &act_info,
+                       bool                       enable_fast_math)
 {
-    ARM_COMPUTE_RETURN_ERROR_ON_MSG((num_groups != 1), "Grouping (num_groups != 1) is not supported on Neon");
-
-    const Conv2dInfo info(conv_info, dilation, act_info, enable_fast_math, num_groups);
-    switch (CpuConv2d::get_convolution_method(input, weights, output, conv_info, weights_info, dilation, act_info,
-                                              enable_fast_math))
+    switch (method)
     {
         case ConvolutionMethod::WINOGRAD:
             ARM_COMPUTE_RETURN_ON_ERROR(
@@ -129,19 +116,240 @@ Status CpuConv2d::validate(const ITensorInfo         *input,
                                                                 dilation, act_info, enable_fast_math));
             break;
         case ConvolutionMethod::GEMM_CONV2D:
-            ARM_COMPUTE_RETURN_ON_ERROR(CpuGemmDirectConv2d::validate(input, weights, biases, output, info));
+            ARM_COMPUTE_RETURN_ON_ERROR(CpuGemmDirectConv2d::validate(
+                input, weights, biases, output, Conv2dInfo(conv_info, dilation, act_info, enable_fast_math, 1)));
             break;
         case ConvolutionMethod::DIRECT:
             ARM_COMPUTE_RETURN_ON_ERROR(CpuDirectConv2d::validate(input, weights, biases, output, conv_info, act_info));
             break;
         default:
-            ARM_COMPUTE_ERROR("Not supported.");
-            break;
+            ARM_COMPUTE_RETURN_ERROR_MSG("Not supported.");
     }
+    return Status{};
+}
+
+/** Unique identifier of a convolution in the table of @ref NEConvolutionMethodTuner */
+std::string tuner_conv_id(const ITensorInfo         *input,
+                          const ITensorInfo         *weights,
+                          const ITensorInfo         *output,
+                          const PadStrideInfo       &conv_info,
+                          const Size2D              &dilation,
+                          const ActivationLayerInfo &act_info,
+                          bool                       enable_fast_math)
+{
+    std::stringstream id;
+    id << string_from_data_type(input->data_type()) << "_" << string_from_data_type(weights->data_type()) << "_"
+       << string_from_data_type(output->data_type()) << "_" << string_from_data_layout(input->data_layout()) << "_I";
+    for (size_t d = 0; d < input->num_dimensions(); ++d)
+    {
+        id << (d == 0 ? "" : "x") << input->dimension(d);
+    }
+    id << "_W";
+    for (size_t d = 0; d < weights->num_dimensions(); ++d)
+    {
+        id << (d == 0 ? "" : "x") << weights->dimension(d);
+    }
+    id << "_S" << conv_info.stride().first << "x" << conv_info.stride().second << "_P" << conv_info.pad_left() << "x"
+       << conv_info.pad_right() << "x" << conv_info.pad_top() << "x" << conv_info.pad_bottom() << "_D" << dilation.x()
+       << "x" << dilation.y() << "_ACT"
+       << (act_info.enabled() ? static_cast<int>(act_info.activation()) : -1) << "x" << act_info.a() << "x"
+       << act_info.b() << "_FM" << enable_fast_math << "_T" << NEScheduler::get().num_threads();
+    return id.str();
+}
+
+/** Time the convolution methods supporting a convolution and return the fastest one
+ *
+ * Every method is configured on its own copies of the tensor infos and run on zero-initialised tensors, after the
+ * preparation of its weights.
+ *
+ * @param[in]  input            Source tensor info.
+ * @param[in]  weights          Weights tensor info.
+ * @param[in]  biases           Biases tensor info. Can be nullptr.
+ * @param[in]  output           Destination tensor info.
+ * @param[in]  conv_info        Contains padding and stride information described in @ref PadStrideInfo.
+ * @param[in]  weights_info     Weights reshape information.
+ * @param[in]  dilation         Dilation, in elements, across x and y.
+ * @param[in]  act_info         Activation layer information in case of a fused activation.
+ * @param[in]  enable_fast_math Enable fast math computation.
+ * @param[in]  num_iterations   Number of timed runs of each method. The fastest run is kept.
+ * @param[out] best_method      Fastest method.
+ *
+ * @return True if at least one method supports the convolution
+ */
+bool tune_convolution(const ITensorInfo         *input,
+                      const ITensorInfo         *weights,
+                      const ITensorInfo         *biases,
+                      const ITensorInfo         *output,
+                      const PadStrideInfo       &conv_info,
+                      const WeightsInfo         &weights_info,
+                      const Size2D              &dilation,
+                      const ActivationLayerInfo &act_info,
+                      bool                       enable_fast_math,
+                      unsigned int               num_iterations,
+                      ConvolutionMethod         &best_method)
+{
+    using clock = std::chrono::steady_clock;
+
+    // Direct and Winograd convolutions don't take the dilation into account when validating
+    std::vector<ConvolutionMethod> candidates;
+    for (auto method : {ConvolutionMethod::GEMM, ConvolutionMethod::GEMM_CONV2D, ConvolutionMethod::DIRECT,
+                        ConvolutionMethod::WINOGRAD})
+    {
+        const bool supports_dilation =
+            method == ConvolutionMethod::GEMM || method == ConvolutionMethod::GEMM_CONV2D;
+        if ((supports_dilation || dilation == Size2D(1U, 1U)) &&
+            bool(validate_method(method, input, weights, biases, output, conv_info, weights_info, dilation, act_info,
+                                 enable_fast_math)))
+        {
+            candidates.push_back(method);
+        }
+    }
+    if (candidates.empty())
+    {
+        return false;
+    }
+
+    best_method    = candidates.front();
+    auto best_time = clock::duration::max();
+    for (size_t i = 0; i < candidates.size() && candidates.size() > 1; ++i)
+    {
+        Tensor src;
+        Tensor wei;
+        Tensor bia;
+        Tensor dst;
+        src.allocator()->init(TensorInfo(*input->clone()));
+        wei.allocator()->init(TensorInfo(*weights->clone()));
+        dst.allocator()->init(TensorInfo(*output->clone()));
+        std::vector<Tensor *> tensors{&src, &wei, &dst};
+        if (biases != nullptr)
+        {
+            bia.allocator()->init(TensorInfo(*biases->clone()));
+            tensors.push_back(&bia);
+        }
+        auto f = create_function(candidates[i], src.info(), wei.info(), biases != nullptr ? bia.info() : nullptr,
+                                 dst.info(), conv_info, weights_info, dilation, act_info, enable_fast_math);
+
+        for (auto t : tensors)
+        {
+            t->allocator()->allocate();
+            std::memset(t->buffer(), 0, t->info()->total_size());
+        }
+        ITensorPack pack{{TensorType::ACL_SRC_0, &src}, {TensorType::ACL_SRC_1, &wei}, {TensorType::ACL_DST, &dst}};
+        if (biases != nullptr)
+        {
+            pack.add_const_tensor(TensorType::ACL_SRC_2, &bia);
+        }
+        MemoryGroup memory_group;
+        auto        workspace = manage_workspace<Tensor>(f->workspace(), memory_group, pack, pack);
+
+        // Warm up run, which also prepares the weights
+        f->prepare(pack);
+        f->run(pack);
+
+        auto time = clock::duration::max();
+        for (unsigned int iteration = 0; iteration < num_iterations; ++iteration)
+        {
+            const auto start = clock::now();
+            f->run(pack);
+            time = std::min(time, clock::now() - start);
+        }
+        if (time < best_time)
+        {
+            best_time   = time;
+            best_method = candidates[i];
+        }
+    }
+    return true;
+}
+} // namespace
+
+CpuConv2d::CpuConv2d() : _function()
+{
+}
+
+CpuConv2d::~CpuConv2d() = default;
+
+void CpuConv2d::configure(ITensorInfo               *input,
+                          ITensorInfo               *weights,
+                          const ITensorInfo         *biases,
+                          ITensorInfo               *output,
+                          const PadStrideInfo       &conv_info,
+                          const WeightsInfo         &weights_info,
+                          const Size2D              &dilation,
+                          const ActivationLayerInfo &act_info,
+                          bool                       enable_fast_math,
+                          unsigned int               num_groups)
+{
+    // Perform validate step
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, output);
+    ARM_COMPUTE_UNUSED(num_groups);
+    ARM_COMPUTE_ERROR_THROW_ON(CpuConv2d::validate(input, weights, biases, output, conv_info, weights_info, dilation,
+                                                   act_info, enable_fast_math, num_groups));
+
+    ARM_COMPUTE_LOG_PARAMS(input, weights, biases, output, conv_info, weights_info, dilation, act_info,
+                           enable_fast_math, num_groups);
+
+    CpuConv2d::tune_convolution_method(input, weights, biases, output, conv_info, weights_info, dilation, act_info,
+                                       enable_fast_math);
+    const ConvolutionMethod method = CpuConv2d::get_convolution_method(input, weights, output, conv_info,
+                                                                       weights_info, dilation, act_info,
+                                                                       enable_fast_math);
+    _function = create_function(method, input, weights, biases, output, conv_info, weights_info, dilation, act_info,
+                                enable_fast_math);
+
+    _aux_mem = _function->workspace();
+}
+
+Status CpuConv2d::validate(const ITensorInfo         *input,
+                           const ITensorInfo         *weights,
+                           const ITensorInfo         *biases,
+                           const ITensorInfo         *output,
+                           const PadStrideInfo       &conv_info,
+                           const WeightsInfo         &weights_info,
+                           const Size2D              &dilation,
+                           const ActivationLayerInfo &act_info,
+                           bool                       enable_fast_math,
+                           unsigned int               num_groups)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG((num_groups != 1), "Grouping (num_groups != 1) is not supported on Neon");
+
+    const ConvolutionMethod method = CpuConv2d::get_convolution_method(input, weights, output, conv_info,
+                                                                       weights_info, dilation, act_info,
+                                                                       enable_fast_math);
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_method(method, input, weights, biases, output, conv_info, weights_info,
+                                                dilation, act_info, enable_fast_math));
 
     return Status{};
 }
 
+void CpuConv2d::tune_convolution_method(const ITensorInfo         *input,
+                                        const ITensorInfo         *weights,
+                                        const ITensorInfo         *biases,
+                                        const ITensorInfo         *output,
+                                        const PadStrideInfo       &conv_info,
+                                        const WeightsInfo         &weights_info,
+                                        const Size2D              &dilation,
+                                        const ActivationLayerInfo &act_info,
+                                        bool                       enable_fast_math)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, output, weights);
+
+    NEConvolutionMethodTuner *tuner = NEConvolutionMethodTuner::active_tuner();
+    if (tuner == nullptr || !tuner->tune_new_convolutions() || weights_info.are_reshaped())
+    {
+        return;
+    }
+
+    const std::string conv_id = tuner_conv_id(input, weights, output, conv_info, dilation, act_info, enable_fast_math);
+    ConvolutionMethod method  = ConvolutionMethod::GEMM;
+    if (!tuner->find_method(conv_id, method) &&
+        tune_convolution(input, weights, biases, output, conv_info, weights_info, dilation, act_info, enable_fast_math,
+                         tuner->num_iterations(), method))
+    {
+        tuner->add_method(conv_id, method);
+    }
+}
+
 ConvolutionMethod CpuConv2d::get_convolution_method(const ITensorInfo         *input,
                                                     const ITensorInfo         *weights,
                                                     const ITensorInfo         *output,
@@ -152,7 +360,23 @@ ConvolutionMethod CpuConv2d::get_convolution_method(const ITensorInfo         *i
                                                     bool                       enable_fast_math)
 {
     ARM_COMPUTE_ERROR_ON_NULLPTR(input, output, weights);
-    ARM_COMPUTE_UNUSED(weights_info);
+
+    // Use the method measured by the convolution tuner, if any. Reshaped weights can only be consumed by GEMM.
+    // Convolutions are only timed by tune_convolution_method(), at configuration.
+    NEConvolutionMethodTuner *tuner = NEConvolutionMethodTuner::active_tuner();
+    if (tuner != nullptr && !weights_info.are_reshaped())
+    {
+        const std::string conv_id =
+            tuner_conv_id(input, weights, output, conv_info, dilation, act_info, enable_fast_math);
+        ConvolutionMethod method = ConvolutionMethod::GEMM;
+        // A table created with a different build may contain methods which are not supported anymore
+        if (tuner->find_method(conv_id, method) &&
+            bool(validate_method(method, input, weights, nullptr, output, conv_info, weights_info, dilation, act_info,
+                                 enable_fast_math)))
+        {
+            return method;
+        }
+    }
 
     const size_t idx_w = get_data_layout_dimension_index(input->data_layout(), DataLayoutDimension::WIDTH);
     const size_t idx_h = get_data_layout_dimension_index(input->data_layout(), DataLayoutDimension::HEIGHT);
@@ -277,7 +501,11 @@ ConvolutionMethod CpuConv2d::get_convolution_method(const ITensorInfo         *i
             return ConvolutionMethod::GEMM;
         }
 
-        if (bool(CpuWinogradConv2d::validate(input, weights, nullptr, output, conv_info, act_info, enable_fast_math)))
+        // Quantized Winograd multiplies 16-bit matrices, which only pays off over the 8-bit GEMM with the larger
+        // output tiles allowed by fast math
+        const bool winograd_preferred = !is_data_type_quantized(input->data_type()) || enable_fast_math;
+        if (winograd_preferred &&
+            bool(CpuWinogradConv2d::validate(input, weights, nullptr, output, conv_info, act_info, enable_fast_math)))
         {
             return ConvolutionMethod::WINOGRAD;
         }
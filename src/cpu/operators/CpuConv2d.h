@@ -151,6 +151,9 @@ public:
      * @param[in] enable_fast_math (Optional) Enable fast math computation. In case this flag were set, the function could dispatch the fastest implementation
      *                             available which may introduce a drop of accuracy as well. Default is false
      *
+     * @note When a @ref NEConvolutionMethodTuner is active, the method it recorded for the convolution is returned.
+     *       The convolution is never timed here: see @ref tune_convolution_method.
+     *
      * @return the Convolution Method Hint
      */
     static ConvolutionMethod get_convolution_method(const ITensorInfo         *src,
@@ -161,6 +164,33 @@ public:
                                                     const Size2D              &dilation         = Size2D(1U, 1U),
                                                     const ActivationLayerInfo &act_info         = ActivationLayerInfo(),
                                                     bool                       enable_fast_math = false);
+    /** Time the convolution methods supporting the given configuration with the active @ref NEConvolutionMethodTuner
+     *
+     * Does nothing if no tuner is active, if it doesn't tune new convolutions, or if it already has a method for the
+     * convolution. Otherwise the fastest method is recorded in the tuner, and returned by @ref get_convolution_method
+     * afterwards.
+     *
+     * @note Allocates and runs tensors: only to be called when configuring a function, never from validate().
+     *
+     * @param[in] src              Source tensor info.
+     * @param[in] weights          Weights tensor info.
+     * @param[in] biases           Biases tensor info. Can be nullptr.
+     * @param[in] dst              Destination tensor info.
+     * @param[in] conv_info        Contains padding and stride information described in @ref PadStrideInfo.
+     * @param[in] weights_info     (Optional) Weights reshape information.
+     * @param[in] dilation         (Optional) Dilation, in elements, across x and y. Defaults to (1, 1).
+     * @param[in] act_info         (Optional) Activation layer information in case of a fused activation.
+     * @param[in] enable_fast_math (Optional) Enable fast math computation. Default is false
+     */
+    static void tune_convolution_method(const ITensorInfo         *src,
+                                        const ITensorInfo         *weights,
+                                        const ITensorInfo         *biases,
+                                        const ITensorInfo         *dst,
+                                        const PadStrideInfo       &conv_info,
+                                        const WeightsInfo         &weights_info     = WeightsInfo(),
+                                        const Size2D              &dilation         = Size2D(1U, 1U),
+                                        const ActivationLayerInfo &act_info         = ActivationLayerInfo(),
+                                        bool                       enable_fast_math = false);
     // Inherited methods overridden:
     void                             run(ITensorPack &tensors) override;
     void                             prepare(ITensorPack &constants) override;
@@ -0,0 +1,297 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/operators/CpuDynamicQuantizedGemm.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/KernelDescriptors.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+
+#include "src/common/utils/Log.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/MemoryHelpers.h"
+#include "src/cpu/kernels/CpuGemmLowpDequantizeRowsKernel.h"
+#include "src/cpu/kernels/CpuGemmLowpMatrixReductionKernel.h"
+#include "src/cpu/kernels/CpuGemmLowpQuantizeRowsKernel.h"
+#include "src/cpu/operators/CpuActivation.h"
+#include "src/cpu/operators/CpuGemmLowpMatrixMultiplyCore.h"
+#include "src/cpu/utils/CpuAuxTensorHandler.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+using namespace arm_compute::experimental;
+
+namespace
+{
+TensorShape compute_dst_shape(const ITensorInfo &a, const ITensorInfo &b)
+{
+    TensorShape shape = a.tensor_shape();
+    shape.set(0, b.dimension(0));
+    return shape;
+}
+
+// Info of the quantized rows of matrix A. The actual scale and offset of each row are computed at run time, so the
+// multiplication is run with a unit scale and a zero offset and they are applied when dequantizing the result
+TensorInfo quantized_a_info(const ITensorInfo &a)
+{
+    TensorInfo info = *a.clone();
+    info.set_data_type(DataType::QASYMM8_SIGNED).set_quantization_info(QuantizationInfo(1.f, 0));
+    return info;
+}
+
+// QSYMM8 matrix B is multiplied as QASYMM8_SIGNED with a zero offset, so that the same kernels as for
+// QASYMM8_SIGNED can be used. They have the same representation.
+TensorInfo mm_b_info(const ITensorInfo &b)
+{
+    TensorInfo info = *b.clone();
+    if (b.data_type() == DataType::QSYMM8)
+    {
+        info.set_data_type(DataType::QASYMM8_SIGNED)
+            .set_quantization_info(QuantizationInfo(b.quantization_info().uniform().scale, 0));
+    }
+    return info;
+}
+} // namespace
+
+CpuDynamicQuantizedGemm::CpuDynamicQuantizedGemm()
+    : _quantize_a_kernel(),
+      _mm_gemmlowp(),
+      _mtx_b_reduction_kernel(),
+      _dequantize_kernel(),
+      _activation_func(),
+      _quantized_a(),
+      _row_qinfo(),
+      _mm_result_s32(),
+      _weights_sum(),
+      _reshape_b_only_on_first_run(false),
+      _is_prepared(false),
+      _aux_mem(Count)
+{
+}
+
+CpuDynamicQuantizedGemm::~CpuDynamicQuantizedGemm() = default;
+
+void CpuDynamicQuantizedGemm::configure(
+    const ITensorInfo *a, const ITensorInfo *b, const ITensorInfo *c, ITensorInfo *dst, const GEMMInfo &gemm_info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(a, b, dst);
+    ARM_COMPUTE_ERROR_THROW_ON(CpuDynamicQuantizedGemm::validate(a, b, c, dst, gemm_info));
+    ARM_COMPUTE_LOG_PARAMS(a, b, c, dst, gemm_info);
+
+    _reshape_b_only_on_first_run = b->are_values_constant();
+    _is_prepared                 = false;
+
+    auto_init_if_empty(*dst, a->clone()->set_tensor_shape(compute_dst_shape(*a, *b)));
+
+    // Quantize the rows of matrix A
+    _quantized_a       = quantized_a_info(*a);
+    _quantize_a_kernel = std::make_unique<kernels::CpuGemmLowpQuantizeRowsKernel>();
+    _quantize_a_kernel->configure(a, &_quantized_a, &_row_qinfo);
+
+    // Multiply the quantized matrices, without any offset contribution as both offsets are 0
+    GEMMInfo mm_info = gemm_info;
+    mm_info.set_activation_info(ActivationLayerInfo());
+
+    const TensorInfo b_info = mm_b_info(*b);
+    _mm_result_s32          = TensorInfo(dst->tensor_shape(), 1, DataType::S32);
+    _mm_gemmlowp            = std::make_unique<CpuGemmLowpMatrixMultiplyCore>();
+    _mm_gemmlowp->configure(&_quantized_a, &b_info, nullptr, &_mm_result_s32, mm_info);
+
+    // The sums of the columns of matrix B remove the contribution of the offsets of the rows of matrix A
+    const GEMMLowpReductionKernelInfo reduction_info(a->dimension(0), false, 0, false);
+    _mtx_b_reduction_kernel = std::make_unique<kernels::CpuGemmLowpMatrixBReductionKernel>();
+    _mtx_b_reduction_kernel->configure(b, &_weights_sum, reduction_info);
+
+    _dequantize_kernel = std::make_unique<kernels::CpuGemmLowpDequantizeRowsKernel>();
+    _dequantize_kernel->configure(&_mm_result_s32, &_row_qinfo, b, &_weights_sum, c, dst);
+
+    const ActivationLayerInfo &activation = gemm_info.activation_info();
+    if (activation.enabled())
+    {
+        _activation_func = std::make_unique<CpuActivation>();
+        _activation_func->configure(dst, nullptr, activation);
+    }
+
+    const auto mm_mem_req = _mm_gemmlowp->workspace();
+    for (unsigned int slot = 0; slot < mm_mem_req.size(); ++slot)
+    {
+        _aux_mem[slot] = mm_mem_req[slot];
+    }
+
+    _aux_mem[QuantizedA] =
+        MemoryInfo(offset_int_vec(QuantizedA), MemoryLifetime::Temporary, _quantized_a.total_size());
+    _aux_mem[RowQuantInfo] =
+        MemoryInfo(offset_int_vec(RowQuantInfo), MemoryLifetime::Temporary, _row_qinfo.total_size());
+    _aux_mem[MMResultS32] =
+        MemoryInfo(offset_int_vec(MMResultS32), MemoryLifetime::Temporary, _mm_result_s32.total_size());
+    _aux_mem[WeightsSum] = MemoryInfo(offset_int_vec(WeightsSum),
+                                      _reshape_b_only_on_first_run ? MemoryLifetime::Persistent
+                                                                   : MemoryLifetime::Temporary,
+                                      _weights_sum.total_size());
+}
+
+Status CpuDynamicQuantizedGemm::validate(const ITensorInfo *a,
+                                         const ITensorInfo *b,
+                                         const ITensorInfo *c,
+                                         const ITensorInfo *dst,
+                                         const GEMMInfo    &gemm_info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(a, b, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(a, 1, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(b, 1, DataType::QASYMM8_SIGNED, DataType::QSYMM8,
+                                                         DataType::QSYMM8_PER_CHANNEL);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(a->is_dynamic() || b->is_dynamic() || dst->is_dynamic(),
+                                    "Dynamic shapes are not supported");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(b->num_dimensions() > 2, "Batched matrix B is not supported");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(
+        a->dimension(0) != b->dimension(1),
+        "The product AB is defined only if the number of columns in A is equal to the number of rows in B");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(gemm_info.is_a_reshaped(), "Matrix A already reshaped is not supported");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(gemm_info.is_b_reshaped(), "Matrix B already reshaped is not supported");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(gemm_info.pretranspose_A(), "Matrix A already pretransposed is not supported");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(gemm_info.pretranspose_B(), "Matrix B already pretransposed is not supported");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(gemm_info.accumulate(), "Accumulation is not supported");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(gemm_info.gemmlowp_output_stage().type != GEMMLowpOutputStageType::NONE,
+                                    "The output is dequantized, so no output stage is supported");
+
+    TensorInfo dst_info = *dst->clone();
+    auto_init_if_empty(dst_info, a->clone()->set_tensor_shape(compute_dst_shape(*a, *b)));
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(&dst_info, 1, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(dst_info.tensor_shape(), compute_dst_shape(*a, *b));
+
+    const TensorInfo quantized_a = quantized_a_info(*a);
+    TensorInfo       row_qinfo{};
+    ARM_COMPUTE_RETURN_ON_ERROR(kernels::CpuGemmLowpQuantizeRowsKernel::validate(a, &quantized_a, &row_qinfo));
+
+    GEMMInfo mm_info = gemm_info;
+    mm_info.set_activation_info(ActivationLayerInfo());
+
+    const TensorInfo b_info = mm_b_info(*b);
+    const TensorInfo mm_result_s32(dst_info.tensor_shape(), 1, DataType::S32);
+    ARM_COMPUTE_RETURN_ON_ERROR(
+        CpuGemmLowpMatrixMultiplyCore::validate(&quantized_a, &b_info, nullptr, &mm_result_s32, mm_info));
+
+    const TensorInfo weights_sum(TensorShape(b->dimension(0)), 1, DataType::S32);
+    ARM_COMPUTE_RETURN_ON_ERROR(kernels::CpuGemmLowpMatrixBReductionKernel::validate(
+        b, &weights_sum, GEMMLowpReductionKernelInfo(a->dimension(0), false, 0, false)));
+
+    TensorShape row_qinfo_shape = a->tensor_shape();
+    row_qinfo_shape.set(0, 2);
+    row_qinfo = TensorInfo(row_qinfo_shape, 1, DataType::F32);
+    ARM_COMPUTE_RETURN_ON_ERROR(
+        kernels::CpuGemmLowpDequantizeRowsKernel::validate(&mm_result_s32, &row_qinfo, b, &weights_sum, c, &dst_info));
+
+    if (gemm_info.activation_info().enabled())
+    {
+        ARM_COMPUTE_RETURN_ON_ERROR(CpuActivation::validate(&dst_info, nullptr, gemm_info.activation_info()));
+    }
+
+    return Status{};
+}
+
+void CpuDynamicQuantizedGemm::run(ITensorPack &tensors)
+{
+    prepare(tensors);
+
+    auto a   = tensors.get_const_tensor(TensorType::ACL_SRC_0);
+    auto b   = tensors.get_const_tensor(TensorType::ACL_SRC_1);
+    auto c   = tensors.get_const_tensor(TensorType::ACL_SRC_2);
+    auto dst = tensors.get_tensor(TensorType::ACL_DST);
+
+    CpuAuxTensorHandler quantized_a(offset_int_vec(QuantizedA), _quantized_a, tensors, false);
+    CpuAuxTensorHandler row_qinfo(offset_int_vec(RowQuantInfo), _row_qinfo, tensors, false);
+    CpuAuxTensorHandler mm_result_s32(offset_int_vec(MMResultS32), _mm_result_s32, tensors, false);
+    CpuAuxTensorHandler weights_sum(offset_int_vec(WeightsSum), _weights_sum, tensors, true);
+
+    // Quantize the rows of matrix A
+    ITensorPack quantize_pack = {{TensorType::ACL_SRC, a},
+                                 {TensorType::ACL_DST_0, quantized_a.get()},
+                                 {TensorType::ACL_DST_1, row_qinfo.get()}};
+    NEScheduler::get().schedule_op(_quantize_a_kernel.get(), Window::DimY, _quantize_a_kernel->window(),
+                                   quantize_pack);
+
+    // Run the integer matrix multiplication. The bias is added when dequantizing, so it is not passed on.
+    ITensorPack mm_pack = tensors;
+    mm_pack.add_const_tensor(TensorType::ACL_SRC_0, quantized_a.get());
+    mm_pack.remove_tensor(TensorType::ACL_SRC_2);
+    mm_pack.add_tensor(TensorType::ACL_DST, mm_result_s32.get());
+    _mm_gemmlowp->run(mm_pack);
+
+    if (!_reshape_b_only_on_first_run)
+    {
+        ITensorPack pack = {{TensorType::ACL_SRC, b}, {TensorType::ACL_DST, weights_sum.get()}};
+        NEScheduler::get().schedule_op(_mtx_b_reduction_kernel.get(), Window::DimX, _mtx_b_reduction_kernel->window(),
+                                       pack);
+    }
+
+    ITensorPack dequantize_pack = {{TensorType::ACL_SRC_0, mm_result_s32.get()},
+                                   {TensorType::ACL_SRC_1, row_qinfo.get()},
+                                   {TensorType::ACL_SRC_2, weights_sum.get()},
+                                   {TensorType::ACL_SRC_3, c},
+                                   {TensorType::ACL_DST, dst}};
+    NEScheduler::get().schedule_op(_dequantize_kernel.get(), Window::DimY, _dequantize_kernel->window(),
+                                   dequantize_pack);
+
+    if (_activation_func != nullptr)
+    {
+        ITensorPack pack = {{TensorType::ACL_SRC, dst}, {TensorType::ACL_DST, dst}};
+        _activation_func->run(pack);
+    }
+}
+
+void CpuDynamicQuantizedGemm::prepare(ITensorPack &tensors)
+{
+    if (!_is_prepared)
+    {
+        // Reduce matrix B before preparing the multiplication, which may mark it as unused once reshaped
+        if (_reshape_b_only_on_first_run)
+        {
+            auto     b             = tensors.get_const_tensor(TensorType::ACL_SRC_1);
+            ITensor *weights_sum_p =
+                utils::cast::polymorphic_downcast<ITensor *>(tensors.get_tensor(offset_int_vec(WeightsSum)));
+            CpuAuxTensorHandler weights_sum(_weights_sum, *weights_sum_p);
+            ITensorPack         pack = {{TensorType::ACL_SRC, b}, {TensorType::ACL_DST, weights_sum.get()}};
+            NEScheduler::get().schedule_op(_mtx_b_reduction_kernel.get(), Window::DimX,
+                                           _mtx_b_reduction_kernel->window(), pack);
+        }
+
+        ITensorPack mm_pack = tensors;
+        mm_pack.remove_tensor(TensorType::ACL_SRC_2);
+        _mm_gemmlowp->prepare(mm_pack);
+
+        _is_prepared = true;
+    }
+}
+
+experimental::MemoryRequirements CpuDynamicQuantizedGemm::workspace() const
+{
+    return _aux_mem;
+}
+} // namespace cpu
+} // namespace arm_compute
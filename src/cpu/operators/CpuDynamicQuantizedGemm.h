@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_OPERATORS_CPUDYNAMICQUANTIZEDGEMM_H
+#define ACL_SRC_CPU_OPERATORS_CPUDYNAMICQUANTIZEDGEMM_H
+
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/function_info/GEMMInfo.h"
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuOperator.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+class CpuGemmLowpQuantizeRowsKernel;
+class CpuGemmLowpMatrixBReductionKernel;
+class CpuGemmLowpDequantizeRowsKernel;
+} // namespace kernels
+class CpuGemmLowpMatrixMultiplyCore;
+class CpuActivation;
+
+/** Basic function to multiply a F32 matrix by a quantized matrix, quantizing the F32 matrix on the fly.
+ *
+ * Each row of matrix A is quantized to QASYMM8_SIGNED with its own scale and offset, computed from the range of
+ * the row at run time. The quantized rows are multiplied by matrix B with integer arithmetic and the result is
+ * dequantized to F32. This function calls the following kernels/operators:
+ *
+ *  -# @ref kernels::CpuGemmLowpQuantizeRowsKernel
+ *  -# @ref CpuGemmLowpMatrixMultiplyCore
+ *  -# @ref kernels::CpuGemmLowpMatrixBReductionKernel (called once if matrix B is constant)
+ *  -# @ref kernels::CpuGemmLowpDequantizeRowsKernel
+ *  -# @ref CpuActivation (if an activation is enabled in @p gemm_info)
+ */
+class CpuDynamicQuantizedGemm : public ICpuOperator
+{
+public:
+    /** Constructor */
+    CpuDynamicQuantizedGemm();
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuDynamicQuantizedGemm);
+    /** Destructor */
+    ~CpuDynamicQuantizedGemm();
+    /** Initialise the kernel's inputs, output
+     *
+     * Valid data layouts:
+     * - All
+     *
+     * Valid data type configurations:
+     * |src0 |src1               |src2 |dst |
+     * |:----|:------------------|:----|:---|
+     * |F32  |QASYMM8_SIGNED     |F32  |F32 |
+     * |F32  |QSYMM8             |F32  |F32 |
+     * |F32  |QSYMM8_PER_CHANNEL |F32  |F32 |
+     *
+     * @note Matrix B must be symmetrically quantized, i.e. its quantization offset must be 0.
+     *
+     * @param[in]  a         First input tensor info (Matrix A). Data type supported: F32.
+     * @param[in]  b         Second input tensor info (Matrix B).
+     *                       Data type supported: QASYMM8_SIGNED/QSYMM8/QSYMM8_PER_CHANNEL.
+     * @param[in]  c         Bias tensor info. It can be a nullptr. Shape: [N]. Data type supported: F32
+     * @param[out] dst       Output tensor info. Data type supported: F32
+     * @param[in]  gemm_info (Optional) Specifies the activation to apply to the output. Reshaped and pretransposed
+     *                       matrices are not supported.
+     */
+    void configure(const ITensorInfo *a,
+                   const ITensorInfo *b,
+                   const ITensorInfo *c,
+                   ITensorInfo       *dst,
+                   const GEMMInfo    &gemm_info = GEMMInfo());
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuDynamicQuantizedGemm::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *a,
+                           const ITensorInfo *b,
+                           const ITensorInfo *c,
+                           const ITensorInfo *dst,
+                           const GEMMInfo    &gemm_info = GEMMInfo());
+
+    // Inherited methods overridden:
+    void                             run(ITensorPack &tensors) override;
+    void                             prepare(ITensorPack &tensors) override;
+    experimental::MemoryRequirements workspace() const override;
+
+private:
+    enum AuxTensorIdx
+    {
+        /* Slots 0 - 9 reserved for CpuGemmLowpMatrixMultiplyCore */
+        QuantizedA = 10,
+        RowQuantInfo,
+        MMResultS32,
+        WeightsSum,
+        Count
+    };
+
+    std::unique_ptr<kernels::CpuGemmLowpQuantizeRowsKernel>     _quantize_a_kernel;
+    std::unique_ptr<CpuGemmLowpMatrixMultiplyCore>              _mm_gemmlowp;
+    std::unique_ptr<kernels::CpuGemmLowpMatrixBReductionKernel> _mtx_b_reduction_kernel;
+    std::unique_ptr<kernels::CpuGemmLowpDequantizeRowsKernel>   _dequantize_kernel;
+    std::unique_ptr<CpuActivation>                              _activation_func;
+
+    TensorInfo _quantized_a;
+    TensorInfo _row_qinfo;
+    TensorInfo _mm_result_s32;
+    TensorInfo _weights_sum;
+
+    bool                             _reshape_b_only_on_first_run;
+    bool                             _is_prepared;
+    experimental::MemoryRequirements _aux_mem{};
+};
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_OPERATORS_CPUDYNAMICQUANTIZEDGEMM_H
@@ -36,6 +36,7 @@
 #include "src/core/utils/quantization/AsymmHelpers.h"
 #include "src/cpu/kernels/CpuTransposeKernel.h"
 #include "src/cpu/operators/CpuConvertFullyConnectedWeights.h"
+#include "src/cpu/operators/CpuDynamicQuantizedGemm.h"
 #include "src/cpu/operators/CpuFlatten.h"
 #include "src/cpu/operators/CpuGemm.h"
 #include "src/cpu/operators/CpuGemmLowpMatrixMultiplyCore.h"
@@ -50,6 +51,14 @@ using namespace arm_compute::misc::shape_calculator;
 
 namespace
 {
+// F32 src multiplied by quantized weights, quantizing src on the fly
+bool is_dynamic_quantization(const ITensorInfo *src, const ITensorInfo *weights)
+{
+    return src->data_type() == DataType::F32 &&
+           (weights->data_type() == DataType::QASYMM8_SIGNED || weights->data_type() == DataType::QSYMM8 ||
+            weights->data_type() == DataType::QSYMM8_PER_CHANNEL);
+}
+
 Status get_gemmlowp_output_stage_info(const ITensorInfo         *src,
                                       const ITensorInfo         *weights,
                                       const ITensorInfo         *dst,
@@ -113,6 +122,12 @@ Status validate_mm(const ITensorInfo         *src,
         ARM_COMPUTE_RETURN_ON_ERROR(
             CpuGemmLowpMatrixMultiplyCore::validate(&src_info, &weights_info, biases, dst, gemm_info));
     }
+    else if (is_dynamic_quantization(src, weights))
+    {
+        GEMMInfo gemm_info;
+        gemm_info.set_activation_info(act);
+        ARM_COMPUTE_RETURN_ON_ERROR(CpuDynamicQuantizedGemm::validate(src, weights, biases, dst, gemm_info));
+    }
     else
     {
         GEMMInfo gemm_info;
@@ -132,6 +147,7 @@ CpuFullyConnected::CpuFullyConnected()
       _transpose_weights(nullptr),
       _mm_gemm(nullptr),
       _mm_gemmlowp(nullptr),
+      _mm_dynamic_quantized(nullptr),
       _flattened_src(),
       _converted_weights(),
       _reshaped_weights(),
@@ -142,6 +158,7 @@ CpuFullyConnected::CpuFullyConnected()
       _needs_weights_reshape(false),
       _is_fc_after_conv(false),
       _is_quantized_asymmetric(false),
+      _is_dynamic_quantization(false),
       _is_prepared(false),
       _enable_fast_math(false),
       _fixed_format(false),
@@ -183,6 +200,13 @@ void CpuFullyConnected::configure_mm(const ITensorInfo         *src,
         _mm_gemmlowp = std::make_unique<CpuGemmLowpMatrixMultiplyCore>();
         _mm_gemmlowp->configure(&src_info, &weights_info, biases, dst, gemm_info);
     }
+    else if (_is_dynamic_quantization)
+    {
+        GEMMInfo gemm_info;
+        gemm_info.set_activation_info(act);
+        _mm_dynamic_quantized = std::make_unique<CpuDynamicQuantizedGemm>();
+        _mm_dynamic_quantized->configure(src, weights, biases, dst, gemm_info);
+    }
     else
     {
         // Configure matrix multiply kernel
@@ -246,6 +270,7 @@ void CpuFullyConnected::configure(const ITensorInfo      *src,
     _needs_weights_reshape    = _needs_weights_reshape && !fc_info.retain_internal_weights;
     _is_fc_after_conv         = true;
     _is_quantized_asymmetric  = is_data_type_quantized_asymmetric(src->data_type());
+    _is_dynamic_quantization  = is_dynamic_quantization(src, weights);
     _is_prepared              = false;
     _trans_weights_idx        = AuxTensorIdx::Count;
     _enable_fast_math         = fc_info.enable_fast_math;
@@ -318,7 +343,9 @@ void CpuFullyConnected::configure(const ITensorInfo      *src,
     }
 
     // Set auxiliary memory requirements
-    auto gemm_mem_req = (_is_quantized_asymmetric) ? _mm_gemmlowp->workspace() : _mm_gemm->workspace();
+    auto gemm_mem_req = (_is_quantized_asymmetric)   ? _mm_gemmlowp->workspace()
+                        : (_is_dynamic_quantization) ? _mm_dynamic_quantized->workspace()
+                                                     : _mm_gemm->workspace();
     for (unsigned int i = 0; i < gemm_mem_req.size(); ++i)
     {
         _aux_mem[i] = gemm_mem_req[i];
@@ -391,6 +418,10 @@ Status CpuFullyConnected::validate(const ITensorInfo      *src,
         ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_NOT_IN(weights, DataType::BFLOAT16);
         ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_NOT_IN(dst, DataType::F32);
     }
+    else if (is_dynamic_quantization(src, weights))
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, dst);
+    }
     else
     {
         ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, weights, dst);
@@ -520,6 +551,10 @@ void CpuFullyConnected::run(ITensorPack &tensors)
     {
         _mm_gemmlowp->run(gemm_pack);
     }
+    else if (_is_dynamic_quantization)
+    {
+        _mm_dynamic_quantized->run(gemm_pack);
+    }
     else
     {
         _mm_gemm->run(gemm_pack);
@@ -569,13 +604,17 @@ void CpuFullyConnected::prepare(ITensorPack &tensors)
         gemm_pack.add_const_tensor(ACL_SRC_1, cur_weights);
 
         // Prepare GEMM prepare and release unused weights
-        if (!_is_quantized_asymmetric)
+        if (_is_quantized_asymmetric)
         {
-            _mm_gemm->prepare(gemm_pack);
+            _mm_gemmlowp->prepare(gemm_pack);
+        }
+        else if (_is_dynamic_quantization)
+        {
+            _mm_dynamic_quantized->prepare(gemm_pack);
         }
         else
         {
-            _mm_gemmlowp->prepare(gemm_pack);
+            _mm_gemm->prepare(gemm_pack);
         }
 
         _is_prepared = true;
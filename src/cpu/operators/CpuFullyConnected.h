@@ -37,6 +37,7 @@ namespace cpu
 {
 // Forward declarations
 class CpuConvertFullyConnectedWeights;
+class CpuDynamicQuantizedGemm;
 class CpuFlatten;
 class CpuGemm;
 class CpuGemmLowpMatrixMultiplyCore;
@@ -47,7 +48,8 @@ class CpuTransposeKernel;
 /** Basic function to compute a Fully Connected layer. This function calls the following kernels:
  *  -# @ref kernels::CpuIm2ColKernel (called when the input comes from a convolutional layer)
  *  -# @ref kernels::CpuTransposeKernel (if @p are_weights_reshaped is set to false and transpose_weights is set to true ) (called once)
- *  -# @ref CpuGemm or @ref CpuGemmLowpMatrixMultiplyCore (if quantized asymmetric)
+ *  -# @ref CpuGemm or @ref CpuGemmLowpMatrixMultiplyCore (if quantized asymmetric) or @ref CpuDynamicQuantizedGemm (if
+ *     the weights are quantized and the src is not)
  *  -# @ref kernels::CpuGemmMatrixAdditionKernel or @ref CpuGemmLowpOutputStage (if quantized asymmetric) (if @p biases is not equal to nullptr)
  *
  * @note  The fully connected layer accepts "weights" tensors only with 2 dimensions.
@@ -70,15 +72,22 @@ public:
      * |:--------------|:------------------|:------|:--------------|
      * |F16            |F16                |F16    |F16            |
      * |F32            |F32                |F32    |F32            |
+     * |F32            |QASYMM8_SIGNED     |F32    |F32            |
+     * |F32            |QSYMM8             |F32    |F32            |
+     * |F32            |QSYMM8_PER_CHANNEL |F32    |F32            |
      * |QASYMM8        |QASYMM8            |S32    |QASYMM8        |
      * |QASYMM8_SIGNED |QASYMM8_SIGNED     |S32    |QASYMM8_SIGNED |
      *
+     * @note With F32 src and quantized weights, the rows of src are dynamically quantized to QASYMM8_SIGNED, each with
+     *       its own scale and offset, and the product is computed with integer arithmetic then dequantized to F32.
+     *       The weights must be symmetrically quantized, per tensor or per output channel.
+     *
      * @param[in]  src          Source tensor info. Data type supported: QASYMM8/QASYMM8_SIGNED/F16/F32.
      * @param[in]  weights      Weights tensor info. The weights must be 2 dimensional.
      *                          If this function is called after a Convolution Layer, the (transposed) weights will have as many rows as the product of the first 3 input's dimensions.
      *                          If it is called after another FullyConnected Layer, the (transposed) weights will have as many rows as the input's first dimension.
-     *                          Data type supported: Same as @p src.
-     * @param[in]  biases       Bias tensor info. Can be nullptr. Data type supported: Same as @p weights, S32 if @p weights is QASYMM8/QASYMM8_SIGNED.
+     *                          Data type supported: Same as @p src, or QASYMM8_SIGNED/QSYMM8/QSYMM8_PER_CHANNEL if @p src is F32.
+     * @param[in]  biases       Bias tensor info. Can be nullptr. Data type supported: Same as @p src, S32 if @p src is QASYMM8/QASYMM8_SIGNED.
      * @param[out] dst          Destination tensor info. Its shape should be equal to the output of a matrix multiplication between:
      *                          - The output of im2col on the input and the (transposed) 2D weights, if the function is called after a Convolution Layer
      *                          - The input tensor and the (transposed) 2D weights, if the function is called after another FullyConnected Layer.
@@ -153,7 +162,11 @@ private:
         GemmTemp6,
         GemmTemp7,
         GemmTemp8,
-        // Slots above (0-9) reserved for either CpuGemm or CpuGemmLowpMatrixMultiplyCore
+        GemmTemp9,
+        GemmTemp10,
+        GemmTemp11,
+        GemmTemp12,
+        // Slots above (0-13) reserved for either CpuGemm, CpuGemmLowpMatrixMultiplyCore or CpuDynamicQuantizedGemm
         TransposedWeights,
         ConvertedWeights,
         FlattenedSrc,
@@ -165,6 +178,7 @@ private:
     std::unique_ptr<kernels::CpuTransposeKernel>     _transpose_weights;
     std::unique_ptr<CpuGemm>                         _mm_gemm;
     std::unique_ptr<CpuGemmLowpMatrixMultiplyCore>   _mm_gemmlowp;
+    std::unique_ptr<CpuDynamicQuantizedGemm>         _mm_dynamic_quantized;
 
     TensorInfo   _flattened_src;
     TensorInfo   _converted_weights;
@@ -178,6 +192,7 @@ private:
     bool                      _needs_weights_reshape;
     bool                      _is_fc_after_conv;
     bool                      _is_quantized_asymmetric;
+    bool                      _is_dynamic_quantization;
     bool                      _is_prepared;
     bool                      _enable_fast_math;
     bool                      _fixed_format;
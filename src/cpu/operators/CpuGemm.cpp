@@ -93,6 +93,14 @@ void CpuGemm::configure(const ITensorInfo *a,
         (!run_optimised ||
          (run_optimised && !cpu::CpuGemmAssemblyDispatch::is_activation_supported(gemm_info.activation_info())));
 
+    // With dynamic shapes, the activations run on the current shape of d rather than on the configured one
+    TensorInfo d_to_activate = *d->clone();
+    if (a->is_dynamic() || b->is_dynamic() || d->is_dynamic())
+    {
+        d_to_activate.set_tensor_dims_state(
+            ITensorInfo::TensorDimsState(TensorShape::num_max_dimensions, ITensorInfo::get_dynamic_state_value()));
+    }
+
     if (run_optimised)
     {
         _run_interleave_transpose   = false;
@@ -112,7 +120,8 @@ void CpuGemm::configure(const ITensorInfo *a,
         {
             _alpha_scale_func = std::make_unique<cpu::CpuActivation>();
             _alpha_scale_func->configure(
-                d, nullptr, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LINEAR, alpha, 0.f));
+                &d_to_activate, nullptr,
+                ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LINEAR, alpha, 0.f));
         }
     }
     else
@@ -207,7 +216,7 @@ void CpuGemm::configure(const ITensorInfo *a,
     if (_run_activation)
     {
         _activation_func = std::make_unique<cpu::CpuActivation>();
-        _activation_func->configure(d, nullptr, gemm_info.activation_info());
+        _activation_func->configure(&d_to_activate, nullptr, gemm_info.activation_info());
     }
 }
 
@@ -334,6 +343,10 @@ Status CpuGemm::validate(const ITensorInfo *a,
         !(!b->are_values_constant() &&
           b->tensor_shape().z() > 1); // Disable batch matmul as optimized GeMM handles batching differently.
 
+    // Only the assembly kernels can run on shapes other than the configured ones
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG((a->is_dynamic() || b->is_dynamic() || d->is_dynamic()) && !run_optimised,
+                                    "Dynamic shapes are only supported by the assembly kernels");
+
     if (!run_optimised)
     {
         ARM_COMPUTE_RETURN_ERROR_ON_MSG(gemm_info.reinterpret_input_as_3d(),
@@ -84,6 +84,8 @@ public:
      * @note GEMM: The tensors a, b, c, d must have the same data type. You should not mix data types when calling this function.
      *
      * @note Batched GEMM only supports broadcasting cases where RHS rank < LHS rank but not the other way around
+     * @note If any tensor has dynamic dimensions, the configured shapes are the largest ones the operator runs on.
+     *       Only the assembly path supports them; it runs on the shapes of the tensors passed to run().
      *
      * @param[in]  a         First input tensor info (Matrix A or Vector A). Data type supported: BFLOAT16/F16/F32
      * @param[in]  b         Second input tensor info (Matrix B). Data type supported: same as @p a
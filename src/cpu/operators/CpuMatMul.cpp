@@ -80,6 +80,56 @@ Status get_gemmlowp_output_stage_info(const ITensorInfo         *src,
 
     return Status{};
 }
+
+// F32 lhs multiplied by a quantized rhs, quantizing lhs on the fly
+bool is_dynamic_quantization(const ITensorInfo *lhs, const ITensorInfo *rhs)
+{
+    return lhs->data_type() == DataType::F32 &&
+           (rhs->data_type() == DataType::QASYMM8_SIGNED || rhs->data_type() == DataType::QSYMM8 ||
+            rhs->data_type() == DataType::QSYMM8_PER_CHANNEL);
+}
+
+// The rows of all the batches of lhs and dst are multiplied by the same 2D rhs, so they are collapsed
+TensorShape collapse_batches(const TensorShape &shape)
+{
+    return shape.collapsed_from(1);
+}
+
+Status validate_dynamic_quantization(const ITensorInfo         *lhs,
+                                     const ITensorInfo         *rhs,
+                                     const ITensorInfo         *dst,
+                                     const MatMulInfo          &info,
+                                     const CpuMatMulSettings   &settings,
+                                     const ActivationLayerInfo &act_info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(lhs, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(lhs->are_values_constant(), "LHS Tensor must be dynamic.");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(info.adj_lhs(), "Transposed LHS is not supported with a quantized RHS");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(settings.fixed_format(), "Fixed format is not supported with a quantized RHS");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(rhs->num_dimensions() > 2, "Batched quantized RHS is not supported");
+
+    const ITensorInfo *rhs_to_use = rhs;
+    TensorInfo         rhs_transposed{};
+    if (info.adj_rhs())
+    {
+        auto_init_if_empty(rhs_transposed,
+                           rhs->clone()->set_tensor_shape(misc::shape_calculator::compute_transposed_shape(*rhs)));
+        ARM_COMPUTE_RETURN_ON_ERROR(cpu::kernels::CpuTransposeKernel::validate(rhs, &rhs_transposed));
+        rhs_to_use = &rhs_transposed;
+    }
+
+    TensorInfo lhs_collapsed = *lhs->clone();
+    TensorInfo dst_collapsed = *dst->clone();
+    lhs_collapsed.set_tensor_shape(collapse_batches(lhs->tensor_shape()));
+    dst_collapsed.set_tensor_shape(collapse_batches(dst->tensor_shape()));
+
+    GEMMInfo gemm_info;
+    gemm_info.set_activation_info(act_info);
+    ARM_COMPUTE_RETURN_ON_ERROR(
+        CpuDynamicQuantizedGemm::validate(&lhs_collapsed, rhs_to_use, nullptr, &dst_collapsed, gemm_info));
+
+    return Status{};
+}
 } // namespace
 
 CpuMatMul::CpuMatMul()
@@ -101,6 +151,12 @@ Status CpuMatMul::validate(const ITensorInfo         *lhs,
                            const CpuMatMulSettings   &settings,
                            const ActivationLayerInfo &act_info)
 {
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(lhs, rhs, dst);
+    if (is_dynamic_quantization(lhs, rhs))
+    {
+        return validate_dynamic_quantization(lhs, rhs, dst, info, settings, act_info);
+    }
+
     ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(lhs, rhs, dst);
     ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(lhs, 1, DataType::F32, DataType::F16, DataType::BFLOAT16,
                                                          DataType::QASYMM8, DataType::QASYMM8_SIGNED);
@@ -184,11 +240,20 @@ void CpuMatMul::configure(ITensorInfo               *lhs,
 {
     ARM_COMPUTE_ERROR_ON_NULLPTR(lhs, rhs, dst);
     ARM_COMPUTE_LOG_PARAMS(lhs, rhs, dst, info, settings);
-    ARM_COMPUTE_ERROR_THROW_ON(CpuMatMul::validate(lhs, rhs, dst, info, settings));
+    ARM_COMPUTE_ERROR_THROW_ON(CpuMatMul::validate(lhs, rhs, dst, info, settings, act_info));
+
+    _adj_lhs                 = info.adj_lhs();
+    _adj_rhs                 = info.adj_rhs();
+    _fast_math               = settings.fast_math();
+    _is_dynamic              = lhs->is_dynamic() || rhs->is_dynamic() || dst->is_dynamic();
+    _is_dynamic_quantization = is_dynamic_quantization(lhs, rhs);
+    _is_rhs_transposed       = false;
 
-    _adj_lhs   = info.adj_lhs();
-    _adj_rhs   = info.adj_rhs();
-    _fast_math = settings.fast_math();
+    if (_is_dynamic_quantization)
+    {
+        configure_dynamic_quantization(lhs, rhs, dst, act_info);
+        return;
+    }
 
     // 1. Create and reshape tensors
     // ------------------------------------------------------
@@ -282,26 +347,117 @@ void CpuMatMul::configure(ITensorInfo               *lhs,
     }
 }
 
+void CpuMatMul::configure_dynamic_quantization(const ITensorInfo         *lhs,
+                                               const ITensorInfo         *rhs,
+                                               ITensorInfo               *dst,
+                                               const ActivationLayerInfo &act_info)
+{
+    _original_lhs_shape = lhs->tensor_shape();
+    _original_dst_shape = dst->tensor_shape();
+    _original_rhs_shape = rhs->tensor_shape();
+
+    TensorInfo lhs_to_use = *lhs->clone();
+    TensorInfo dst_to_use = *dst->clone();
+    lhs_to_use.set_tensor_shape(collapse_batches(_original_lhs_shape));
+    dst_to_use.set_tensor_shape(collapse_batches(_original_dst_shape));
+
+    const ITensorInfo *rhs_to_use = rhs;
+    if (_adj_rhs)
+    {
+        // A constant rhs is transposed once, on the first run, and kept along with its sums and reshaped form
+        _transpose_kernel_rhs = std::make_unique<cpu::kernels::CpuTransposeKernel>();
+        _transpose_kernel_rhs->configure(rhs, &_rhs_transposed);
+        _rhs_transposed.set_are_values_constant(rhs->are_values_constant());
+        rhs_to_use = &_rhs_transposed;
+
+        _aux_mem[TransposeRHS] =
+            MemoryInfo(offset_int_vec(TransposeRHS),
+                       rhs->are_values_constant() ? MemoryLifetime::Persistent : MemoryLifetime::Temporary,
+                       rhs->total_size());
+    }
+
+    GEMMInfo gemm_info;
+    gemm_info.set_activation_info(act_info);
+    _mm_dynamic_quantized = std::make_unique<CpuDynamicQuantizedGemm>();
+    _mm_dynamic_quantized->configure(&lhs_to_use, rhs_to_use, nullptr, &dst_to_use, gemm_info);
+
+    const auto mm_mem_req = _mm_dynamic_quantized->workspace();
+    for (unsigned int slot = 0; slot < mm_mem_req.size(); ++slot)
+    {
+        _aux_mem[slot] = mm_mem_req[slot];
+    }
+}
+
+void CpuMatMul::run_dynamic_quantization(ITensorPack &tensors)
+{
+    auto lhs = tensors.get_tensor(ACL_SRC_0);
+    auto rhs = tensors.get_const_tensor(ACL_SRC_1);
+    auto dst = tensors.get_tensor(ACL_DST);
+
+    lhs->info()->set_tensor_shape(collapse_batches(_original_lhs_shape));
+    dst->info()->set_tensor_shape(collapse_batches(_original_dst_shape));
+
+    CpuAuxTensorHandler rhs_transposed(offset_int_vec(TransposeRHS), _rhs_transposed, tensors, true);
+
+    ITensorPack mm_tensors(tensors);
+    if (_adj_rhs)
+    {
+        if (!_is_rhs_transposed)
+        {
+            ITensorPack rhs_transpose_pack = {{TensorType::ACL_SRC, rhs}, {TensorType::ACL_DST, rhs_transposed.get()}};
+            NEScheduler::get().schedule_op(_transpose_kernel_rhs.get(), Window::DimY, _transpose_kernel_rhs->window(),
+                                           rhs_transpose_pack);
+            _is_rhs_transposed = _rhs_transposed.are_values_constant();
+        }
+        mm_tensors.add_const_tensor(TensorType::ACL_SRC_1, rhs_transposed.get());
+    }
+    _mm_dynamic_quantized->run(mm_tensors);
+
+    dst->info()->set_tensor_shape(_original_dst_shape);
+    lhs->info()->set_tensor_shape(_original_lhs_shape);
+}
+
 void CpuMatMul::run(ITensorPack &tensors)
 {
+    if (_is_dynamic_quantization)
+    {
+        run_dynamic_quantization(tensors);
+        return;
+    }
+
     // Retrieve tensors from tensor pack
     auto lhs = tensors.get_tensor(ACL_SRC_0);
     auto rhs = tensors.get_const_tensor(ACL_SRC_1);
     auto dst = tensors.get_tensor(ACL_DST);
 
+    // With dynamic shapes, run on the current shapes of the tensors rather than on the configured ones
+    const TensorShape lhs_shape = _is_dynamic ? lhs->info()->tensor_shape() : _original_lhs_shape;
+    const TensorShape rhs_shape = _is_dynamic ? rhs->info()->tensor_shape() : _original_rhs_shape;
+    const TensorShape dst_shape = _is_dynamic ? dst->info()->tensor_shape() : _original_dst_shape;
+
     // Reshape LHS and DST to ensure compatibility with GEMM asm kernel (Batch dimensions is 4th for lhs and dst within asm)
     // Collapse RHS (necessary to support dimensions larger than 3 in gemm assembly)
-    lhs->info()->set_tensor_shape(
-        TensorShape(_original_lhs_shape.x(), _original_lhs_shape.y(), 1,
-                    _original_lhs_shape.collapsed_from(2).z())); // Collapsed 3+ dimensions into z
-    dst->info()->set_tensor_shape(
-        TensorShape(_original_dst_shape.x(), _original_dst_shape.y(), 1,
-                    _original_dst_shape.collapsed_from(2).z())); // Collapsed 3+ dimensions into z
-    rhs->info()->set_tensor_shape(_original_rhs_shape.collapsed_from(2));
+    lhs->info()->set_tensor_shape(TensorShape(lhs_shape.x(), lhs_shape.y(), 1,
+                                              lhs_shape.collapsed_from(2).z())); // Collapsed 3+ dimensions into z
+    dst->info()->set_tensor_shape(TensorShape(dst_shape.x(), dst_shape.y(), 1,
+                                              dst_shape.collapsed_from(2).z())); // Collapsed 3+ dimensions into z
+    rhs->info()->set_tensor_shape(rhs_shape.collapsed_from(2));
+
+    // Transposed tensors take the shape of the tensors they are transposed from
+    TensorInfo lhs_transposed_info = _lhs_transposed;
+    TensorInfo rhs_transposed_info = _rhs_transposed;
+    if (_is_dynamic && _adj_lhs)
+    {
+        lhs_transposed_info.set_tensor_shape(misc::shape_calculator::compute_transposed_shape(*lhs->info()));
+    }
+    if (_is_dynamic && _adj_rhs)
+    {
+        rhs_transposed_info.set_tensor_shape(misc::shape_calculator::compute_transposed_shape(*rhs->info()));
+    }
 
     // Initialise object to handle stored transposed tensors in auxillary memory
-    CpuAuxTensorHandler lhs_transposed(offset_int_vec(TransposeLHS), _lhs_transposed, tensors, true);
-    CpuAuxTensorHandler rhs_transposed(offset_int_vec(TransposeRHS), _rhs_transposed, tensors, true);
+    CpuAuxTensorHandler lhs_transposed(offset_int_vec(TransposeLHS), lhs_transposed_info, tensors, true);
+    CpuAuxTensorHandler rhs_transposed(offset_int_vec(TransposeRHS), rhs_transposed_info, tensors, true);
 
     // Create tensor pack for asm kernel
     ITensorPack asm_tensors(tensors);
@@ -310,25 +466,27 @@ void CpuMatMul::run(ITensorPack &tensors)
     if (_adj_lhs)
     {
         ITensorPack lhs_transpose_pack = {{TensorType::ACL_SRC, lhs}, {TensorType::ACL_DST, lhs_transposed.get()}};
-        NEScheduler::get().schedule_op(_transpose_kernel_lhs.get(), Window::DimY, _transpose_kernel_lhs->window(),
-                                       lhs_transpose_pack);
+        const Window win = _is_dynamic ? kernels::CpuTransposeKernel::compute_window(*lhs->info())
+                                       : _transpose_kernel_lhs->window();
+        NEScheduler::get().schedule_op(_transpose_kernel_lhs.get(), Window::DimY, win, lhs_transpose_pack);
         asm_tensors.add_const_tensor(TensorType::ACL_SRC_0, lhs_transposed.get());
     }
     // Run transpose rhs if necessary
     if (_adj_rhs)
     {
         ITensorPack rhs_transpose_pack = {{TensorType::ACL_SRC, rhs}, {TensorType::ACL_DST, rhs_transposed.get()}};
-        NEScheduler::get().schedule_op(_transpose_kernel_rhs.get(), Window::DimY, _transpose_kernel_rhs->window(),
-                                       rhs_transpose_pack);
+        const Window win = _is_dynamic ? kernels::CpuTransposeKernel::compute_window(*rhs->info())
+                                       : _transpose_kernel_rhs->window();
+        NEScheduler::get().schedule_op(_transpose_kernel_rhs.get(), Window::DimY, win, rhs_transpose_pack);
         asm_tensors.add_const_tensor(TensorType::ACL_SRC_1, rhs_transposed.get());
     }
     // Run asm kernel
     _asm_glue->run(asm_tensors);
 
     // Undo reshape of tensors
-    dst->info()->set_tensor_shape(_original_dst_shape);
-    lhs->info()->set_tensor_shape(_original_lhs_shape);
-    rhs->info()->set_tensor_shape(_original_rhs_shape);
+    dst->info()->set_tensor_shape(dst_shape);
+    lhs->info()->set_tensor_shape(lhs_shape);
+    rhs->info()->set_tensor_shape(rhs_shape);
 }
 
 experimental::MemoryRequirements CpuMatMul::workspace() const
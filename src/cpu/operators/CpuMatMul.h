@@ -29,6 +29,7 @@
 #include "src/core/common/Macros.h"
 #include "src/cpu/ICpuOperator.h"
 #include "src/cpu/kernels/CpuTransposeKernel.h"
+#include "src/cpu/operators/CpuDynamicQuantizedGemm.h"
 #include "src/cpu/operators/internal/CpuGemmAssemblyDispatch.h"
 
 namespace arm_compute
@@ -44,7 +45,7 @@ namespace cpu
  * If adjoint/adj flag is enabled for either input lhs or rhs (or both) :
  *  -# @ref cpu::kernels::CpuTransposeKernel
  * Then :
- *  -# @ref cpu::CpuGemmAssemblyDispatch
+ *  -# @ref cpu::CpuGemmAssemblyDispatch, or @ref cpu::CpuDynamicQuantizedGemm if lhs is F32 and rhs is quantized
  */
 class CpuMatMul : public ICpuOperator
 {
@@ -59,6 +60,8 @@ public:
      *
      * Note: Check documentation of @ref NEMatMul for a list of supported datatypes and layouts
      *
+     * Note: If any tensor has dynamic dimensions, the configured shapes are the largest ones the operator runs on.
+     *       The workspace is sized for them and @ref run uses the shapes of the tensors it is given.
      *
      * @param[in]  lhs      Left-hand side tensor info.
      * @param[in]  rhs      Right-hand side tensor info.
@@ -91,10 +94,16 @@ public:
     experimental::MemoryRequirements workspace() const override;
 
 private:
+    void configure_dynamic_quantization(const ITensorInfo         *lhs,
+                                        const ITensorInfo         *rhs,
+                                        ITensorInfo               *dst,
+                                        const ActivationLayerInfo &act_info);
+    void run_dynamic_quantization(ITensorPack &tensors);
+
     enum InternalTensorIdx
     {
-        /* Slots 0 - 2 reserved for CpuGemmAssemblyDispatch */
-        TransposeLHS = 3,
+        /* Slots 0 - 13 reserved for CpuGemmAssemblyDispatch or CpuDynamicQuantizedGemm */
+        TransposeLHS = 14,
         TransposeRHS,
         Count
     };
@@ -103,6 +112,7 @@ private:
     std::unique_ptr<kernels::CpuTransposeKernel> _transpose_kernel_lhs{nullptr};
     std::unique_ptr<kernels::CpuTransposeKernel> _transpose_kernel_rhs{nullptr};
     std::unique_ptr<CpuGemmAssemblyDispatch>     _asm_glue{nullptr};
+    std::unique_ptr<CpuDynamicQuantizedGemm>     _mm_dynamic_quantized{nullptr};
 
     // TensorInfo for tensors stored in auxillary memory
     TensorInfo _lhs_transposed{};
@@ -117,6 +127,9 @@ private:
     bool                             _adj_lhs{false};
     bool                             _adj_rhs{false};
     bool                             _fast_math{false};
+    bool                             _is_dynamic{false};
+    bool                             _is_dynamic_quantization{false};
+    bool                             _is_rhs_transposed{false};
     AsmGemmInfo                      _gemm_info{};
     experimental::MemoryRequirements _aux_mem{Count};
 };
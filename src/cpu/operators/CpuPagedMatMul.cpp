@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/operators/CpuPagedMatMul.h"
+
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+
+#include "src/common/utils/Log.h"
+#include "src/cpu/kernels/CpuPagedMatMulKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+void CpuPagedMatMul::configure(const ITensorInfo *lhs,
+                               const ITensorInfo *cache,
+                               const ITensorInfo *block_table,
+                               const ITensorInfo *seq_lens,
+                               ITensorInfo       *dst,
+                               const MatMulInfo  &info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(lhs, cache, block_table, seq_lens, dst);
+    ARM_COMPUTE_ERROR_THROW_ON(CpuPagedMatMul::validate(lhs, cache, block_table, seq_lens, dst, info));
+    ARM_COMPUTE_LOG_PARAMS(lhs, cache, block_table, seq_lens, dst);
+
+    auto kernel = std::make_unique<kernels::CpuPagedMatMulKernel>();
+    kernel->configure(lhs, cache, block_table, seq_lens, dst, info);
+    _kernel = std::move(kernel);
+}
+
+Status CpuPagedMatMul::validate(const ITensorInfo *lhs,
+                                const ITensorInfo *cache,
+                                const ITensorInfo *block_table,
+                                const ITensorInfo *seq_lens,
+                                const ITensorInfo *dst,
+                                const MatMulInfo  &info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(lhs, cache, block_table, seq_lens, dst);
+    return kernels::CpuPagedMatMulKernel::validate(lhs, cache, block_table, seq_lens, dst, info);
+}
+
+void CpuPagedMatMul::run(ITensorPack &tensors)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(tensors.empty(), "No inputs provided");
+
+    // Splitting over the heads keeps the rows of the cache read by a thread to the heads it owns. With fewer heads
+    // than threads, the scores against the cached keys are split over the blocks of the sequences instead, which is
+    // what a single decoding stream needs. The product by the cached values reduces over the blocks, so it is only
+    // split over the heads.
+    const Window &win             = _kernel->window();
+    const size_t  split_dimension = win.num_iterations(Window::DimZ) >= NEScheduler::get().num_threads() ||
+                                           win.num_iterations(Window::DimX) == 1
+                                        ? Window::DimZ
+                                        : Window::DimX;
+    // Every call is a decoding step
+    const auto hints = IScheduler::Hints(split_dimension).set_latency_critical(true);
+    NEScheduler::get().schedule_op(_kernel.get(), hints, win, tensors);
+}
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_OPERATORS_CPUPAGEDMATMUL_H
+#define ACL_SRC_CPU_OPERATORS_CPUPAGEDMATMUL_H
+
+#include "arm_compute/core/ITensorInfo.h"
+#include "arm_compute/function_info/MatMulInfo.h"
+
+#include "src/cpu/ICpuKernel.h"
+#include "src/cpu/ICpuOperator.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+namespace cpu
+{
+/** Basic function to run @ref kernels::CpuPagedMatMulKernel
+ *
+ * Multiplies the few rows of each head of an incremental decoding step by the rows of a paged cache, without
+ * gathering the blocks of the cache into a contiguous tensor first.
+ */
+class CpuPagedMatMul : public ICpuOperator
+{
+public:
+    /** Configure operator for a given list of arguments
+     *
+     * @param[in]  lhs         Left-hand side tensor info of shape [K, M, num_heads, num_batches], with
+     *                         K = cache->dimension(0) if @p info adj_rhs is set, and K = max_seq_len otherwise.
+     *                         Data types supported: F32/F16
+     * @param[in]  cache       Cache tensor info of shape [row_size, block_size, num_kv_heads, num_blocks], where
+     *                         num_heads is a multiple of num_kv_heads. The row size must not exceed 256.
+     *                         Data types supported: same as @p lhs or QASYMM8_SIGNED
+     * @param[in]  block_table Tensor info of the indices of the blocks of each sequence, of shape
+     *                         [max_blocks_per_seq, num_batches]. Data type supported: S32
+     * @param[in]  seq_lens    Tensor info of the number of valid rows of the cache of each sequence, of shape
+     *                         [num_batches]. Data type supported: S32
+     * @param[out] dst         Destination tensor info of shape [max_seq_len, M, num_heads, num_batches] if @p info
+     *                         adj_rhs is set, and [row_size, M, num_heads, num_batches] otherwise.
+     *                         Data type supported: same as @p lhs
+     * @param[in]  info        Matrix multiplication information. adj_lhs must be false.
+     */
+    void configure(const ITensorInfo *lhs,
+                   const ITensorInfo *cache,
+                   const ITensorInfo *block_table,
+                   const ITensorInfo *seq_lens,
+                   ITensorInfo       *dst,
+                   const MatMulInfo  &info);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to @ref CpuPagedMatMul::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *lhs,
+                           const ITensorInfo *cache,
+                           const ITensorInfo *block_table,
+                           const ITensorInfo *seq_lens,
+                           const ITensorInfo *dst,
+                           const MatMulInfo  &info);
+
+    // Inherited methods overridden:
+    void run(ITensorPack &tensors) override;
+
+private:
+    std::unique_ptr<ICPPKernel> _kernel{nullptr};
+};
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_OPERATORS_CPUPAGEDMATMUL_H
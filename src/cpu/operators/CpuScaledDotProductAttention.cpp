@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/operators/CpuScaledDotProductAttention.h"
+
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+
+#include "src/common/utils/Log.h"
+#include "src/cpu/kernels/CpuScaledDotProductAttentionKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+void CpuScaledDotProductAttention::configure(const ITensorInfo                   *query,
+                                             const ITensorInfo                   *key,
+                                             const ITensorInfo                   *value,
+                                             const ITensorInfo                   *mask,
+                                             ITensorInfo                         *dst,
+                                             const ScaledDotProductAttentionInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(query, key, value, dst);
+    ARM_COMPUTE_ERROR_THROW_ON(CpuScaledDotProductAttention::validate(query, key, value, mask, dst, info));
+    ARM_COMPUTE_LOG_PARAMS(query, key, value, mask, dst);
+
+    auto kernel = std::make_unique<kernels::CpuScaledDotProductAttentionKernel>();
+    kernel->configure(query, key, value, mask, dst, info);
+    _kernel = std::move(kernel);
+}
+
+Status CpuScaledDotProductAttention::validate(const ITensorInfo                   *query,
+                                              const ITensorInfo                   *key,
+                                              const ITensorInfo                   *value,
+                                              const ITensorInfo                   *mask,
+                                              const ITensorInfo                   *dst,
+                                              const ScaledDotProductAttentionInfo &info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(query, key, value, dst);
+    return kernels::CpuScaledDotProductAttentionKernel::validate(query, key, value, mask, dst, info);
+}
+
+void CpuScaledDotProductAttention::run(ITensorPack &tensors)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(tensors.empty(), "No inputs provided");
+
+    // Splitting over the heads gives every thread its own keys and values. The queries are only split when there
+    // are not enough heads to keep all the threads busy, e.g. for a single batch of a model with few heads.
+    const Window &win             = _kernel->window();
+    const size_t  split_dimension = win.num_iterations(Window::DimZ) >= NEScheduler::get().num_threads()
+                                        ? Window::DimZ
+                                        : Window::DimY;
+    // A single block of queries is a decoding step
+    const auto hints =
+        IScheduler::Hints(split_dimension).set_latency_critical(win.num_iterations(Window::DimY) == 1);
+    NEScheduler::get().schedule_op(_kernel.get(), hints, win, tensors);
+}
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_OPERATORS_CPUSCALEDDOTPRODUCTATTENTION_H
+#define ACL_SRC_CPU_OPERATORS_CPUSCALEDDOTPRODUCTATTENTION_H
+
+#include "arm_compute/core/ITensorInfo.h"
+#include "arm_compute/function_info/ScaledDotProductAttentionInfo.h"
+
+#include "src/cpu/ICpuKernel.h"
+#include "src/cpu/ICpuOperator.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+namespace cpu
+{
+/** Basic function to run @ref kernels::CpuScaledDotProductAttentionKernel
+ *
+ * The attention softmax(scale * Q * K^T + mask) * V is computed in a single pass over the keys and values, without
+ * storing the scores of all the queries against all the keys.
+ */
+class CpuScaledDotProductAttention : public ICpuOperator
+{
+public:
+    /** Configure operator for a given list of arguments
+     *
+     * @param[in]  query Query tensor info of shape [head_size, num_queries, num_heads, num_batches].
+     *                   Data types supported: F32/F16/BFLOAT16. The head size must not exceed 256.
+     * @param[in]  key   Key tensor info of shape [head_size, num_keys, num_kv_heads, num_batches], where num_heads
+     *                   is a multiple of num_kv_heads. Data type supported: same as @p query
+     * @param[in]  value Value tensor info of shape [value_head_size, num_keys, num_kv_heads, num_batches].
+     *                   Data type supported: same as @p query. The value head size must not exceed 256.
+     * @param[in]  mask  (Optional) Mask tensor info of shape [num_keys, num_queries, 1 or num_heads, 1 or num_batches],
+     *                   added to the scaled scores. Can be nullptr. Data type supported: same as @p query
+     * @param[out] dst   Destination tensor info of shape [value_head_size, num_queries, num_heads, num_batches].
+     *                   Data type supported: same as @p query
+     * @param[in]  info  (Optional) Attention information, holding the scale of the scores and the causal mask flag
+     */
+    void configure(const ITensorInfo                   *query,
+                   const ITensorInfo                   *key,
+                   const ITensorInfo                   *value,
+                   const ITensorInfo                   *mask,
+                   ITensorInfo                         *dst,
+                   const ScaledDotProductAttentionInfo &info = ScaledDotProductAttentionInfo());
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to @ref CpuScaledDotProductAttention::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo                   *query,
+                           const ITensorInfo                   *key,
+                           const ITensorInfo                   *value,
+                           const ITensorInfo                   *mask,
+                           const ITensorInfo                   *dst,
+                           const ScaledDotProductAttentionInfo &info = ScaledDotProductAttentionInfo());
+
+    // Inherited methods overridden:
+    void run(ITensorPack &tensors) override;
+
+private:
+    std::unique_ptr<ICPPKernel> _kernel{nullptr};
+};
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_OPERATORS_CPUSCALEDDOTPRODUCTATTENTION_H
@@ -25,13 +25,27 @@
 
 #include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
 
-#include "src/cpu/kernels/CpuScatterKernel.h"
+#include "src/common/utils/Log.h"
+#include "src/core/helpers/MemoryHelpers.h"
+#include "src/cpu/kernels/CpuCopyKernel.h"
+#include "src/cpu/kernels/CpuFillKernel.h"
+#include "src/cpu/utils/CpuAuxTensorHandler.h"
+
+using namespace arm_compute::experimental;
 
 namespace arm_compute
 {
 namespace cpu
 {
+namespace
+{
+// Minimum number of elements of a block per thread for the scatter kernel to be split along the blocks rather than
+// along the indices
+constexpr size_t min_block_elements_per_thread = 256;
+} // namespace
 
 void CpuScatter::configure(const ITensorInfo *src,
                            const ITensorInfo *updates,
@@ -39,12 +53,30 @@ void CpuScatter::configure(const ITensorInfo *src,
                            ITensorInfo       *dst,
                            const ScatterInfo &Scatter_info)
 {
-    ARM_COMPUTE_ERROR_ON_NULLPTR(src, indices, dst);
-    ARM_COMPUTE_UNUSED(src);
-    ARM_COMPUTE_UNUSED(updates);
-    ARM_COMPUTE_UNUSED(indices);
-    ARM_COMPUTE_UNUSED(dst);
-    ARM_COMPUTE_UNUSED(Scatter_info);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(updates, indices, dst);
+    ARM_COMPUTE_LOG_PARAMS(src, updates, indices, dst, Scatter_info);
+    ARM_COMPUTE_ERROR_THROW_ON(CpuScatter::validate(src, updates, indices, dst, Scatter_info));
+
+    if (Scatter_info.zero_initialization)
+    {
+        auto f = std::make_unique<kernels::CpuFillKernel>();
+        f->configure(dst, PixelValue(0.0f));
+        _fill_kernel = std::move(f);
+    }
+    else if (src != dst)
+    {
+        auto c = std::make_unique<kernels::CpuCopyKernel>();
+        c->configure(src, dst);
+        _copy_kernel = std::move(c);
+    }
+
+    _scatter_kernel = std::make_unique<kernels::CpuScatterKernel>();
+    _scatter_kernel->configure(updates, indices, dst, Scatter_info);
+
+    _entries = TensorInfo(
+        TensorShape(_scatter_kernel->num_entries() * sizeof(kernels::CpuScatterKernel::ScatterEntry)), 1, DataType::U8);
+    _aux_mem[InternalTensorIdx::ENTRIES] =
+        MemoryInfo(offset_int_vec(InternalTensorIdx::ENTRIES), MemoryLifetime::Temporary, _entries.total_size());
 }
 
 Status CpuScatter::validate(const ITensorInfo *src,
@@ -53,18 +85,62 @@ Status CpuScatter::validate(const ITensorInfo *src,
                             const ITensorInfo *dst,
                             const ScatterInfo &Scatter_info)
 {
-    ARM_COMPUTE_UNUSED(src);
-    ARM_COMPUTE_UNUSED(updates);
-    ARM_COMPUTE_UNUSED(indices);
-    ARM_COMPUTE_UNUSED(dst);
-    ARM_COMPUTE_UNUSED(Scatter_info);
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(updates, indices, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(src == nullptr && !Scatter_info.zero_initialization,
+                                    "src can only be nullptr with zero initialization");
+    if (src != nullptr)
+    {
+        // Check dst/src are same shape and datatype.
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(src->tensor_shape(), dst->tensor_shape());
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, updates, dst);
+        if (src != dst)
+        {
+            ARM_COMPUTE_RETURN_ON_ERROR(kernels::CpuCopyKernel::validate(src, dst));
+        }
+    }
 
-    return Status{ErrorCode::RUNTIME_ERROR, "No configuration implemented yet."};
+    return kernels::CpuScatterKernel::validate(updates, indices, dst, Scatter_info);
 }
 
 void CpuScatter::run(ITensorPack &tensors)
 {
-    ARM_COMPUTE_UNUSED(tensors);
+    ARM_COMPUTE_ERROR_ON_MSG(tensors.empty(), "No inputs provided");
+
+    auto src     = tensors.get_const_tensor(TensorType::ACL_SRC_0);
+    auto updates = tensors.get_const_tensor(TensorType::ACL_SRC_1);
+    auto indices = tensors.get_const_tensor(TensorType::ACL_SRC_2);
+    auto dst     = tensors.get_tensor(TensorType::ACL_DST);
+
+    if (_fill_kernel != nullptr)
+    {
+        ITensorPack fill_pack{{TensorType::ACL_SRC_DST, dst}};
+        NEScheduler::get().schedule_op(_fill_kernel.get(), Window::DimY, _fill_kernel->window(), fill_pack);
+    }
+    else if (_copy_kernel != nullptr)
+    {
+        ITensorPack copy_pack{{TensorType::ACL_SRC, src}, {TensorType::ACL_DST, dst}};
+        NEScheduler::get().schedule_op(_copy_kernel.get(), Window::DimY, _copy_kernel->window(), copy_pack);
+    }
+
+    CpuAuxTensorHandler entries(offset_int_vec(InternalTensorIdx::ENTRIES), _entries, tensors, true);
+
+    // Wide blocks are split between the threads, which then all go through the indices in order. Otherwise the
+    // indices are split, and grouped by destination so that no two threads update the same block.
+    const size_t block_size = _scatter_kernel->window().num_iterations(Window::DimX);
+    const bool   split_x    = block_size >= NEScheduler::get().num_threads() * min_block_elements_per_thread;
+
+    auto *entries_ptr = reinterpret_cast<kernels::CpuScatterKernel::ScatterEntry *>(entries.get()->buffer());
+    _scatter_kernel->prepare_entries(updates, indices, dst, entries_ptr, !split_x);
+
+    ITensorPack scatter_pack{
+        {TensorType::ACL_SRC_0, updates}, {TensorType::ACL_DST, dst}, {TensorType::ACL_INT_0, entries.get()}};
+    NEScheduler::get().schedule_op(_scatter_kernel.get(), split_x ? Window::DimX : Window::DimY,
+                                   _scatter_kernel->window(), scatter_pack);
+}
+
+experimental::MemoryRequirements CpuScatter::workspace() const
+{
+    return _aux_mem;
 }
 } // namespace cpu
 } // namespace arm_compute
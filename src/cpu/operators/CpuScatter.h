@@ -24,17 +24,26 @@
 #ifndef ACL_SRC_CPU_OPERATORS_CPUSCATTER_H
 #define ACL_SRC_CPU_OPERATORS_CPUSCATTER_H
 
+#include "arm_compute/core/experimental/Types.h"
 #include "arm_compute/core/ITensorInfo.h"
+#include "arm_compute/core/TensorInfo.h"
 #include "arm_compute/function_info/ScatterInfo.h"
 
 #include "src/cpu/ICpuKernel.h"
 #include "src/cpu/ICpuOperator.h"
+#include "src/cpu/kernels/CpuScatterKernel.h"
 
 namespace arm_compute
 {
 namespace cpu
 {
-/** Basic function to execute Scatter in Neon ™ */
+/** Basic function to execute Scatter in Neon ™
+ *
+ * This function runs the following kernels:
+ * -# @ref kernels::CpuFillKernel if zero initialization is requested, or @ref kernels::CpuCopyKernel if src and dst
+ *    are different tensors
+ * -# @ref kernels::CpuScatterKernel
+ */
 class CpuScatter : public ICpuOperator
 {
 public:
@@ -43,13 +52,13 @@ public:
      * Valid data layouts:
      * - All
      *
-     * @note indices must always be U32
+     * @note indices must always be S32
      * @note src, updates and dst tensors must be same datatype.
      *
      * @param[in]  src          Source input tensor info. Can be nullptr when using "Add" Scatter Function with zero initialization.
      * @param[in]  updates      Tensor info for tensor storing update values to use for scatter function. Data types supported: same as @p src.
-     * @param[in]  indices      Tensor info for tensor storing indices to use for scatter function. Data types supported: U32 only.
-     * @param[out] dst          Output tensor to store the result of the Scatter Function. Data types supported: same as @p src and @p updates.
+     * @param[in]  indices      Tensor info for tensor storing indices to use for scatter function. Data types supported: S32 only.
+     * @param[out] dst          Output tensor to store the result of the Scatter Function. Data types supported: F32/F16/S32/S16/S8/U32/U16/U8.
      * @param[in]  Scatter_info Contains Scatter operation information described in @ref ScatterInfo.
      */
     void configure(const ITensorInfo *src,
@@ -70,11 +79,21 @@ public:
                            const ScatterInfo &Scatter_info);
 
     // Inherited methods overridden:
-    void run(ITensorPack &tensors) override;
+    void                             run(ITensorPack &tensors) override;
+    experimental::MemoryRequirements workspace() const override;
 
 private:
-    std::unique_ptr<ICPPKernel> _scatter_kernel{nullptr};
-    std::unique_ptr<ICPPKernel> _fill_kernel{nullptr};
+    enum InternalTensorIdx
+    {
+        ENTRIES = 0,
+        COUNT
+    };
+
+    std::unique_ptr<kernels::CpuScatterKernel> _scatter_kernel{nullptr};
+    std::unique_ptr<ICPPKernel>                _fill_kernel{nullptr};
+    std::unique_ptr<ICPPKernel>                _copy_kernel{nullptr};
+    TensorInfo                                 _entries{};
+    experimental::MemoryRequirements           _aux_mem{InternalTensorIdx::COUNT};
 };
 } // namespace cpu
 } // namespace arm_compute
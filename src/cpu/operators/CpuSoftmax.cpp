@@ -55,7 +55,8 @@ void CpuSoftmaxGeneric::configure(const ITensorInfo *src, ITensorInfo *dst, floa
     const unsigned int actual_axis =
         static_cast<unsigned int>(wrap_around(axis, static_cast<int32_t>(src->num_dimensions())));
 
-    _axis = actual_axis;
+    _axis       = actual_axis;
+    _is_dynamic = src->is_dynamic();
 
     const ITensorInfo *tmp_input = src;
 
@@ -124,14 +125,12 @@ void CpuSoftmaxGeneric::run(ITensorPack &tensors)
 
     softmax_pack = {{TensorType::ACL_SRC_0, src}, {TensorType::ACL_DST_0, dst}, {TensorType::ACL_DST_1, tmp.get()}};
 
-    if (_axis == 0)
-    {
-        NEScheduler::get().schedule_op(_softmax_kernel.get(), Window::DimY, _softmax_kernel->window(), softmax_pack);
-    }
-    else
-    {
-        NEScheduler::get().schedule_op(_softmax_kernel.get(), Window::DimX, _softmax_kernel->window(), softmax_pack);
-    }
+    // With dynamic shapes, the window is recomputed from the shape of the tensors to run on
+    const auto  *kernel = static_cast<kernels::CpuSoftmaxKernel *>(_softmax_kernel.get());
+    const Window win    = _is_dynamic ? kernel->compute_window(*dst->info()) : kernel->window();
+
+    const size_t split_dimension = _axis == 0 ? Window::DimY : Window::DimX;
+    NEScheduler::get().schedule_op(_softmax_kernel.get(), split_dimension, win, softmax_pack);
 }
 
 experimental::MemoryRequirements CpuSoftmaxGeneric::workspace() const
@@ -57,6 +57,9 @@ class CpuSoftmaxGeneric : public ICpuOperator
 public:
     CpuSoftmaxGeneric();
     /** Set the input and output tensors.
+     *
+     * @note If @p src has dynamic dimensions, its configured shape is the largest one the operator runs on: the
+     *       workspace is sized for it and the execution window is recomputed from the tensors passed to @ref run
      *
      * @param[in,out] src    Source tensor info. Data types supported: QASYMM8/QASYMM8_SIGNED/F16/F32.
      *                       last value of each row to the nearest multiple.
@@ -95,7 +98,8 @@ private:
 
     experimental::MemoryRequirements _aux_mem{};
 
-    unsigned int _axis = 0;
+    unsigned int _axis       = 0;
+    bool         _is_dynamic = false;
 };
 
 } // namespace cpu
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/operators/CpuTopK.h"
+
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+
+#include "src/common/utils/Log.h"
+#include "src/core/helpers/MemoryHelpers.h"
+#include "src/cpu/kernels/CpuTopKKernel.h"
+#include "src/cpu/utils/CpuAuxTensorHandler.h"
+
+#include <algorithm>
+
+using namespace arm_compute::experimental;
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace
+{
+// Every thread owns a candidates buffer. The kernel is split over the (collapsed) rows, so there are never more
+// threads than rows.
+TensorInfo scratch_info(const kernels::CpuTopKKernel &kernel, unsigned int num_threads)
+{
+    const size_t num_rows    = kernel.window().num_iterations(Window::DimY);
+    const size_t num_buffers = std::max<size_t>(std::min<size_t>(num_threads, num_rows), 1);
+    return TensorInfo(TensorShape(kernel.get_scratch_size_per_thread(), num_buffers), 1, DataType::U8);
+}
+} // namespace
+
+CpuTopK::CpuTopK() : _kernel(), _scratch(), _aux_mem(InternalTensorIdx::COUNT)
+{
+}
+
+void CpuTopK::configure(const ITensorInfo *src, ITensorInfo *values, ITensorInfo *indices, unsigned int k, bool sorted)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, values, indices);
+    ARM_COMPUTE_ERROR_THROW_ON(CpuTopK::validate(src, values, indices, k, sorted));
+    ARM_COMPUTE_LOG_PARAMS(src, values, indices, k, sorted);
+
+    auto kernel = std::make_unique<kernels::CpuTopKKernel>();
+    kernel->configure(src, values, indices, k, sorted);
+
+    _scratch = scratch_info(*kernel, NEScheduler::get().num_threads());
+    _aux_mem[InternalTensorIdx::SCRATCH] =
+        MemoryInfo(offset_int_vec(InternalTensorIdx::SCRATCH), MemoryLifetime::Temporary, _scratch.total_size());
+
+    _kernel = std::move(kernel);
+}
+
+Status CpuTopK::validate(
+    const ITensorInfo *src, const ITensorInfo *values, const ITensorInfo *indices, unsigned int k, bool sorted)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, values, indices);
+    ARM_COMPUTE_RETURN_ON_ERROR(kernels::CpuTopKKernel::validate(src, values, indices, k, sorted));
+    return Status{};
+}
+
+void CpuTopK::run(ITensorPack &tensors)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(tensors.empty(), "No inputs provided");
+
+    // The scheduler may have more threads than at configuration: the handler then allocates a larger scratch
+    const auto         *kernel          = static_cast<kernels::CpuTopKKernel *>(_kernel.get());
+    TensorInfo          scratch_for_run = scratch_info(*kernel, NEScheduler::get().num_threads());
+    CpuAuxTensorHandler scratch(offset_int_vec(InternalTensorIdx::SCRATCH), scratch_for_run, tensors, true);
+
+    ITensorPack pack = {{TensorType::ACL_SRC, tensors.get_const_tensor(TensorType::ACL_SRC)},
+                        {TensorType::ACL_DST_0, tensors.get_tensor(TensorType::ACL_DST_0)},
+                        {TensorType::ACL_DST_1, tensors.get_tensor(TensorType::ACL_DST_1)},
+                        {TensorType::ACL_INT_0, scratch.get()}};
+
+    NEScheduler::get().schedule_op(_kernel.get(), Window::DimY, _kernel->window(), pack);
+}
+
+experimental::MemoryRequirements CpuTopK::workspace() const
+{
+    return _aux_mem;
+}
+} // namespace cpu
+} // namespace arm_compute
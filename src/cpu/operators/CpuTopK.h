@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_OPERATORS_CPUTOPK_H
+#define ACL_SRC_CPU_OPERATORS_CPUTOPK_H
+
+#include "arm_compute/core/experimental/Types.h"
+#include "arm_compute/core/TensorInfo.h"
+
+#include "src/cpu/ICpuKernel.h"
+#include "src/cpu/ICpuOperator.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+namespace cpu
+{
+/** Basic function to run @ref kernels::CpuTopKKernel
+ *
+ * The k largest values of each row are selected with a threshold filter and a partial selection over a bounded
+ * candidates buffer, so that the cost is linear in the row length rather than the O(n log n) of a full sort.
+ */
+class CpuTopK : public ICpuOperator
+{
+public:
+    CpuTopK();
+    /** Configure operator for a given list of arguments
+     *
+     * @param[in]  src     Source tensor info. Data types supported: QASYMM8/QASYMM8_SIGNED/F16/F32.
+     * @param[out] values  Destination tensor info of the k largest values of each row of @p src.
+     *                     Data type supported: same as @p src
+     * @param[out] indices Destination tensor info of the indices of @p values in the rows of @p src.
+     *                     Data type supported: S32
+     * @param[in]  k       Number of values to select in each row, in the range [1, src->dimension(0)]
+     * @param[in]  sorted  (Optional) True to return the values in descending order, false to return them in the order
+     *                     of the row. Defaults to true
+     */
+    void
+    configure(const ITensorInfo *src, ITensorInfo *values, ITensorInfo *indices, unsigned int k, bool sorted = true);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to @ref CpuTopK::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *src,
+                           const ITensorInfo *values,
+                           const ITensorInfo *indices,
+                           unsigned int       k,
+                           bool               sorted = true);
+
+    // Inherited methods overridden:
+    void                             run(ITensorPack &tensors) override;
+    experimental::MemoryRequirements workspace() const override;
+
+private:
+    enum InternalTensorIdx
+    {
+        SCRATCH = 0,
+        COUNT
+    };
+
+    std::unique_ptr<ICPPKernel>      _kernel;
+    TensorInfo                       _scratch;
+    experimental::MemoryRequirements _aux_mem{};
+};
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_OPERATORS_CPUTOPK_H
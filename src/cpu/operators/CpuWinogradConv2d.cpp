@@ -77,12 +77,38 @@ Status validate_arguments(const ITensorInfo   *src,
 
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(conv_info.stride().first != 1 || conv_info.stride().second != 1,
                                     "Winograd layer only supports unit strides.");
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::QASYMM8, DataType::QASYMM8_SIGNED,
+                                                         DataType::F16, DataType::F32);
+    if (is_data_type_quantized_asymmetric(src->data_type()))
+    {
+#ifndef __aarch64__
+        ARM_COMPUTE_RETURN_ERROR_MSG("Quantized Winograd convolution only supported for aarch64");
+#endif /* __aarch64__ */
+        if (biases != nullptr)
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(biases, 1, DataType::S32);
+            ARM_COMPUTE_RETURN_ERROR_ON(biases->num_dimensions() > 1);
+        }
+        if (is_data_type_quantized_per_channel(weights->data_type()))
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(weights, 1, DataType::QSYMM8_PER_CHANNEL);
+        }
+        else
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, weights);
+        }
+        if (dst->total_size() != 0)
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, dst);
+        }
+        return Status{};
+    }
+
     if (biases != nullptr)
     {
         ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, biases);
         ARM_COMPUTE_RETURN_ERROR_ON(biases->num_dimensions() > 1);
     }
-    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::F16, DataType::F32);
     ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, weights);
     return Status{};
 }
@@ -107,6 +133,12 @@ bool get_winograd_kernel_implementation(const ITensorInfo
     // Get configuration arguments for Winograd
     winograd_cfg.output_rows = 0;
     winograd_cfg.output_cols = 0;
+    if (is_data_type_quantized_asymmetric(data_type) && !enable_fast_math)
+    {
+        // The 16-bit transforms of F(2x2, 3x3) are exact for most problems, those of larger tiles lose precision
+        winograd_cfg.output_rows = 2;
+        winograd_cfg.output_cols = 2;
+    }
     conv_args                = std::make_unique<arm_conv::ConvolutionArgs>(
         in_shape.n_batches,
         arm_conv::Shape2D{static_cast<uint32_t>(in_shape.n_rows), static_cast<uint32_t>(in_shape.n_cols)},
@@ -129,6 +161,23 @@ bool get_winograd_kernel_implementation(const ITensorInfo
                                                                  enable_fast_math, &winograd_cfg, nullptr);
     }
 #endif // defined(__aarch64__) && defined(ENABLE_FP16_KERNELS)
+#if defined(__aarch64__)
+    else if (data_type == DataType::QASYMM8 && weights->data_type() == DataType::QSYMM8_PER_CHANNEL)
+    {
+        success = arm_conv::winograd::get_implementation<uint8_t, int8_t, uint8_t, int16_t, int32_t>(
+            *winograd_impl, &CPUInfo::get(), *conv_args, nthreads, enable_fast_math, &winograd_cfg, nullptr);
+    }
+    else if (data_type == DataType::QASYMM8)
+    {
+        success = arm_conv::winograd::get_implementation<uint8_t, uint8_t, uint8_t, int16_t, int32_t>(
+            *winograd_impl, &CPUInfo::get(), *conv_args, nthreads, enable_fast_math, &winograd_cfg, nullptr);
+    }
+    else if (data_type == DataType::QASYMM8_SIGNED)
+    {
+        success = arm_conv::winograd::get_implementation<int8_t, int8_t, int8_t, int16_t, int32_t>(
+            *winograd_impl, &CPUInfo::get(), *conv_args, nthreads, enable_fast_math, &winograd_cfg, nullptr);
+    }
+#endif // defined(__aarch64__)
     else
     {
         success = false;
@@ -144,7 +193,7 @@ inline bool fuse_function_supported(const ActivationLayerInfo &act_info)
 
 CpuWinogradConv2d::CpuWinogradConv2d()
 
-    : _gemm_function(std::make_unique<CpuGemm>()),
+    : _gemm_function(nullptr),
       _activation_func(std::make_unique<CpuActivation>()),
       _transform_input_kernel(nullptr),
       _transform_output_kernel(nullptr),
@@ -153,6 +202,9 @@ CpuWinogradConv2d::CpuWinogradConv2d()
       _permute_weights(std::make_unique<CpuPermute>()),
       _aux_mem(AuxTensorIdx::Count),
       _conv_args{nullptr},
+      _quantization{nullptr},
+      _output_multipliers(),
+      _point_scales(),
       _winograd_impl{},
       _data_layout(),
       _winograd_transformed_input{},
@@ -216,8 +268,19 @@ void CpuWinogradConv2d::configure(const ITensorInfo         *src,
 
         const auto &wds = _winograd_impl.winograd_spec;
 
+        // Set up the requantization of quantized convolutions. The transforms work on 16-bit values whose
+        // products are accumulated into 32-bit values.
+        const bool is_quantized = is_data_type_quantized_asymmetric(data_type);
+        if (is_quantized)
+        {
+            configure_quantization(src, weights, dst, act_info);
+        }
+        const DataType winograd_in_type  = is_quantized ? DataType::S16 : data_type;
+        const DataType winograd_out_type = is_quantized ? DataType::S32 : data_type;
+
         // Preparing winograd transformed input tensor
-        const size_t     data_type_size    = src->element_size();
+        const size_t     in_data_type_size  = data_size_from_type(winograd_in_type);
+        const size_t     out_data_type_size = data_size_from_type(winograd_out_type);
         const uint32_t   m                 = _winograd_impl.gemm_args->_Msize; // Total number of tiles
         const uint32_t   k                 = _winograd_impl.gemm_args->_Ksize; // Input channels
         const uint32_t   n                 = _winograd_impl.gemm_args->_Nsize; // Output channels
@@ -226,28 +289,28 @@ void CpuWinogradConv2d::configure(const ITensorInfo         *src,
         constexpr size_t storage_alignment = 64;
 
         const TensorShape a_shape(k, m, n_batches, n_gemms);
-        Strides           a_strides(data_type_size);
-        a_strides.set(1, data_type_size * _winograd_impl.winograd_spec.input_ld_row);
-        a_strides.set(2, data_type_size * _winograd_impl.winograd_spec.input_ld_batch);
-        a_strides.set(3, data_type_size * _winograd_impl.winograd_spec.input_ld_matrix);
+        Strides           a_strides(in_data_type_size);
+        a_strides.set(1, in_data_type_size * _winograd_impl.winograd_spec.input_ld_row);
+        a_strides.set(2, in_data_type_size * _winograd_impl.winograd_spec.input_ld_batch);
+        a_strides.set(3, in_data_type_size * _winograd_impl.winograd_spec.input_ld_matrix);
 
         const TensorShape b_shape(n, k, n_gemms);
-        Strides           b_strides(data_type_size);
-        b_strides.set(1, data_type_size * _winograd_impl.winograd_spec.weight_ld_row);
-        b_strides.set(2, data_type_size * _winograd_impl.winograd_spec.weight_ld_matrix);
+        Strides           b_strides(in_data_type_size);
+        b_strides.set(1, in_data_type_size * _winograd_impl.winograd_spec.weight_ld_row);
+        b_strides.set(2, in_data_type_size * _winograd_impl.winograd_spec.weight_ld_matrix);
 
         const TensorShape d_shape(n, m, n_batches, n_gemms);
-        Strides           d_strides(data_type_size);
-        d_strides.set(1, data_type_size * _winograd_impl.winograd_spec.output_ld_row);
-        d_strides.set(2, data_type_size * _winograd_impl.winograd_spec.output_ld_batch);
-        d_strides.set(3, data_type_size * _winograd_impl.winograd_spec.output_ld_matrix);
+        Strides           d_strides(out_data_type_size);
+        d_strides.set(1, out_data_type_size * _winograd_impl.winograd_spec.output_ld_row);
+        d_strides.set(2, out_data_type_size * _winograd_impl.winograd_spec.output_ld_batch);
+        d_strides.set(3, out_data_type_size * _winograd_impl.winograd_spec.output_ld_matrix);
 
         TensorInfo a_info{};
         TensorInfo b_info{};
         TensorInfo d_info{};
-        a_info.init(a_shape, 1, data_type, a_strides, 0, wds.input_matrix_size_bytes);
-        b_info.init(b_shape, 1, data_type, b_strides, 0, wds.weight_matrix_size_bytes);
-        d_info.init(d_shape, 1, data_type, d_strides, 0, wds.output_matrix_size_bytes);
+        a_info.init(a_shape, 1, winograd_in_type, a_strides, 0, wds.input_matrix_size_bytes);
+        b_info.init(b_shape, 1, winograd_in_type, b_strides, 0, wds.weight_matrix_size_bytes);
+        d_info.init(d_shape, 1, winograd_out_type, d_strides, 0, wds.output_matrix_size_bytes);
 
         _winograd_transformed_input   = a_info;
         _winograd_transformed_weights = b_info;
@@ -280,8 +343,21 @@ void CpuWinogradConv2d::configure(const ITensorInfo         *src,
             std::make_unique<CpuWinogradConv2dTransformInputKernel>(_winograd_impl, *_conv_args, nthreads);
 
         // Configure GEMM function
-        _gemm_function->configure(&_winograd_transformed_input, &_winograd_transformed_weights, nullptr,
-                                  &_winograd_transformed_output, 1.0f, 0.f);
+        if (is_quantized)
+        {
+            auto gemm = std::make_unique<CpuGemmAssemblyDispatch>();
+            gemm->configure(&_winograd_transformed_input, &_winograd_transformed_weights, nullptr,
+                            &_winograd_transformed_output, AsmGemmInfo{});
+            ARM_COMPUTE_ERROR_ON(!gemm->is_configured());
+            _gemm_function = std::move(gemm);
+        }
+        else
+        {
+            auto gemm = std::make_unique<CpuGemm>();
+            gemm->configure(&_winograd_transformed_input, &_winograd_transformed_weights, nullptr,
+                            &_winograd_transformed_output, 1.0f, 0.f);
+            _gemm_function = std::move(gemm);
+        }
 
         // Configure output transform kernel
         _transform_output_kernel =
@@ -332,7 +408,8 @@ Status CpuWinogradConv2d::validate(const ITensorInfo         *src,
     // Disable winograd for fp16 if fast math is false.
     if (!enable_fast_math)
     {
-        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::F32);
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::QASYMM8, DataType::QASYMM8_SIGNED,
+                                                             DataType::F32);
     }
 
     const Tensor4DShape              kernel_shape{internal_get_shape(weights)};
@@ -353,6 +430,51 @@ Status CpuWinogradConv2d::validate(const ITensorInfo         *src,
     return Status{};
 }
 
+void CpuWinogradConv2d::configure_quantization(const ITensorInfo         *src,
+                                               const ITensorInfo         *weights,
+                                               const ITensorInfo         *dst,
+                                               const ActivationLayerInfo &act_info)
+{
+    const DataType                data_type      = src->data_type();
+    const UniformQuantizationInfo iqinfo         = src->quantization_info().uniform();
+    const UniformQuantizationInfo oqinfo         = dst->quantization_info().uniform();
+    const QuantizationInfo        wqinfo         = weights->quantization_info();
+    const bool                    is_per_channel = is_data_type_quantized_per_channel(weights->data_type());
+
+    // Input scale times weight scale over output scale, for each output channel
+    const std::vector<float> &weight_scales = wqinfo.scale();
+    _output_multipliers.resize(_conv_args->n_output_channels);
+    for (unsigned int c = 0; c < _conv_args->n_output_channels; ++c)
+    {
+        _output_multipliers[c] = iqinfo.scale * weight_scales[is_per_channel ? c : 0] / oqinfo.scale;
+    }
+
+    // Set by the weight transform
+    _point_scales.resize(_winograd_impl.input_transform->get_input_rows() *
+                         _winograd_impl.input_transform->get_input_cols());
+
+    // Merge a supported activation with the requantization
+    PixelValue type_min{};
+    PixelValue type_max{};
+    std::tie(type_min, type_max) = get_min_max(data_type);
+    int32_t min_activation       = type_min.get<int32_t>();
+    int32_t max_activation       = type_max.get<int32_t>();
+    if (fuse_function_supported(act_info))
+    {
+        std::tie(min_activation, max_activation) = get_quantized_activation_min_max(act_info, data_type, oqinfo);
+    }
+
+    _quantization = std::make_unique<arm_conv::WinogradQuantization>();
+    _quantization->input_offset       = iqinfo.offset;
+    _quantization->weight_offset      = is_per_channel ? 0 : wqinfo.uniform().offset;
+    _quantization->output_offset      = oqinfo.offset;
+    _quantization->minval             = min_activation;
+    _quantization->maxval             = max_activation;
+    _quantization->output_multipliers = _output_multipliers.data();
+    _quantization->point_scales       = _point_scales.data();
+    _conv_args->quantization          = _quantization.get();
+}
+
 void CpuWinogradConv2d::run(ITensorPack &tensors)
 {
     prepare(tensors);
@@ -36,6 +36,8 @@
 #include "src/cpu/operators/CpuPermute.h"
 #include "src/cpu/operators/internal/CpuGemmAssemblyDispatch.h"
 
+#include <vector>
+
 namespace arm_compute
 {
 namespace cpu
@@ -56,23 +58,29 @@ public:
      * - NCHW
      *
      * Valid data type configurations:
-     * |src0           |src1           |src2   |dst            |
-     * |:--------------|:--------------|:------|:--------------|
-     * |F16            |F16            |F16    |F16            |
-     * |F32            |F32            |F32    |F32            |
+     * |src0           |src1               |src2   |dst            |
+     * |:--------------|:------------------|:------|:--------------|
+     * |F16            |F16                |F16    |F16            |
+     * |F32            |F32                |F32    |F32            |
+     * |QASYMM8        |QASYMM8            |S32    |QASYMM8        |
+     * |QASYMM8        |QSYMM8_PER_CHANNEL |S32    |QASYMM8        |
+     * |QASYMM8_SIGNED |QASYMM8_SIGNED     |S32    |QASYMM8_SIGNED |
+     * |QASYMM8_SIGNED |QSYMM8_PER_CHANNEL |S32    |QASYMM8_SIGNED |
      *
      * @param[in]  src              Source tensor Info. 3 lower dimensions represent a single input [width, height, IFM],
      *                              while every optional dimension from 4 and above represent a batch of inputs.
-     *                              Data types supported: F16/F32.
-     * @param[in]  weights          Weights tensor Info. Weights are 4D tensor with dimensions [kernel_x, kernel_y, IFM, OFM]. Data type supported: Same as @p input.
+     *                              Data types supported: QASYMM8/QASYMM8_SIGNED/F16/F32.
+     * @param[in]  weights          Weights tensor Info. Weights are 4D tensor with dimensions [kernel_x, kernel_y, IFM, OFM]. Data type supported: Same as @p input,
+     *                              also QSYMM8_PER_CHANNEL for quantized @p input.
      *                              For supported kernel sizes, see @ref arm_compute::NEWinogradConvolutionLayer
-     * @param[in]  biases           Biases tensor Info. Shared biases supported. Biases are 1D tensor with dimensions [OFM]. Data type supported: Same as @p weights.
+     * @param[in]  biases           Biases tensor Info. Shared biases supported. Biases are 1D tensor with dimensions [OFM]. Data type supported: Same as @p input, except for input of QASYMM8/QASYMM8_SIGNED type where biases should be of S32 type.
      * @param[out] dst              Destination tensor Info. 3 lower dimensions represent a single output [width, height, OFM], while the rest represent batch of outputs.
      *                              Data types supported: Same as @p input.
      * @param[in]  conv_info        Contains padding and stride information described in @ref PadStrideInfo. Currently only unit strides are supported.
      * @param[in]  act_info         (Optional) Activation layer information in case of a fused activation.
      * @param[in]  enable_fast_math (Optional) Enable fast math computation. In case this flag were set, the function could dispatch the fastest implementation
-     *                              available which may introduce a drop of accuracy as well. Default is false
+     *                              available which may introduce a drop of accuracy as well. Default is false.
+     *                              Quantized convolutions use larger output tiles when it is set.
      */
     void configure(const ITensorInfo         *src,
                    const ITensorInfo         *weights,
@@ -101,6 +109,18 @@ public:
     experimental::MemoryRequirements workspace() const override;
 
 private:
+    /** Set up the quantization parameters used by the transforms of quantized convolutions
+     *
+     * @param[in] src      Source tensor info. Data types supported: QASYMM8/QASYMM8_SIGNED.
+     * @param[in] weights  Weights tensor info. Data types supported: Same as @p src, QSYMM8_PER_CHANNEL.
+     * @param[in] dst      Destination tensor info. Data types supported: Same as @p src.
+     * @param[in] act_info Activation layer information, merged with the requantization if possible.
+     */
+    void configure_quantization(const ITensorInfo         *src,
+                                const ITensorInfo         *weights,
+                                const ITensorInfo         *dst,
+                                const ActivationLayerInfo &act_info);
+
     enum AuxTensorIdx
     {
         /** Slot 0 - 6 reserved for CpuGemm */
@@ -113,7 +133,7 @@ private:
         PermutedInput  = TransformedOutput,
         PermutedOutput = TransformedInput
     };
-    std::unique_ptr<CpuGemm>         _gemm_function;
+    std::unique_ptr<ICpuOperator>    _gemm_function;
     std::unique_ptr<CpuActivation>   _activation_func;
     std::unique_ptr<ICPPKernel>      _transform_input_kernel;
     std::unique_ptr<ICPPKernel>      _transform_output_kernel;
@@ -123,6 +143,10 @@ private:
     experimental::MemoryRequirements _aux_mem{Count};
     std::unique_ptr<arm_conv::ConvolutionArgs>
         _conv_args; // Make it unique ptr because this type does not have a default constructor
+    std::unique_ptr<arm_conv::WinogradQuantization>
+        _quantization; // Make it unique ptr because _conv_args refers to it
+    std::vector<float>               _output_multipliers;
+    std::vector<float>               _point_scales;
     arm_conv::winograd::WinogradImpl _winograd_impl;
     DataLayout                       _data_layout;
     TensorInfo                       _winograd_transformed_input;
@@ -23,6 +23,9 @@
  */
 #include "src/cpu/operators/internal/CpuGemmAssemblyDispatch.h"
 
+#include "arm_compute/core/utils/DataTypeUtils.h"
+#include "arm_compute/runtime/NEON/NEGEMMTuner.h"
+#include "arm_compute/runtime/NEON/NEGEMMWeightsCache.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
 
 #include "src/core/CPP/Validate.h"
@@ -33,8 +36,15 @@
 #include "src/cpu/kernels/assembly/CpuGemmAssemblyWrapperKernel.h"
 #include "src/cpu/operators/CpuTranspose.h"
 #include "src/cpu/utils/CpuAuxTensorHandler.h"
+#include "support/StringSupport.h"
 
 #include <arm_neon.h>
+#include <chrono>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <tuple>
 
 namespace arm_compute
 {
@@ -42,6 +52,9 @@ namespace cpu
 {
 namespace
 {
+/** Maximum number of run-time shapes whose assembly kernels are cached by an operator with dynamic shapes */
+constexpr size_t max_dynamic_kernels = 16;
+
 /** Run pretranspose_B_array in parallel (1D static scheduling)
  *
  * @tparam TypeInput
@@ -163,6 +176,228 @@ IScheduler::Hints scheduling_hint_heuristic(arm_gemm::GemmMethod method, DataTyp
     return scheduling_hint;
 }
 
+/** Unique identifier of a GEMM shape in the table of @ref NEGEMMTuner
+ *
+ * @param[in] a    Input tensor info containing the Matrix A.
+ * @param[in] b    Input tensor info containing the Matrix B.
+ * @param[in] d    Output tensor info.
+ * @param[in] args GEMM arguments passed to arm_gemm.
+ *
+ * @return The identifier of the GEMM shape
+ */
+std::string
+tuner_gemm_id(const ITensorInfo *a, const ITensorInfo *b, const ITensorInfo *d, const arm_gemm::GemmArgs &args)
+{
+    std::stringstream id;
+    id << string_from_data_type(a->data_type()) << "_" << string_from_data_type(b->data_type()) << "_"
+       << string_from_data_type(d->data_type()) << "_M" << args._Msize << "_N" << args._Nsize << "_K" << args._Ksize
+       << "_S" << args._Ksections << "_B" << args._nbatches << "_MU" << args._nmulti << "_ACT"
+       << static_cast<int>(args._act.type) << "_FM" << args._fast_mode << "_ACC" << args._accumulate << "_T"
+       << args._maxthreads;
+    return id.str();
+}
+
+/** Identifier of the output stage parameters which affect the reshaped weights */
+std::string output_stage_id(const arm_gemm::Nothing &)
+{
+    return "";
+}
+
+std::string output_stage_id(const arm_gemm::DequantizeFloat &)
+{
+    return "";
+}
+
+std::string output_stage_id(const arm_gemm::Requantize32 &os)
+{
+    // The column sums stored with the reshaped weights depend on the offsets
+    return "_AO" + support::cpp11::to_string(os.a_offset) + "_BO" + support::cpp11::to_string(os.b_offset);
+}
+
+/** Hash the content of a tensor, ignoring its padding
+ *
+ * The rows are hashed in parallel in a fixed number of chunks, so the result doesn't depend on the number of threads.
+ *
+ * @param[in] tensor Tensor to hash.
+ *
+ * @return The hash of the content of the tensor
+ */
+uint64_t hash_tensor_content(const ITensor *tensor)
+{
+    const ITensorInfo *info      = tensor->info();
+    const TensorShape &shape     = info->tensor_shape();
+    const Strides     &strides   = info->strides_in_bytes();
+    const size_t       row_bytes = shape[0] * info->element_size();
+    const size_t       num_rows  = shape.total_size_upper(1);
+    const uint8_t     *base      = tensor->buffer() + info->offset_first_element_in_bytes();
+
+    constexpr size_t                  num_chunks = 64;
+    std::vector<uint64_t>             chunk_hashes(num_chunks, 0);
+    std::vector<IScheduler::Workload> workloads(num_chunks);
+    for (size_t chunk = 0; chunk < num_chunks; ++chunk)
+    {
+        workloads[chunk] = [&, chunk](const ThreadInfo &)
+        {
+            const size_t start = (chunk * num_rows) / num_chunks;
+            const size_t end   = ((chunk + 1) * num_rows) / num_chunks;
+            uint64_t     h     = chunk;
+            for (size_t row = start; row < end; ++row)
+            {
+                // Offset of the row from its linear index in the upper dimensions
+                size_t offset = 0;
+                size_t index  = row;
+                for (size_t d = 1; d < TensorShape::num_max_dimensions; ++d)
+                {
+                    offset += (index % shape[d]) * strides[d];
+                    index /= shape[d];
+                }
+                h = NEGEMMWeightsCache::hash(base + offset, row_bytes, h);
+            }
+            chunk_hashes[chunk] = h;
+        };
+    }
+    NEScheduler::get().run_tagged_workloads(workloads, "CpuGemmAssemblyDispatch/hash_weights");
+
+    uint64_t h = 0;
+    for (const uint64_t chunk_hash : chunk_hashes)
+    {
+        h = NEGEMMWeightsCache::hash(&chunk_hash, sizeof(chunk_hash), h);
+    }
+    return h;
+}
+
+/** Zero-initialised buffer aligned to 128 bytes (required by 32-bit kernels) */
+class AlignedBuffer
+{
+public:
+    explicit AlignedBuffer(size_t size) : _mem(size + alignment, 0)
+    {
+    }
+    void *get()
+    {
+        const auto address = reinterpret_cast<uintptr_t>(_mem.data());
+        return _mem.data() + ((alignment - address % alignment) % alignment);
+    }
+
+private:
+    static constexpr size_t alignment = 128;
+    std::vector<uint8_t>    _mem;
+};
+
+/** Time the assembly kernels supporting a GEMM shape and return the name of the fastest one
+ *
+ * The kernels are run on zero-initialised matrices, with the threads and the scheduling of @ref Fallback::run().
+ *
+ * @param[in] args           GEMM arguments passed to arm_gemm. The method and filter of its config are honoured.
+ * @param[in] os             Output stage meta-data.
+ * @param[in] method         Method used to choose the scheduling hints.
+ * @param[in] data_type      Data type of the output, used to choose the scheduling hints.
+ * @param[in] num_iterations Number of timed runs of each kernel. The fastest run is kept.
+ *
+ * @return The name of the fastest kernel, or an empty string if there is nothing to choose from
+ */
+template <typename TypeInput, typename TypeWeight, typename TypeOutput, class OutputStage>
+std::string tune_gemm(const arm_gemm::GemmArgs &args,
+                      const OutputStage        &os,
+                      arm_gemm::GemmMethod      method,
+                      DataType                  data_type,
+                      unsigned int              num_iterations)
+{
+    using clock = std::chrono::steady_clock;
+
+    const arm_gemm::GemmConfig base_cfg = (args._cfg != nullptr) ? *args._cfg : arm_gemm::GemmConfig();
+
+    const int M = args._Msize;
+    const int N = args._Nsize;
+    const int K = args._Ksize;
+
+    AlignedBuffer a(sizeof(TypeInput) * M * K * args._nbatches * args._nmulti);
+    AlignedBuffer b(sizeof(TypeWeight) * K * N * args._nmulti);
+    AlignedBuffer d(sizeof(TypeOutput) * M * N * args._nbatches * args._nmulti);
+
+    std::vector<std::string> candidates;
+    const auto kernels = arm_gemm::get_compatible_kernels<TypeInput, TypeWeight, TypeOutput, OutputStage>(args, os);
+    for (const auto &kernel : kernels)
+    {
+        if ((base_cfg.method == arm_gemm::GemmMethod::DEFAULT || kernel.method == base_cfg.method) &&
+            (base_cfg.filter.empty() || kernel.name.find(base_cfg.filter) != std::string::npos))
+        {
+            candidates.push_back(kernel.name);
+        }
+    }
+    if (candidates.size() < 2)
+    {
+        return "";
+    }
+
+    std::string best_name;
+    auto        best_time = clock::duration::max();
+    for (const auto &name : candidates)
+    {
+        arm_gemm::GemmConfig cfg            = base_cfg;
+        cfg.filter                          = name;
+        arm_gemm::GemmArgs   candidate_args = args;
+        candidate_args._cfg                 = &cfg;
+
+        // The filter matches substrings of the names: skip the kernels it can't select on its own
+        if (arm_gemm::get_gemm_method<TypeInput, TypeWeight, TypeOutput, OutputStage>(candidate_args, os).name != name)
+        {
+            continue;
+        }
+        auto gemm = arm_gemm::gemm<TypeInput, TypeWeight, TypeOutput, OutputStage>(candidate_args, os);
+        if (gemm == nullptr)
+        {
+            continue;
+        }
+
+        AlignedBuffer workspace(gemm->get_working_size());
+        gemm->set_working_space(workspace.get());
+
+        AlignedBuffer     pretransposed(gemm->get_B_pretransposed_array_size());
+        const TypeWeight *b_ptr = reinterpret_cast<const TypeWeight *>(b.get());
+        if (gemm->B_pretranspose_required())
+        {
+            gemm->pretranspose_B_array(pretransposed.get(), b_ptr, N, K * N, false);
+            b_ptr = nullptr;
+        }
+        if (std::is_same<OutputStage, arm_gemm::DequantizeFloat>::value)
+        {
+            gemm->set_dequantize_scale(1.f);
+        }
+        gemm->set_arrays(reinterpret_cast<const TypeInput *>(a.get()), K, M * K, M * K * args._nbatches, b_ptr, N,
+                         K * N, reinterpret_cast<TypeOutput *>(d.get()), N, M * N, M * N * args._nbatches, nullptr, 0);
+
+        kernel::CpuGemmAssemblyWrapperKernel<TypeInput, TypeWeight, TypeOutput> wrapper;
+        wrapper.configure(gemm.get(), name);
+
+        const auto   hints       = scheduling_hint_heuristic(method, data_type);
+        unsigned int num_threads = std::min<unsigned int>(NEScheduler::get().num_threads(),
+                                                          gemm->get_window_size().total_size());
+        if (hints.split_dimension() != IScheduler::split_dimensions_all)
+        {
+            num_threads = std::min<unsigned int>(num_threads, wrapper.window().num_iterations(hints.split_dimension()));
+        }
+        gemm->set_nthreads(num_threads);
+
+        // Warm up the caches before timing
+        NEScheduler::get().schedule(&wrapper, hints);
+        auto time = clock::duration::max();
+        for (unsigned int i = 0; i < num_iterations; ++i)
+        {
+            const auto start = clock::now();
+            NEScheduler::get().schedule(&wrapper, hints);
+            time = std::min(time, clock::now() - start);
+        }
+
+        if (time < best_time)
+        {
+            best_time = time;
+            best_name = name;
+        }
+    }
+    return best_name;
+}
+
 /** Fallback in case ACL doesn't have a function */
 template <typename TypeInput, typename TypeWeight, typename TypeOutput, class OutputStage = arm_gemm::Nothing>
 class Fallback : public CpuGemmAssemblyDispatch::IFallback
@@ -247,6 +482,7 @@ public:
         }
 
         _gemm_kernel_asm->update_quantization_parameters(gemm_requant_info);
+        _output_stage_id = output_stage_id(gemm_requant_info);
 
         // After update_quantization_parameters(), window may change, reconfigure it.
         auto *opt = reinterpret_cast<kernel::CpuGemmAssemblyWrapperKernel<TypeInput, TypeWeight, TypeOutput> *>(
@@ -276,6 +512,34 @@ private:
     void configure_indirect(const ITensorInfo *a, const ITensorInfo *b, const ITensorInfo *d, const AsmGemmInfo &info);
     /** Prepare the indirect buffer */
     void prepare_indirect_buffer(ITensorPack &tensors);
+    /** Get the assembly kernel to run on the current shapes of the tensors
+     *
+     * With dynamic shapes, a kernel is created on first use of each shape. It is pinned to the configured kernel, so
+     * that it uses no more workspace than the declared maximum shape and shares the pretransposed B. A run-time shape
+     * the configured workspace or pretransposed B can't accommodate is rejected with an error, in all build types.
+     *
+     * Each cached kernel only holds the GemmCommon object and its wrapper, as its buffers are those of the configured
+     * kernel. The cache is nevertheless cleared once it holds @ref max_dynamic_kernels shapes, so that workloads
+     * with many distinct shapes don't grow it without bound: the kernels of the evicted shapes are created again on
+     * their next use.
+     *
+     * @param[in] a Input tensor containing the Matrix A.
+     * @param[in] b Input tensor containing the Matrix B. Can be nullptr.
+     * @param[in] d Output tensor to store the result of matrix multiplication.
+     *
+     * @return The assembly GEMM and its wrapper kernel
+     */
+    std::pair<arm_gemm::GemmCommon<TypeInput, TypeWeight, TypeOutput> *, INEKernel *>
+    select_kernel(const ITensor *a, const ITensor *b, const ITensor *d);
+
+    /** Assembly Gemm kernel and its wrapper for a dynamic shape */
+    struct DynamicKernel
+    {
+        std::shared_ptr<arm_gemm::GemmCommon<TypeInput, TypeWeight, TypeOutput>> gemm{nullptr};
+        std::unique_ptr<INEKernel>                                                kernel{nullptr};
+    };
+    /** M, N, K, batches and multis of a dynamic shape */
+    using DynamicShapeKey = std::tuple<unsigned int, unsigned int, unsigned int, unsigned int, unsigned int>;
 
     /** Operator to transpose B before gemm or pretranspose_B_array*/
     std::unique_ptr<CpuTranspose> _pre_pretranspose_b{nullptr};
@@ -311,7 +575,25 @@ private:
     bool                                  _is_b_constant{true};
     bool                                  _is_c_constant{true};
     bool                                  _run_pre_pretranspose_b{false};
+    /** Identifier of the GEMM and kernel in the weights cache (see @ref NEGEMMWeightsCache) */
+    std::string _weights_cache_id{};
+    /** Identifier of the output stage parameters in the weights cache */
+    std::string _output_stage_id{};
+    /** Weights cache active when the GEMM was configured, if it can use it */
+    NEGEMMWeightsCache *_weights_cache{nullptr};
+    /** Copy of the reshaped weights, kept when they can't be stored in the weights cache */
+    std::unique_ptr<uint8_t[]> _pretransposed_b_copy{nullptr};
     bool                                  _B_pre_pretranspose_required{false};
+    /** True if any of the tensors has dynamic dimensions */
+    bool _is_dynamic{false};
+    /** Arguments of the configured GEMM, used to create the kernels of dynamic shapes */
+    std::unique_ptr<arm_gemm::GemmArgs> _dynamic_args{nullptr};
+    /** Output stage of the configured GEMM */
+    OutputStage _os{};
+    /** Pretransposed B shared by the kernels of dynamic shapes */
+    void *_pretransposed_b_data{nullptr};
+    /** Kernels of the dynamic shapes run so far, at most @ref max_dynamic_kernels of them */
+    std::map<DynamicShapeKey, DynamicKernel> _dynamic_kernels{};
 };
 
 template <typename TypeInput, typename TypeWeight, typename TypeOutput, class OutputStage>
@@ -476,7 +758,37 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::configure(const I
     _is_b_constant = b->are_values_constant();
     _is_c_constant = c ? c->are_values_constant() : true;
 
+    // Use the kernel chosen by the GEMM tuner, if any. Only plain GEMMs can be timed in isolation.
+    const arm_gemm::GemmConfig *default_cfg = args._cfg;
+    arm_gemm::GemmConfig        tuned_cfg   = (default_cfg != nullptr) ? *default_cfg : arm_gemm::GemmConfig();
+    NEGEMMTuner                *tuner       = NEGEMMTuner::active_tuner();
+    if (tuner != nullptr && gemm_info.method == AsmConvMethod::Im2Col && !args._indirect_input && !args._fixed_format)
+    {
+        const std::string gemm_id = tuner_gemm_id(a, b, d, args);
+        std::string       kernel_name;
+        if (!tuner->find_kernel(gemm_id, kernel_name) && tuner->tune_new_kernels())
+        {
+            kernel_name = tune_gemm<TypeInput, TypeWeight, TypeOutput, OutputStage>(
+                args, os, _kernel_info.method, d->data_type(), tuner->num_iterations());
+            if (!kernel_name.empty())
+            {
+                tuner->add_kernel(gemm_id, kernel_name);
+            }
+        }
+        if (!kernel_name.empty())
+        {
+            tuned_cfg.filter = kernel_name;
+            args._cfg        = &tuned_cfg;
+        }
+    }
+
     _gemm_kernel_asm = arm_gemm::gemm<TypeInput, TypeWeight, TypeOutput, OutputStage>(args, os);
+    if (_gemm_kernel_asm == nullptr && args._cfg != default_cfg)
+    {
+        // The tuned kernel isn't available on this CPU (e.g. the table has been loaded from another platform)
+        args._cfg        = default_cfg;
+        _gemm_kernel_asm = arm_gemm::gemm<TypeInput, TypeWeight, TypeOutput, OutputStage>(args, os);
+    }
     if (_gemm_kernel_asm == nullptr)
     {
         //configuration not supported: Leave function unconfigured:
@@ -557,8 +869,26 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::configure(const I
         const unsigned int alignment           = 128;
         const size_t       B_pretranspose_size = _gemm_kernel_asm->get_B_pretransposed_array_size();
         _pretranspose_info                     = TensorInfo(TensorShape(B_pretranspose_size), 1, DataType::U8);
-        MemoryLifetime lifetime = _is_b_constant ? MemoryLifetime::Persistent : MemoryLifetime::Temporary;
-        _aux_mem[Pretranspose]  = MemoryInfo(offset_int_vec(Pretranspose), lifetime, B_pretranspose_size, alignment);
+
+        // Non-constant biases are folded into the reshaped weights at run time, so they can't use a read-only mapping
+        _weights_cache = (_is_b_constant && _is_c_constant) ? NEGEMMWeightsCache::active_cache() : nullptr;
+
+        // With a weights cache, the kernel reads the reshaped weights from the mapped cache entry: the buffer is only
+        // needed to reshape them on a cache miss, so it doesn't persist beyond prepare()
+        MemoryLifetime lifetime = MemoryLifetime::Temporary;
+        if (_is_b_constant)
+        {
+            lifetime = _weights_cache != nullptr ? MemoryLifetime::Prepare : MemoryLifetime::Persistent;
+        }
+        _aux_mem[Pretranspose] = MemoryInfo(offset_int_vec(Pretranspose), lifetime, B_pretranspose_size, alignment);
+
+        // The layout of the reshaped weights depends on the kernel and its blocking
+        std::stringstream cache_id;
+        cache_id << tuner_gemm_id(a, b, d, args) << "_" << gemm_cfg.filter << "_IB" << gemm_cfg.inner_block_size
+                 << "_OB" << gemm_cfg.outer_block_size << "_TB" << _gemm_info.transpose_b << "_P"
+                 << B_pretranspose_size;
+        _weights_cache_id = cache_id.str();
+        _output_stage_id  = output_stage_id(os);
     }
 
     // Handle indirect GEMM convolution
@@ -573,6 +903,15 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::configure(const I
         _gemm_kernel_asm->set_dequantize_scale(a->quantization_info().uniform().scale *
                                                b->quantization_info().uniform().scale);
     }
+
+    // The configured shapes are the largest ones: kernels for smaller shapes are created at run time
+    _is_dynamic = a->is_dynamic() || b->is_dynamic() || d->is_dynamic();
+    if (_is_dynamic)
+    {
+        _dynamic_args       = std::make_unique<arm_gemm::GemmArgs>(args);
+        _dynamic_args->_cfg = nullptr;
+        _os                 = os;
+    }
 }
 
 template <typename TypeInput, typename TypeWeight, typename TypeOutput, class OutputStage>
@@ -592,15 +931,27 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::prepare(ITensorPa
         }
         const ITensor *b_to_use = b;
 
+        // Look the reshaped weights up in the weights cache, if any
+        std::string weights_key;
+        const void *cached_weights = nullptr;
+        if (_weights_cache != nullptr)
+        {
+            std::stringstream key;
+            key << _weights_cache_id << _output_stage_id << "_W" << std::hex << hash_tensor_content(b);
+            weights_key    = key.str();
+            cached_weights = _weights_cache->find(weights_key, _pretranspose_info.total_size());
+        }
+        const bool run_pretranspose = cached_weights == nullptr;
+
         // Pre-pretranspose B if required
         CpuAuxTensorHandler pre_pretransposed_b(
             offset_int_vec(PrePretransposedB), _pre_pretransposed_b_info, tensors,
             /*pack_inject: no need to inject into tensors*/
             false,
             /*bypass_alloc: no need to allocate if pre-pretranspose B is not required as this handle will not be used*/
-            !_run_pre_pretranspose_b);
+            !(_run_pre_pretranspose_b && run_pretranspose));
 
-        if (_run_pre_pretranspose_b)
+        if (_run_pre_pretranspose_b && run_pretranspose)
         {
             ARM_COMPUTE_ERROR_ON(_pre_pretranspose_b == nullptr);
             ITensorPack pre_pretranspose_pack{{ACL_SRC, b_to_use}, {ACL_DST, pre_pretransposed_b.get()}};
@@ -608,8 +959,15 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::prepare(ITensorPa
             b_to_use = pre_pretransposed_b.get();
         }
 
+        if (cached_weights != nullptr)
+        {
+            // Use the mapped weights in place: the kernel only reads them
+            _gemm_kernel_asm->set_pretransposed_B_data(const_cast<void *>(cached_weights));
+            _pretransposed_b_data = const_cast<void *>(cached_weights);
+            b->mark_as_unused();
+        }
         // Pretranspose B if required
-        if (_B_pretranspose_required)
+        else if (_B_pretranspose_required)
         {
             // Fixed format kernels need no pretranspose.
             ARM_COMPUTE_ERROR_ON(arm_compute::is_fixed_format(
@@ -628,6 +986,37 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::prepare(ITensorPa
                 _gemm_kernel_asm.get(), pretranspose.get(), in1_ptr, ldb, multi_stride_b,
                 NEScheduler::get().num_threads(), _B_pre_pretranspose_required && kernel_supports_transpose);
 
+            _pretransposed_b_data = pretranspose.get()->buffer();
+            if (_weights_cache != nullptr)
+            {
+                // The reshaped weights are released after prepare(): run on the stored entry, or on a copy of them if
+                // it can't be stored
+                const size_t size           = _pretranspose_info.total_size();
+                const void  *stored_weights = nullptr;
+                if (_weights_cache->store(weights_key, _pretransposed_b_data, size))
+                {
+                    stored_weights = _weights_cache->find(weights_key, size);
+                }
+
+                if (stored_weights != nullptr)
+                {
+                    _pretransposed_b_data = const_cast<void *>(stored_weights);
+                }
+                else
+                {
+                    // Forcing 128-byte alignment (required by 32-bit kernels)
+                    const size_t alignment = 128;
+                    size_t       space     = size + alignment;
+                    void        *copy      = nullptr;
+
+                    _pretransposed_b_copy = std::make_unique<uint8_t[]>(space);
+                    copy                  = _pretransposed_b_copy.get();
+                    std::memcpy(std::align(alignment, size, copy, space), _pretransposed_b_data, size);
+                    _pretransposed_b_data = copy;
+                }
+                _gemm_kernel_asm->set_pretransposed_B_data(_pretransposed_b_data);
+            }
+
             b->mark_as_unused();
             // Note that we don't need to mark b_to_use as unused, as if it's been assigned to pre_pretransposed_b,
             // its memory will be auto-managed by the handler
@@ -642,6 +1031,95 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::prepare(ITensorPa
     }
 }
 
+template <typename TypeInput, typename TypeWeight, typename TypeOutput, class OutputStage>
+std::pair<arm_gemm::GemmCommon<TypeInput, TypeWeight, TypeOutput> *, INEKernel *>
+Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::select_kernel(const ITensor *a,
+                                                                        const ITensor *b,
+                                                                        const ITensor *d)
+{
+    const arm_gemm::GemmArgs *args = _dynamic_args.get();
+    if (!_is_dynamic || args == nullptr)
+    {
+        return std::make_pair(_gemm_kernel_asm.get(), _optimised_kernel.get());
+    }
+
+    ARM_COMPUTE_ERROR_ON_NULLPTR(a, b, d);
+    const Params p = extract_parameters(a->info(), b->info(), d->info(), _gemm_info);
+    if (p.M == args->_Msize && p.N == args->_Nsize && p.K == args->_Ksize && p.batches == args->_nbatches &&
+        p.multis == args->_nmulti)
+    {
+        return std::make_pair(_gemm_kernel_asm.get(), _optimised_kernel.get());
+    }
+
+    const DynamicShapeKey key = std::make_tuple(p.M, p.N, p.K, p.batches, p.multis);
+    auto                  it  = _dynamic_kernels.find(key);
+    if (it == _dynamic_kernels.end())
+    {
+        // Pin the configured kernel. Its blocking sets the layout of the pretransposed B, so it is kept too when B is
+        // constant and pretransposed only once.
+        arm_gemm::GemmConfig cfg = _gemm_kernel_asm->get_config();
+        if (!_is_b_constant)
+        {
+            cfg.inner_block_size = 0;
+            cfg.outer_block_size = 0;
+        }
+        arm_gemm::GemmArgs shape_args = *args;
+        shape_args._Msize             = p.M;
+        shape_args._Nsize             = p.N;
+        shape_args._Ksize             = p.K;
+        shape_args._nbatches          = p.batches;
+        shape_args._nmulti            = p.multis;
+        shape_args._cfg               = &cfg;
+
+        DynamicKernel dynamic_kernel;
+        dynamic_kernel.gemm = arm_gemm::gemm<TypeInput, TypeWeight, TypeOutput, OutputStage>(shape_args, _os);
+        if (dynamic_kernel.gemm == nullptr)
+        {
+            ARM_COMPUTE_ERROR_VAR("Assembly kernel %s does not support the run-time shape", cfg.filter.c_str());
+        }
+        // The buffers are sized for the configured shape: these checks guard against out of bounds accesses, so they
+        // are kept in release builds
+        if (dynamic_kernel.gemm->get_working_size() > _workspace_info.total_size())
+        {
+            ARM_COMPUTE_ERROR("Run-time shape needs more workspace than the configured one");
+        }
+        if (_B_pretranspose_required)
+        {
+            const size_t B_pretranspose_size = dynamic_kernel.gemm->get_B_pretransposed_array_size();
+            if (!dynamic_kernel.gemm->B_pretranspose_required() || B_pretranspose_size > _pretranspose_info.total_size())
+            {
+                ARM_COMPUTE_ERROR("Run-time shape needs a larger pretransposed B than the configured one");
+            }
+            if (_is_b_constant)
+            {
+                if (B_pretranspose_size != _pretranspose_info.total_size())
+                {
+                    ARM_COMPUTE_ERROR("Dimensions of a constant B can't change at run time");
+                }
+                dynamic_kernel.gemm->set_pretransposed_B_data(_pretransposed_b_data);
+            }
+        }
+
+        const unsigned int window_size = dynamic_kernel.gemm->get_window_size().total_size();
+        if (window_size < static_cast<unsigned int>(args->_maxthreads))
+        {
+            dynamic_kernel.gemm->set_nthreads(window_size);
+        }
+
+        auto acl_gemm_wrapper =
+            std::make_unique<kernel::CpuGemmAssemblyWrapperKernel<TypeInput, TypeWeight, TypeOutput>>();
+        acl_gemm_wrapper->configure(dynamic_kernel.gemm.get(), cfg.filter);
+        dynamic_kernel.kernel = std::move(acl_gemm_wrapper);
+
+        if (_dynamic_kernels.size() >= max_dynamic_kernels)
+        {
+            _dynamic_kernels.clear();
+        }
+        it = _dynamic_kernels.emplace(key, std::move(dynamic_kernel)).first;
+    }
+    return std::make_pair(it->second.gemm.get(), it->second.kernel.get());
+}
+
 template <typename TypeInput, typename TypeWeight, typename TypeOutput, class OutputStage>
 bool Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::is_configured() const
 {
@@ -663,13 +1141,23 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::run(ITensorPack &
     auto d = tensors.get_tensor(TensorType::ACL_DST);
     ARM_COMPUTE_ERROR_ON_NULLPTR(a, d);
 
+    // With dynamic shapes, B is prepared first as the kernel of the run-time shape may share its pretransposed form
+    if (_is_dynamic)
+    {
+        prepare(tensors);
+    }
+    arm_gemm::GemmCommon<TypeInput, TypeWeight, TypeOutput> *gemm_kernel      = nullptr;
+    INEKernel                                               *optimised_kernel = nullptr;
+
+    std::tie(gemm_kernel, optimised_kernel) = select_kernel(a, b, d);
+
     // Only update at runtime if the src quantization is dynamic
     if (std::is_same<OutputStage, arm_gemm::DequantizeFloat>::value &&
         (a->info()->quantization_info().is_dynamic() || b->info()->quantization_info().is_dynamic()))
     {
         // Output dequantization is just the two src scales multiplied together
-        _gemm_kernel_asm->set_dequantize_scale(a->info()->quantization_info().uniform().scale *
-                                               b->info()->quantization_info().uniform().scale);
+        gemm_kernel->set_dequantize_scale(a->info()->quantization_info().uniform().scale *
+                                          b->info()->quantization_info().uniform().scale);
     }
 
     int       lda = a->info()->strides_in_bytes().y() / a->info()->element_size();
@@ -708,7 +1196,7 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::run(ITensorPack &
     }
 
     // Check if B is pre-tranposed and de-reference if not
-    if (b_to_use && !_gemm_kernel_asm->B_is_pretransposed())
+    if (b_to_use && !gemm_kernel->B_is_pretransposed())
     {
         ldb            = b_to_use->info()->strides_in_bytes().y() / b_to_use->info()->element_size();
         multi_stride_b = b_to_use->info()->strides_in_bytes().z() / b_to_use->info()->element_size();
@@ -721,7 +1209,7 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::run(ITensorPack &
     {
         if (c && c->info()->data_type() == DataType::S32)
         {
-            _gemm_kernel_asm->set_quantized_bias(
+            gemm_kernel->set_quantized_bias(
                 reinterpret_cast<const int32_t *>(c->buffer() + c->info()->offset_first_element_in_bytes()), 0);
         }
 
@@ -730,7 +1218,7 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::run(ITensorPack &
         {
             // Fixed format kernels need no pretranspose.
             ARM_COMPUTE_ERROR_ON(arm_compute::is_fixed_format(
-                assembly_utils::map_to_arm_compute_weight_format(_gemm_kernel_asm->get_config().weight_format)));
+                assembly_utils::map_to_arm_compute_weight_format(gemm_kernel->get_config().weight_format)));
             const int  ldb            = b_to_use->info()->strides_in_bytes().y() / b_to_use->info()->element_size();
             const auto b_ptr          = reinterpret_cast<const TypeWeight *>(b_to_use->buffer() +
                                                                     b_to_use->info()->offset_first_element_in_bytes());
@@ -741,27 +1229,29 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::run(ITensorPack &
 
             if (_is_b_constant)
             {
-                _gemm_kernel_asm->requantize_bias(pretranspose.get()->buffer(), b_ptr, ldb, multi_stride_b);
+                gemm_kernel->requantize_bias(pretranspose.get()->buffer(), b_ptr, ldb, multi_stride_b);
             }
             else
             {
-                const bool kernel_supports_transpose = _gemm_kernel_asm->B_pretranspose_supports_transpose();
+                const bool kernel_supports_transpose = gemm_kernel->B_pretranspose_supports_transpose();
                 run_parallel_pretranspose_B_array<TypeInput, TypeWeight, TypeOutput>(
-                    _gemm_kernel_asm.get(), pretranspose.get(), b_ptr, ldb, multi_stride_b,
+                    gemm_kernel, pretranspose.get(), b_ptr, ldb, multi_stride_b,
                     NEScheduler::get().num_threads(), _B_pre_pretranspose_required && kernel_supports_transpose);
             }
         }
     }
 
-    const auto scheduling_hint = scheduling_hint_heuristic(_kernel_info.method, d->info()->data_type());
+    auto scheduling_hint = scheduling_hint_heuristic(_kernel_info.method, d->info()->data_type());
+    // A single row of activations is a matrix-vector product of a decoding step
+    scheduling_hint.set_latency_critical(d->info()->dimension(1) == 1);
 
     // Set workspace if needed and reset number of threads as buffer manager gets re-created with max_threads
     CpuAuxTensorHandler workspace(offset_int_vec(AsmGemmWorkspace), _workspace_info, tensors, false);
     if (workspace.get()->buffer() != nullptr)
     {
-        _gemm_kernel_asm->set_working_space(reinterpret_cast<void *>(workspace.get()->buffer()));
+        gemm_kernel->set_working_space(reinterpret_cast<void *>(workspace.get()->buffer()));
         const unsigned int split_dim   = scheduling_hint.split_dimension();
-        const unsigned int window_size = _gemm_kernel_asm->get_window_size().total_size();
+        const unsigned int window_size = gemm_kernel->get_window_size().total_size();
         unsigned int       num_threads = NEScheduler::get().num_threads();
         if (window_size < num_threads)
         {
@@ -770,10 +1260,10 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::run(ITensorPack &
         if (split_dim != IScheduler::split_dimensions_all)
         {
             // Make sure the kernel does not expect more threads than we can actually spawn
-            const unsigned int num_iterations = _optimised_kernel->window().num_iterations(split_dim);
+            const unsigned int num_iterations = optimised_kernel->window().num_iterations(split_dim);
             num_threads                       = std::min(num_iterations, num_threads);
         }
-        _gemm_kernel_asm->set_nthreads(num_threads);
+        gemm_kernel->set_nthreads(num_threads);
     }
 
     // Prepare assembly kernel
@@ -795,10 +1285,10 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::run(ITensorPack &
     }
 
     // Set gemm parameters
-    _gemm_kernel_asm->set_arrays(in0_ptr, lda, batch_stride_a, multi_stride_a, in1_ptr, ldb, multi_stride_b, out_ptr,
-                                 ldd, batch_stride_d, multi_stride_d, bias, 0);
+    gemm_kernel->set_arrays(in0_ptr, lda, batch_stride_a, multi_stride_a, in1_ptr, ldb, multi_stride_b, out_ptr,
+                            ldd, batch_stride_d, multi_stride_d, bias, 0);
     // Schedule
-    NEScheduler::get().schedule(_optimised_kernel.get(), scheduling_hint);
+    NEScheduler::get().schedule(optimised_kernel, scheduling_hint);
 }
 
 template <typename TypeInput, typename TypeWeight, typename TypeOutput>
@@ -981,6 +1471,11 @@ Status CpuGemmAssemblyDispatch::has_opt_impl(arm_compute::WeightFormat &expected
                     "We could not find an optimized kernel for S8 input and S8 output");
             }
             break;
+        case DataType::S16:
+            ARM_COMPUTE_RETURN_ERROR_ON_MSG(
+                !(arm_gemm::has_opt_gemm<int16_t, int16_t, int32_t, arm_gemm::Nothing>(arm_gemm_expected_wf, args, {})),
+                "We could not find an optimized kernel for S16 input and S32 output");
+            break;
 #endif /* __aarch64__ */
 
 #if defined(ARM_COMPUTE_ENABLE_BF16)
@@ -1033,13 +1528,14 @@ Status CpuGemmAssemblyDispatch::validate(
 
 #ifndef __aarch64__
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(a->element_size() == 1, "8bit integer types only supported for aarch64");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(a->data_type() == DataType::S16, "S16 input only supported for aarch64");
 #endif /* __aarch64__ */
     ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(a, 1, DataType::U8, DataType::QASYMM8,
-                                                         DataType::QASYMM8_SIGNED, DataType::S8, DataType::BFLOAT16,
-                                                         DataType::F16, DataType::F32);
+                                                         DataType::QASYMM8_SIGNED, DataType::S8, DataType::S16,
+                                                         DataType::BFLOAT16, DataType::F16, DataType::F32);
     ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(
         b, 1, DataType::U8, DataType::QASYMM8, DataType::QASYMM8_SIGNED, DataType::QSYMM8_PER_CHANNEL, DataType::S8,
-        DataType::BFLOAT16, DataType::F16, DataType::F32);
+        DataType::S16, DataType::BFLOAT16, DataType::F16, DataType::F32);
     if (is_data_type_quantized_per_channel(b->data_type()))
     {
         ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(a, 1, DataType::QASYMM8_SIGNED, DataType::S8);
@@ -1064,10 +1560,21 @@ Status CpuGemmAssemblyDispatch::validate(
                                     "Only U32 output supported for U8 input");
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(a->data_type() == DataType::S8 && d->data_type() != DataType::S32,
                                     "Only S32 output supported for S8 input");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(a->data_type() == DataType::S16 && d->data_type() != DataType::S32,
+                                    "Only S32 output supported for S16 input");
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(
         a->data_type() == DataType::QASYMM8 &&
             (d->data_type() != DataType::QASYMM8 && d->data_type() != DataType::S32 && d->data_type() != DataType::F32),
         "Only QASYMM8/S32/F32 output supported for QASYMM8 input");
+    if (a->is_dynamic() || b->is_dynamic() || d->is_dynamic())
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(a, 1, DataType::BFLOAT16, DataType::F16, DataType::F32);
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(info.method != AsmConvMethod::Im2Col || info.depth_output_gemm3d != 0 ||
+                                            info.reinterpret_input_as_3d,
+                                        "Dynamic shapes are only supported for plain matrix multiplications");
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(b->is_dynamic() && b->are_values_constant(),
+                                        "Dimensions of a constant B can't be dynamic");
+    }
     arm_compute::WeightFormat expected_weight_format = arm_compute::WeightFormat::UNSPECIFIED;
     const Status              ret = CpuGemmAssemblyDispatch::has_opt_impl(expected_weight_format, a, b, c, d, info);
     if (bool(ret) && expected_weight_format != arm_compute::WeightFormat::ANY)
@@ -1143,6 +1650,9 @@ void CpuGemmAssemblyDispatch::configure(
                 create_arm_gemm_quant<int8_t, int8_t, int8_t>(_arm_gemm, a, b, c, d, act, info);
             }
             break;
+        case DataType::S16:
+            create_arm_gemm<int16_t, int16_t, int32_t>(_arm_gemm, a, b, c, d, act, info);
+            break;
 #endif /* __aarch64__ */
 #if defined(ARM_COMPUTE_ENABLE_BF16)
         case DataType::BFLOAT16:
@@ -27,6 +27,8 @@
 #include "arm_compute/graph/backends/BackendRegistry.h"
 #include "arm_compute/graph/Utils.h"
 
+#include <algorithm>
+
 namespace arm_compute
 {
 namespace graph
@@ -100,11 +102,16 @@ std::map<Target, WeightsManagerContext> &GraphContext::weights_managers()
 
 void GraphContext::finalize()
 {
-    const size_t num_pools = 1;
     for (auto &mm_obj : _memory_managers)
     {
         ARM_COMPUTE_ERROR_ON(!mm_obj.second.allocator);
 
+        // Functions of concurrently executed branches or pipeline stages need their own pool
+        const size_t num_pools =
+            (mm_obj.first == Target::NEON)
+                ? std::max({1U, _config.num_parallel_branches, _config.num_pipeline_stages})
+                : size_t(1);
+
         // Finalize intra layer memory manager
         if (mm_obj.second.intra_mm != nullptr)
         {
@@ -56,6 +56,10 @@ void GraphManager::finalize_graph(Graph &graph, GraphContext &ctx, PassManager &
     // Apply IR mutating passes
     pm.run_type(graph, IGraphMutator::MutationType::IR);
 
+    // Split the graph into pipeline stages, on the Neon target only
+    const bool pipelined = ctx.config().num_pipeline_stages > 1 && target == Target::NEON;
+    const auto stages    = detail::split_pipeline_stages(graph, pipelined ? ctx.config().num_pipeline_stages : 1);
+
     // Force target to all graph construct
     Target forced_target = target;
 
@@ -96,6 +100,9 @@ void GraphManager::finalize_graph(Graph &graph, GraphContext &ctx, PassManager &
     auto workload = detail::configure_all_nodes(graph, ctx, topological_sorted_nodes);
     ARM_COMPUTE_ERROR_ON_MSG(workload.tasks.empty(), "Could not configure all nodes!");
 
+    // Allocate the unmanaged tensors with the backend allocators
+    detail::set_all_tensor_allocators(graph, ctx);
+
     // Allocate const tensors and call accessors
     detail::allocate_const_tensors(graph);
     detail::call_all_const_node_accessors(graph);
@@ -103,8 +110,13 @@ void GraphManager::finalize_graph(Graph &graph, GraphContext &ctx, PassManager &
     // Prepare graph
     detail::prepare_all_tasks(workload);
 
+    // Independent branches are executed concurrently on the Neon target only
+    const bool parallel_branches =
+        !pipelined && ctx.config().num_parallel_branches > 1 && forced_target == Target::NEON;
+
     // Setup tensor memory (Allocate all tensors or setup transition manager)
-    if (ctx.config().use_transition_memory_manager)
+    // Transition buffers can't share memory when the tasks are not executed in order
+    if (ctx.config().use_transition_memory_manager && !parallel_branches && !pipelined)
     {
         detail::configure_transition_manager(graph, ctx, workload);
     }
@@ -113,6 +125,18 @@ void GraphManager::finalize_graph(Graph &graph, GraphContext &ctx, PassManager &
         detail::allocate_all_tensors(graph);
     }
 
+    // Setup the concurrent execution of the branches
+    if (parallel_branches)
+    {
+        detail::configure_parallel_branches(workload, ctx.config().num_parallel_branches);
+    }
+
+    // Setup the streaming of the inputs through the pipeline stages
+    if (pipelined)
+    {
+        detail::configure_pipeline_stages(workload, stages);
+    }
+
     // Finalize Graph context
     ctx.finalize();
 
@@ -129,6 +153,13 @@ void GraphManager::execute_graph(Graph &graph)
     auto it = _workloads.find(graph.id());
     ARM_COMPUTE_ERROR_ON_MSG(it == std::end(_workloads), "Graph is not registered!");
 
+    // Pipelined workloads stream the inputs through their stages until an accessor returns false
+    if (!it->second.stage_schedulers.empty())
+    {
+        detail::call_all_pipeline_stages(it->second);
+        return;
+    }
+
     while (true)
     {
         // Call input accessors
@@ -106,6 +106,18 @@ bool Tensor::call_accessor()
     return retval;
 }
 
+bool Tensor::import_accessor_memory()
+{
+    // Early exit guard
+    if (!_accessor || !_handle || _handle->is_subtensor() || !_handle->tensor().info()->is_resizable())
+    {
+        return false;
+    }
+
+    void *memory = _accessor->import_memory(*_handle->tensor().info());
+    return memory != nullptr && _handle->import_memory(memory);
+}
+
 void Tensor::bind_edge(EdgeID eid)
 {
     _bound_edges.insert(eid);
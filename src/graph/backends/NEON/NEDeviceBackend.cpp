@@ -40,6 +40,7 @@
 #include "arm_compute/runtime/MemoryGroup.h"
 #include "arm_compute/runtime/MemoryManagerOnDemand.h"
 #include "arm_compute/runtime/OffsetLifetimeManager.h"
+#include "arm_compute/runtime/PlannedLifetimeManager.h"
 #include "arm_compute/runtime/PoolManager.h"
 #include "arm_compute/runtime/Scheduler.h"
 
@@ -52,7 +53,7 @@ namespace backends
 /** Register CPU backend */
 static detail::BackendRegistrar<NEDeviceBackend> NEDeviceBackend_registrar(Target::NEON);
 
-NEDeviceBackend::NEDeviceBackend() : _allocator()
+NEDeviceBackend::NEDeviceBackend() : _allocator(), _huge_page_allocator()
 {
 }
 
@@ -75,15 +76,25 @@ void NEDeviceBackend::setup_backend_context(GraphContext &ctx)
         Scheduler::get().set_num_threads(ctx.config().num_threads);
     }
 
+    // Back the memory pools and the unmanaged tensors of the graph (e.g. weights) with huge pages
+    if (ctx.config().use_huge_pages && _huge_page_allocator == nullptr)
+    {
+        _huge_page_allocator = std::make_unique<HugePageAllocator>();
+    }
+
     // Create function level memory manager
     if (ctx.memory_management_ctx(Target::NEON) == nullptr)
     {
+        const MemoryManagerAffinity affinity =
+            ctx.config().use_memory_planner ? MemoryManagerAffinity::Planned : MemoryManagerAffinity::Offset;
+
         MemoryManagerContext mm_ctx;
         mm_ctx.target      = Target::NEON;
-        mm_ctx.intra_mm    = create_memory_manager(MemoryManagerAffinity::Offset);
-        mm_ctx.cross_mm    = create_memory_manager(MemoryManagerAffinity::Offset);
+        mm_ctx.intra_mm    = create_memory_manager(affinity);
+        mm_ctx.cross_mm    = create_memory_manager(affinity);
         mm_ctx.cross_group = std::make_shared<MemoryGroup>(mm_ctx.cross_mm);
-        mm_ctx.allocator   = &_allocator;
+        mm_ctx.allocator =
+            ctx.config().use_huge_pages ? static_cast<IAllocator *>(_huge_page_allocator.get()) : &_allocator;
 
         ctx.insert_memory_management_ctx(std::move(mm_ctx));
     }
@@ -157,6 +168,10 @@ std::shared_ptr<arm_compute::IMemoryManager> NEDeviceBackend::create_memory_mana
     {
         lifetime_mgr = std::make_shared<BlobLifetimeManager>();
     }
+    else if (affinity == MemoryManagerAffinity::Planned)
+    {
+        lifetime_mgr = std::make_shared<PlannedLifetimeManager>();
+    }
     else
     {
         lifetime_mgr = std::make_shared<OffsetLifetimeManager>();
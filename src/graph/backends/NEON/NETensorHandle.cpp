@@ -48,6 +48,16 @@ void NETensorHandle::free()
     _tensor.allocator()->free();
 }
 
+bool NETensorHandle::import_memory(void *memory)
+{
+    return bool(_tensor.allocator()->import_memory(memory));
+}
+
+void NETensorHandle::set_allocator(IAllocator *allocator)
+{
+    _tensor.allocator()->set_allocator(allocator);
+}
+
 void NETensorHandle::manage(IMemoryGroup *mg)
 {
     if (mg != nullptr)
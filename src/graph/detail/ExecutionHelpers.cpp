@@ -23,12 +23,28 @@
  */
 #include "arm_compute/graph/detail/ExecutionHelpers.h"
 
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/graph/algorithms/TopologicalSort.h"
 #include "arm_compute/graph/backends/BackendRegistry.h"
 #include "arm_compute/graph/Graph.h"
 #include "arm_compute/graph/GraphContext.h"
 #include "arm_compute/graph/GraphManager.h"
+#include "arm_compute/graph/nodes/DummyNode.h"
 #include "arm_compute/graph/Tensor.h"
 #include "arm_compute/graph/Utils.h"
+#include "arm_compute/runtime/Scheduler.h"
+#include "arm_compute/runtime/SchedulerFactory.h"
+
+#include "support/StringSupport.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <deque>
+#include <limits>
+#include <map>
+#include <set>
 
 namespace arm_compute
 {
@@ -36,6 +52,99 @@ namespace graph
 {
 namespace detail
 {
+namespace
+{
+/** Sets the scheduler of the calling thread for the lifetime of the guard, so it is reset even if a task throws */
+class ThreadSchedulerGuard final
+{
+public:
+    explicit ThreadSchedulerGuard(IScheduler *scheduler)
+    {
+        Scheduler::set_thread_scheduler(scheduler);
+    }
+    ThreadSchedulerGuard(const ThreadSchedulerGuard &)            = delete;
+    ThreadSchedulerGuard &operator=(const ThreadSchedulerGuard &) = delete;
+    ~ThreadSchedulerGuard()
+    {
+        Scheduler::set_thread_scheduler(nullptr);
+    }
+};
+
+// Rough estimate of the number of operations performed by a node
+uint64_t estimate_node_cost(const INode &node)
+{
+    const Tensor *output = node.num_outputs() > 0 ? node.output(0) : nullptr;
+    if (output == nullptr)
+    {
+        return 0;
+    }
+    const uint64_t output_size = output->desc().shape.total_size();
+
+    switch (node.type())
+    {
+        case NodeType::Input:
+        case NodeType::Output:
+        case NodeType::Const:
+        case NodeType::Dummy:
+            return 0;
+        case NodeType::ConvolutionLayer:
+        case NodeType::DeconvolutionLayer:
+        case NodeType::DepthwiseConvolutionLayer:
+        case NodeType::FusedConvolutionBatchNormalizationLayer:
+        case NodeType::FusedDepthwiseConvolutionBatchNormalizationLayer:
+        case NodeType::FullyConnectedLayer:
+        {
+            // Every output element is a dot product over the weights of its channel
+            const Tensor *weights = node.num_inputs() > 1 ? node.input(1) : nullptr;
+            if (weights == nullptr)
+            {
+                break;
+            }
+            const size_t num_channels = (node.type() == NodeType::FullyConnectedLayer)
+                                            ? output->desc().shape[0]
+                                            : get_dimension_size(output->desc(), DataLayoutDimension::CHANNEL);
+            return output_size * weights->desc().shape.total_size() / std::max<size_t>(num_channels, 1);
+        }
+        default:
+            break;
+    }
+
+    // Memory bound nodes: count the elements read and written
+    uint64_t cost = output_size;
+    for (size_t i = 0; i < node.num_inputs(); ++i)
+    {
+        if (node.input(i) != nullptr)
+        {
+            cost += node.input(i)->desc().shape.total_size();
+        }
+    }
+    return cost;
+}
+
+// Copies the content of a tensor to another one of the same shape and data type, row by row
+void copy_tensor(ITensorHandle &src, ITensorHandle &dst)
+{
+    src.map(true);
+    dst.map(true);
+
+    const ITensor &src_tensor = src.tensor();
+    ITensor       &dst_tensor = dst.tensor();
+    ARM_COMPUTE_ERROR_ON(src_tensor.info()->tensor_shape() != dst_tensor.info()->tensor_shape());
+    ARM_COMPUTE_ERROR_ON(src_tensor.info()->element_size() != dst_tensor.info()->element_size());
+
+    Window win;
+    win.use_tensor_dimensions(src_tensor.info()->tensor_shape(), Window::DimY);
+    Iterator     src_it(&src_tensor, win);
+    Iterator     dst_it(&dst_tensor, win);
+    const size_t row_size = src_tensor.info()->dimension(0) * src_tensor.info()->element_size();
+    execute_window_loop(
+        win, [&](const Coordinates &) { std::memcpy(dst_it.ptr(), src_it.ptr(), row_size); }, src_it, dst_it);
+
+    dst.unmap();
+    src.unmap();
+}
+} // namespace
+
 void validate_all_nodes(Graph &g)
 {
     auto &nodes = g.nodes();
@@ -70,6 +179,21 @@ void configure_all_tensors(Graph &g)
     }
 }
 
+void set_all_tensor_allocators(Graph &g, GraphContext &ctx)
+{
+    for (auto &tensor : g.tensors())
+    {
+        if (tensor != nullptr && tensor->handle() != nullptr)
+        {
+            MemoryManagerContext *mm_ctx = ctx.memory_management_ctx(tensor->desc().target);
+            if (mm_ctx != nullptr)
+            {
+                tensor->handle()->set_allocator(mm_ctx->allocator);
+            }
+        }
+    }
+}
+
 void allocate_all_input_tensors(INode &node)
 {
     for (unsigned int i = 0; i < node.num_inputs(); ++i)
@@ -96,6 +220,22 @@ void allocate_all_output_tensors(INode &node)
     }
 }
 
+void import_or_allocate_all_output_tensors(INode &node)
+{
+    for (unsigned int i = 0; i < node.num_outputs(); ++i)
+    {
+        Tensor *tensor = node.output(i);
+        if (tensor != nullptr && !tensor->bound_edges().empty())
+        {
+            ARM_COMPUTE_ERROR_ON_MSG(!tensor->handle(), "Tensor handle is not configured!");
+            if (!tensor->import_accessor_memory())
+            {
+                tensor->handle()->allocate();
+            }
+        }
+    }
+}
+
 void allocate_const_tensors(Graph &g)
 {
     for (auto &node : g.nodes())
@@ -105,6 +245,8 @@ void allocate_const_tensors(Graph &g)
             switch (node->type())
             {
                 case NodeType::Const:
+                    import_or_allocate_all_output_tensors(*node);
+                    break;
                 case NodeType::Input:
                     allocate_all_output_tensors(*node);
                     break;
@@ -229,6 +371,120 @@ void prepare_all_tasks(ExecutionWorkload &workload)
     }
 }
 
+void configure_parallel_branches(ExecutionWorkload &workload, unsigned int num_branches)
+{
+    ARM_COMPUTE_ERROR_ON(workload.graph == nullptr);
+
+    const size_t num_tasks = workload.tasks.size();
+    workload.task_dependencies.assign(num_tasks, {});
+    workload.task_branches.assign(num_tasks, 0);
+    workload.branch_schedulers.clear();
+
+#ifndef BARE_METAL
+    if (num_branches < 2)
+    {
+        return;
+    }
+
+    std::map<NodeID, size_t> node_tasks;
+    for (size_t i = 0; i < num_tasks; ++i)
+    {
+        node_tasks[workload.tasks[i].node->id()] = i;
+    }
+
+    // Tasks producing the inputs of a node. Nodes without a task (e.g. concatenations done through sub-tensors) are
+    // looked through, so that their consumers depend on the tasks producing their inputs.
+    std::map<NodeID, std::set<size_t>>                     taskless_producers;
+    std::function<void(const INode &, std::set<size_t> &)> collect_producers =
+        [&](const INode &node, std::set<size_t> &producers)
+    {
+        for (size_t e = 0; e < node.input_edges().size(); ++e)
+        {
+            const Edge *edge = node.input_edge(e);
+            if (edge == nullptr || edge->producer() == nullptr)
+            {
+                continue;
+            }
+            const auto task_it = node_tasks.find(edge->producer_id());
+            if (task_it != std::end(node_tasks))
+            {
+                producers.insert(task_it->second);
+                continue;
+            }
+            auto cache_it = taskless_producers.find(edge->producer_id());
+            if (cache_it == std::end(taskless_producers))
+            {
+                std::set<size_t> indirect_producers;
+                collect_producers(*edge->producer(), indirect_producers);
+                cache_it = taskless_producers.emplace(edge->producer_id(), std::move(indirect_producers)).first;
+            }
+            producers.insert(std::begin(cache_it->second), std::end(cache_it->second));
+        }
+    };
+
+    std::map<const Tensor *, std::vector<size_t>> tensor_readers;
+    for (size_t i = 0; i < num_tasks; ++i)
+    {
+        const INode     &node = *workload.tasks[i].node;
+        std::set<size_t> dependencies;
+        collect_producers(node, dependencies);
+
+        // A task writing a tensor in-place must wait for the tasks still reading its previous content
+        for (size_t o = 0; o < node.num_outputs(); ++o)
+        {
+            const auto readers_it = tensor_readers.find(node.output(o));
+            if (node.output(o) != nullptr && readers_it != std::end(tensor_readers))
+            {
+                dependencies.insert(std::begin(readers_it->second), std::end(readers_it->second));
+            }
+        }
+        dependencies.erase(i);
+        for (size_t in = 0; in < node.num_inputs(); ++in)
+        {
+            if (node.input(in) != nullptr)
+            {
+                tensor_readers[node.input(in)].push_back(i);
+            }
+        }
+
+        ARM_COMPUTE_ERROR_ON(!dependencies.empty() && *dependencies.rbegin() >= i);
+        workload.task_dependencies[i].assign(std::begin(dependencies), std::end(dependencies));
+    }
+
+    // Assign the tasks to the branches: a task continues the branch of one of its dependencies unless another
+    // successor already did, in which case it starts on the least loaded branch
+    std::vector<size_t> branch_loads(num_branches, 0);
+    std::vector<bool>   branch_continued(num_tasks, false);
+    for (size_t i = 0; i < num_tasks; ++i)
+    {
+        size_t      branch       = std::distance(std::begin(branch_loads),
+                                                 std::min_element(std::begin(branch_loads), std::end(branch_loads)));
+        const auto &dependencies = workload.task_dependencies[i];
+        for (auto dep = dependencies.rbegin(); dep != dependencies.rend(); ++dep)
+        {
+            if (!branch_continued[*dep])
+            {
+                branch_continued[*dep] = true;
+                branch                 = workload.task_branches[*dep];
+                break;
+            }
+        }
+        workload.task_branches[i] = branch;
+        ++branch_loads[branch];
+    }
+
+    // Split the threads of the active scheduler among the branches
+    const unsigned int threads_per_branch = std::max(1U, Scheduler::get().num_threads() / num_branches);
+    for (unsigned int b = 0; b < num_branches; ++b)
+    {
+        workload.branch_schedulers.emplace_back(SchedulerFactory::create());
+        workload.branch_schedulers.back()->set_num_threads(threads_per_branch);
+    }
+#else  /* BARE_METAL */
+    ARM_COMPUTE_UNUSED(num_branches);
+#endif /* BARE_METAL */
+}
+
 void call_all_tasks(ExecutionWorkload &workload)
 {
     ARM_COMPUTE_ERROR_ON(workload.ctx == nullptr);
@@ -243,10 +499,42 @@ void call_all_tasks(ExecutionWorkload &workload)
     }
 
     // Execute tasks
-    for (auto &task : workload.tasks)
+    if (workload.branch_schedulers.empty())
     {
-        task();
+        for (auto &task : workload.tasks)
+        {
+            task();
+        }
     }
+#ifndef BARE_METAL
+    else
+    {
+        // Submit every task to its branch once the tasks it depends on are complete
+        std::vector<IScheduler::Completion> completions(workload.tasks.size());
+        for (size_t i = 0; i < workload.tasks.size(); ++i)
+        {
+            std::vector<IScheduler::Completion> dependencies;
+            for (auto dep : workload.task_dependencies[i])
+            {
+                dependencies.push_back(completions[dep]);
+            }
+            IScheduler    *branch = workload.branch_schedulers[workload.task_branches[i]].get();
+            ExecutionTask *task   = &workload.tasks[i];
+            completions[i]        = branch->run_async(
+                [branch, task]()
+                {
+                    // Functions run by the task use the threads of the branch
+                    ThreadSchedulerGuard guard(branch);
+                    (*task)();
+                },
+                dependencies);
+        }
+        for (auto &completion : completions)
+        {
+            completion.get();
+        }
+    }
+#endif /* BARE_METAL */
 
     // Release memory for the transition buffers
     for (auto &mm_ctx : workload.ctx->memory_managers())
@@ -258,6 +546,324 @@ void call_all_tasks(ExecutionWorkload &workload)
     }
 }
 
+PipelineStages split_pipeline_stages(Graph &g, unsigned int num_stages)
+{
+    PipelineStages stages;
+    stages.node_stages.assign(g.nodes().size(), 0);
+    stages.transfer_nodes.resize(std::max(1U, num_stages) - 1);
+    if (num_stages < 2)
+    {
+        return stages;
+    }
+
+    // Cut the topological order into stages of similar cost. A node belongs to the stage holding the middle of its
+    // cost, so the stage of a node is never lower than the ones of its producers.
+    const std::vector<NodeID> node_order = dfs(g);
+    std::vector<uint64_t>     node_costs(g.nodes().size(), 0);
+    uint64_t                  total_cost = 0;
+    for (auto node_id : node_order)
+    {
+        node_costs[node_id] = estimate_node_cost(*g.node(node_id));
+        total_cost += node_costs[node_id];
+    }
+
+    uint64_t prefix_cost = 0;
+    for (auto node_id : node_order)
+    {
+        const INode *node = g.node(node_id);
+        if (node->type() == NodeType::Output)
+        {
+            stages.node_stages[node_id] = num_stages - 1;
+        }
+        else if (total_cost > 0 && node->type() != NodeType::Input && node->type() != NodeType::Const)
+        {
+            const uint64_t middle_cost  = prefix_cost + node_costs[node_id] / 2;
+            stages.node_stages[node_id] = std::min<uint64_t>(num_stages - 1, middle_cost * num_stages / total_cost);
+        }
+        prefix_cost += node_costs[node_id];
+    }
+
+    // Give every stage its own copy of the tensors it reads from the previous stages. Constant tensors are read-only
+    // and therefore shared.
+    for (auto node_id : node_order)
+    {
+        const INode *producer = g.node(node_id);
+        if (producer->type() == NodeType::Const)
+        {
+            continue;
+        }
+        const unsigned int producer_stage = stages.node_stages[node_id];
+        for (size_t idx = 0; idx < producer->num_outputs(); ++idx)
+        {
+            Tensor *tensor = producer->output(idx);
+            if (tensor == nullptr)
+            {
+                continue;
+            }
+
+            // Copies of the tensor in the following stages, chained through a node per stage boundary
+            std::vector<NodeID>    copies(num_stages, EmptyNodeID);
+            const std::set<EdgeID> bound_edges = tensor->bound_edges();
+            for (auto eid : bound_edges)
+            {
+                const Edge        *edge           = g.edge(eid);
+                const NodeID       consumer_id    = edge->consumer_id();
+                const size_t       consumer_idx   = edge->consumer_idx();
+                const unsigned int consumer_stage = stages.node_stages[consumer_id];
+                if (consumer_stage <= producer_stage)
+                {
+                    continue;
+                }
+
+                NodeID source     = node_id;
+                size_t source_idx = idx;
+                for (unsigned int s = producer_stage + 1; s <= consumer_stage; ++s)
+                {
+                    if (copies[s] == EmptyNodeID)
+                    {
+                        copies[s] = g.add_node<DummyNode>(tensor->desc().shape);
+                        const std::string name = producer->name() + "_stage" + support::cpp11::to_string(s);
+                        g.node(copies[s])->set_common_node_parameters(NodeParams{name, Target::UNSPECIFIED});
+                        g.add_connection(source, source_idx, copies[s], 0);
+                        stages.node_stages.push_back(s);
+                        stages.transfer_nodes[s - 1].push_back(copies[s]);
+                    }
+                    source     = copies[s];
+                    source_idx = 0;
+                }
+
+                g.remove_connection(eid);
+                g.add_connection(source, 0, consumer_id, consumer_idx);
+
+                // Output accessors follow the tensor to the last stage
+                if (g.node(consumer_id)->type() == NodeType::Output && tensor->accessor() != nullptr)
+                {
+                    g.node(source)->output(0)->set_accessor(tensor->extract_accessor());
+                }
+            }
+        }
+    }
+
+    return stages;
+}
+
+void configure_pipeline_stages(ExecutionWorkload &workload, const PipelineStages &stages)
+{
+    ARM_COMPUTE_ERROR_ON(workload.graph == nullptr);
+
+    const size_t num_stages = stages.transfer_nodes.size() + 1;
+    workload.task_stages.assign(workload.tasks.size(), 0);
+    workload.stage_transfers.clear();
+    workload.stage_schedulers.clear();
+
+#ifndef BARE_METAL
+    if (num_stages < 2)
+    {
+        return;
+    }
+
+    // Nodes added by the backend passes run in the stage of their producers
+    Graph              &g = *workload.graph;
+    std::vector<size_t> node_stages(g.nodes().size(), 0);
+    for (auto node_id : dfs(g))
+    {
+        const INode *node = g.node(node_id);
+        if (node_id < stages.node_stages.size())
+        {
+            node_stages[node_id] = stages.node_stages[node_id];
+            continue;
+        }
+        for (size_t e = 0; e < node->input_edges().size(); ++e)
+        {
+            const Edge *edge = node->input_edge(e);
+            if (edge != nullptr && edge->producer() != nullptr)
+            {
+                node_stages[node_id] = std::max(node_stages[node_id], node_stages[edge->producer_id()]);
+            }
+        }
+    }
+    for (size_t i = 0; i < workload.tasks.size(); ++i)
+    {
+        workload.task_stages[i] = node_stages[workload.tasks[i].node->id()];
+    }
+
+    workload.stage_transfers.resize(num_stages - 1);
+    for (size_t s = 0; s < num_stages - 1; ++s)
+    {
+        for (auto node_id : stages.transfer_nodes[s])
+        {
+            const INode *node = g.node(node_id);
+            ARM_COMPUTE_ERROR_ON(node == nullptr || node->type() != NodeType::Dummy);
+            workload.stage_transfers[s].emplace_back(node->input(0), node->output(0));
+        }
+    }
+
+    // Pin the threads of each stage to its own group of cores. The affinity is set from the dispatcher of the stage as
+    // the thread calling set_num_threads_with_affinity() is the first thread of the pool.
+    const unsigned int threads_per_stage = std::max(1U, Scheduler::get().num_threads() / unsigned(num_stages));
+    for (unsigned int s = 0; s < num_stages; ++s)
+    {
+        workload.stage_schedulers.emplace_back(SchedulerFactory::create());
+        IScheduler *stage = workload.stage_schedulers.back().get();
+        stage
+            ->run_async(
+                [stage, s, threads_per_stage]()
+                {
+                    stage->set_num_threads_with_affinity(threads_per_stage,
+                                                         [s, threads_per_stage](int i, int max_cores)
+                                                         { return (s * threads_per_stage + i) % max_cores; });
+                })
+            .get();
+    }
+#else  /* BARE_METAL */
+    ARM_COMPUTE_UNUSED(stages);
+#endif /* BARE_METAL */
+}
+
+void call_all_pipeline_stages(ExecutionWorkload &workload)
+{
+#ifndef BARE_METAL
+    const size_t num_stages = workload.stage_schedulers.size();
+    ARM_COMPUTE_ERROR_ON(num_stages < 2 || workload.stage_transfers.size() != num_stages - 1);
+
+    // First frame not to be executed, set once an input or output accessor returns false
+    std::atomic<size_t> end_frame{std::numeric_limits<size_t>::max()};
+    auto                stop_at = [&end_frame](size_t frame)
+    {
+        size_t current = end_frame.load();
+        while (frame < current && !end_frame.compare_exchange_weak(current, frame))
+        {
+        }
+    };
+
+    // Completions of the computations and transfers of every stage for the frames in flight
+    struct Frame
+    {
+        std::vector<IScheduler::Completion> computes;
+        std::vector<IScheduler::Completion> transfers;
+    };
+    std::deque<Frame> frames;
+
+    auto wait_all = [&frames]()
+    {
+        for (auto &frame : frames)
+        {
+            for (auto &completion : frame.computes)
+            {
+                completion.wait();
+            }
+            for (auto &completion : frame.transfers)
+            {
+                completion.wait();
+            }
+        }
+    };
+
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+    try
+    {
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+        for (size_t f = 0; f < end_frame.load(); ++f)
+        {
+            const Frame *previous = frames.empty() ? nullptr : &frames.back();
+            Frame        current;
+            for (size_t s = 0; s < num_stages; ++s)
+            {
+                IScheduler *stage = workload.stage_schedulers[s].get();
+
+                // Stage s starts frame f once the previous stage has handed over its tensors. Frame f - 1 was
+                // submitted to the stage before, so it is done with the tensors frame f overwrites.
+                std::vector<IScheduler::Completion> dependencies;
+                if (s > 0)
+                {
+                    dependencies.push_back(current.transfers[s - 1]);
+                }
+                current.computes.push_back(stage->run_async(
+                    [&workload, &end_frame, &stop_at, stage, s, f, num_stages]()
+                    {
+                        if (f >= end_frame.load())
+                        {
+                            return;
+                        }
+                        if (s == 0 && !call_all_input_node_accessors(workload))
+                        {
+                            stop_at(f);
+                            return;
+                        }
+                        {
+                            ThreadSchedulerGuard guard(stage);
+                            for (size_t i = 0; i < workload.tasks.size(); ++i)
+                            {
+                                if (workload.task_stages[i] == s)
+                                {
+                                    workload.tasks[i]();
+                                }
+                            }
+                        }
+                        if (s == num_stages - 1 && !call_all_output_node_accessors(workload))
+                        {
+                            stop_at(f + 1);
+                        }
+                    },
+                    dependencies));
+
+                // The tensors of stage s + 1 can be overwritten once it is done with frame f - 1 (including its own
+                // transfer, which may read them)
+                if (s < num_stages - 1)
+                {
+                    dependencies.clear();
+                    if (previous != nullptr)
+                    {
+                        dependencies.push_back(s + 1 < num_stages - 1 ? previous->transfers[s + 1]
+                                                                      : previous->computes[s + 1]);
+                    }
+                    current.transfers.push_back(stage->run_async(
+                        [&workload, &end_frame, s, f]()
+                        {
+                            if (f >= end_frame.load())
+                            {
+                                return;
+                            }
+                            for (auto &transfer : workload.stage_transfers[s])
+                            {
+                                copy_tensor(*transfer.first->handle(), *transfer.second->handle());
+                            }
+                        },
+                        dependencies));
+                }
+            }
+            frames.push_back(std::move(current));
+
+            // Bound the number of frames in flight to the number of stages
+            if (frames.size() > num_stages)
+            {
+                frames.front().computes.back().get();
+                frames.pop_front();
+            }
+
+            // The input accessors of the next frame run once the first stage has read the current one
+            frames.back().computes.front().get();
+        }
+
+        for (auto &frame : frames)
+        {
+            frame.computes.back().get();
+        }
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+    }
+    catch (...)
+    {
+        // Tasks still in flight reference the workload: wait for them before unwinding
+        stop_at(0);
+        wait_all();
+        throw;
+    }
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+#else  /* BARE_METAL */
+    ARM_COMPUTE_UNUSED(workload);
+#endif /* BARE_METAL */
+}
+
 bool call_all_output_node_accessors(ExecutionWorkload &workload)
 {
     bool is_valid = true;
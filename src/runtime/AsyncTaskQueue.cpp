@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef BARE_METAL
+#include "src/runtime/AsyncTaskQueue.h"
+
+#include <utility>
+
+namespace arm_compute
+{
+AsyncTaskQueue::AsyncTaskQueue()
+{
+    _thread = std::thread(&AsyncTaskQueue::dispatch, this);
+}
+
+AsyncTaskQueue::~AsyncTaskQueue()
+{
+    std::deque<Entry> dropped{};
+    {
+        std::lock_guard<std::mutex> lock(_m);
+        dropped.swap(_entries);
+        _stop = true;
+    }
+    _cv.notify_one();
+    if (_thread.joinable())
+    {
+        _thread.join();
+    }
+    // Destroying the promises of the dropped tasks releases their waiters with a broken promise
+}
+
+void AsyncTaskQueue::drain()
+{
+    {
+        std::lock_guard<std::mutex> lock(_m);
+        _stop = true;
+    }
+    _cv.notify_one();
+    if (_thread.joinable())
+    {
+        _thread.join();
+    }
+}
+
+IScheduler::Completion AsyncTaskQueue::push(Task task, const std::vector<IScheduler::Completion> &dependencies)
+{
+    Entry entry;
+    entry.task                        = std::move(task);
+    entry.dependencies                = dependencies;
+    IScheduler::Completion completion = entry.promise.get_future().share();
+    {
+        std::lock_guard<std::mutex> lock(_m);
+        _entries.emplace_back(std::move(entry));
+    }
+    _cv.notify_one();
+    return completion;
+}
+
+void AsyncTaskQueue::dispatch()
+{
+    while (true)
+    {
+        Entry entry;
+        {
+            std::unique_lock<std::mutex> lock(_m);
+            _cv.wait(lock, [&] { return _stop || !_entries.empty(); });
+            // Once stopped, the pending tasks are still run: drain() relies on it
+            if (_entries.empty())
+            {
+                return;
+            }
+            entry = std::move(_entries.front());
+            _entries.pop_front();
+        }
+
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+        try
+        {
+            for (auto &dependency : entry.dependencies)
+            {
+                // Rethrows the exception of a failed dependency
+                dependency.get();
+            }
+            entry.task();
+            entry.promise.set_value();
+        }
+        catch (...)
+        {
+            entry.promise.set_exception(std::current_exception());
+        }
+#else  /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+        for (auto &dependency : entry.dependencies)
+        {
+            dependency.wait();
+        }
+        entry.task();
+        entry.promise.set_value();
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+    }
+}
+} // namespace arm_compute
+#endif /* BARE_METAL */
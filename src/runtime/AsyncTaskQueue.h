@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_RUNTIME_ASYNCTASKQUEUE_H
+#define ACL_SRC_RUNTIME_ASYNCTASKQUEUE_H
+
+#include "arm_compute/runtime/IScheduler.h"
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace arm_compute
+{
+/** FIFO of tasks executed in submission order by a dedicated dispatcher thread.
+ *
+ * Each task waits for the completion of its dependencies before running. As the tasks of a queue are executed in
+ * submission order, dependencies on tasks of the same queue never block the queue, while dependencies on tasks of
+ * other queues let independent queues (e.g. one per scheduler) progress concurrently.
+ */
+class AsyncTaskQueue final
+{
+public:
+    /** Task signature */
+    using Task = std::function<void()>;
+
+    /** Constructor: start the dispatcher thread */
+    AsyncTaskQueue();
+    /** Destructor: drop the tasks which have not started, wait for the running one and join the dispatcher thread
+     *
+     * The completions of the dropped tasks hold a std::future_error (broken promise).
+     */
+    ~AsyncTaskQueue();
+    /** Prevent instances of this class from being copied */
+    AsyncTaskQueue(const AsyncTaskQueue &) = delete;
+    /** Prevent instances of this class from being copied */
+    AsyncTaskQueue &operator=(const AsyncTaskQueue &) = delete;
+
+    /** Submit a task
+     *
+     * @param[in] task         Task to run.
+     * @param[in] dependencies Completions that must be reached before the task starts.
+     *
+     * @return Completion of the submitted task. If the task or any of its dependencies failed it holds the exception.
+     */
+    IScheduler::Completion push(Task task, const std::vector<IScheduler::Completion> &dependencies);
+
+    /** Run all the pending tasks and join the dispatcher thread
+     *
+     * @note No task can be submitted after this call.
+     */
+    void drain();
+
+private:
+    struct Entry
+    {
+        Task                                task{};
+        std::vector<IScheduler::Completion> dependencies{};
+        std::promise<void>                  promise{};
+    };
+
+    /** Function ran by the dispatcher thread */
+    void dispatch();
+
+    std::deque<Entry>       _entries{};
+    std::mutex              _m{};
+    std::condition_variable _cv{};
+    bool                    _stop{false};
+    std::thread             _thread{};
+};
+} // namespace arm_compute
+#endif // ACL_SRC_RUNTIME_ASYNCTASKQUEUE_H
@@ -30,11 +30,16 @@
 #include "arm_compute/core/Utils.h"
 #include "arm_compute/core/utils/misc/Utility.h"
 
+#include "src/common/cpuinfo/CpuModel.h"
 #include "support/Mutex.h"
 
+#include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <cstdlib>
 #include <iostream>
+#include <limits>
 #include <list>
 #include <memory>
 #include <mutex>
@@ -138,9 +143,59 @@ void set_thread_affinity(int core_id)
  *  3. FanoutThread 1 wakes FanoutThread 5, 6
  */
 
+/** Hint to the core that the current thread is busy-waiting */
+inline void cpu_relax()
+{
+#if defined(__aarch64__) || defined(__arm__)
+    __asm__ __volatile__("yield" ::: "memory");
+#elif defined(__x86_64__) || defined(__i386__)
+    __asm__ __volatile__("pause" ::: "memory");
+#endif /* defined(__aarch64__) || defined(__arm__) */
+}
+
+/** Busy-wait until a flag is set or the spin budget is exhausted
+ *
+ * @param[in] flag      Flag to wait for.
+ * @param[in] budget_us Spin budget in microseconds. The budget is read again while spinning, so that it can be
+ *                      changed by another thread. @ref Thread::spin_forever never expires.
+ *
+ * @return True if the flag is set.
+ */
+bool spin_until(const std::atomic<bool> &flag, const std::atomic<unsigned int> &budget_us)
+{
+    using clock = std::chrono::steady_clock;
+
+    if (budget_us.load(std::memory_order_relaxed) == 0)
+    {
+        return flag.load(std::memory_order_acquire);
+    }
+    const auto   start = clock::now();
+    unsigned int count = 0;
+    while (!flag.load(std::memory_order_acquire))
+    {
+        cpu_relax();
+        // Only read the clock once in a while as it is much more expensive than checking the flag. Also give up
+        // the core then, in case the thread setting the flag is waiting for it.
+        if ((++count % 64) == 0)
+        {
+            std::this_thread::yield();
+            const unsigned int budget = budget_us.load(std::memory_order_relaxed);
+            if (budget != std::numeric_limits<unsigned int>::max() &&
+                clock::now() - start >= std::chrono::microseconds(budget))
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
 class Thread final
 {
 public:
+    /** Spin budget of the threads which never sleep */
+    static constexpr unsigned int spin_forever = std::numeric_limits<unsigned int>::max();
+
     /** Start a new thread
      *
      * Thread will be pinned to a given core id if value is non-negative
@@ -192,6 +247,15 @@ public:
         _wake_end    = wake_end;
     }
 
+    /** Set how long the worker spins waiting for work, and the caller for its completion, before sleeping
+     *
+     * @param[in] spin_us Spin budget in microseconds, 0 to sleep straight away, or @ref spin_forever.
+     */
+    void set_spin_budget(unsigned int spin_us)
+    {
+        _spin_us.store(spin_us, std::memory_order_relaxed);
+    }
+
 private:
     std::thread                        _thread{};
     ThreadInfo                         _info{};
@@ -199,8 +263,11 @@ private:
     ThreadFeeder                      *_feeder{nullptr};
     std::mutex                         _m{};
     std::condition_variable            _cv{};
-    bool                               _wait_for_work{false};
-    bool                               _job_complete{true};
+    std::atomic<bool>                  _wait_for_work{false};
+    std::atomic<bool>                  _job_complete{true};
+    std::atomic<bool>                  _worker_sleeping{false};
+    std::atomic<bool>                  _caller_sleeping{false};
+    std::atomic<unsigned int>          _spin_us{0};
     std::exception_ptr                 _current_exception{nullptr};
     int                                _core_pin{-1};
     std::list<Thread>                 *_thread_pool{nullptr};
@@ -234,19 +301,26 @@ void Thread::set_workload(std::vector<IScheduler::Workload> *workloads, ThreadFe
 
 void Thread::start()
 {
+    _job_complete.store(false, std::memory_order_relaxed);
+    _wait_for_work.store(true);
+    // A spinning worker picks the work up by itself: only go through the kernel if it is sleeping
+    if (_spin_us.load(std::memory_order_relaxed) == 0 || _worker_sleeping.load())
     {
-        std::lock_guard<std::mutex> lock(_m);
-        _wait_for_work = true;
-        _job_complete  = false;
+        {
+            std::lock_guard<std::mutex> lock(_m);
+        }
+        _cv.notify_all();
     }
-    _cv.notify_one();
 }
 
 std::exception_ptr Thread::wait()
 {
+    if (!spin_until(_job_complete, _spin_us))
     {
         std::unique_lock<std::mutex> lock(_m);
-        _cv.wait(lock, [&] { return _job_complete; });
+        _caller_sleeping.store(true);
+        _cv.wait(lock, [&] { return _job_complete.load(); });
+        _caller_sleeping.store(false, std::memory_order_relaxed);
     }
     return _current_exception;
 }
@@ -257,9 +331,14 @@ void Thread::worker_thread()
 
     while (true)
     {
-        std::unique_lock<std::mutex> lock(_m);
-        _cv.wait(lock, [&] { return _wait_for_work; });
-        _wait_for_work = false;
+        if (!spin_until(_wait_for_work, _spin_us))
+        {
+            std::unique_lock<std::mutex> lock(_m);
+            _worker_sleeping.store(true);
+            _cv.wait(lock, [&] { return _wait_for_work.load(); });
+            _worker_sleeping.store(false, std::memory_order_relaxed);
+        }
+        _wait_for_work.store(false, std::memory_order_relaxed);
 
         _current_exception = nullptr;
 
@@ -294,10 +373,16 @@ void Thread::worker_thread()
             _current_exception = std::current_exception();
         }
 #endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
-        _workloads    = nullptr;
-        _job_complete = true;
-        lock.unlock();
-        _cv.notify_one();
+        _workloads = nullptr;
+        _job_complete.store(true);
+        // A spinning caller notices the completion by itself: only go through the kernel if it is sleeping
+        if (_spin_us.load(std::memory_order_relaxed) == 0 || _caller_sleeping.load())
+        {
+            {
+                std::lock_guard<std::mutex> lock(_m);
+            }
+            _cv.notify_all();
+        }
     }
 }
 } //namespace
@@ -332,11 +417,31 @@ struct CPPScheduler::Impl final
         {
             _forced_mode = ModeToggle::None;
         }
+
+        const auto capacity_env_v = utility::tolower(utility::getenv("ARM_COMPUTE_CPP_SCHEDULER_CAPACITY"));
+        if (capacity_env_v == "weighted")
+        {
+            _capacity_policy = CapacityPolicy::WEIGHTED;
+        }
+        else if (capacity_env_v == "big_only")
+        {
+            _capacity_policy = CapacityPolicy::WEIGHTED_BIG_ONLY;
+        }
+
+        const auto spin_env_v = utility::getenv("ARM_COMPUTE_CPP_SCHEDULER_SPIN_US");
+        if (!spin_env_v.empty())
+        {
+            _spin_us = static_cast<unsigned int>(std::strtoul(spin_env_v.c_str(), nullptr, 10));
+            update_spin_budget();
+        }
     }
     void set_num_threads(unsigned int num_threads, unsigned int thread_hint)
     {
         _num_threads = num_threads == 0 ? thread_hint : num_threads;
         _threads.resize(_num_threads - 1);
+        // Threads aren't pinned: the cores they will run on are unknown
+        _core_capacities.clear();
+        update_spin_budget();
         auto_switch_mode(_num_threads);
     }
     void set_num_threads_with_affinity(unsigned int num_threads, unsigned int thread_hint, BindFunc func)
@@ -344,14 +449,19 @@ struct CPPScheduler::Impl final
         _num_threads = num_threads == 0 ? thread_hint : num_threads;
 
         // Set affinity on main thread
-        set_thread_affinity(func(0, thread_hint));
+        const int main_core = func(0, thread_hint);
+        set_thread_affinity(main_core);
+        _core_capacities.assign(1, core_capacity(main_core));
 
         // Set affinity on worked threads
         _threads.clear();
         for (auto i = 1U; i < _num_threads; ++i)
         {
-            _threads.emplace_back(func(i, thread_hint));
+            const int core = func(i, thread_hint);
+            _threads.emplace_back(core);
+            _core_capacities.push_back(core_capacity(core));
         }
+        update_spin_budget();
         auto_switch_mode(_num_threads);
     }
     void auto_switch_mode(unsigned int num_threads_to_use)
@@ -413,14 +523,36 @@ struct CPPScheduler::Impl final
         return _mode;
     }
 
+    void update_spin_budget()
+    {
+        for (auto &thread : _threads)
+        {
+            thread.set_spin_budget(_keep_hot ? Thread::spin_forever : _spin_us);
+        }
+    }
+    /** Capacity of a core, or of a big core if the thread isn't pinned */
+    static unsigned int core_capacity(int core_id)
+    {
+        const CPUInfo &cpu_info = CPUInfo::get();
+        if (core_id < 0 || static_cast<unsigned int>(core_id) >= cpu_info.get_cpu_num())
+        {
+            return cpuinfo::model_capacity(CPUModel::GENERIC);
+        }
+        return cpuinfo::model_capacity(cpu_info.get_cpu_model(core_id));
+    }
+
     void run_workloads(std::vector<IScheduler::Workload> &workloads);
 
-    unsigned int       _num_threads;
-    std::list<Thread>  _threads;
-    arm_compute::Mutex _run_workloads_mutex{};
-    Mode               _mode{Mode::Linear};
-    ModeToggle         _forced_mode{ModeToggle::None};
-    unsigned int       _wake_fanout{0};
+    unsigned int              _num_threads;
+    std::list<Thread>         _threads;
+    arm_compute::Mutex        _run_workloads_mutex{};
+    Mode                      _mode{Mode::Linear};
+    ModeToggle                _forced_mode{ModeToggle::None};
+    unsigned int              _wake_fanout{0};
+    CapacityPolicy            _capacity_policy{CapacityPolicy::UNIFORM};
+    std::vector<unsigned int> _core_capacities{}; /**< Capacity of the core of each thread, main thread first */
+    unsigned int              _spin_us{0};
+    bool                      _keep_hot{false};
 };
 
 /*
@@ -436,7 +568,10 @@ CPPScheduler::CPPScheduler() : _impl(std::make_unique<Impl>(num_threads_hint()))
 {
 }
 
-CPPScheduler::~CPPScheduler() = default;
+CPPScheduler::~CPPScheduler()
+{
+    drain_async_tasks();
+}
 
 void CPPScheduler::set_num_threads(unsigned int num_threads)
 {
@@ -457,6 +592,53 @@ unsigned int CPPScheduler::num_threads() const
     return _impl->num_threads();
 }
 
+void CPPScheduler::set_capacity_policy(CapacityPolicy policy)
+{
+    // No changes of the policy while current workloads are being split
+    arm_compute::lock_guard<std::mutex> lock(_impl->_run_workloads_mutex);
+    _impl->_capacity_policy = policy;
+}
+
+void CPPScheduler::set_spin_wait(unsigned int spin_us)
+{
+    // Threads can't be resized while the budget is updated
+    arm_compute::lock_guard<std::mutex> lock(_impl->_run_workloads_mutex);
+    _impl->_spin_us = spin_us;
+    _impl->update_spin_budget();
+}
+
+void CPPScheduler::set_keep_hot(bool keep_hot)
+{
+    // Threads can't be resized while the budget is updated
+    arm_compute::lock_guard<std::mutex> lock(_impl->_run_workloads_mutex);
+    _impl->_keep_hot = keep_hot;
+    _impl->update_spin_budget();
+}
+
+std::vector<unsigned int> CPPScheduler::thread_weights(unsigned int num_threads, const Hints &hints) const
+{
+    const std::vector<unsigned int> &capacities = _impl->_core_capacities;
+    if (_impl->_capacity_policy == CapacityPolicy::UNIFORM || num_threads == 0 || num_threads > capacities.size())
+    {
+        return {};
+    }
+
+    // run_workloads() gives the thread ids [0, num_threads - 1) to the pool threads and the last one to the main thread
+    std::vector<unsigned int> weights(capacities.begin() + 1, capacities.begin() + num_threads);
+    weights.push_back(capacities[0]);
+
+    if (_impl->_capacity_policy == CapacityPolicy::WEIGHTED_BIG_ONLY && hints.latency_critical())
+    {
+        // Same threshold as the one used to count the big cores in cpuinfo
+        const unsigned int threshold = *std::max_element(weights.begin(), weights.end()) / 2;
+        for (auto &w : weights)
+        {
+            w = (w < threshold) ? 0U : w;
+        }
+    }
+    return weights;
+}
+
 #ifndef DOXYGEN_SKIP_THIS
 void CPPScheduler::run_workloads(std::vector<IScheduler::Workload> &workloads)
 {
@@ -29,6 +29,11 @@
 
 namespace arm_compute
 {
+SingleThreadScheduler::~SingleThreadScheduler()
+{
+    drain_async_tasks();
+}
+
 void SingleThreadScheduler::set_num_threads(unsigned int num_threads)
 {
     ARM_COMPUTE_UNUSED(num_threads);
@@ -0,0 +1,573 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/CPP/WorkStealingScheduler.h"
+
+#include "arm_compute/core/CPP/ICPPKernel.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Log.h"
+
+#include "support/Mutex.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace arm_compute
+{
+namespace
+{
+/** Range of workload indices owned by one thread of the pool.
+ *
+ * The begin and end of the range are packed in a single 64-bit atomic so that the owner (popping from the front)
+ * and the thieves (splitting off the back) can both update it with a single compare-and-swap.
+ * The structure is padded so that the ranges of two threads never share a cache line.
+ */
+struct WorkRange
+{
+    static constexpr uint64_t end_mask = 0xFFFFFFFFu;
+
+    static uint64_t pack(uint32_t begin, uint32_t end)
+    {
+        return (static_cast<uint64_t>(begin) << 32) | end;
+    }
+
+    /** Reset the range. Must only be called while no other thread is accessing it. */
+    void reset(uint32_t begin, uint32_t end)
+    {
+        range.store(pack(begin, end), std::memory_order_release);
+    }
+
+    /** Pop the first index of the range. Only called by the owner of the range.
+     *
+     * @param[out] next Index of the workload to run next.
+     *
+     * @return False if the range is empty.
+     */
+    bool pop(unsigned int &next)
+    {
+        uint64_t r = range.load(std::memory_order_acquire);
+        while (true)
+        {
+            const uint32_t begin = static_cast<uint32_t>(r >> 32);
+            const uint32_t end   = static_cast<uint32_t>(r & end_mask);
+            if (begin >= end)
+            {
+                return false;
+            }
+            if (range.compare_exchange_weak(r, pack(begin + 1, end), std::memory_order_acq_rel,
+                                            std::memory_order_acquire))
+            {
+                next = begin;
+                return true;
+            }
+        }
+    }
+
+    /** Steal the back half of the range.
+     *
+     * @param[out] begin First index of the stolen range.
+     * @param[out] end   End of the stolen range (not inclusive).
+     *
+     * @return False if the range is empty.
+     */
+    bool steal(uint32_t &begin, uint32_t &end)
+    {
+        uint64_t r = range.load(std::memory_order_acquire);
+        while (true)
+        {
+            const uint32_t b = static_cast<uint32_t>(r >> 32);
+            const uint32_t e = static_cast<uint32_t>(r & end_mask);
+            if (b >= e)
+            {
+                return false;
+            }
+            const uint32_t mid = e - (e - b + 1) / 2;
+            if (range.compare_exchange_weak(r, pack(b, mid), std::memory_order_acq_rel, std::memory_order_acquire))
+            {
+                begin = mid;
+                end   = e;
+                return true;
+            }
+        }
+    }
+
+    std::atomic<uint64_t> range{0};
+    char                  padding[128 - sizeof(std::atomic<uint64_t>)]{};
+};
+
+/** State shared by all the threads taking part in a single run_workloads() call */
+struct WorkContext
+{
+    std::vector<IScheduler::Workload>       *workloads{nullptr};
+    std::vector<WorkRange>                  *ranges{nullptr};
+    const std::vector<std::vector<unsigned>> *victims{nullptr};
+};
+
+/** Run the workloads of the calling thread's range, then steal from the other threads until no work is left.
+ *
+ * @param[in] ctx  Workloads, ranges and victim lists of the current run.
+ * @param[in] info Threading and CPU info.
+ */
+void process_workloads(const WorkContext &ctx, const ThreadInfo &info)
+{
+    auto              &workloads = *ctx.workloads;
+    auto              &ranges    = *ctx.ranges;
+    WorkRange         &own       = ranges[info.thread_id];
+    const auto        &victims   = (*ctx.victims)[info.thread_id];
+    unsigned int       index     = 0;
+    while (true)
+    {
+        while (own.pop(index))
+        {
+            ARM_COMPUTE_ERROR_ON(index >= workloads.size());
+            workloads[index](info);
+        }
+
+        // Own range exhausted: look for a victim, closest first
+        bool     stolen = false;
+        uint32_t begin  = 0;
+        uint32_t end    = 0;
+        for (auto victim : victims)
+        {
+            if (static_cast<int>(victim) < info.num_threads && ranges[victim].steal(begin, end))
+            {
+                stolen = true;
+                break;
+            }
+        }
+        if (!stolen)
+        {
+            // All the ranges are empty: the remaining workloads are being run by their owners
+            return;
+        }
+
+        // Keep the first stolen workload for ourselves and expose the rest to the other thieves
+        own.reset(begin + 1, end);
+        ARM_COMPUTE_ERROR_ON(begin >= workloads.size());
+        workloads[begin](info);
+    }
+}
+
+/** Set thread affinity. Pin current thread to a particular core
+ *
+ * @param[in] core_id ID of the core to which the current thread is pinned
+ */
+void set_thread_affinity(int core_id)
+{
+    if (core_id < 0)
+    {
+        return;
+    }
+
+#if !defined(_WIN64) && !defined(__APPLE__) && !defined(__OpenBSD__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(core_id, &set);
+    ARM_COMPUTE_EXIT_ON_MSG(sched_setaffinity(0, sizeof(set), &set), "Error setting thread affinity");
+#endif /* !defined(__APPLE__) && !defined(__OpenBSD__) */
+}
+
+class Worker final
+{
+public:
+    /** Start a new thread
+     *
+     * Thread will be pinned to a given core id if value is non-negative
+     *
+     * @param[in] core_pin Core id to pin the thread on. If negative no thread pinning will take place
+     */
+    explicit Worker(int core_pin = -1);
+
+    Worker(const Worker &)            = delete;
+    Worker &operator=(const Worker &) = delete;
+    Worker(Worker &&)                 = delete;
+    Worker &operator=(Worker &&)      = delete;
+
+    /** Destructor. Make the thread join. */
+    ~Worker();
+
+    /** Set workloads
+     *
+     * @param[in] ctx      Shared state of the run, nullptr to request the thread to exit.
+     * @param[in] info     Threading and CPU info.
+     * @param[in] children Workers this worker must wake up before processing its workloads.
+     */
+    void set_workload(const WorkContext *ctx, const ThreadInfo &info, std::vector<Worker *> children);
+
+    /** Request the worker thread to start executing workloads.
+     *
+     * @note This function will return as soon as the workloads have been sent to the worker thread.
+     * wait() needs to be called to ensure the execution is complete.
+     */
+    void start();
+
+    /** Wait for the current kernel execution to complete. */
+    std::exception_ptr wait();
+
+    /** Function ran by the worker thread. */
+    void worker_thread();
+
+private:
+    std::thread             _thread{};
+    ThreadInfo              _info{};
+    const WorkContext      *_ctx{nullptr};
+    std::vector<Worker *>   _children{};
+    std::mutex              _m{};
+    std::condition_variable _cv{};
+    bool                    _wait_for_work{false};
+    bool                    _job_complete{true};
+    std::exception_ptr      _current_exception{nullptr};
+    int                     _core_pin{-1};
+};
+
+Worker::Worker(int core_pin) : _core_pin(core_pin)
+{
+    _thread = std::thread(&Worker::worker_thread, this);
+}
+
+Worker::~Worker()
+{
+    // Make sure worker thread has ended
+    if (_thread.joinable())
+    {
+        set_workload(nullptr, ThreadInfo(), {});
+        start();
+        _thread.join();
+    }
+}
+
+void Worker::set_workload(const WorkContext *ctx, const ThreadInfo &info, std::vector<Worker *> children)
+{
+    _ctx      = ctx;
+    _info     = info;
+    _children = std::move(children);
+}
+
+void Worker::start()
+{
+    {
+        std::lock_guard<std::mutex> lock(_m);
+        _wait_for_work = true;
+        _job_complete  = false;
+    }
+    _cv.notify_one();
+}
+
+std::exception_ptr Worker::wait()
+{
+    {
+        std::unique_lock<std::mutex> lock(_m);
+        _cv.wait(lock, [&] { return _job_complete; });
+    }
+    return _current_exception;
+}
+
+void Worker::worker_thread()
+{
+    set_thread_affinity(_core_pin);
+
+    while (true)
+    {
+        std::unique_lock<std::mutex> lock(_m);
+        _cv.wait(lock, [&] { return _wait_for_work; });
+        _wait_for_work = false;
+
+        _current_exception = nullptr;
+
+        // Exit if the worker thread has not been fed with workloads
+        if (_ctx == nullptr)
+        {
+            return;
+        }
+
+        // Wake up the next level of the wake-up tree before starting to work
+        for (auto child : _children)
+        {
+            child->start();
+        }
+
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+        try
+        {
+#endif /* ARM_COMPUTE_EXCEPTIONS_ENABLED */
+            process_workloads(*_ctx, _info);
+
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+        }
+        catch (...)
+        {
+            _current_exception = std::current_exception();
+        }
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+        _ctx          = nullptr;
+        _job_complete = true;
+        lock.unlock();
+        _cv.notify_one();
+    }
+}
+} // namespace
+
+struct WorkStealingScheduler::Impl final
+{
+    /** Number of workers every thread wakes up */
+    constexpr static unsigned int wake_fanout = 2;
+
+    explicit Impl(unsigned int thread_hint)
+    {
+        set_num_threads(thread_hint, thread_hint);
+    }
+    void set_num_threads(unsigned int num_threads, unsigned int thread_hint)
+    {
+        _num_threads = num_threads == 0 ? thread_hint : num_threads;
+        _workers.clear();
+        _main_core_pin = -1;
+        _worker_core_pins.assign(_num_threads - 1, -1);
+        for (auto i = 1U; i < _num_threads; ++i)
+        {
+            _workers.emplace_back(std::make_unique<Worker>());
+        }
+        reset_victims();
+    }
+    void set_num_threads_with_affinity(unsigned int num_threads, unsigned int thread_hint, BindFunc func)
+    {
+        _num_threads = num_threads == 0 ? thread_hint : num_threads;
+        _workers.clear();
+        _worker_core_pins.resize(_num_threads - 1);
+
+        _main_core_pin = func(0, thread_hint);
+        set_thread_affinity(_main_core_pin);
+        for (auto i = 1U; i < _num_threads; ++i)
+        {
+            _worker_core_pins[i - 1] = func(i, thread_hint);
+            _workers.emplace_back(std::make_unique<Worker>(_worker_core_pins[i - 1]));
+        }
+        reset_victims();
+    }
+
+    /** Discard the victim lists computed for the previous pool of threads */
+    void reset_victims()
+    {
+        _victims.assign(_num_threads, {});
+        _ranges = std::vector<WorkRange>(_num_threads);
+    }
+
+    /** Get for every thread of a run the order in which it visits the other threads when stealing.
+     *
+     * In a run on @p num_threads threads, threads 0 to num_threads - 2 are the first workers and the main thread is
+     * the last one (see run_workloads), so the lists depend on the number of threads. They are computed on first use.
+     *
+     * Threads pinned to a core of the same model as the thief's are visited first, as they are likely to share a
+     * cluster and its caches, then the others by increasing distance in the run, alternating both directions.
+     *
+     * @param[in] num_threads Number of threads taking part in the run.
+     *
+     * @return The victims of each thread of the run
+     */
+    const std::vector<std::vector<unsigned>> &victims(unsigned int num_threads)
+    {
+        auto &run_victims = _victims[num_threads - 1];
+        if (!run_victims.empty())
+        {
+            return run_victims;
+        }
+
+        const CPUInfo &cpu_info = CPUInfo::get();
+        auto           model_of = [&](unsigned int t)
+        {
+            const int core_pin = t + 1 == num_threads ? _main_core_pin : _worker_core_pins[t];
+            return core_pin < 0 ? CPUModel::GENERIC : cpu_info.get_cpu_model(core_pin);
+        };
+
+        run_victims.assign(num_threads, {});
+        for (unsigned int t = 0; t < num_threads; ++t)
+        {
+            auto &thread_victims = run_victims[t];
+            for (unsigned int d = 1; d <= num_threads / 2; ++d)
+            {
+                const unsigned int next = (t + d) % num_threads;
+                const unsigned int prev = (t + num_threads - d) % num_threads;
+                thread_victims.push_back(next);
+                if (prev != next)
+                {
+                    thread_victims.push_back(prev);
+                }
+            }
+            const CPUModel own_model = model_of(t);
+            std::stable_partition(thread_victims.begin(), thread_victims.end(),
+                                  [&](unsigned int v) { return model_of(v) == own_model; });
+        }
+        return run_victims;
+    }
+    unsigned int num_threads() const
+    {
+        return _num_threads;
+    }
+
+    unsigned int                                    _num_threads{1};
+    std::vector<std::unique_ptr<Worker>>            _workers{};
+    std::vector<int>                                _worker_core_pins{};
+    int                                             _main_core_pin{-1};
+    /** Victim lists of the runs, indexed by their number of threads minus one */
+    std::vector<std::vector<std::vector<unsigned>>> _victims{};
+    std::vector<WorkRange>                          _ranges{};
+    arm_compute::Mutex                              _run_workloads_mutex{};
+};
+
+WorkStealingScheduler::WorkStealingScheduler() : _impl(std::make_unique<Impl>(num_threads_hint()))
+{
+}
+
+WorkStealingScheduler::~WorkStealingScheduler()
+{
+    drain_async_tasks();
+}
+
+void WorkStealingScheduler::set_num_threads(unsigned int num_threads)
+{
+    // No changes in the number of threads while current workloads are running
+    arm_compute::lock_guard<std::mutex> lock(_impl->_run_workloads_mutex);
+    _impl->set_num_threads(num_threads, num_threads_hint());
+}
+
+void WorkStealingScheduler::set_num_threads_with_affinity(unsigned int num_threads, BindFunc func)
+{
+    // No changes in the number of threads while current workloads are running
+    arm_compute::lock_guard<std::mutex> lock(_impl->_run_workloads_mutex);
+    _impl->set_num_threads_with_affinity(num_threads, num_threads_hint(), func);
+}
+
+unsigned int WorkStealingScheduler::num_threads() const
+{
+    return _impl->num_threads();
+}
+
+#ifndef DOXYGEN_SKIP_THIS
+void WorkStealingScheduler::run_workloads(std::vector<IScheduler::Workload> &workloads)
+{
+    // Mutex to ensure other threads won't interfere with the setup of the current thread's workloads
+    arm_compute::lock_guard<std::mutex> lock(_impl->_run_workloads_mutex);
+    const unsigned int num_threads_to_use = std::min(_impl->num_threads(), static_cast<unsigned int>(workloads.size()));
+    if (num_threads_to_use < 1)
+    {
+        return;
+    }
+
+    // Give every thread a contiguous block of workloads so that neighbouring windows run on the same core
+    const auto num_workloads = static_cast<uint32_t>(workloads.size());
+    for (unsigned int t = 0; t < _impl->num_threads(); ++t)
+    {
+        if (t < num_threads_to_use)
+        {
+            _impl->_ranges[t].reset(static_cast<uint32_t>(uint64_t(num_workloads) * t / num_threads_to_use),
+                                    static_cast<uint32_t>(uint64_t(num_workloads) * (t + 1) / num_threads_to_use));
+        }
+        else
+        {
+            _impl->_ranges[t].reset(0, 0);
+        }
+    }
+
+    WorkContext ctx;
+    ctx.workloads = &workloads;
+    ctx.ranges    = &_impl->_ranges;
+    ctx.victims   = &_impl->victims(num_threads_to_use);
+
+    ThreadInfo info;
+    info.cpu_info    = &cpu_info();
+    info.num_threads = num_threads_to_use;
+
+    // Workers are woken up as a tree: worker t wakes up workers wake_fanout * t + 1 ... wake_fanout * (t + 1)
+    const unsigned int num_workers = num_threads_to_use - 1;
+    for (unsigned int t = 0; t < num_workers; ++t)
+    {
+        std::vector<Worker *> children;
+        for (unsigned int c = Impl::wake_fanout * t + 1; c <= Impl::wake_fanout * (t + 1) && c < num_workers; ++c)
+        {
+            children.push_back(_impl->_workers[c].get());
+        }
+        info.thread_id = t;
+        _impl->_workers[t]->set_workload(&ctx, info, std::move(children));
+    }
+    if (num_workers > 0)
+    {
+        _impl->_workers[0]->start();
+    }
+
+    info.thread_id                    = num_workers; // Set main thread's thread_id
+    std::exception_ptr last_exception = nullptr;
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+    try
+    {
+#endif                                     /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+        process_workloads(ctx, info); // Main thread processes workloads
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+    }
+    catch (...)
+    {
+        last_exception = std::current_exception();
+    }
+
+    try
+    {
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+        for (unsigned int t = 0; t < num_workers; ++t)
+        {
+            std::exception_ptr current_exception = _impl->_workers[t]->wait();
+            if (current_exception)
+            {
+                last_exception = current_exception;
+            }
+        }
+        if (last_exception)
+        {
+            std::rethrow_exception(last_exception);
+        }
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+    }
+    catch (const std::system_error &e)
+    {
+        std::cerr << "Caught system_error with code " << e.code() << " meaning " << e.what() << '\n';
+    }
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+}
+#endif /* DOXYGEN_SKIP_THIS */
+
+void WorkStealingScheduler::schedule_op(ICPPKernel *kernel, const Hints &hints, const Window &window, ITensorPack &tensors)
+{
+    schedule_common(kernel, hints, window, tensors);
+}
+
+void WorkStealingScheduler::schedule(ICPPKernel *kernel, const Hints &hints)
+{
+    ITensorPack tensors;
+    schedule_common(kernel, hints, kernel->window(), tensors);
+}
+} // namespace arm_compute
@@ -25,12 +25,20 @@
 
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/utils/math/Math.h"
 #include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/Scheduler.h"
 
 #include "src/common/utils/Log.h"
+#include "src/core/CPP/NonMaxSuppression.h"
 #include "src/core/helpers/AutoConfiguration.h"
 
-#include <list>
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#if defined(__aarch64__)
+#include <arm_neon.h>
+#endif // defined(__aarch64__)
 
 namespace arm_compute
 {
@@ -72,174 +80,43 @@ Status validate_arguments(const ITensorInfo       *input_loc,
     return Status{};
 }
 
-/** Function used to sort pair<float, T> in descend order based on the score (first) value.
- */
-template <typename T>
-bool SortScorePairDescend(const std::pair<float, T> &pair1, const std::pair<float, T> &pair2)
-{
-    return pair1.first > pair2.first;
-}
-
-/** Get location predictions from input_loc.
- *
- * @param[in]  input_loc                The input location prediction.
- * @param[in]  num                      The number of images.
- * @param[in]  num_priors               number of predictions per class.
- * @param[in]  num_loc_classes          number of location classes. It is 1 if share_location is true,
- *                                      and is equal to number of classes needed to predict otherwise.
- * @param[in]  share_location           If true, all classes share the same location prediction.
- * @param[out] all_location_predictions All the location predictions.
- *
- */
-void retrieve_all_loc_predictions(const ITensor          *input_loc,
-                                  const int               num,
-                                  const int               num_priors,
-                                  const int               num_loc_classes,
-                                  const bool              share_location,
-                                  std::vector<LabelBBox> &all_location_predictions)
-{
-    for (int i = 0; i < num; ++i)
-    {
-        for (int c = 0; c < num_loc_classes; ++c)
-        {
-            int label = share_location ? -1 : c;
-            if (all_location_predictions[i].find(label) == all_location_predictions[i].end())
-            {
-                all_location_predictions[i][label].resize(num_priors);
-            }
-            else
-            {
-                ARM_COMPUTE_ERROR_ON(all_location_predictions[i][label].size() != static_cast<size_t>(num_priors));
-                break;
-            }
-        }
-    }
-    for (int i = 0; i < num; ++i)
-    {
-        for (int p = 0; p < num_priors; ++p)
-        {
-            for (int c = 0; c < num_loc_classes; ++c)
-            {
-                const int label    = share_location ? -1 : c;
-                const int base_ptr = i * num_priors * num_loc_classes * 4 + p * num_loc_classes * 4 + c * 4;
-                //xmin, ymin, xmax, ymax
-                all_location_predictions[i][label][p][0] =
-                    *reinterpret_cast<float *>(input_loc->ptr_to_element(Coordinates(base_ptr)));
-                all_location_predictions[i][label][p][1] =
-                    *reinterpret_cast<float *>(input_loc->ptr_to_element(Coordinates(base_ptr + 1)));
-                all_location_predictions[i][label][p][2] =
-                    *reinterpret_cast<float *>(input_loc->ptr_to_element(Coordinates(base_ptr + 2)));
-                all_location_predictions[i][label][p][3] =
-                    *reinterpret_cast<float *>(input_loc->ptr_to_element(Coordinates(base_ptr + 3)));
-            }
-        }
-    }
-}
-
-/** Get confidence predictions from input_conf.
- *
- * @param[in]  input_loc                The input location prediction.
- * @param[in]  num                      The number of images.
- * @param[in]  num_priors               Number of predictions per class.
- * @param[in]  num_loc_classes          Number of location classes. It is 1 if share_location is true,
- *                                      and is equal to number of classes needed to predict otherwise.
- * @param[out] all_location_predictions All the location predictions.
- *
- */
-void retrieve_all_conf_scores(const ITensor                                  *input_conf,
-                              const int                                       num,
-                              const int                                       num_priors,
-                              const int                                       num_classes,
-                              std::vector<std::map<int, std::vector<float>>> &all_confidence_scores)
-{
-    std::vector<float> tmp_buffer;
-    tmp_buffer.resize(num * num_priors * num_classes);
-    for (int i = 0; i < num; ++i)
-    {
-        for (int c = 0; c < num_classes; ++c)
-        {
-            for (int p = 0; p < num_priors; ++p)
-            {
-                tmp_buffer[i * num_classes * num_priors + c * num_priors + p] = *reinterpret_cast<float *>(
-                    input_conf->ptr_to_element(Coordinates(i * num_classes * num_priors + p * num_classes + c)));
-            }
-        }
-    }
-    for (int i = 0; i < num; ++i)
-    {
-        for (int c = 0; c < num_classes; ++c)
-        {
-            all_confidence_scores[i][c].resize(num_priors);
-            all_confidence_scores[i][c].assign(&tmp_buffer[i * num_classes * num_priors + c * num_priors],
-                                               &tmp_buffer[i * num_classes * num_priors + c * num_priors + num_priors]);
-        }
-    }
-}
-
-/** Get prior boxes from input_priorbox.
- *
- * @param[in]  input_priorbox           The input location prediction.
- * @param[in]  num_priors               Number of priors.
- * @param[in]  num_loc_classes          number of location classes. It is 1 if share_location is true,
- *                                      and is equal to number of classes needed to predict otherwise.
- * @param[out] all_prior_bboxes         If true, all classes share the same location prediction.
- * @param[out] all_location_predictions All the location predictions.
- *
- */
-void retrieve_all_priorbox(const ITensor                     *input_priorbox,
-                           const int                          num_priors,
-                           std::vector<BBox>                 &all_prior_bboxes,
-                           std::vector<std::array<float, 4>> &all_prior_variances)
-{
-    for (int i = 0; i < num_priors; ++i)
-    {
-        all_prior_bboxes[i] = {{*reinterpret_cast<float *>(input_priorbox->ptr_to_element(Coordinates(i * 4))),
-                                *reinterpret_cast<float *>(input_priorbox->ptr_to_element(Coordinates(i * 4 + 1))),
-                                *reinterpret_cast<float *>(input_priorbox->ptr_to_element(Coordinates(i * 4 + 2))),
-                                *reinterpret_cast<float *>(input_priorbox->ptr_to_element(Coordinates(i * 4 + 3)))}};
-    }
-
-    std::array<float, 4> var({{0, 0, 0, 0}});
-    for (int i = 0; i < num_priors; ++i)
-    {
-        for (int j = 0; j < 4; ++j)
-        {
-            var[j] = *reinterpret_cast<float *>(input_priorbox->ptr_to_element(Coordinates((num_priors + i) * 4 + j)));
-        }
-        all_prior_variances[i] = var;
-    }
-}
+// Number of priors decoded and transposed by each task of the decode stage, sized so that the confidences of a block
+// stay in the L1 cache while they are transposed
+constexpr int prior_block_size = 256;
 
 /** Decode a bbox according to a prior bbox.
  *
- * @param[in]  prior_bbox                 The input prior bounding boxes.
+ * @param[in]  prior_bbox                 The input prior bounding box.
  * @param[in]  prior_variance             The corresponding input variance.
  * @param[in]  code_type                  The detection output code type used to decode the results.
  * @param[in]  variance_encoded_in_target If true, the variance is encoded in target.
- * @param[in]  clip_bbox                  If true, the results should be between 0.f and 1.f.
  * @param[in]  bbox                       The input bbox to decode
- * @param[out] decode_bbox                The decoded bboxes.
+ * @param[out] decode_bbox                The decoded bbox.
  *
  */
-void DecodeBBox(const BBox                        &prior_bbox,
-                const std::array<float, 4>        &prior_variance,
+void DecodeBBox(const float                       *prior_bbox,
+                const float                       *prior_variance,
                 const DetectionOutputLayerCodeType code_type,
                 const bool                         variance_encoded_in_target,
-                const bool                         clip_bbox,
-                const BBox                        &bbox,
-                BBox                              &decode_bbox)
+                const float                       *bbox,
+                float                             *decode_bbox)
 {
     // if the variance is encoded in target, we simply need to add the offset predictions
     // otherwise we need to scale the offset accordingly.
+    float offset[4];
+    for (int k = 0; k < 4; ++k)
+    {
+        offset[k] = variance_encoded_in_target ? bbox[k] : prior_variance[k] * bbox[k];
+    }
+
     switch (code_type)
     {
         case DetectionOutputLayerCodeType::CORNER:
         {
-            decode_bbox[0] = prior_bbox[0] + (variance_encoded_in_target ? bbox[0] : prior_variance[0] * bbox[0]);
-            decode_bbox[1] = prior_bbox[1] + (variance_encoded_in_target ? bbox[1] : prior_variance[1] * bbox[1]);
-            decode_bbox[2] = prior_bbox[2] + (variance_encoded_in_target ? bbox[2] : prior_variance[2] * bbox[2]);
-            decode_bbox[3] = prior_bbox[3] + (variance_encoded_in_target ? bbox[3] : prior_variance[3] * bbox[3]);
-
+            for (int k = 0; k < 4; ++k)
+            {
+                decode_bbox[k] = prior_bbox[k] + offset[k];
+            }
             break;
         }
         case DetectionOutputLayerCodeType::CENTER_SIZE:
@@ -251,23 +128,18 @@ void DecodeBBox(const BBox                        &prior_bbox,
             ARM_COMPUTE_ERROR_ON(prior_width <= 0.f);
             ARM_COMPUTE_ERROR_ON(prior_height <= 0.f);
 
-            const float prior_center_x = (prior_bbox[0] + prior_bbox[2]) / 2.;
-            const float prior_center_y = (prior_bbox[1] + prior_bbox[3]) / 2.;
-
-            const float decode_bbox_center_x =
-                (variance_encoded_in_target ? bbox[0] : prior_variance[0] * bbox[0]) * prior_width + prior_center_x;
-            const float decode_bbox_center_y =
-                (variance_encoded_in_target ? bbox[1] : prior_variance[1] * bbox[1]) * prior_height + prior_center_y;
-            const float decode_bbox_width =
-                (variance_encoded_in_target ? std::exp(bbox[2]) : std::exp(prior_variance[2] * bbox[2])) * prior_width;
-            const float decode_bbox_height =
-                (variance_encoded_in_target ? std::exp(bbox[3]) : std::exp(prior_variance[3] * bbox[3])) * prior_height;
+            const float prior_center_x = (prior_bbox[0] + prior_bbox[2]) * 0.5f;
+            const float prior_center_y = (prior_bbox[1] + prior_bbox[3]) * 0.5f;
 
-            decode_bbox[0] = (decode_bbox_center_x - decode_bbox_width / 2.f);
-            decode_bbox[1] = (decode_bbox_center_y - decode_bbox_height / 2.f);
-            decode_bbox[2] = (decode_bbox_center_x + decode_bbox_width / 2.f);
-            decode_bbox[3] = (decode_bbox_center_y + decode_bbox_height / 2.f);
+            const float decode_bbox_center_x = offset[0] * prior_width + prior_center_x;
+            const float decode_bbox_center_y = offset[1] * prior_height + prior_center_y;
+            const float decode_bbox_width    = std::exp(offset[2]) * prior_width;
+            const float decode_bbox_height   = std::exp(offset[3]) * prior_height;
 
+            decode_bbox[0] = decode_bbox_center_x - decode_bbox_width * 0.5f;
+            decode_bbox[1] = decode_bbox_center_y - decode_bbox_height * 0.5f;
+            decode_bbox[2] = decode_bbox_center_x + decode_bbox_width * 0.5f;
+            decode_bbox[3] = decode_bbox_center_y + decode_bbox_height * 0.5f;
             break;
         }
         case DetectionOutputLayerCodeType::CORNER_SIZE:
@@ -279,155 +151,370 @@ void DecodeBBox(const BBox                        &prior_bbox,
             ARM_COMPUTE_ERROR_ON(prior_width <= 0.f);
             ARM_COMPUTE_ERROR_ON(prior_height <= 0.f);
 
-            decode_bbox[0] =
-                prior_bbox[0] + (variance_encoded_in_target ? bbox[0] : prior_variance[0] * bbox[0]) * prior_width;
-            decode_bbox[1] =
-                prior_bbox[1] + (variance_encoded_in_target ? bbox[1] : prior_variance[1] * bbox[1]) * prior_height;
-            decode_bbox[2] =
-                prior_bbox[2] + (variance_encoded_in_target ? bbox[2] : prior_variance[2] * bbox[2]) * prior_width;
-            decode_bbox[3] =
-                prior_bbox[3] + (variance_encoded_in_target ? bbox[3] : prior_variance[3] * bbox[3]) * prior_height;
-
+            decode_bbox[0] = prior_bbox[0] + offset[0] * prior_width;
+            decode_bbox[1] = prior_bbox[1] + offset[1] * prior_height;
+            decode_bbox[2] = prior_bbox[2] + offset[2] * prior_width;
+            decode_bbox[3] = prior_bbox[3] + offset[3] * prior_height;
             break;
         }
         default:
             ARM_COMPUTE_ERROR("Unsupported Detection Output Code Type.");
     }
+}
 
-    if (clip_bbox)
+/** Decode a range of location predictions according to their prior bboxes.
+ *
+ * @param[in]  prior_bboxes               The prior bounding boxes, 4 values per prior.
+ * @param[in]  prior_variances            The corresponding variances, 4 values per prior.
+ * @param[in]  loc                        The location predictions of the first prior.
+ * @param[in]  loc_stride                 Number of elements between the location predictions of two consecutive priors.
+ * @param[in]  code_type                  The detection output code type used to decode the results.
+ * @param[in]  variance_encoded_in_target If true, the variance is encoded in target.
+ * @param[in]  begin                      First prior to decode.
+ * @param[in]  end                        One past the last prior to decode.
+ * @param[out] decode_bboxes              The decoded bboxes, indexed by prior.
+ *
+ */
+void decode_bboxes(const float                       *prior_bboxes,
+                   const float                       *prior_variances,
+                   const float                       *loc,
+                   const int                          loc_stride,
+                   const DetectionOutputLayerCodeType code_type,
+                   const bool                         variance_encoded_in_target,
+                   const int                          begin,
+                   const int                          end,
+                   cpp::NMSBoxes                     &decode_bboxes)
+{
+    int p = begin;
+
+#if defined(__aarch64__)
+    // De-interleave the coordinates of four contiguous priors into one register per coordinate
+    for (; loc_stride == 4 && p + 4 <= end; p += 4)
     {
-        for (auto &d_bbox : decode_bbox)
+        const float32x4x4_t prior    = vld4q_f32(prior_bboxes + 4 * p);
+        const float32x4x4_t variance = vld4q_f32(prior_variances + 4 * p);
+        const float32x4x4_t bbox     = vld4q_f32(loc + 4 * p);
+
+        float32x4_t offset[4];
+        for (int k = 0; k < 4; ++k)
         {
-            d_bbox = utility::clamp(d_bbox, 0.f, 1.f);
+            offset[k] = variance_encoded_in_target ? bbox.val[k] : vmulq_f32(variance.val[k], bbox.val[k]);
+        }
+
+        float32x4_t decoded[4];
+        switch (code_type)
+        {
+            case DetectionOutputLayerCodeType::CORNER:
+            {
+                for (int k = 0; k < 4; ++k)
+                {
+                    decoded[k] = vaddq_f32(prior.val[k], offset[k]);
+                }
+                break;
+            }
+            case DetectionOutputLayerCodeType::CENTER_SIZE:
+            {
+                const float32x4_t prior_width    = vsubq_f32(prior.val[2], prior.val[0]);
+                const float32x4_t prior_height   = vsubq_f32(prior.val[3], prior.val[1]);
+                const float32x4_t prior_center_x = vmulq_n_f32(vaddq_f32(prior.val[0], prior.val[2]), 0.5f);
+                const float32x4_t prior_center_y = vmulq_n_f32(vaddq_f32(prior.val[1], prior.val[3]), 0.5f);
+                const float32x4_t center_x       = vaddq_f32(vmulq_f32(offset[0], prior_width), prior_center_x);
+                const float32x4_t center_y       = vaddq_f32(vmulq_f32(offset[1], prior_height), prior_center_y);
+
+                // The exponential is evaluated per lane so that the results match the scalar tail
+                float size[8];
+                vst1q_f32(size, offset[2]);
+                vst1q_f32(size + 4, offset[3]);
+                for (float &s : size)
+                {
+                    s = std::exp(s);
+                }
+                const float32x4_t half_width  = vmulq_n_f32(vmulq_f32(vld1q_f32(size), prior_width), 0.5f);
+                const float32x4_t half_height = vmulq_n_f32(vmulq_f32(vld1q_f32(size + 4), prior_height), 0.5f);
+
+                decoded[0] = vsubq_f32(center_x, half_width);
+                decoded[1] = vsubq_f32(center_y, half_height);
+                decoded[2] = vaddq_f32(center_x, half_width);
+                decoded[3] = vaddq_f32(center_y, half_height);
+                break;
+            }
+            case DetectionOutputLayerCodeType::CORNER_SIZE:
+            {
+                const float32x4_t prior_width  = vsubq_f32(prior.val[2], prior.val[0]);
+                const float32x4_t prior_height = vsubq_f32(prior.val[3], prior.val[1]);
+
+                decoded[0] = vaddq_f32(prior.val[0], vmulq_f32(offset[0], prior_width));
+                decoded[1] = vaddq_f32(prior.val[1], vmulq_f32(offset[1], prior_height));
+                decoded[2] = vaddq_f32(prior.val[2], vmulq_f32(offset[2], prior_width));
+                decoded[3] = vaddq_f32(prior.val[3], vmulq_f32(offset[3], prior_height));
+                break;
+            }
+            default:
+                ARM_COMPUTE_ERROR("Unsupported Detection Output Code Type.");
         }
+
+        const float32x4_t area =
+            vmulq_f32(vsubq_f32(decoded[2], decoded[0]), vsubq_f32(decoded[3], decoded[1]));
+        vst1q_f32(decode_bboxes.xmin.data() + p, decoded[0]);
+        vst1q_f32(decode_bboxes.ymin.data() + p, decoded[1]);
+        vst1q_f32(decode_bboxes.xmax.data() + p, decoded[2]);
+        vst1q_f32(decode_bboxes.ymax.data() + p, decoded[3]);
+        vst1q_f32(decode_bboxes.area.data() + p, area);
+    }
+#endif // defined(__aarch64__)
+
+    for (; p < end; ++p)
+    {
+        float decoded[4];
+        DecodeBBox(prior_bboxes + 4 * p, prior_variances + 4 * p, code_type, variance_encoded_in_target,
+                   loc + p * loc_stride, decoded);
+        decode_bboxes.set(p, decoded[0], decoded[1], decoded[2], decoded[3], 0.f);
     }
 }
 
-/** Do non maximum suppression given bboxes and scores.
+/** Do non maximum suppression with a threshold that decays by @p eta after each kept bbox.
  *
- * @param[in]  bboxes          The input bounding boxes.
- * @param[in]  scores          The corresponding input confidence.
- * @param[in]  score_threshold The threshold used to filter detection results.
- * @param[in]  nms_threshold   The threshold used in non maximum suppression.
- * @param[in]  eta             Adaptation rate for nms threshold.
- * @param[in]  top_k           If not -1, keep at most top_k picked indices.
- * @param[out] indices         The kept indices of bboxes after nms.
+ * @param[in]  bboxes       The input bounding boxes, sorted by descending score.
+ * @param[in]  config       The overlap criterion, with the initial nms threshold.
+ * @param[in]  eta          Adaptation rate for nms threshold.
+ * @param[out] max_overlaps Scratch buffer holding the highest overlap of each bbox with the kept ones.
+ * @param[out] overlaps     Scratch buffer holding the overlaps with the last kept bbox.
+ * @param[out] keep         Positions in @p bboxes of the kept bboxes, in selection order.
  *
  */
-void ApplyNMSFast(const std::vector<BBox>  &bboxes,
-                  const std::vector<float> &scores,
-                  const float               score_threshold,
-                  const float               nms_threshold,
-                  const float               eta,
-                  const int                 top_k,
-                  std::vector<int>         &indices)
+void ApplyAdaptiveNMS(const cpp::NMSBoxes       &bboxes,
+                      const cpp::NMSConfig      &config,
+                      const float                eta,
+                      std::vector<float>        &max_overlaps,
+                      std::vector<float>        &overlaps,
+                      std::vector<unsigned int> &keep)
 {
-    ARM_COMPUTE_ERROR_ON_MSG(bboxes.size() != scores.size(), "bboxes and scores have different size.");
+    const size_t num_bboxes = bboxes.size();
+    keep.clear();
+    max_overlaps.assign(num_bboxes, 0.f);
+    overlaps.resize(num_bboxes);
+
+    // A bbox is kept if it does not overlap any of the bboxes kept so far by more than the current threshold
+    float adaptive_threshold = config.iou_threshold;
+    for (size_t i = 0; i < num_bboxes; ++i)
+    {
+        if (!(max_overlaps[i] <= adaptive_threshold))
+        {
+            continue;
+        }
+        keep.push_back(i);
+        if (adaptive_threshold > 0.5f)
+        {
+            adaptive_threshold *= eta;
+        }
 
-    // Get top_k scores (with corresponding indices).
-    std::list<std::pair<float, int>> score_index_vec;
+        cpp::nms_compute_overlaps(bboxes, i, bboxes, config, overlaps.data());
+        for (size_t j = i + 1; j < num_bboxes; ++j)
+        {
+            max_overlaps[j] = std::max(max_overlaps[j], overlaps[j]);
+        }
+    }
+}
+} // namespace
 
-    // Generate index score pairs.
-    for (size_t i = 0; i < scores.size(); ++i)
+struct CPPDetectionOutputLayer::Impl
+{
+    /** Scratch buffers of a workload of the nms stage */
+    struct Workspace
+    {
+        std::vector<int>          candidates{};
+        cpp::NMSBoxes             sorted_bboxes{};
+        std::vector<unsigned int> keep{};
+        std::vector<float>        max_overlaps{};
+        std::vector<float>        overlaps{};
+    };
+
+    /** Allocate the scratch buffers of a workload */
+    void init_workspace(Workspace &workspace) const
     {
-        if (scores[i] > score_threshold)
+        workspace.candidates.reserve(num_priors);
+        workspace.sorted_bboxes.resize(num_priors);
+        workspace.keep.reserve(num_priors);
+        if (info.eta() < 1.f && info.nms_threshold() > 0.5f)
         {
-            score_index_vec.emplace_back(std::make_pair(scores[i], i));
+            workspace.max_overlaps.reserve(num_priors);
+            workspace.overlaps.reserve(num_priors);
         }
     }
 
-    // Sort the score pair according to the scores in descending order
-    score_index_vec.sort(SortScorePairDescend<int>);
-
-    // Keep top_k scores if needed.
-    const int score_index_vec_size = score_index_vec.size();
-    if (top_k > -1 && top_k < score_index_vec_size)
+    /** Build the workloads of the decode and nms stages for a number of threads */
+    void configure_workloads(unsigned int num_threads);
+    /** Decode the bboxes and transpose the confidences of a block of priors of an image */
+    void decode(int image, int block);
+    /** Select the bboxes of a class of an image */
+    void select(int image, int label, Workspace &workspace);
+
+    const ITensor           *input_loc{nullptr};
+    const ITensor           *input_conf{nullptr};
+    const ITensor           *input_priorbox{nullptr};
+    ITensor                 *output{nullptr};
+    DetectionOutputLayerInfo info{};
+
+    int num_priors{0};
+    int num{0};
+
+    std::vector<cpp::NMSBoxes>                         all_decode_bboxes{};  // [num][num_loc_classes]
+    std::vector<float>                                 all_conf_scores{};    // [num][num_classes][num_priors]
+    std::vector<std::vector<int>>                      all_indices{};        // [num][num_classes]
+    std::vector<Workspace>                             workspaces{};
+    std::vector<std::pair<float, std::pair<int, int>>> score_index_pairs{};
+
+    unsigned int                      workloads_num_threads{0}; // Number of threads the workloads were built for
+    std::vector<IScheduler::Workload> decode_workloads{};
+    std::vector<IScheduler::Workload> nms_workloads{};
+};
+
+void CPPDetectionOutputLayer::Impl::configure_workloads(unsigned int num_threads)
+{
+    workloads_num_threads = num_threads;
+
+    // Decode all loc predictions to bboxes and transpose the confidences, one block of priors per task
+    const int          num_blocks         = DIV_CEIL(num_priors, prior_block_size);
+    const unsigned int num_decode_tasks   = num * num_blocks;
+    const unsigned int num_decode_workers = std::max(1U, std::min(num_decode_tasks, num_threads));
+    decode_workloads.resize(num_decode_workers);
+    for (unsigned int t = 0; t < num_decode_workers; ++t)
     {
-        score_index_vec.resize(top_k);
+        decode_workloads[t] = [this, t, num_blocks, num_decode_tasks, num_decode_workers](const ThreadInfo &)
+        {
+            for (unsigned int task = t; task < num_decode_tasks; task += num_decode_workers)
+            {
+                decode(task / num_blocks, task % num_blocks);
+            }
+        };
     }
 
-    // Do nms.
-    float adaptive_threshold = nms_threshold;
-    indices.clear();
-
-    while (!score_index_vec.empty())
+    // Run the non maximum suppression of the classes of all the images in parallel, each worker owns a workspace
+    const int          num_classes     = info.num_classes();
+    const unsigned int num_nms_tasks   = num * num_classes;
+    const unsigned int num_nms_workers = std::max(1U, std::min(num_nms_tasks, num_threads));
+    const size_t       num_initialized = workspaces.size();
+    if (num_initialized < num_nms_workers)
+    {
+        workspaces.resize(num_nms_workers);
+        for (size_t t = num_initialized; t < num_nms_workers; ++t)
+        {
+            init_workspace(workspaces[t]);
+        }
+    }
+    nms_workloads.resize(num_nms_workers);
+    for (unsigned int t = 0; t < num_nms_workers; ++t)
     {
-        const int idx  = score_index_vec.front().second;
-        bool      keep = true;
-        for (int kept_idx : indices)
+        nms_workloads[t] = [this, t, num_classes, num_nms_tasks, num_nms_workers](const ThreadInfo &)
         {
-            if (keep)
+            for (unsigned int task = t; task < num_nms_tasks; task += num_nms_workers)
             {
-                // Compute the jaccard (intersection over union IoU) overlap between two bboxes.
-                BBox intersect_bbox = std::array<float, 4>({0, 0, 0, 0});
-                if (bboxes[kept_idx][0] > bboxes[idx][2] || bboxes[kept_idx][2] < bboxes[idx][0] ||
-                    bboxes[kept_idx][1] > bboxes[idx][3] || bboxes[kept_idx][3] < bboxes[idx][1])
+                const int label = task % num_classes;
+                if (label != info.background_label_id())
                 {
-                    intersect_bbox = std::array<float, 4>({{0, 0, 0, 0}});
-                }
-                else
-                {
-                    intersect_bbox = std::array<float, 4>(
-                        {{std::max(bboxes[idx][0], bboxes[kept_idx][0]), std::max(bboxes[idx][1], bboxes[kept_idx][1]),
-                          std::min(bboxes[idx][2], bboxes[kept_idx][2]),
-                          std::min(bboxes[idx][3], bboxes[kept_idx][3])}});
+                    select(task / num_classes, label, workspaces[t]);
                 }
+            }
+        };
+    }
+}
 
-                float intersect_width  = intersect_bbox[2] - intersect_bbox[0];
-                float intersect_height = intersect_bbox[3] - intersect_bbox[1];
+void CPPDetectionOutputLayer::Impl::decode(int image, int block)
+{
+    const int num_classes     = info.num_classes();
+    const int num_loc_classes = info.num_loc_classes();
+    const int begin           = block * prior_block_size;
+    const int end             = std::min(begin + prior_block_size, num_priors);
 
-                float overlap = 0.f;
-                if (intersect_width > 0 && intersect_height > 0)
-                {
-                    float intersect_size = intersect_width * intersect_height;
-                    float bbox1_size     = (bboxes[idx][2] < bboxes[idx][0] || bboxes[idx][3] < bboxes[idx][1])
-                                               ? 0.f
-                                               : (bboxes[idx][2] - bboxes[idx][0]) *
-                                                 (bboxes[idx][3] - bboxes[idx][1]); //BBoxSize(bboxes[idx]);
-                    float bbox2_size =
-                        (bboxes[kept_idx][2] < bboxes[kept_idx][0] || bboxes[kept_idx][3] < bboxes[kept_idx][1])
-                            ? 0.f
-                            : (bboxes[kept_idx][2] - bboxes[kept_idx][0]) *
-                                  (bboxes[kept_idx][3] - bboxes[kept_idx][1]); // BBoxSize(bboxes[kept_idx]);
-                    overlap = intersect_size / (bbox1_size + bbox2_size - intersect_size);
-                }
-                keep = (overlap <= adaptive_threshold);
-            }
-            else
-            {
-                break;
-            }
+    const auto *prior_bboxes    = reinterpret_cast<const float *>(input_priorbox->ptr_to_element(Coordinates(0, 0)));
+    const auto *prior_variances = reinterpret_cast<const float *>(input_priorbox->ptr_to_element(Coordinates(0, 1)));
+    const auto *loc             = reinterpret_cast<const float *>(input_loc->ptr_to_element(Coordinates(0, image)));
+    const auto *conf            = reinterpret_cast<const float *>(input_conf->ptr_to_element(Coordinates(0, image)));
+
+    for (int c = 0; c < num_loc_classes; ++c)
+    {
+        if (!info.share_location() && c == info.background_label_id())
+        {
+            // Ignore background class.
+            continue;
         }
-        if (keep)
+        decode_bboxes(prior_bboxes, prior_variances, loc + 4 * c, 4 * num_loc_classes, info.code_type(),
+                      info.variance_encoded_in_target(), begin, end, all_decode_bboxes[image * num_loc_classes + c]);
+    }
+
+    // Store the confidences of each class contiguously
+    float *conf_scores = all_conf_scores.data() + static_cast<size_t>(image) * num_classes * num_priors;
+    for (int p = begin; p < end; ++p)
+    {
+        for (int c = 0; c < num_classes; ++c)
         {
-            indices.push_back(idx);
+            conf_scores[c * num_priors + p] = conf[p * num_classes + c];
         }
-        score_index_vec.erase(score_index_vec.begin());
-        if (keep && eta < 1.f && adaptive_threshold > 0.5f)
+    }
+}
+
+void CPPDetectionOutputLayer::Impl::select(int image, int label, Workspace &workspace)
+{
+    const int    num_classes = info.num_classes();
+    const float *scores =
+        all_conf_scores.data() + (static_cast<size_t>(image) * num_classes + label) * num_priors;
+    const cpp::NMSBoxes &bboxes =
+        all_decode_bboxes[image * info.num_loc_classes() + (info.share_location() ? 0 : label)];
+
+    // Generate the indices of the scores above the threshold
+    std::vector<int> &candidates = workspace.candidates;
+    candidates.clear();
+    for (int p = 0; p < num_priors; ++p)
+    {
+        if (scores[p] > info.confidence_threshold())
         {
-            adaptive_threshold *= eta;
+            candidates.push_back(p);
         }
     }
+
+    // Sort the indices according to the scores in descending order, keeping the top_k ones if needed
+    const auto score_descend = [scores](int idx0, int idx1)
+    { return scores[idx0] > scores[idx1] || (scores[idx0] == scores[idx1] && idx0 < idx1); };
+    if (info.top_k() > -1 && static_cast<size_t>(info.top_k()) < candidates.size())
+    {
+        std::partial_sort(candidates.begin(), candidates.begin() + info.top_k(), candidates.end(), score_descend);
+        candidates.resize(info.top_k());
+    }
+    else
+    {
+        std::sort(candidates.begin(), candidates.end(), score_descend);
+    }
+
+    // Do nms.
+    cpp::nms_gather_boxes(bboxes, candidates.data(), candidates.size(), workspace.sorted_bboxes);
+
+    cpp::NMSConfig config{};
+    config.iou_threshold = info.nms_threshold();
+    config.skip_empty    = true;
+    if (info.eta() < 1.f && info.nms_threshold() > 0.5f)
+    {
+        ApplyAdaptiveNMS(workspace.sorted_bboxes, config, info.eta(), workspace.max_overlaps, workspace.overlaps,
+                         workspace.keep);
+    }
+    else
+    {
+        cpp::nms_sorted(workspace.sorted_bboxes, config, candidates.size(), workspace.keep);
+    }
+
+    std::vector<int> &indices = all_indices[image * num_classes + label];
+    indices.clear();
+    for (const unsigned int k : workspace.keep)
+    {
+        indices.push_back(candidates[k]);
+    }
 }
-} // namespace
 
-CPPDetectionOutputLayer::CPPDetectionOutputLayer()
-    : _input_loc(nullptr),
-      _input_conf(nullptr),
-      _input_priorbox(nullptr),
-      _output(nullptr),
-      _info(),
-      _num_priors(),
-      _num(),
-      _all_location_predictions(),
-      _all_confidence_scores(),
-      _all_prior_bboxes(),
-      _all_prior_variances(),
-      _all_decode_bboxes(),
-      _all_indices()
+CPPDetectionOutputLayer::CPPDetectionOutputLayer() : _impl(std::make_unique<Impl>())
 {
 }
 
+CPPDetectionOutputLayer::~CPPDetectionOutputLayer() = default;
+
 void CPPDetectionOutputLayer::configure(const ITensor           *input_loc,
                                         const ITensor           *input_conf,
                                         const ITensor           *input_priorbox,
@@ -449,34 +536,33 @@ void CPPDetectionOutputLayer::configure(const ITensor           *input_loc,
     ARM_COMPUTE_ERROR_THROW_ON(
         validate_arguments(input_loc->info(), input_conf->info(), input_priorbox->info(), output->info(), info));
 
-    _input_loc      = input_loc;
-    _input_conf     = input_conf;
-    _input_priorbox = input_priorbox;
-    _output         = output;
-    _info           = info;
-    _num_priors     = input_priorbox->info()->dimension(0) / 4;
-    _num            = (_input_loc->info()->num_dimensions() > 1 ? _input_loc->info()->dimension(1) : 1);
-
-    _all_location_predictions.resize(_num);
-    _all_confidence_scores.resize(_num);
-    _all_prior_bboxes.resize(_num_priors);
-    _all_prior_variances.resize(_num_priors);
-    _all_decode_bboxes.resize(_num);
-
-    for (int i = 0; i < _num; ++i)
+    _impl->input_loc      = input_loc;
+    _impl->input_conf     = input_conf;
+    _impl->input_priorbox = input_priorbox;
+    _impl->output         = output;
+    _impl->info           = info;
+    _impl->num_priors     = input_priorbox->info()->dimension(0) / 4;
+    _impl->num            = (input_loc->info()->num_dimensions() > 1 ? input_loc->info()->dimension(1) : 1);
+
+    // Allocate all the intermediate buffers so that run() does not allocate memory
+    const int num_priors = _impl->num_priors;
+    const int num        = _impl->num;
+    _impl->all_decode_bboxes.resize(num * info.num_loc_classes());
+    for (auto &decode_bboxes : _impl->all_decode_bboxes)
     {
-        for (int c = 0; c < _info.num_loc_classes(); ++c)
-        {
-            const int label = _info.share_location() ? -1 : c;
-            if (label == _info.background_label_id())
-            {
-                // Ignore background class.
-                continue;
-            }
-            _all_decode_bboxes[i][label].resize(_num_priors);
-        }
+        decode_bboxes.resize(num_priors);
+    }
+    _impl->all_conf_scores.resize(static_cast<size_t>(num) * info.num_classes() * num_priors);
+
+    const int max_indices = info.top_k() > -1 ? std::min(info.top_k(), num_priors) : num_priors;
+    _impl->all_indices.resize(num * info.num_classes());
+    for (auto &indices : _impl->all_indices)
+    {
+        indices.reserve(max_indices);
     }
-    _all_indices.resize(_num);
+    _impl->score_index_pairs.reserve(static_cast<size_t>(info.num_classes()) * max_indices);
+
+    _impl->configure_workloads(Scheduler::get().num_threads());
 
     Coordinates coord;
     coord.set_num_dimensions(output->info()->num_dimensions());
@@ -495,156 +581,75 @@ Status CPPDetectionOutputLayer::validate(const ITensorInfo       *input_loc,
 
 void CPPDetectionOutputLayer::run()
 {
-    // Retrieve all location predictions.
-    retrieve_all_loc_predictions(_input_loc, _num, _num_priors, _info.num_loc_classes(), _info.share_location(),
-                                 _all_location_predictions);
-
-    // Retrieve all confidences.
-    retrieve_all_conf_scores(_input_conf, _num, _num_priors, _info.num_classes(), _all_confidence_scores);
-
-    // Retrieve all prior bboxes.
-    retrieve_all_priorbox(_input_priorbox, _num_priors, _all_prior_bboxes, _all_prior_variances);
-
-    // Decode all loc predictions to bboxes
-    const bool clip_bbox = false;
-    for (int i = 0; i < _num; ++i)
+    Impl                           &impl        = *_impl;
+    const DetectionOutputLayerInfo &info        = impl.info;
+    const int                       num         = impl.num;
+    const int                       num_classes = info.num_classes();
+
+    // The workloads are built at configuration, unless the number of threads has changed since
+    const unsigned int num_threads = Scheduler::get().num_threads();
+    if (num_threads != impl.workloads_num_threads)
     {
-        for (int c = 0; c < _info.num_loc_classes(); ++c)
-        {
-            const int label = _info.share_location() ? -1 : c;
-            if (label == _info.background_label_id())
-            {
-                // Ignore background class.
-                continue;
-            }
-            ARM_COMPUTE_ERROR_ON_MSG_VAR(_all_location_predictions[i].find(label) == _all_location_predictions[i].end(),
-                                         "Could not find location predictions for label %d.", label);
-
-            const std::vector<BBox> &label_loc_preds = _all_location_predictions[i].find(label)->second;
-
-            const int num_bboxes = _all_prior_bboxes.size();
-            ARM_COMPUTE_ERROR_ON(_all_prior_variances[i].size() != 4);
-
-            for (int j = 0; j < num_bboxes; ++j)
-            {
-                DecodeBBox(_all_prior_bboxes[j], _all_prior_variances[j], _info.code_type(),
-                           _info.variance_encoded_in_target(), clip_bbox, label_loc_preds[j],
-                           _all_decode_bboxes[i][label][j]);
-            }
-        }
+        impl.configure_workloads(num_threads);
     }
+    Scheduler::get().run_tagged_workloads(impl.decode_workloads, "CPPDetectionOutputLayer/decode");
+    Scheduler::get().run_tagged_workloads(impl.nms_workloads, "CPPDetectionOutputLayer/nms");
 
-    int num_kept = 0;
-
-    for (int i = 0; i < _num; ++i)
+    // Keep the keep_top_k detections of each image and write them ordered by label
+    auto &score_index_pairs = impl.score_index_pairs;
+    int   count             = 0;
+    for (int i = 0; i < num; ++i)
     {
-        const LabelBBox                         &decode_bboxes = _all_decode_bboxes[i];
-        const std::map<int, std::vector<float>> &conf_scores   = _all_confidence_scores[i];
+        const float *conf_scores = impl.all_conf_scores.data() + static_cast<size_t>(i) * num_classes * impl.num_priors;
 
-        std::map<int, std::vector<int>> indices;
-        int                             num_det = 0;
-        for (int c = 0; c < _info.num_classes(); ++c)
+        score_index_pairs.clear();
+        for (int c = 0; c < num_classes; ++c)
         {
-            if (c == _info.background_label_id())
+            if (c == info.background_label_id())
             {
                 // Ignore background class
                 continue;
             }
-            const int label = _info.share_location() ? -1 : c;
-            if (conf_scores.find(c) == conf_scores.end() || decode_bboxes.find(label) == decode_bboxes.end())
+            for (const int idx : impl.all_indices[i * num_classes + c])
             {
-                ARM_COMPUTE_ERROR_VAR("Could not find predictions for label %d.", label);
+                score_index_pairs.emplace_back(conf_scores[c * impl.num_priors + idx], std::make_pair(c, idx));
             }
-            const std::vector<float> &scores = conf_scores.find(c)->second;
-            const std::vector<BBox>  &bboxes = decode_bboxes.find(label)->second;
-
-            ApplyNMSFast(bboxes, scores, _info.confidence_threshold(), _info.nms_threshold(), _info.eta(),
-                         _info.top_k(), indices[c]);
-
-            num_det += indices[c].size();
         }
 
-        int num_to_add = 0;
-        if (_info.keep_top_k() > -1 && num_det > _info.keep_top_k())
+        if (info.keep_top_k() > -1 && score_index_pairs.size() > static_cast<size_t>(info.keep_top_k()))
         {
-            std::vector<std::pair<float, std::pair<int, int>>> score_index_pairs;
-            for (auto const &it : indices)
-            {
-                const int               label         = it.first;
-                const std::vector<int> &label_indices = it.second;
-
-                if (conf_scores.find(label) == conf_scores.end())
-                {
-                    ARM_COMPUTE_ERROR_VAR("Could not find predictions for label %d.", label);
-                }
-
-                const std::vector<float> &scores = conf_scores.find(label)->second;
-                for (auto idx : label_indices)
-                {
-                    ARM_COMPUTE_ERROR_ON(idx > static_cast<int>(scores.size()));
-                    score_index_pairs.emplace_back(std::make_pair(scores[idx], std::make_pair(label, idx)));
-                }
-            }
-
             // Keep top k results per image.
-            std::sort(score_index_pairs.begin(), score_index_pairs.end(), SortScorePairDescend<std::pair<int, int>>);
-            score_index_pairs.resize(_info.keep_top_k());
-
-            // Store the new indices.
-
-            std::map<int, std::vector<int>> new_indices;
-            for (auto score_index_pair : score_index_pairs)
-            {
-                int label = score_index_pair.second.first;
-                int idx   = score_index_pair.second.second;
-                new_indices[label].push_back(idx);
-            }
-            _all_indices[i] = new_indices;
-            num_to_add      = _info.keep_top_k();
+            std::stable_sort(score_index_pairs.begin(), score_index_pairs.end(),
+                             [](const std::pair<float, std::pair<int, int>> &pair0,
+                                const std::pair<float, std::pair<int, int>> &pair1)
+                             { return pair0.first > pair1.first; });
+            score_index_pairs.resize(info.keep_top_k());
+            std::stable_sort(score_index_pairs.begin(), score_index_pairs.end(),
+                             [](const std::pair<float, std::pair<int, int>> &pair0,
+                                const std::pair<float, std::pair<int, int>> &pair1)
+                             { return pair0.second.first < pair1.second.first; });
         }
-        else
+
+        for (const auto &score_index_pair : score_index_pairs)
         {
-            _all_indices[i] = indices;
-            num_to_add      = num_det;
+            const int            label  = score_index_pair.second.first;
+            const int            idx    = score_index_pair.second.second;
+            const cpp::NMSBoxes &bboxes = impl.all_decode_bboxes[i * info.num_loc_classes() +
+                                                                 (info.share_location() ? 0 : label)];
+
+            auto *row = reinterpret_cast<float *>(impl.output->ptr_to_element(Coordinates(0, count)));
+            row[0]    = i;
+            row[1]    = label;
+            row[2]    = score_index_pair.first;
+            row[3]    = bboxes.xmin[idx];
+            row[4]    = bboxes.ymin[idx];
+            row[5]    = bboxes.xmax[idx];
+            row[6]    = bboxes.ymax[idx];
+            ++count;
         }
-        num_kept += num_to_add;
     }
 
     //Update the valid region of the ouput to mark the exact number of detection
-    _output->info()->set_valid_region(ValidRegion(Coordinates(0, 0), TensorShape(7, num_kept)));
-
-    int count = 0;
-    for (int i = 0; i < _num; ++i)
-    {
-        const std::map<int, std::vector<float>> &conf_scores   = _all_confidence_scores[i];
-        const LabelBBox                         &decode_bboxes = _all_decode_bboxes[i];
-        for (auto &it : _all_indices[i])
-        {
-            const int                 label     = it.first;
-            const std::vector<float> &scores    = conf_scores.find(label)->second;
-            const int                 loc_label = _info.share_location() ? -1 : label;
-            if (conf_scores.find(label) == conf_scores.end() || decode_bboxes.find(loc_label) == decode_bboxes.end())
-            {
-                // Either if there are no confidence predictions
-                // or there are no location predictions for current label.
-                ARM_COMPUTE_ERROR_VAR("Could not find predictions for the label %d.", label);
-            }
-            const std::vector<BBox> &bboxes  = decode_bboxes.find(loc_label)->second;
-            const std::vector<int>  &indices = it.second;
-
-            for (auto idx : indices)
-            {
-                *(reinterpret_cast<float *>(_output->ptr_to_element(Coordinates(count * 7))))     = i;
-                *(reinterpret_cast<float *>(_output->ptr_to_element(Coordinates(count * 7 + 1)))) = label;
-                *(reinterpret_cast<float *>(_output->ptr_to_element(Coordinates(count * 7 + 2)))) = scores[idx];
-                *(reinterpret_cast<float *>(_output->ptr_to_element(Coordinates(count * 7 + 3)))) = bboxes[idx][0];
-                *(reinterpret_cast<float *>(_output->ptr_to_element(Coordinates(count * 7 + 4)))) = bboxes[idx][1];
-                *(reinterpret_cast<float *>(_output->ptr_to_element(Coordinates(count * 7 + 5)))) = bboxes[idx][2];
-                *(reinterpret_cast<float *>(_output->ptr_to_element(Coordinates(count * 7 + 6)))) = bboxes[idx][3];
-
-                ++count;
-            }
-        }
-    }
+    impl.output->info()->set_valid_region(ValidRegion(Coordinates(0, 0), TensorShape(7, count)));
 }
 } // namespace arm_compute
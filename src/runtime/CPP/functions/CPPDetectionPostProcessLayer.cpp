@@ -26,13 +26,16 @@
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/Scheduler.h"
 
 #include "src/common/utils/Log.h"
+#include "src/core/CPP/NonMaxSuppression.h"
 #include "src/core/helpers/AutoConfiguration.h"
 
 #include <cstddef>
 #include <ios>
 #include <list>
+#include <numeric>
 
 namespace arm_compute
 {
@@ -258,6 +261,55 @@ void SaveOutputs(const Tensor              *decoded_boxes,
     }
     *(reinterpret_cast<float *>(num_detection->ptr_to_element(Coordinates(0)))) = num_output;
 }
+
+std::vector<int> RegularNMS(const ITensor                       *scores,
+                            const cpp::NMSBoxes                 &boxes,
+                            unsigned int                         class_idx,
+                            const DetectionPostProcessLayerInfo &info)
+{
+    // Select the boxes of the class above the score threshold
+    std::vector<int>   indices_above_thd;
+    std::vector<float> scores_above_thd;
+    for (unsigned int i = 0; i < boxes.size(); ++i)
+    {
+        const float score_i = *(reinterpret_cast<float *>(scores->ptr_to_element(Coordinates(class_idx + 1, i))));
+        if (score_i >= info.nms_score_threshold())
+        {
+            scores_above_thd.emplace_back(score_i);
+            indices_above_thd.emplace_back(i);
+        }
+    }
+
+    // Sort selected indices based on scores
+    const unsigned int        num_above_thd = indices_above_thd.size();
+    std::vector<unsigned int> sorted_indices(num_above_thd);
+    std::iota(sorted_indices.begin(), sorted_indices.end(), 0);
+    std::sort(sorted_indices.begin(), sorted_indices.end(),
+              [&](unsigned int first, unsigned int second)
+              { return scores_above_thd[first] > scores_above_thd[second]; });
+
+    std::vector<int> sorted_box_indices(num_above_thd);
+    for (unsigned int i = 0; i < num_above_thd; ++i)
+    {
+        sorted_box_indices[i] = indices_above_thd[sorted_indices[i]];
+    }
+    cpp::NMSBoxes sorted_boxes;
+    cpp::nms_gather_boxes(boxes, sorted_box_indices.data(), num_above_thd, sorted_boxes);
+
+    cpp::NMSConfig config{};
+    config.iou_threshold = info.iou_threshold();
+    config.skip_empty    = true;
+
+    std::vector<unsigned int> keep;
+    cpp::nms_sorted(sorted_boxes, config, std::min(info.detection_per_class(), num_above_thd), keep);
+
+    std::vector<int> selected(keep.size());
+    for (unsigned int i = 0; i < keep.size(); ++i)
+    {
+        selected[i] = sorted_box_indices[keep[i]];
+    }
+    return selected;
+}
 } // namespace
 
 CPPDetectionPostProcessLayer::CPPDetectionPostProcessLayer(std::shared_ptr<IMemoryManager> memory_manager)
@@ -431,31 +483,40 @@ void CPPDetectionPostProcessLayer::run()
         std::vector<float>        result_scores_after_nms;
         std::vector<unsigned int> sorted_indices;
 
-        for (unsigned int c = 0; c < num_classes; ++c)
+        // The decoded boxes are shared by all the classes, box-corner format: xmin, ymin, xmax, ymax
+        cpp::NMSBoxes boxes;
+        boxes.resize(_num_boxes);
+        for (unsigned int i = 0; i < _num_boxes; ++i)
         {
-            // For each boxes get scores of the boxes for the class c
-            for (unsigned int i = 0; i < _num_boxes; ++i)
-            {
-                *(reinterpret_cast<float *>(_class_scores.ptr_to_element(Coordinates(i)))) =
-                    *(reinterpret_cast<float *>(_input_scores_to_use->ptr_to_element(
-                        Coordinates(c + 1, i)))); // i * _num_classes_with_background + c + 1
-            }
-
-            // Run Non-maxima Suppression
-            _nms.run();
+            boxes.set(i, *(reinterpret_cast<float *>(_decoded_boxes.ptr_to_element(Coordinates(0, i)))),
+                      *(reinterpret_cast<float *>(_decoded_boxes.ptr_to_element(Coordinates(1, i)))),
+                      *(reinterpret_cast<float *>(_decoded_boxes.ptr_to_element(Coordinates(2, i)))),
+                      *(reinterpret_cast<float *>(_decoded_boxes.ptr_to_element(Coordinates(3, i)))), 0.f);
+        }
 
-            for (unsigned int i = 0; i < _info.detection_per_class(); ++i)
+        // Run Non-maxima Suppression of the classes in parallel
+        std::vector<std::vector<int>>     selected_per_class(num_classes);
+        const unsigned int                num_workloads = std::min(num_classes, Scheduler::get().num_threads());
+        std::vector<IScheduler::Workload> workloads(num_workloads);
+        for (unsigned int t = 0; t < num_workloads; ++t)
+        {
+            workloads[t] = [&, t](const ThreadInfo &)
             {
-                const auto selected_index =
-                    *(reinterpret_cast<int *>(_selected_indices.ptr_to_element(Coordinates(i))));
-                if (selected_index == -1)
+                for (unsigned int c = t; c < num_classes; c += num_workloads)
                 {
-                    // Nms will return -1 for all the last M-elements not valid
-                    break;
+                    selected_per_class[c] = RegularNMS(_input_scores_to_use, boxes, c, _info);
                 }
+            };
+        }
+        Scheduler::get().run_tagged_workloads(workloads, "CPPDetectionPostProcessLayer/nms");
+
+        for (unsigned int c = 0; c < num_classes; ++c)
+        {
+            for (const int selected_index : selected_per_class[c])
+            {
                 result_idx_boxes_after_nms.emplace_back(selected_index);
-                result_scores_after_nms.emplace_back(
-                    (reinterpret_cast<float *>(_class_scores.buffer()))[selected_index]);
+                result_scores_after_nms.emplace_back(*(reinterpret_cast<float *>(
+                    _input_scores_to_use->ptr_to_element(Coordinates(c + 1, selected_index)))));
                 result_classes_after_nms.emplace_back(c);
             }
         }
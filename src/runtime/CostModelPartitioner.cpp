@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/CostModelPartitioner.h"
+
+#include "arm_compute/core/CPP/ICPPKernel.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Window.h"
+
+#include <algorithm>
+
+namespace arm_compute
+{
+namespace
+{
+/** Sum of the sizes of the source and destination tensors of a pack */
+size_t tensors_size_in_bytes(const ITensorPack &tensors)
+{
+    size_t bytes = 0;
+    for (int id = ACL_SRC_0; id <= ACL_SRC_END; ++id)
+    {
+        const ITensor *tensor = tensors.get_const_tensor(id);
+        bytes += (tensor != nullptr) ? tensor->info()->total_size() : 0;
+    }
+    for (int id = ACL_DST_0; id <= ACL_DST_END; ++id)
+    {
+        const ITensor *tensor = tensors.get_const_tensor(id);
+        bytes += (tensor != nullptr) ? tensor->info()->total_size() : 0;
+    }
+    return bytes;
+}
+} // namespace
+
+CostModelPartitioner::CostModelPartitioner(unsigned int workloads_per_thread)
+    : _workloads_per_thread(std::max(1U, workloads_per_thread)), _is_heterogeneous(false)
+{
+    const CPUInfo &cpu_info = CPUInfo::get();
+    for (unsigned int cpu = 1; cpu < cpu_info.get_cpu_num(); ++cpu)
+    {
+        _is_heterogeneous |= cpu_info.get_cpu_model(cpu) != cpu_info.get_cpu_model(0);
+    }
+}
+
+WorkloadPartition CostModelPartitioner::partition(const ICPPKernel        &kernel,
+                                                  const Window            &window,
+                                                  const IScheduler::Hints &hints,
+                                                  const ITensorPack       &tensors,
+                                                  unsigned int             num_threads,
+                                                  const CPUInfo           &cpu_info) const
+{
+    WorkloadPartition partition;
+    partition.split_dimension = hints.split_dimension();
+
+    const size_t num_iterations = window.num_iterations(partition.split_dimension);
+    if (num_iterations == 0 || num_threads <= 1)
+    {
+        return partition;
+    }
+
+    // Number of workloads wanted to keep all the threads busy
+    size_t num_workloads = num_threads;
+    if (hints.strategy() == IScheduler::StrategyHint::DYNAMIC)
+    {
+        num_workloads = (hints.threshold() <= 0) ? num_threads : static_cast<size_t>(hints.threshold());
+    }
+    else if (_is_heterogeneous)
+    {
+        num_workloads = static_cast<size_t>(num_threads) * _workloads_per_thread;
+    }
+
+    // Don't create workloads accessing less than half of the L1 cache
+    size_t bytes = kernel.estimate_bytes_accessed(tensors);
+    if (bytes == 0)
+    {
+        bytes = tensors_size_in_bytes(tensors);
+    }
+    if (bytes != 0)
+    {
+        const size_t min_bytes_per_workload = std::max<size_t>(cpu_info.get_L1_cache_size() / 2, 1024);
+        num_workloads = std::min(num_workloads, std::max<size_t>(bytes / min_bytes_per_workload, 1));
+    }
+
+    // Split the preferred dimension, subject to the minimum workload size of the kernel
+    const size_t mws       = std::max<size_t>(kernel.get_mws(cpu_info, num_threads), 1);
+    const size_t max_split = std::max<size_t>(num_iterations / mws, 1);
+    partition.num_windows  = static_cast<unsigned int>(std::min(num_workloads, max_split));
+
+    // Too narrow to occupy all the threads: also split the largest other dimension (X is left whole as kernels
+    // vectorise along it)
+    if (partition.num_windows < std::min<size_t>(num_workloads, num_threads))
+    {
+        size_t best_iterations = 1;
+        for (size_t d = Window::DimY; d < Coordinates::num_max_dimensions; ++d)
+        {
+            if (d != partition.split_dimension && window.num_iterations(d) > best_iterations)
+            {
+                best_iterations             = window.num_iterations(d);
+                partition.split_dimension_2 = d;
+            }
+        }
+        if (best_iterations > 1)
+        {
+            const size_t wanted     = (num_workloads + partition.num_windows - 1) / partition.num_windows;
+            partition.num_windows_2 = static_cast<unsigned int>(std::min(wanted, best_iterations));
+        }
+    }
+    return partition;
+}
+} // namespace arm_compute
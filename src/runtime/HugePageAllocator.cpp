@@ -0,0 +1,315 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/HugePageAllocator.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/runtime/MemoryRegion.h"
+#include "arm_compute/runtime/Scheduler.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#if !defined(_WIN64) && !defined(BARE_METAL)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif // !defined(_WIN64) && !defined(BARE_METAL)
+
+namespace arm_compute
+{
+namespace
+{
+constexpr size_t default_huge_page_size = 2 * 1024 * 1024;
+
+size_t round_up(size_t size, size_t multiple)
+{
+    return ((size + multiple - 1) / multiple) * multiple;
+}
+
+/** Region owning a mapping of @ref HugePageAllocator */
+class MappedMemoryRegion final : public IMemoryRegion
+{
+public:
+    MappedMemoryRegion(std::shared_ptr<void> mapping, size_t size) : IMemoryRegion(size), _mapping(std::move(mapping))
+    {
+    }
+
+    // Inherited methods overridden :
+    void *buffer() override
+    {
+        return _mapping.get();
+    }
+    const void *buffer() const override
+    {
+        return _mapping.get();
+    }
+    std::unique_ptr<IMemoryRegion> extract_subregion(size_t offset, size_t size) override
+    {
+        if (_mapping != nullptr && (offset < _size) && (_size - offset >= size))
+        {
+            return std::make_unique<MemoryRegion>(static_cast<uint8_t *>(_mapping.get()) + offset, size);
+        }
+        return nullptr;
+    }
+
+private:
+    std::shared_ptr<void> _mapping;
+};
+
+#if !defined(_WIN64) && !defined(BARE_METAL)
+/** Size of the huge pages of the pool for explicit huge pages, or of the transparent huge pages otherwise */
+size_t read_huge_page_size(HugePageMode mode)
+{
+    size_t page_size = 0;
+    if (mode == HugePageMode::Explicit)
+    {
+        std::ifstream meminfo("/proc/meminfo");
+        std::string   line;
+        while (page_size == 0 && std::getline(meminfo, line))
+        {
+            if (line.compare(0, 13, "Hugepagesize:") == 0)
+            {
+                page_size = std::stoul(line.substr(13)) * 1024;
+            }
+        }
+    }
+    else
+    {
+        std::ifstream hpage_pmd_size("/sys/kernel/mm/transparent_hugepage/hpage_pmd_size");
+        hpage_pmd_size >> page_size;
+    }
+    return page_size != 0 ? page_size : default_huge_page_size;
+}
+
+/** Bind the pages of a mapping to a NUMA node. Failures are ignored: the kernel places the pages as usual. */
+void bind_to_numa_node(void *ptr, size_t size, int numa_node)
+{
+#ifdef SYS_mbind
+    constexpr int              mpol_bind    = 2;
+    constexpr size_t           bits_in_mask = 8 * sizeof(unsigned long);
+    std::vector<unsigned long> node_mask(numa_node / bits_in_mask + 1, 0);
+    node_mask[numa_node / bits_in_mask] = 1UL << (numa_node % bits_in_mask);
+    syscall(SYS_mbind, ptr, size, mpol_bind, node_mask.data(), node_mask.size() * bits_in_mask + 1, 0);
+#else  // SYS_mbind
+    ARM_COMPUTE_UNUSED(ptr, size, numa_node);
+#endif // SYS_mbind
+}
+
+/** Unmap a mapping of @ref HugePageAllocator */
+void unmap(void *ptr, size_t size)
+{
+    const int ret = munmap(ptr, size);
+    ARM_COMPUTE_UNUSED(ret);
+    ARM_COMPUTE_ERROR_ON_MSG(ret != 0, "Failed to unmap a huge page mapping");
+}
+
+/** Map anonymous memory aligned to @p alignment, trimming the excess of the mapping
+ *
+ * @note The trimmed ranges must be multiples of the page size of the mapping: not to be used with MAP_HUGETLB.
+ *
+ * @return The mapping, unmapped when the last reference is released, or nullptr if the memory couldn't be mapped
+ */
+std::shared_ptr<void> map_aligned(size_t size, size_t alignment, int flags)
+{
+    const size_t length = size + alignment;
+    void        *mem    = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | flags, -1, 0);
+    if (mem == MAP_FAILED)
+    {
+        return nullptr;
+    }
+    const auto address = reinterpret_cast<uintptr_t>(mem);
+    const auto aligned = round_up(address, alignment);
+    if (aligned != address && munmap(mem, aligned - address) != 0)
+    {
+        unmap(mem, length);
+        return nullptr;
+    }
+    if (address + length != aligned + size &&
+        munmap(reinterpret_cast<void *>(aligned + size), address + length - aligned - size) != 0)
+    {
+        unmap(reinterpret_cast<void *>(aligned), address + length - aligned);
+        return nullptr;
+    }
+    return std::shared_ptr<void>(reinterpret_cast<void *>(aligned), [size](void *ptr) { unmap(ptr, size); });
+}
+
+#ifdef MAP_HUGETLB
+/** Map @p size bytes from the huge page pool
+ *
+ * The mapping is not trimmed: @p size must be a multiple of the huge page size, to which the kernel aligns the
+ * mapping.
+ *
+ * @return The mapping, unmapped when the last reference is released, or nullptr if the pool is too small
+ */
+std::shared_ptr<void> map_huge_pages(size_t size)
+{
+    void *mem = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if (mem == MAP_FAILED)
+    {
+        return nullptr;
+    }
+    return std::shared_ptr<void>(mem, [size](void *ptr) { unmap(ptr, size); });
+}
+#endif // MAP_HUGETLB
+
+/** Write to every page of a buffer, spreading the pages over the threads of the scheduler */
+void prefault_pages(void *ptr, size_t size, size_t page_size)
+{
+    const size_t num_pages   = size / page_size;
+    const auto   touch_pages = [=](size_t start, size_t end)
+    {
+        for (size_t page = start; page < end; ++page)
+        {
+            static_cast<volatile uint8_t *>(ptr)[page * page_size] = 0;
+        }
+    };
+
+    const size_t num_workloads = std::min<size_t>(Scheduler::get().num_threads(), num_pages);
+    if (num_workloads < 2)
+    {
+        touch_pages(0, num_pages);
+        return;
+    }
+    std::vector<IScheduler::Workload> workloads(num_workloads);
+    for (size_t i = 0; i < num_workloads; ++i)
+    {
+        workloads[i] = [=](const ThreadInfo &)
+        { touch_pages(i * num_pages / num_workloads, (i + 1) * num_pages / num_workloads); };
+    }
+    Scheduler::get().run_tagged_workloads(workloads, "HugePageAllocator/prefault");
+}
+
+/** Map a buffer backed by the requested pages
+ *
+ * @return The mapping, or nullptr if the memory couldn't be mapped
+ */
+std::shared_ptr<void>
+map_buffer(size_t size, size_t alignment, HugePageMode mode, size_t page_size, int numa_node, bool prefault)
+{
+    const size_t          length  = round_up(size, page_size);
+    std::shared_ptr<void> mapping = nullptr;
+#ifdef MAP_HUGETLB
+    if (mode == HugePageMode::Explicit && alignment <= page_size)
+    {
+        // Huge page pool mappings are aligned to the size of the huge pages
+        mapping = map_huge_pages(length);
+    }
+#endif // MAP_HUGETLB
+    if (mapping == nullptr)
+    {
+        // Transparent huge pages only back the ranges aligned to the size of the huge pages
+        mapping = map_aligned(length, std::max(alignment, page_size), 0);
+#ifdef MADV_HUGEPAGE
+        if (mapping != nullptr && mode != HugePageMode::None)
+        {
+            madvise(mapping.get(), length, MADV_HUGEPAGE);
+        }
+#endif // MADV_HUGEPAGE
+    }
+    if (mapping != nullptr && numa_node >= 0)
+    {
+        bind_to_numa_node(mapping.get(), length, numa_node);
+    }
+    if (mapping != nullptr && prefault)
+    {
+        prefault_pages(mapping.get(), length, page_size);
+    }
+    return mapping;
+}
+#endif // !defined(_WIN64) && !defined(BARE_METAL)
+} // namespace
+
+HugePageAllocator::HugePageAllocator(HugePageMode mode, int numa_node, bool prefault, size_t min_size)
+    : _mode(mode), _numa_node(numa_node), _prefault(prefault), _min_size(min_size), _page_size(0), _mtx(), _mappings()
+{
+#if !defined(_WIN64) && !defined(BARE_METAL)
+    _page_size = (mode == HugePageMode::None) ? static_cast<size_t>(sysconf(_SC_PAGESIZE)) : read_huge_page_size(mode);
+#else  // !defined(_WIN64) && !defined(BARE_METAL)
+    _page_size = default_huge_page_size;
+#endif // !defined(_WIN64) && !defined(BARE_METAL)
+}
+
+HugePageAllocator::~HugePageAllocator() = default;
+
+size_t HugePageAllocator::page_size() const
+{
+    return _page_size;
+}
+
+std::unique_ptr<IMemoryRegion> HugePageAllocator::make_region(size_t size, size_t alignment)
+{
+    std::shared_ptr<void> mapping = nullptr;
+#if !defined(_WIN64) && !defined(BARE_METAL)
+    if (size != 0 && size >= _min_size)
+    {
+        mapping = map_buffer(size, alignment, _mode, _page_size, _numa_node, _prefault);
+    }
+#endif // !defined(_WIN64) && !defined(BARE_METAL)
+
+    if (mapping == nullptr)
+    {
+        return std::make_unique<MemoryRegion>(size, alignment);
+    }
+    return std::make_unique<MappedMemoryRegion>(std::move(mapping), size);
+}
+
+void *HugePageAllocator::allocate(size_t size, size_t alignment)
+{
+    std::shared_ptr<void> mapping = nullptr;
+#if !defined(_WIN64) && !defined(BARE_METAL)
+    if (size != 0 && size >= _min_size)
+    {
+        mapping = map_buffer(size, alignment, _mode, _page_size, _numa_node, _prefault);
+    }
+#else  // !defined(_WIN64) && !defined(BARE_METAL)
+    ARM_COMPUTE_UNUSED(alignment);
+#endif // !defined(_WIN64) && !defined(BARE_METAL)
+
+    if (mapping == nullptr)
+    {
+        // Small buffers are allocated on the heap, as Allocator does
+        return ::operator new(size);
+    }
+
+    std::lock_guard<std::mutex> lock(_mtx);
+    void                       *ptr = mapping.get();
+    _mappings[ptr]                  = std::move(mapping);
+    return ptr;
+}
+
+void HugePageAllocator::free(void *ptr)
+{
+    {
+        std::lock_guard<std::mutex> lock(_mtx);
+        if (_mappings.erase(ptr) != 0)
+        {
+            return;
+        }
+    }
+    ::operator delete(ptr);
+}
+} // namespace arm_compute
@@ -27,18 +27,65 @@
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/Log.h"
 #include "arm_compute/core/Window.h"
+#include "arm_compute/runtime/IWorkloadPartitioner.h"
 
 #include "src/common/cpuinfo/CpuInfo.h"
 #include "src/runtime/SchedulerUtils.h"
+#ifndef BARE_METAL
+#include "src/runtime/AsyncTaskQueue.h"
+#endif /* BARE_METAL */
+#include "support/Mutex.h"
+
+#include <algorithm>
+#include <cstdint>
 
 namespace arm_compute
 {
+namespace
+{
+/** Split a window along a dimension in as many sub-windows as weights, proportionally to the weights
+ *
+ * @param[in] window    Window to split.
+ * @param[in] dimension Dimension along which to split.
+ * @param[in] weights   Weights of the sub-windows. Their sum must be non-zero.
+ * @param[in] id        Index of the sub-window to return.
+ *
+ * @return The sub-window with index @p id, which is empty if its weight is 0.
+ */
+Window
+split_window_weighted(const Window &window, size_t dimension, const std::vector<unsigned int> &weights, size_t id)
+{
+    uint64_t weight_begin = 0;
+    uint64_t weight_total = 0;
+    for (size_t t = 0; t < weights.size(); ++t)
+    {
+        weight_begin += (t < id) ? weights[t] : 0;
+        weight_total += weights[t];
+    }
+    ARM_COMPUTE_ERROR_ON(weight_total == 0);
+
+    const Window::Dimension &dim      = window[dimension];
+    const uint64_t           num_it   = window.num_iterations(dimension);
+    const uint64_t           it_start = num_it * weight_begin / weight_total;
+    const uint64_t           it_end   = num_it * (weight_begin + weights[id]) / weight_total;
+
+    const int start = dim.start() + static_cast<int>(it_start) * dim.step();
+    const int end   = std::min(dim.end(), dim.start() + static_cast<int>(it_end) * dim.step());
+
+    Window out(window);
+    out.set(dimension, Window::Dimension(start, end, dim.step()));
+    return out;
+}
+} // namespace
+
 IScheduler::IScheduler()
 {
     // Work out the best possible number of execution threads
     _num_threads_hint = cpuinfo::num_threads_hint();
 }
 
+IScheduler::~IScheduler() = default;
+
 CPUInfo &IScheduler::cpu_info()
 {
     return CPUInfo::get();
@@ -55,6 +102,11 @@ unsigned int IScheduler::num_threads_hint() const
     return _num_threads_hint;
 }
 
+void IScheduler::set_workload_partitioner(std::shared_ptr<IWorkloadPartitioner> partitioner)
+{
+    _partitioner = std::move(partitioner);
+}
+
 void IScheduler::schedule_common(ICPPKernel *kernel, const Hints &hints, const Window &window, ITensorPack &tensors)
 {
     ARM_COMPUTE_ERROR_ON_MSG(!kernel, "The child class didn't set the kernel");
@@ -109,7 +161,45 @@ void IScheduler::schedule_common(ICPPKernel *kernel, const Hints &hints, const W
             return;
         }
 
-        if (!kernel->is_parallelisable() || num_threads == 1)
+        if (kernel->is_parallelisable() && kernel->partitions_by_window() && _partitioner != nullptr &&
+            this->num_threads() > 1)
+        {
+            // The partitioner may split a second dimension, so the number of iterations of the split dimension
+            // doesn't cap the number of workloads
+            WorkloadPartition partition =
+                _partitioner->partition(*kernel, max_window, hints, tensors, this->num_threads(), cpu_info());
+            partition.num_windows   = std::max(partition.num_windows, 1U);
+            partition.num_windows_2 = std::max(partition.num_windows_2, 1U);
+
+            const unsigned int num_windows = partition.num_windows * partition.num_windows_2;
+
+            std::vector<IScheduler::Workload> workloads(num_windows);
+            for (unsigned int t = 0; t < num_windows; ++t)
+            {
+                workloads[t] = [t, &partition, &max_window, &kernel, &tensors](const ThreadInfo &info)
+                {
+                    Window win = max_window.split_window(partition.split_dimension, t / partition.num_windows_2,
+                                                         partition.num_windows);
+                    if (partition.num_windows_2 > 1)
+                    {
+                        win = win.split_window(partition.split_dimension_2, t % partition.num_windows_2,
+                                               partition.num_windows_2);
+                    }
+                    win.validate();
+
+                    if (tensors.empty())
+                    {
+                        kernel->run(win, info);
+                    }
+                    else
+                    {
+                        kernel->run_op(tensors, win, info);
+                    }
+                };
+            }
+            run_workloads(workloads);
+        }
+        else if (!kernel->is_parallelisable() || num_threads == 1)
         {
             ThreadInfo info;
             info.cpu_info = &cpu_info();
@@ -144,13 +234,36 @@ void IScheduler::schedule_common(ICPPKernel *kernel, const Hints &hints, const W
             // Make sure the smallest window is larger than minimum workload size
             num_windows = adjust_num_of_windows(max_window, hints.split_dimension(), num_windows, *kernel, cpu_info());
 
+            // Size the workloads to the capacity of the threads running them. This is only needed for STATIC
+            // workloads, unless some threads must stay idle.
+            std::vector<unsigned int> weights = thread_weights(std::min(num_windows, this->num_threads()), hints);
+            const bool has_idle_threads       = std::find(weights.begin(), weights.end(), 0U) != weights.end();
+            const bool has_uniform_weights    = std::adjacent_find(weights.begin(), weights.end(),
+                                                                   std::not_equal_to<unsigned int>()) == weights.end();
+            if (has_uniform_weights || (hints.strategy() != StrategyHint::STATIC && !has_idle_threads))
+            {
+                weights.clear();
+            }
+            else
+            {
+                num_windows = weights.size();
+            }
+
             std::vector<IScheduler::Workload> workloads(num_windows);
             for (unsigned int t = 0; t < num_windows; ++t)
             {
                 //Capture 't' by copy, all the other variables by reference:
-                workloads[t] = [t, &hints, &max_window, &num_windows, &kernel, &tensors](const ThreadInfo &info)
+                workloads[t] =
+                    [t, &hints, &max_window, &num_windows, &weights, &kernel, &tensors](const ThreadInfo &info)
                 {
-                    Window win = max_window.split_window(hints.split_dimension(), t, num_windows);
+                    Window win = weights.empty()
+                                     ? max_window.split_window(hints.split_dimension(), t, num_windows)
+                                     : split_window_weighted(max_window, hints.split_dimension(), weights, t);
+                    if (!weights.empty() && win[hints.split_dimension()].start() == win[hints.split_dimension()].end())
+                    {
+                        // Nothing left for this thread
+                        return;
+                    }
                     win.validate();
 
                     if (tensors.empty())
@@ -171,12 +284,57 @@ void IScheduler::schedule_common(ICPPKernel *kernel, const Hints &hints, const W
 #endif /* !BARE_METAL */
 }
 
+std::vector<unsigned int> IScheduler::thread_weights(unsigned int num_threads, const Hints &hints) const
+{
+    ARM_COMPUTE_UNUSED(num_threads, hints);
+    return {};
+}
+
 void IScheduler::run_tagged_workloads(std::vector<Workload> &workloads, const char *tag)
 {
     ARM_COMPUTE_UNUSED(tag);
     run_workloads(workloads);
 }
 
+#ifndef BARE_METAL
+IScheduler::Completion IScheduler::schedule_op_async(ICPPKernel                    *kernel,
+                                                     const Hints                   &hints,
+                                                     const Window                  &window,
+                                                     ITensorPack                   &tensors,
+                                                     const std::vector<Completion> &dependencies)
+{
+    ARM_COMPUTE_ERROR_ON(kernel == nullptr);
+    // Capture the hints, the window and the pack by copy as the caller is free to reuse them once this returns
+    return run_async([this, kernel, hints, window, tensors]() mutable { schedule_op(kernel, hints, window, tensors); },
+                     dependencies);
+}
+
+IScheduler::Completion IScheduler::run_async(std::function<void()> task, const std::vector<Completion> &dependencies)
+{
+    {
+        // The dispatcher thread is only created on first use
+        static arm_compute::Mutex           async_queue_mutex;
+        arm_compute::lock_guard<std::mutex> lock(async_queue_mutex);
+        if (_async_queue == nullptr)
+        {
+            _async_queue = std::make_unique<AsyncTaskQueue>();
+        }
+    }
+    return _async_queue->push(std::move(task), dependencies);
+}
+#endif /* BARE_METAL */
+
+void IScheduler::drain_async_tasks()
+{
+#ifndef BARE_METAL
+    if (_async_queue != nullptr)
+    {
+        _async_queue->drain();
+        _async_queue.reset();
+    }
+#endif /* BARE_METAL */
+}
+
 std::size_t IScheduler::adjust_num_of_windows(const Window     &window,
                                               std::size_t       split_dimension,
                                               std::size_t       init_num_windows,
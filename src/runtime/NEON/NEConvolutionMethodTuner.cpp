@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/NEConvolutionMethodTuner.h"
+
+#include "arm_compute/core/Error.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <utility>
+
+namespace arm_compute
+{
+namespace
+{
+std::atomic<NEConvolutionMethodTuner *> g_active_tuner{nullptr};
+
+/** Names of the methods in the table files */
+const std::pair<ConvolutionMethod, const char *> method_names[] = {
+    {ConvolutionMethod::GEMM, "GEMM"},
+    {ConvolutionMethod::GEMM_CONV2D, "GEMM_CONV2D"},
+    {ConvolutionMethod::DIRECT, "DIRECT"},
+    {ConvolutionMethod::WINOGRAD, "WINOGRAD"},
+};
+} // namespace
+
+NEConvolutionMethodTuner::NEConvolutionMethodTuner(bool tune_new_convolutions, unsigned int num_iterations)
+    : _method_table(),
+      _mtx(),
+      _tune_new_convolutions(tune_new_convolutions),
+      _num_iterations(std::max(num_iterations, 1U))
+{
+}
+
+void NEConvolutionMethodTuner::set_tune_new_convolutions(bool tune_new_convolutions)
+{
+    _tune_new_convolutions = tune_new_convolutions;
+}
+
+bool NEConvolutionMethodTuner::tune_new_convolutions() const
+{
+    return _tune_new_convolutions;
+}
+
+unsigned int NEConvolutionMethodTuner::num_iterations() const
+{
+    return _num_iterations;
+}
+
+void NEConvolutionMethodTuner::add_method(const std::string &conv_id, ConvolutionMethod method)
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    _method_table[conv_id] = method;
+}
+
+bool NEConvolutionMethodTuner::find_method(const std::string &conv_id, ConvolutionMethod &method) const
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    const auto                  it = _method_table.find(conv_id);
+    if (it == _method_table.end())
+    {
+        return false;
+    }
+    method = it->second;
+    return true;
+}
+
+const std::unordered_map<std::string, ConvolutionMethod> &NEConvolutionMethodTuner::method_table() const
+{
+    return _method_table;
+}
+
+void NEConvolutionMethodTuner::load_from_file(const std::string &filename)
+{
+    std::ifstream fs;
+    fs.exceptions(std::ifstream::badbit);
+    fs.open(filename, std::ios::in);
+    if (!fs.is_open())
+    {
+        ARM_COMPUTE_ERROR_VAR("Failed to open '%s' (%s [%d])", filename.c_str(), strerror(errno), errno);
+    }
+    std::string line;
+    while (!std::getline(fs, line).fail())
+    {
+        const size_t pos = line.find(";");
+        if (pos == std::string::npos)
+        {
+            ARM_COMPUTE_ERROR_VAR("Malformed row '%s' in %s", line.c_str(), filename.c_str());
+        }
+        const std::string name = line.substr(pos + 1);
+        const auto        it   = std::find_if(std::begin(method_names), std::end(method_names),
+                                              [&](const std::pair<ConvolutionMethod, const char *> &method)
+                                              { return name == method.second; });
+        if (it == std::end(method_names))
+        {
+            ARM_COMPUTE_ERROR_VAR("Unknown convolution method '%s' in %s", name.c_str(), filename.c_str());
+        }
+        add_method(line.substr(0, pos), it->first);
+    }
+    fs.close();
+}
+
+bool NEConvolutionMethodTuner::save_to_file(const std::string &filename) const
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    if (_method_table.empty() || filename.empty())
+    {
+        return false;
+    }
+    std::ofstream fs;
+    fs.exceptions(std::ifstream::failbit | std::ifstream::badbit);
+    fs.open(filename, std::ios::out);
+    for (auto const &entry : _method_table)
+    {
+        const auto it = std::find_if(std::begin(method_names), std::end(method_names),
+                                     [&](const std::pair<ConvolutionMethod, const char *> &method)
+                                     { return entry.second == method.first; });
+        ARM_COMPUTE_ERROR_ON(it == std::end(method_names));
+        fs << entry.first << ";" << it->second << std::endl;
+    }
+    fs.close();
+    return true;
+}
+
+void NEConvolutionMethodTuner::set_active_tuner(NEConvolutionMethodTuner *tuner)
+{
+    g_active_tuner.store(tuner);
+}
+
+NEConvolutionMethodTuner *NEConvolutionMethodTuner::active_tuner()
+{
+    return g_active_tuner.load();
+}
+} // namespace arm_compute
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/NEGEMMTuner.h"
+
+#include "arm_compute/core/Error.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+
+namespace arm_compute
+{
+namespace
+{
+std::atomic<NEGEMMTuner *> g_active_tuner{nullptr};
+} // namespace
+
+NEGEMMTuner::NEGEMMTuner(bool tune_new_kernels, unsigned int num_iterations)
+    : _kernel_table(), _mtx(), _tune_new_kernels(tune_new_kernels), _num_iterations(std::max(num_iterations, 1U))
+{
+}
+
+void NEGEMMTuner::set_tune_new_kernels(bool tune_new_kernels)
+{
+    _tune_new_kernels = tune_new_kernels;
+}
+
+bool NEGEMMTuner::tune_new_kernels() const
+{
+    return _tune_new_kernels;
+}
+
+unsigned int NEGEMMTuner::num_iterations() const
+{
+    return _num_iterations;
+}
+
+void NEGEMMTuner::add_kernel(const std::string &gemm_id, const std::string &kernel_name)
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    _kernel_table[gemm_id] = kernel_name;
+}
+
+bool NEGEMMTuner::find_kernel(const std::string &gemm_id, std::string &kernel_name) const
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    const auto                  it = _kernel_table.find(gemm_id);
+    if (it == _kernel_table.end())
+    {
+        return false;
+    }
+    kernel_name = it->second;
+    return true;
+}
+
+const std::unordered_map<std::string, std::string> &NEGEMMTuner::kernel_table() const
+{
+    return _kernel_table;
+}
+
+void NEGEMMTuner::load_from_file(const std::string &filename)
+{
+    std::ifstream fs;
+    fs.exceptions(std::ifstream::badbit);
+    fs.open(filename, std::ios::in);
+    if (!fs.is_open())
+    {
+        ARM_COMPUTE_ERROR_VAR("Failed to open '%s' (%s [%d])", filename.c_str(), strerror(errno), errno);
+    }
+    std::string line;
+    while (!std::getline(fs, line).fail())
+    {
+        const size_t pos = line.find(";");
+        if (pos == std::string::npos || pos + 1 == line.size())
+        {
+            ARM_COMPUTE_ERROR_VAR("Malformed row '%s' in %s", line.c_str(), filename.c_str());
+        }
+        add_kernel(line.substr(0, pos), line.substr(pos + 1));
+    }
+    fs.close();
+}
+
+bool NEGEMMTuner::save_to_file(const std::string &filename) const
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    if (_kernel_table.empty() || filename.empty())
+    {
+        return false;
+    }
+    std::ofstream fs;
+    fs.exceptions(std::ifstream::failbit | std::ifstream::badbit);
+    fs.open(filename, std::ios::out);
+    for (auto const &kernel : _kernel_table)
+    {
+        fs << kernel.first << ";" << kernel.second << std::endl;
+    }
+    fs.close();
+    return true;
+}
+
+void NEGEMMTuner::set_active_tuner(NEGEMMTuner *tuner)
+{
+    g_active_tuner.store(tuner);
+}
+
+NEGEMMTuner *NEGEMMTuner::active_tuner()
+{
+    return g_active_tuner.load();
+}
+} // namespace arm_compute
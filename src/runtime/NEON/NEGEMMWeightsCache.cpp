@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/NEGEMMWeightsCache.h"
+
+#include "arm_compute/core/Error.h"
+
+#include <array>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+#if !defined(_WIN64) && !defined(BARE_METAL)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif // !defined(_WIN64) && !defined(BARE_METAL)
+
+namespace arm_compute
+{
+namespace
+{
+std::atomic<NEGEMMWeightsCache *> g_active_cache{nullptr};
+
+constexpr std::array<char, 8> entry_magic{{'A', 'C', 'L', 'W', 'G', 'T', '0', '1'}};
+// Offset of the content in the entry files: a multiple of the page size and of the alignment needed by the kernels
+constexpr uint64_t entry_alignment = 4096;
+
+/** Header of the entry files, followed by the key and the content at offset data_offset */
+struct EntryHeader
+{
+    std::array<char, 8> magic;
+    uint64_t            key_size;
+    uint64_t            data_offset;
+    uint64_t            data_size;
+};
+
+constexpr uint64_t k0 = 0x9E3779B97F4A7C15ULL;
+constexpr uint64_t k1 = 0xBF58476D1CE4E5B9ULL;
+constexpr uint64_t k2 = 0x94D049BB133111EBULL;
+
+inline uint64_t rotl(uint64_t x, unsigned int r)
+{
+    return (x << r) | (x >> (64 - r));
+}
+
+inline uint64_t avalanche(uint64_t x)
+{
+    x ^= x >> 30;
+    x *= k1;
+    x ^= x >> 27;
+    x *= k2;
+    x ^= x >> 31;
+    return x;
+}
+} // namespace
+
+NEGEMMWeightsCache::NEGEMMWeightsCache(std::string directory) : _directory(std::move(directory)), _mappings(), _mtx()
+{
+}
+
+NEGEMMWeightsCache::~NEGEMMWeightsCache()
+{
+#if !defined(_WIN64) && !defined(BARE_METAL)
+    for (auto &mapping : _mappings)
+    {
+        ::munmap(mapping.second.address, mapping.second.size);
+    }
+#endif // !defined(_WIN64) && !defined(BARE_METAL)
+}
+
+const void *NEGEMMWeightsCache::find(const std::string &key, size_t size)
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+
+    const auto it = _mappings.find(key);
+    if (it != _mappings.end())
+    {
+        return (it->second.data_size == size) ? it->second.data : nullptr;
+    }
+
+#if !defined(_WIN64) && !defined(BARE_METAL)
+    const std::string path = entry_path(key);
+    const int         fd   = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+    {
+        return nullptr;
+    }
+
+    // Check that the entry matches before mapping it
+    struct stat st; // NOLINT
+    EntryHeader header{};
+    std::string stored_key(key.size(), '\0');
+    bool        valid =
+        ::fstat(fd, &st) == 0 && ::pread(fd, &header, sizeof(header), 0) == static_cast<ssize_t>(sizeof(header)) &&
+        header.magic == entry_magic && header.key_size == key.size() && header.data_size == size &&
+        header.data_offset % entry_alignment == 0 &&
+        static_cast<uint64_t>(st.st_size) >= header.data_offset + header.data_size &&
+        ::pread(fd, &stored_key[0], key.size(), sizeof(header)) == static_cast<ssize_t>(key.size()) &&
+        stored_key == key;
+
+    void *address = nullptr;
+    if (valid)
+    {
+        address = ::mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        valid   = address != MAP_FAILED;
+    }
+    ::close(fd);
+    if (!valid)
+    {
+        return nullptr;
+    }
+
+    const void *data = static_cast<const uint8_t *>(address) + header.data_offset;
+    _mappings.emplace(key, Mapping{address, static_cast<size_t>(st.st_size), data, size});
+    return data;
+#else  // !defined(_WIN64) && !defined(BARE_METAL)
+    ARM_COMPUTE_UNUSED(size);
+    return nullptr;
+#endif // !defined(_WIN64) && !defined(BARE_METAL)
+}
+
+bool NEGEMMWeightsCache::store(const std::string &key, const void *data, size_t size)
+{
+#if !defined(_WIN64) && !defined(BARE_METAL)
+    ARM_COMPUTE_ERROR_ON(data == nullptr && size != 0);
+
+    EntryHeader header{};
+    header.magic       = entry_magic;
+    header.key_size    = key.size();
+    header.data_offset = ((sizeof(header) + key.size() + entry_alignment - 1) / entry_alignment) * entry_alignment;
+    header.data_size   = size;
+
+    // Write to a temporary file first, so that concurrent readers never see a partial entry
+    const std::string path     = entry_path(key);
+    const std::string tmp_path = path + ".tmp" + std::to_string(::getpid());
+    std::ofstream     fs(tmp_path, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!fs.is_open())
+    {
+        return false;
+    }
+    const std::vector<char> padding(header.data_offset - sizeof(header) - key.size(), 0);
+    fs.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    fs.write(key.data(), key.size());
+    fs.write(padding.data(), padding.size());
+    fs.write(static_cast<const char *>(data), size);
+    fs.close();
+
+    if (fs.fail() || std::rename(tmp_path.c_str(), path.c_str()) != 0)
+    {
+        std::remove(tmp_path.c_str());
+        return false;
+    }
+    return true;
+#else  // !defined(_WIN64) && !defined(BARE_METAL)
+    ARM_COMPUTE_UNUSED(key, data, size);
+    return false;
+#endif // !defined(_WIN64) && !defined(BARE_METAL)
+}
+
+const std::string &NEGEMMWeightsCache::directory() const
+{
+    return _directory;
+}
+
+uint64_t NEGEMMWeightsCache::hash(const void *data, size_t size, uint64_t seed)
+{
+    const auto *ptr = static_cast<const uint8_t *>(data);
+    uint64_t    h   = seed ^ (size * k0);
+    for (; size >= sizeof(uint64_t); size -= sizeof(uint64_t), ptr += sizeof(uint64_t))
+    {
+        uint64_t word;
+        std::memcpy(&word, ptr, sizeof(word));
+        h = (rotl(h, 23) ^ word) * k1;
+    }
+    if (size > 0)
+    {
+        uint64_t word = 0;
+        std::memcpy(&word, ptr, size);
+        h = (rotl(h, 23) ^ word) * k1;
+    }
+    return avalanche(h);
+}
+
+void NEGEMMWeightsCache::set_active_cache(NEGEMMWeightsCache *cache)
+{
+    g_active_cache.store(cache);
+}
+
+NEGEMMWeightsCache *NEGEMMWeightsCache::active_cache()
+{
+    return g_active_cache.load();
+}
+
+std::string NEGEMMWeightsCache::entry_path(const std::string &key) const
+{
+    std::stringstream path;
+    path << _directory << "/" << std::hex << hash(key.data(), key.size()) << ".bin";
+    return path.str();
+}
+} // namespace arm_compute
@@ -28,8 +28,11 @@
 #include "arm_compute/runtime/NEON/NEScheduler.h"
 
 #include "src/common/utils/Log.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/NEON/kernels/NEFFTChirpKernel.h"
 #include "src/core/NEON/kernels/NEFFTDigitReverseKernel.h"
 #include "src/core/NEON/kernels/NEFFTRadixStageKernel.h"
+#include "src/core/NEON/kernels/NEFFTRealUnpackKernel.h"
 #include "src/core/NEON/kernels/NEFFTScaleKernel.h"
 #include "src/core/utils/helpers/fft.h"
 
@@ -38,15 +41,28 @@ namespace arm_compute
 NEFFT1D::~NEFFT1D() = default;
 
 NEFFT1D::NEFFT1D(std::shared_ptr<IMemoryManager> memory_manager)
-    : _memory_group(std::move(memory_manager)),
+    : _memory_manager(memory_manager),
+      _memory_group(std::move(memory_manager)),
       _digit_reverse_kernel(),
       _fft_kernels(),
+      _real_unpack_kernel(),
       _scale_kernel(),
+      _chirp_input_kernel(),
+      _chirp_product_kernel(),
+      _chirp_output_kernel(),
+      _chirp_fft(),
+      _product_fft(),
       _digit_reversed_input(),
       _digit_reverse_indices(),
+      _chirp(),
+      _chirp_spectrum(),
+      _chirp_input(),
+      _chirp_product(),
       _num_ffts(0),
       _axis(0),
-      _run_scale(false)
+      _run_scale(false),
+      _run_real_unpack(false),
+      _run_bluestein(false)
 {
 }
 
@@ -59,11 +75,32 @@ void NEFFT1D::configure(const ITensor *input, ITensor *output, const FFT1DInfo &
     // Decompose size to radix factors
     const auto         supported_radix   = NEFFTRadixStageKernel::supported_radix();
     const unsigned int N                 = input->info()->tensor_shape()[config.axis];
-    const auto         decomposed_vector = arm_compute::helpers::fft::decompose_stages(N, supported_radix);
-    ARM_COMPUTE_ERROR_ON(decomposed_vector.empty());
+    auto               decomposed_vector = arm_compute::helpers::fft::decompose_stages(N, supported_radix);
+
+    _axis          = config.axis;
+    _run_bluestein = decomposed_vector.empty();
+
+    if (_run_bluestein)
+    {
+        configure_bluestein(input, output, config);
+        return;
+    }
+
+    // Real inputs of even length along axis 0 are packed as complex inputs of half length
+    const bool is_real_input = input->info()->num_channels() == 1;
+    if (is_real_input && config.axis == 0 && N % 2 == 0)
+    {
+        const auto half_decomposed_vector = arm_compute::helpers::fft::decompose_stages(N / 2, supported_radix);
+        _run_real_unpack                  = !half_decomposed_vector.empty();
+        if (_run_real_unpack)
+        {
+            decomposed_vector = half_decomposed_vector;
+        }
+    }
+    const unsigned int fft_size = _run_real_unpack ? N / 2 : N;
 
     // Flags
-    _run_scale = config.direction == FFTDirection::Inverse;
+    _run_scale = config.direction == FFTDirection::Inverse && !_run_real_unpack;
 
     const bool is_c2r = input->info()->num_channels() == 2 && output->info()->num_channels() == 1;
 
@@ -71,7 +108,8 @@ void NEFFT1D::configure(const ITensor *input, ITensor *output, const FFT1DInfo &
     FFTDigitReverseKernelInfo digit_reverse_config;
     digit_reverse_config.axis      = config.axis;
     digit_reverse_config.conjugate = config.direction == FFTDirection::Inverse;
-    TensorInfo digit_reverse_indices_info(TensorShape(input->info()->tensor_shape()[config.axis]), 1, DataType::U32);
+    digit_reverse_config.pack_real = _run_real_unpack;
+    TensorInfo digit_reverse_indices_info(TensorShape(fft_size), 1, DataType::U32);
     _digit_reverse_indices.allocator()->init(digit_reverse_indices_info);
     _memory_group.manage(&_digit_reversed_input);
     _digit_reverse_kernel = std::make_unique<NEFFTDigitReverseKernel>();
@@ -81,11 +119,11 @@ void NEFFT1D::configure(const ITensor *input, ITensor *output, const FFT1DInfo &
     unsigned int Nx = 1;
     _num_ffts       = decomposed_vector.size();
     _fft_kernels.resize(_num_ffts);
-    _axis = config.axis;
 
     for (unsigned int i = 0; i < _num_ffts; ++i)
     {
         const unsigned int radix_for_stage = decomposed_vector.at(i);
+        const bool         is_last_stage   = (i == (_num_ffts - 1)) && !is_c2r && !_run_real_unpack;
 
         FFTRadixStageKernelInfo fft_kernel_info;
         fft_kernel_info.axis           = config.axis;
@@ -93,12 +131,21 @@ void NEFFT1D::configure(const ITensor *input, ITensor *output, const FFT1DInfo &
         fft_kernel_info.Nx             = Nx;
         fft_kernel_info.is_first_stage = (i == 0);
         _fft_kernels[i]                = std::make_unique<NEFFTRadixStageKernel>();
-        _fft_kernels[i]->configure(&_digit_reversed_input, ((i == (_num_ffts - 1)) && !is_c2r) ? output : nullptr,
-                                   fft_kernel_info);
+        _fft_kernels[i]->configure(&_digit_reversed_input, is_last_stage ? output : nullptr, fft_kernel_info);
 
         Nx *= radix_for_stage;
     }
 
+    // Configure the unpacking of the spectrum of real inputs, which also scales and conjugates the output if needed
+    if (_run_real_unpack)
+    {
+        FFTRealUnpackKernelInfo unpack_config;
+        unpack_config.scale     = config.direction == FFTDirection::Inverse ? static_cast<float>(N) : 1.f;
+        unpack_config.conjugate = config.direction == FFTDirection::Inverse;
+        _real_unpack_kernel     = std::make_unique<NEFFTRealUnpackKernel>();
+        _real_unpack_kernel->configure(&_digit_reversed_input, output, unpack_config);
+    }
+
     // Configure scale kernel
     if (_run_scale)
     {
@@ -107,7 +154,7 @@ void NEFFT1D::configure(const ITensor *input, ITensor *output, const FFT1DInfo &
         scale_config.conjugate = config.direction == FFTDirection::Inverse;
         _scale_kernel          = std::make_unique<NEFFTScaleKernel>();
         is_c2r ? _scale_kernel->configure(&_digit_reversed_input, output, scale_config)
-                        : _scale_kernel->configure(output, nullptr, scale_config);
+               : _scale_kernel->configure(output, nullptr, scale_config);
     }
 
     // Allocate tensors
@@ -115,8 +162,74 @@ void NEFFT1D::configure(const ITensor *input, ITensor *output, const FFT1DInfo &
     _digit_reverse_indices.allocator()->allocate();
 
     // Init digit reverse indices
-    const auto digit_reverse_cpu = arm_compute::helpers::fft::digit_reverse_indices(N, decomposed_vector);
-    std::copy_n(digit_reverse_cpu.data(), N, reinterpret_cast<unsigned int *>(_digit_reverse_indices.buffer()));
+    const auto digit_reverse_cpu = arm_compute::helpers::fft::digit_reverse_indices(fft_size, decomposed_vector);
+    std::copy_n(digit_reverse_cpu.data(), fft_size, reinterpret_cast<unsigned int *>(_digit_reverse_indices.buffer()));
+}
+
+void NEFFT1D::configure_bluestein(const ITensor *input, ITensor *output, const FFT1DInfo &config)
+{
+    // The FFT is computed as X[k] = w[k] * (x * w)[k] (*) conj(w)[k], with the chirp w[n] = exp(-i * pi * n^2 / N).
+    // The linear convolution is computed as a cyclic one of decomposable length M >= 2 * N - 1, through the identity
+    // ifft(A * B) = conj(fft(conj(A * B))) / M so that both FFTs are forward ones. Conjugations and scalings are
+    // fused in the chirp multiplications.
+    const auto         supported_radix = NEFFTRadixStageKernel::supported_radix();
+    const unsigned int N               = input->info()->tensor_shape()[config.axis];
+    const unsigned int M               = arm_compute::helpers::fft::bluestein_convolution_size(N, supported_radix);
+    const bool         is_inverse      = config.direction == FFTDirection::Inverse;
+    ARM_COMPUTE_ERROR_ON(M == 0);
+
+    auto_init_if_empty(*output->info(), input->info()->tensor_shape(), 2, input->info()->data_type());
+
+    TensorShape convolution_shape = input->info()->tensor_shape();
+    convolution_shape.set(config.axis, M);
+    const TensorInfo convolution_info(convolution_shape, 2, input->info()->data_type());
+    _chirp.allocator()->init(TensorInfo(TensorShape(N), 2, input->info()->data_type()));
+    _chirp_spectrum.allocator()->init(TensorInfo(TensorShape(M), 2, input->info()->data_type()));
+    _chirp_input.allocator()->init(convolution_info);
+    _chirp_product.allocator()->init(convolution_info);
+    _memory_group.manage(&_chirp_input);
+    _memory_group.manage(&_chirp_product);
+
+    FFT1DInfo convolution_fft_config;
+    convolution_fft_config.axis      = config.axis;
+    convolution_fft_config.direction = FFTDirection::Forward;
+
+    // Multiply the input by the chirp and zero-pad it to M
+    FFTChirpKernelInfo chirp_config;
+    chirp_config.axis   = config.axis;
+    _chirp_input_kernel = std::make_unique<NEFFTChirpKernel>();
+    _chirp_input_kernel->configure(input, &_chirp_input, &_chirp, chirp_config);
+    _chirp_fft = std::make_unique<NEFFT1D>(_memory_manager);
+    _chirp_fft->configure(&_chirp_input, &_chirp_product, convolution_fft_config);
+
+    // Multiply by the spectrum of the kernel and transform back
+    chirp_config.conjugate = true;
+    _chirp_product_kernel  = std::make_unique<NEFFTChirpKernel>();
+    _chirp_product_kernel->configure(&_chirp_product, &_chirp_product, &_chirp_spectrum, chirp_config);
+    _product_fft = std::make_unique<NEFFT1D>(_memory_manager);
+    _product_fft->configure(&_chirp_product, &_chirp_input, convolution_fft_config);
+
+    // Multiply by the chirp and crop to N
+    _chirp_output_kernel = std::make_unique<NEFFTChirpKernel>();
+    _chirp_output_kernel->configure(&_chirp_input, output, &_chirp, chirp_config);
+
+    // Allocate tensors
+    _chirp_input.allocator()->allocate();
+    _chirp_product.allocator()->allocate();
+    _chirp.allocator()->allocate();
+    _chirp_spectrum.allocator()->allocate();
+
+    // Init the chirp and the spectrum of the kernel, conjugated and scaled by 1 / M (and 1 / N for inverse FFTs)
+    const auto chirp_cpu    = arm_compute::helpers::fft::bluestein_chirp(N, is_inverse);
+    const auto spectrum_cpu = arm_compute::helpers::fft::bluestein_kernel_spectrum(N, M, is_inverse);
+    const auto scale        = 1.f / (static_cast<float>(M) * (is_inverse ? static_cast<float>(N) : 1.f));
+    auto      *spectrum_ptr = reinterpret_cast<float *>(_chirp_spectrum.buffer());
+    std::copy_n(chirp_cpu.data(), 2 * N, reinterpret_cast<float *>(_chirp.buffer()));
+    for (unsigned int m = 0; m < M; ++m)
+    {
+        spectrum_ptr[2 * m]     = spectrum_cpu[2 * m] * scale;
+        spectrum_ptr[2 * m + 1] = -spectrum_cpu[2 * m + 1] * scale;
+    }
 }
 
 Status NEFFT1D::validate(const ITensorInfo *input, const ITensorInfo *output, const FFT1DInfo &config)
@@ -126,11 +239,12 @@ Status NEFFT1D::validate(const ITensorInfo *input, const ITensorInfo *output, co
     ARM_COMPUTE_RETURN_ERROR_ON(input->num_channels() > 2);
     ARM_COMPUTE_RETURN_ERROR_ON(std::set<unsigned int>({0, 1}).count(config.axis) == 0);
 
-    // Check if FFT is decomposable
+    // Sizes that are not decomposable are computed with the Bluestein algorithm
     const auto         supported_radix   = NEFFTRadixStageKernel::supported_radix();
     const unsigned int N                 = input->tensor_shape()[config.axis];
     const auto         decomposed_vector = arm_compute::helpers::fft::decompose_stages(N, supported_radix);
-    ARM_COMPUTE_RETURN_ERROR_ON(decomposed_vector.empty());
+    ARM_COMPUTE_RETURN_ERROR_ON(decomposed_vector.empty() &&
+                                arm_compute::helpers::fft::bluestein_convolution_size(N, supported_radix) == 0);
 
     // Checks performed when output is configured
     if ((output != nullptr) && (output->total_size() != 0))
@@ -149,6 +263,16 @@ void NEFFT1D::run()
 {
     MemoryGroupResourceScope scope_mg(_memory_group);
 
+    if (_run_bluestein)
+    {
+        NEScheduler::get().schedule(_chirp_input_kernel.get(), Window::DimY);
+        _chirp_fft->run();
+        NEScheduler::get().schedule(_chirp_product_kernel.get(), Window::DimY);
+        _product_fft->run();
+        NEScheduler::get().schedule(_chirp_output_kernel.get(), Window::DimY);
+        return;
+    }
+
     NEScheduler::get().schedule(_digit_reverse_kernel.get(), (_axis == 0 ? Window::DimY : Window::DimZ));
 
     for (unsigned int i = 0; i < _num_ffts; ++i)
@@ -156,6 +280,12 @@ void NEFFT1D::run()
         NEScheduler::get().schedule(_fft_kernels[i].get(), (_axis == 0 ? Window::DimY : Window::DimX));
     }
 
+    // Unpack the spectrum of real inputs
+    if (_run_real_unpack)
+    {
+        NEScheduler::get().schedule(_real_unpack_kernel.get(), Window::DimY);
+    }
+
     // Run output scaling
     if (_run_scale)
     {
@@ -23,105 +23,130 @@
  */
 #include "arm_compute/runtime/NEON/functions/NELSTMLayer.h"
 
+#include "arm_compute/core/ITensorPack.h"
+#include "arm_compute/core/KernelDescriptors.h"
 #include "arm_compute/core/Utils.h"
 #include "arm_compute/core/utils/misc/InfoHelpers.h"
 #include "arm_compute/core/utils/misc/ShapeCalculator.h"
-#include "arm_compute/core/utils/quantization/AsymmHelpers.h"
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/runtime/common/LSTMParams.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
 
 #include "src/common/utils/Log.h"
+#include "src/cpu/kernels/CpuLstmCellKernel.h"
+#include "src/cpu/operators/CpuCopy.h"
 
 namespace arm_compute
 {
 using namespace arm_compute::misc::shape_calculator;
 using namespace arm_compute::utils::info_helpers;
 
+namespace
+{
+/** Gather one tensor per gate, in the order the gates are computed, the input gate being omitted with CIFG */
+template <typename T>
+std::vector<const T *> gates_vector(const LSTMParams<T> &lstm_params,
+                                    const T             *input_gate,
+                                    const T             *forget_gate,
+                                    const T             *cell_gate,
+                                    const T             *output_gate)
+{
+    std::vector<const T *> tensors;
+    if (!lstm_params.has_cifg_opt())
+    {
+        tensors.emplace_back(input_gate);
+    }
+    tensors.emplace_back(forget_gate);
+    tensors.emplace_back(cell_gate);
+    tensors.emplace_back(output_gate);
+    return tensors;
+}
+
+/** Gather the rows of the parameters of the LSTM cell kernel, see cpu::kernels::CpuLstmCellKernel::configure() */
+template <typename T>
+std::vector<const T *> cell_params_vector(const LSTMParams<T> &lstm_params,
+                                          const T             *forget_gate_bias,
+                                          const T             *cell_bias,
+                                          const T             *output_gate_bias)
+{
+    std::vector<const T *> params;
+    if (lstm_params.has_peephole_opt())
+    {
+        if (!lstm_params.has_cifg_opt())
+        {
+            params.emplace_back(lstm_params.cell_to_input_weights());
+        }
+        params.emplace_back(lstm_params.cell_to_forget_weights());
+        params.emplace_back(lstm_params.cell_to_output_weights());
+    }
+    if (lstm_params.use_layer_norm())
+    {
+        const auto norm_weights = gates_vector<T>(
+            lstm_params, lstm_params.input_layer_norm_weights(), lstm_params.forget_layer_norm_weights(),
+            lstm_params.cell_layer_norm_weights(), lstm_params.output_layer_norm_weights());
+        const auto biases =
+            gates_vector<T>(lstm_params, lstm_params.input_gate_bias(), forget_gate_bias, cell_bias, output_gate_bias);
+        params.insert(params.end(), norm_weights.begin(), norm_weights.end());
+        params.insert(params.end(), biases.begin(), biases.end());
+    }
+    return params;
+}
+
+template <typename T>
+LSTMCellKernelInfo
+cell_kernel_info(const LSTMParams<T> &lstm_params, const ActivationLayerInfo &activation_info, float cell_threshold)
+{
+    LSTMCellKernelInfo info{};
+    info.activation_info = activation_info;
+    info.cell_threshold  = cell_threshold;
+    info.has_cifg        = lstm_params.has_cifg_opt();
+    info.has_peephole    = lstm_params.has_peephole_opt();
+    info.use_layer_norm  = lstm_params.use_layer_norm();
+    return info;
+}
+} // namespace
+
 NELSTMLayer::~NELSTMLayer() = default;
 
 NELSTMLayer::NELSTMLayer(std::shared_ptr<IMemoryManager> memory_manager)
     : _memory_group(std::move(memory_manager)),
-      _fully_connected_input_gate(),
-      _accum_input_gate1(),
-      _subtract_input_gate(),
-      _pixelwise_mul_input_gate(),
-      _activation_input_gate(),
-      _fully_connected_forget_gate(),
-      _accum_forget_gate1(),
-      _pixelwise_mul_forget_gate(),
-      _activation_forget_gate(),
-      _fully_connected_cell_state(),
-      _gemm_cell_state1(),
-      _transpose_cell_state(),
-      _accum_cell_state1(),
-      _accum_cell_state2(),
-      _pixelwise_mul_cell_state1(),
-      _activation_cell_state(),
-      _cell_clip(),
-      _pixelwise_mul_cell_state2(),
-      _fully_connected_output(),
-      _pixelwise_mul_output_state1(),
-      _accum_output1(),
-      _activation_output(),
-      _activation_output_state(),
-      _pixelwise_mul_output_state2(),
-      _fully_connected_output_state(),
+      _concat_inputs(),
+      _concat_input_weights(),
+      _concat_recurrent_weights(),
+      _concat_weights(),
+      _concat_bias(),
+      _concat_cell_params(),
+      _fully_connected_gates(),
+      _fully_connected_recurrent_gates(),
+      _lstm_cell_kernel(),
+      _fully_connected_projection(),
       _projection_clip(),
-      _copy_cell_state(),
       _copy_output(),
-      _concat_scratch_buffer(),
-      _concat_inputs_forget_gate(),
-      _concat_weights_forget_gate(),
-      _concat_weights_input_gate(),
-      _concat_weights_output(),
-      _mean_std_norm_input_gate(),
-      _pixelwise_mul_input_gate_coeff(),
-      _accum_input_gate_bias(),
-      _mean_std_norm_forget_gate(),
-      _pixelwise_mul_forget_gate_coeff(),
-      _accum_forget_gate_bias(),
-      _mean_std_norm_cell_gate(),
-      _pixelwise_mul_cell_gate_coeff(),
-      _accum_cell_gate_bias(),
-      _mean_std_norm_output_gate(),
-      _pixelwise_mul_output_gate_coeff(),
-      _accum_output_gate_bias(),
-      _input_gate_out1(),
-      _input_gate_out2(),
-      _input_gate_out3(),
-      _input_gate_out4(),
-      _forget_gate_out1(),
-      _forget_gate_out2(),
-      _forget_gate_out3(),
-      _forget_gate_out4(),
-      _forget_gate_out5(),
-      _cell_state_out1(),
-      _cell_state_out2(),
-      _cell_state_out3(),
-      _cell_state_out4(),
-      _cell_state_out5(),
-      _output1(),
-      _output2(),
-      _output3(),
-      _output4(),
-      _cell_state_activation(),
-      _output_state1(),
-      _ones(),
-      _input_layer_norm_out1(),
-      _input_layer_norm_out2(),
-      _forget_layer_norm_out1(),
-      _forget_layer_norm_out2(),
-      _cell_layer_norm_out1(),
-      _cell_layer_norm_out2(),
-      _output_layer_norm_out1(),
-      _output_layer_norm_out2(),
-      _run_peephole_opt(false),
-      _run_cifg_opt(false),
-      _perform_cell_clipping(false),
+      _copy_state(),
+      _input_weights(),
+      _recurrent_weights(),
+      _weights(),
+      _bias(),
+      _cell_params(),
+      _inputs(),
+      _sequence_input(),
+      _gates(),
+      _recurrent_gates(),
+      _cell_output(),
+      _step_gates(),
+      _step_outputs(),
+      _input(nullptr),
+      _output_state_in(nullptr),
+      _cell_state_in(nullptr),
+      _cell_state_out(nullptr),
+      _output_state_out(nullptr),
+      _scratch_buffer(nullptr),
+      _num_steps(1),
+      _has_bias(false),
+      _has_cell_params(false),
       _has_projection_weights(false),
       _perform_projection_clipping(false),
-      _is_prepared(false),
-      _is_layer_norm_lstm(false)
+      _is_prepared(false)
 {
 }
 
@@ -156,8 +181,6 @@ void NELSTMLayer::configure(const ITensor             *input,
                            scratch_buffer, output_state_out, cell_state_out, output, lstm_params, activation_info,
                            cell_threshold, projection_threshold);
 
-    _is_layer_norm_lstm = lstm_params.use_layer_norm();
-
     // Set lstm parameters
     LSTMParams<ITensorInfo> lstm_params_info{};
     build_lstm_params_tensor_info(lstm_params, &lstm_params_info);
@@ -170,287 +193,116 @@ void NELSTMLayer::configure(const ITensor             *input,
         cell_state_in->info(), scratch_buffer->info(), output_state_out->info(), cell_state_out->info(), output->info(),
         lstm_params_info, activation_info, cell_threshold, projection_threshold));
 
-    const TensorShape cell_state_shape = cell_state_in->info()->tensor_shape();
-
-    // Configure block that calculates the forget gate
-    // forget_gate = Activation(input * input_to_forget_weights + output_state_in * recurrent_to_forget_weights + PixelWiseMul(cell_state, cell_to_forget_weights) + forget_gate_bias)
-    // We optimize this as follows:
-    // forget_gate = Activation( (input,output_state_in) * (input_to_forget_weights,recurrent_to_forget_weights) + PixelWiseMul(cell_state, cell_to_forget_weights) + forget_gate_bias)
-    _forget_gate_out2.allocator()->init(TensorInfo(cell_state_shape, 1, input->info()->data_type()));
-    _forget_gate_out4.allocator()->init(TensorInfo(cell_state_shape, 1, input->info()->data_type()));
-
-    std::vector<const ITensor *> inputs_vector;
-    inputs_vector.emplace_back(input);
-    inputs_vector.emplace_back(output_state_in);
-
-    _memory_group.manage(&_forget_gate_out1);
-    _concat_inputs_forget_gate.configure(inputs_vector, &_forget_gate_out1, Window::DimX);
+    const DataType     data_type        = input->info()->data_type();
+    const TensorShape  cell_state_shape = cell_state_in->info()->tensor_shape();
+    const unsigned int num_batches      = input->info()->dimension(1);
+    const unsigned int num_gate_units   = (lstm_params.has_cifg_opt() ? 3 : 4) * cell_state_shape[0];
 
-    std::vector<const ITensor *> weights_vector;
+    _input            = input;
+    _output_state_in  = output_state_in;
+    _cell_state_in    = cell_state_in;
+    _cell_state_out   = cell_state_out;
+    _output_state_out = output_state_out;
+    _scratch_buffer   = scratch_buffer;
+    _num_steps        = input->info()->dimension(2);
 
-    weights_vector.emplace_back(input_to_forget_weights);
-    weights_vector.emplace_back(recurrent_to_forget_weights);
+    // Concatenate the weights of all the gates, so that they are computed by a single matrix multiplication:
+    // gates = (input, output_state_in) * (input_weights, recurrent_weights) + bias
+    // With layer normalization, the bias is added after the normalization by the LSTM cell kernel instead
+    _concat_input_weights.configure(gates_vector<ITensor>(lstm_params, lstm_params.input_to_input_weights(),
+                                                          input_to_forget_weights, input_to_cell_weights,
+                                                          input_to_output_weights),
+                                    &_input_weights, Window::DimY);
+    _concat_recurrent_weights.configure(gates_vector<ITensor>(lstm_params, lstm_params.recurrent_to_input_weights(),
+                                                              recurrent_to_forget_weights, recurrent_to_cell_weights,
+                                                              recurrent_to_output_weights),
+                                        &_recurrent_weights, Window::DimY);
 
-    _concat_weights_forget_gate.configure(weights_vector, &_forget_gate_out5, Window::DimX);
-
-    _memory_group.manage(&_forget_gate_out4);
-    _fully_connected_forget_gate.configure(&_forget_gate_out1, &_forget_gate_out5,
-                                           (_is_layer_norm_lstm) ? nullptr : forget_gate_bias, &_forget_gate_out4);
-
-    _memory_group.manage(&_forget_gate_out2);
-    _forget_gate_out5.allocator()->allocate();
-
-    Tensor *forget_gate_out = &_forget_gate_out4;
-    if (lstm_params.has_peephole_opt())
-    {
-        _forget_gate_out3.allocator()->init(TensorInfo(cell_state_shape, 1, input->info()->data_type()));
-
-        _run_peephole_opt = true;
-        _memory_group.manage(&_forget_gate_out3);
-        _pixelwise_mul_forget_gate.configure(cell_state_in, lstm_params.cell_to_forget_weights(), &_forget_gate_out3, 1,
-                                             ConvertPolicy::SATURATE, RoundingPolicy::TO_ZERO);
-        _accum_forget_gate1.configure(&_forget_gate_out4, &_forget_gate_out3, &_forget_gate_out2,
-                                      ConvertPolicy::SATURATE);
-        _forget_gate_out3.allocator()->allocate();
-        _forget_gate_out4.allocator()->allocate();
-        forget_gate_out = &_forget_gate_out2;
-    }
-    else
+    _has_bias = !lstm_params.use_layer_norm();
+    if (_has_bias)
     {
-        _forget_gate_out2.allocator()->allocate();
+        _concat_bias.configure(gates_vector<ITensor>(lstm_params, lstm_params.input_gate_bias(), forget_gate_bias,
+                                                     cell_bias, output_gate_bias),
+                               &_bias, Window::DimX);
     }
-    if (_is_layer_norm_lstm)
+    const ITensor *bias = _has_bias ? &_bias : nullptr;
+
+    const std::vector<const ITensor *> cell_params =
+        cell_params_vector<ITensor>(lstm_params, forget_gate_bias, cell_bias, output_gate_bias);
+    _has_cell_params = !cell_params.empty();
+    if (_has_cell_params)
     {
-        _forget_layer_norm_out1.allocator()->init(TensorInfo(cell_state_shape, 1, input->info()->data_type()));
-        _forget_layer_norm_out2.allocator()->init(TensorInfo(cell_state_shape, 1, input->info()->data_type()));
-        _memory_group.manage(&_forget_layer_norm_out1);
-        _memory_group.manage(&_forget_layer_norm_out2);
-        _mean_std_norm_forget_gate.configure(forget_gate_out);
-        _pixelwise_mul_forget_gate_coeff.configure(forget_gate_out, lstm_params.forget_layer_norm_weights(),
-                                                   &_forget_layer_norm_out1, 1, ConvertPolicy::SATURATE,
-                                                   RoundingPolicy::TO_ZERO);
-        // forget_gate_out is going to be reassigned, so allocate the tensor that it was assigned to before
-        forget_gate_out->allocator()->allocate();
-        _accum_forget_gate_bias.configure(&_forget_layer_norm_out1, forget_gate_bias, &_forget_layer_norm_out2,
-                                          ConvertPolicy::SATURATE);
-        _forget_layer_norm_out1.allocator()->allocate();
-        forget_gate_out = &_forget_layer_norm_out2;
+        _concat_cell_params.configure(cell_params, &_cell_params, Window::DimY);
     }
-    _activation_forget_gate.configure(forget_gate_out, nullptr,
-                                      ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LOGISTIC));
-
-    // Configure block that calculates the input gate
-    // input_gate = Activation(input * input_to_input_weights + output_state * recurrent_to_input_weights + PixelWiseMul(cell_state, cell_to_input_weights) + input_gate_bias), without CIFG
-    // input_gate = 1 - forget_gate, with CIFG
-    // We optimize this as follows:
-    // input_gate = Activation((input,output_state) * (input_to_input_weights,recurrent_to_input_weights) + PixelWiseMul(cell_state, cell_to_input_weights) + input_gate_bias), without CIFG
-    _input_gate_out1.allocator()->init(TensorInfo(cell_state_shape, 1, input->info()->data_type()));
-    Tensor *input_gate_out = &_input_gate_out1;
-    if (lstm_params.has_cifg_opt())
+
+    if (_num_steps == 1)
     {
-        _memory_group.manage(&_input_gate_out1);
-        _ones.allocator()->init(TensorInfo(cell_state_shape, 1, input->info()->data_type()));
-        _subtract_input_gate.configure(&_ones, forget_gate_out, &_input_gate_out1, ConvertPolicy::SATURATE);
-        _ones.allocator()->allocate();
-        _run_cifg_opt = true;
+        _concat_weights.configure({&_input_weights, &_recurrent_weights}, &_weights, Window::DimX);
+
+        _gates.allocator()->init(TensorInfo(TensorShape(num_gate_units, num_batches), 1, data_type));
+        _memory_group.manage(&_inputs);
+        _concat_inputs.configure({input, output_state_in}, &_inputs, Window::DimX);
+        _memory_group.manage(&_gates);
+        _fully_connected_gates.configure(&_inputs, &_weights, bias, &_gates);
+        _inputs.allocator()->allocate();
     }
     else
     {
-        _input_gate_out3.allocator()->init(TensorInfo(cell_state_shape, 1, input->info()->data_type()));
-        _input_gate_out4.allocator()->init(TensorInfo(cell_state_shape, 1, input->info()->data_type()));
-
-        std::vector<const ITensor *> lstm_weights;
-        lstm_weights.emplace_back(lstm_params.input_to_input_weights());
-        lstm_weights.emplace_back(lstm_params.recurrent_to_input_weights());
-
-        _concat_weights_input_gate.configure(lstm_weights, &_input_gate_out2, Window::DimX);
-
-        _memory_group.manage(&_input_gate_out1);
-
-        _fully_connected_input_gate.configure(&_forget_gate_out1, &_input_gate_out2,
-                                              (_is_layer_norm_lstm) ? nullptr : lstm_params.input_gate_bias(),
-                                              &_input_gate_out3);
-        _input_gate_out2.allocator()->allocate();
-        input_gate_out = &_input_gate_out3;
-
-        if (_run_peephole_opt)
+        // The contribution of the input to the gates of all the timesteps is computed by one matrix multiplication,
+        // the input being seen as a single batch, so that each timestep only multiplies the output state by the
+        // recurrent weights, which stay in cache from one timestep to the next
+        const TensorShape step_gates_shape(num_gate_units, num_batches);
+        _sequence_input.allocator()->init(
+            TensorInfo(TensorShape(input->info()->dimension(0), num_batches * _num_steps), 1, data_type));
+        _gates.allocator()->init(TensorInfo(TensorShape(num_gate_units, num_batches * _num_steps), 1, data_type));
+        _recurrent_gates.allocator()->init(TensorInfo(step_gates_shape, 1, data_type));
+
+        _memory_group.manage(&_gates);
+        _fully_connected_gates.configure(&_sequence_input, &_input_weights, bias, &_gates);
+
+        // The output state of each timestep is written to output_state_out, which is the input of the next one
+        _memory_group.manage(&_recurrent_gates);
+        _fully_connected_recurrent_gates.configure(output_state_out, &_recurrent_weights, nullptr, &_recurrent_gates);
+
+        _step_gates.reserve(_num_steps);
+        _step_outputs.reserve(_num_steps);
+        for (unsigned int t = 0; t < _num_steps; ++t)
         {
-            _memory_group.manage(&_input_gate_out4);
-            _pixelwise_mul_input_gate.configure(cell_state_in, lstm_params.cell_to_input_weights(), &_input_gate_out4,
-                                                1, ConvertPolicy::SATURATE, RoundingPolicy::TO_ZERO);
-            _accum_input_gate1.configure(&_input_gate_out3, &_input_gate_out4, &_input_gate_out1,
-                                         ConvertPolicy::SATURATE);
-            _input_gate_out3.allocator()->allocate();
-            _input_gate_out4.allocator()->allocate();
-            input_gate_out = &_input_gate_out1;
-        }
-        else
-        {
-            _input_gate_out1.allocator()->allocate();
+            _step_gates.emplace_back(&_gates, step_gates_shape, Coordinates(0, t * num_batches));
+            _step_outputs.emplace_back(output, output_state_out->info()->tensor_shape(), Coordinates(0, 0, t));
         }
 
-        if (_is_layer_norm_lstm)
-        {
-            _input_layer_norm_out1.allocator()->init(TensorInfo(cell_state_shape, 1, input->info()->data_type()));
-            _input_layer_norm_out2.allocator()->init(TensorInfo(cell_state_shape, 1, input->info()->data_type()));
-            _memory_group.manage(&_input_layer_norm_out1);
-            _memory_group.manage(&_input_layer_norm_out2);
-            _mean_std_norm_input_gate.configure(input_gate_out);
-            _pixelwise_mul_input_gate_coeff.configure(input_gate_out, lstm_params.input_layer_norm_weights(),
-                                                      &_input_layer_norm_out1, 1, ConvertPolicy::SATURATE,
-                                                      RoundingPolicy::TO_ZERO);
-            // input_gate_out is going to be reassigned, so allocate the tensor that it was assigned to before
-            input_gate_out->allocator()->allocate();
-            _accum_input_gate_bias.configure(&_input_layer_norm_out1, lstm_params.input_gate_bias(),
-                                             &_input_layer_norm_out2, ConvertPolicy::SATURATE);
-            _input_layer_norm_out1.allocator()->allocate();
-            input_gate_out = &_input_layer_norm_out2;
-        }
-        _activation_input_gate.configure(input_gate_out, nullptr,
-                                         ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LOGISTIC));
+        // The same copy initializes the output state and writes it to the output after each timestep
+        _copy_state = std::make_unique<cpu::CpuCopy>();
+        _copy_state->configure(output_state_out->info(), _step_outputs[0].info());
     }
 
-    // Configure block that calculates the cell state
-    // cell_state = Clip((PixelwiseMul(input_gate, Activation(input * input_to_cell_weights + output_state_in * recurrent_to_cell_weights + cell_bias)) + PixelwiseMul(forget_gate, cell_state)), cell_threshold)
-    TensorShape cell_state1_shape = compute_transposed_shape(*recurrent_to_output_weights->info());
-    _cell_state_out1.allocator()->init(TensorInfo(cell_state_shape, 1, input->info()->data_type()));
-    _cell_state_out2.allocator()->init(TensorInfo(cell_state1_shape, 1, input->info()->data_type()));
-    _cell_state_out3.allocator()->init(TensorInfo(cell_state_shape, 1, input->info()->data_type()));
-    _cell_state_out4.allocator()->init(TensorInfo(cell_state_shape, 1, input->info()->data_type()));
-    _cell_state_out5.allocator()->init(TensorInfo(cell_state_shape, 1, input->info()->data_type()));
-
-    _memory_group.manage(&_cell_state_out1);
-    _fully_connected_cell_state.configure(input, input_to_cell_weights, (_is_layer_norm_lstm) ? nullptr : cell_bias,
-                                          &_cell_state_out1);
-    _memory_group.manage(&_cell_state_out2);
-    _transpose_cell_state.configure(recurrent_to_cell_weights, &_cell_state_out2);
-    _memory_group.manage(&_cell_state_out3);
-    _gemm_cell_state1.configure(output_state_in, &_cell_state_out2, nullptr, &_cell_state_out3, 1.f, 0.f);
-    _cell_state_out2.allocator()->allocate();
-    _memory_group.manage(&_cell_state_out4);
-    _accum_cell_state1.configure(&_cell_state_out1, &_cell_state_out3, &_cell_state_out4, ConvertPolicy::SATURATE);
-    Tensor *cell_state_out_ptr = &_cell_state_out4;
-    if (_is_layer_norm_lstm)
-    {
-        _cell_layer_norm_out1.allocator()->init(TensorInfo(cell_state_shape, 1, input->info()->data_type()));
-        _cell_layer_norm_out2.allocator()->init(TensorInfo(cell_state_shape, 1, input->info()->data_type()));
-        _memory_group.manage(&_cell_layer_norm_out1);
-        _memory_group.manage(&_cell_layer_norm_out2);
-        _mean_std_norm_cell_gate.configure(cell_state_out_ptr);
-        _pixelwise_mul_cell_gate_coeff.configure(cell_state_out_ptr, lstm_params.cell_layer_norm_weights(),
-                                                 &_cell_layer_norm_out1, 1, ConvertPolicy::SATURATE,
-                                                 RoundingPolicy::TO_ZERO);
-        // cell_state_out_ptr is going to be reassigned, so allocate the tensor that it was assigned to before
-        cell_state_out_ptr->allocator()->allocate();
-        _accum_cell_gate_bias.configure(&_cell_layer_norm_out1, cell_bias, &_cell_layer_norm_out2,
-                                        ConvertPolicy::SATURATE);
-        _cell_layer_norm_out1.allocator()->allocate();
-        cell_state_out_ptr = &_cell_layer_norm_out2;
-    }
-    _activation_cell_state.configure(cell_state_out_ptr, nullptr, activation_info);
-    _memory_group.manage(&_cell_state_out5);
-    _pixelwise_mul_cell_state1.configure(cell_state_out_ptr, input_gate_out, &_cell_state_out5, 1,
-                                         ConvertPolicy::SATURATE, RoundingPolicy::TO_ZERO);
-    cell_state_out_ptr->allocator()->allocate();
-    _pixelwise_mul_cell_state2.configure(forget_gate_out, cell_state_in, &_cell_state_out3, 1, ConvertPolicy::SATURATE,
-                                         RoundingPolicy::TO_ZERO);
-    _accum_cell_state2.configure(&_cell_state_out5, &_cell_state_out3, &_cell_state_out1, ConvertPolicy::SATURATE);
-    _cell_state_out3.allocator()->allocate();
-    _cell_state_out5.allocator()->allocate();
-    // Perform clipping
-    if (cell_threshold != 0.f)
+    // Configure the element-wise part of the cell, which writes the output state directly unless there is a projection
+    _has_projection_weights = lstm_params.has_projection();
+    ITensor *cell_output    = _has_projection_weights ? &_cell_output : output_state_out;
+    _cell_output.allocator()->init(TensorInfo(cell_state_shape, 1, data_type));
+    if (_has_projection_weights)
     {
-        _perform_cell_clipping = true;
-        _cell_clip.configure(&_cell_state_out1, nullptr,
-                             ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU,
-                                                 cell_threshold, -cell_threshold));
+        _memory_group.manage(&_cell_output);
     }
 
-    // Configure block that calculates the output
-    // output_state_out = Activation(input * input_to_output_weights + output_state_in * recurrent_to_output_weights + PixelWiseMul(cell_state, cell_to_output_weights) + output_gate_bias)
-    // We optimize this as follows:
-    // output_state_out = Activation( (input,output_state_in) * (input_to_output_weights, recurrent_to_output_weights) + PixelWiseMul(cell_state, cell_to_output_weights) + output_gate_bias)
-    _output1.allocator()->init(TensorInfo(cell_state_shape, 1, input->info()->data_type()));
-    _output4.allocator()->init(TensorInfo(cell_state_shape, 1, input->info()->data_type()));
-
-    std::vector<const ITensor *> in_out_weights;
-    in_out_weights.emplace_back(input_to_output_weights);
-    in_out_weights.emplace_back(recurrent_to_output_weights);
-
-    _concat_weights_output.configure(in_out_weights, &_output2, Window::DimX);
-    _memory_group.manage(&_output1);
-    _memory_group.manage(&_output4);
-
-    _fully_connected_output.configure(&_forget_gate_out1, &_output2, (_is_layer_norm_lstm) ? nullptr : output_gate_bias,
-                                      &_output4);
-
-    _output2.allocator()->allocate();
-    _forget_gate_out1.allocator()->allocate();
-
-    Tensor *output_gate_out = &_output4;
-    if (lstm_params.has_peephole_opt())
-    {
-        _output3.allocator()->init(TensorInfo(_cell_state_out1.info()->tensor_shape(), 1, input->info()->data_type()));
-
-        _memory_group.manage(&_output3);
-        _pixelwise_mul_output_state1.configure(&_cell_state_out1, lstm_params.cell_to_output_weights(), &_output3, 1,
-                                               ConvertPolicy::SATURATE, RoundingPolicy::TO_ZERO);
-        _accum_output1.configure(&_output4, &_output3, &_output1, ConvertPolicy::SATURATE);
-        _output4.allocator()->allocate();
-        output_gate_out = &_output1;
-
-        // Allocate intermediate buffers
-        _output3.allocator()->allocate();
-    }
-    else
-    {
-        _output1.allocator()->allocate();
-    }
-    if (_is_layer_norm_lstm)
+    _lstm_cell_kernel = std::make_unique<cpu::kernels::CpuLstmCellKernel>();
+    _lstm_cell_kernel->configure(_num_steps == 1 ? _gates.info() : _step_gates[0].info(),
+                                 _num_steps == 1 ? nullptr : _recurrent_gates.info(), cell_state_in->info(),
+                                 _has_cell_params ? _cell_params.info() : nullptr, cell_state_out->info(),
+                                 cell_output->info(), scratch_buffer->info(),
+                                 cell_kernel_info(lstm_params, activation_info, cell_threshold));
+    _gates.allocator()->allocate();
+    if (_num_steps > 1)
     {
-        _output_layer_norm_out1.allocator()->init(TensorInfo(cell_state_shape, 1, input->info()->data_type()));
-        _output_layer_norm_out2.allocator()->init(TensorInfo(cell_state_shape, 1, input->info()->data_type()));
-        _memory_group.manage(&_output_layer_norm_out1);
-        _memory_group.manage(&_output_layer_norm_out2);
-        _mean_std_norm_output_gate.configure(output_gate_out);
-        _pixelwise_mul_output_gate_coeff.configure(output_gate_out, lstm_params.output_layer_norm_weights(),
-                                                   &_output_layer_norm_out1, 1, ConvertPolicy::SATURATE,
-                                                   RoundingPolicy::TO_ZERO);
-        // output_gate_out is going to be reassigned, so allocate the tensor that it was assigned to before
-        output_gate_out->allocator()->allocate();
-        _accum_output_gate_bias.configure(&_output_layer_norm_out1, output_gate_bias, &_output_layer_norm_out2,
-                                          ConvertPolicy::SATURATE);
-        _output_layer_norm_out1.allocator()->allocate();
-        output_gate_out = &_output_layer_norm_out2;
+        _recurrent_gates.allocator()->allocate();
     }
-    _activation_output.configure(output_gate_out, nullptr,
-                                 ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LOGISTIC));
-
-    // Configure block that calculates the output state
-    /** lstm_res = PixelwiseMul(output, Activation(cell_state))
-     *
-     *                      -- Clip(lstm_res * projection_weights + projection_bias, projection_threshold) , if there is a projection
-     *                     /
-     *  output_state =  --
-     *                     \
-     *                      -- lstm_res , otherwise
-     */
-    ITensor *output_state_out_tmp = lstm_params.has_projection() ? &_output_state1 : output_state_out;
-    _cell_state_activation.allocator()->init(TensorInfo(cell_state_shape, 1, input->info()->data_type()));
-    _output_state1.allocator()->init(TensorInfo(cell_state_shape, 1, input->info()->data_type()));
-
-    _memory_group.manage(&_cell_state_activation);
-    _activation_output_state.configure(&_cell_state_out1, &_cell_state_activation, activation_info);
-    _pixelwise_mul_output_state2.configure(&_cell_state_activation, output_gate_out, output_state_out_tmp, 1,
-                                           ConvertPolicy::SATURATE, RoundingPolicy::TO_ZERO);
-    _cell_state_activation.allocator()->allocate();
 
-    if (lstm_params.has_projection())
+    if (_has_projection_weights)
     {
-        _has_projection_weights = true;
-        _fully_connected_output_state.configure(output_state_out_tmp, lstm_params.projection_weights(),
-                                                lstm_params.projection_bias(), output_state_out);
-        _output_state1.allocator()->allocate();
+        _fully_connected_projection.configure(&_cell_output, lstm_params.projection_weights(),
+                                              lstm_params.projection_bias(), output_state_out);
+        _cell_output.allocator()->allocate();
         // Perform clipping
         if (projection_threshold != 0.f)
         {
@@ -461,24 +313,25 @@ void NELSTMLayer::configure(const ITensor             *input,
         }
     }
 
-    // Copy cell state and output
-    _copy_cell_state.configure(&_cell_state_out1, cell_state_out);
-    _copy_output.configure(output_state_out, output);
+    if (_num_steps == 1)
+    {
+        _copy_output.configure(output_state_out, output);
+    }
 
-    // Vector for holding the tensors to store in scratch buffer
-    std::vector<const ITensor *> scratch_inputs;
-    if (!lstm_params.has_cifg_opt())
+    _input_weights.allocator()->allocate();
+    _recurrent_weights.allocator()->allocate();
+    if (_num_steps == 1)
+    {
+        _weights.allocator()->allocate();
+    }
+    if (_has_bias)
+    {
+        _bias.allocator()->allocate();
+    }
+    if (_has_cell_params)
     {
-        scratch_inputs.emplace_back(input_gate_out);
+        _cell_params.allocator()->allocate();
     }
-    scratch_inputs.emplace_back(&_cell_state_out1);
-    scratch_inputs.emplace_back(forget_gate_out);
-    scratch_inputs.emplace_back(output_gate_out);
-    _concat_scratch_buffer.configure(scratch_inputs, scratch_buffer, Window::DimX);
-    input_gate_out->allocator()->allocate();
-    _cell_state_out1.allocator()->allocate();
-    forget_gate_out->allocator()->allocate();
-    output_gate_out->allocator()->allocate();
 }
 
 Status NELSTMLayer::validate(const ITensorInfo             *input,
@@ -515,7 +368,7 @@ Status NELSTMLayer::validate(const ITensorInfo             *input,
         output_state_in, cell_state_in, scratch_buffer, output_state_out, cell_state_out, output);
 
     // Check dimensions
-    ARM_COMPUTE_RETURN_ERROR_ON(input->num_dimensions() > 2);
+    ARM_COMPUTE_RETURN_ERROR_ON(input->num_dimensions() > 3);
     ARM_COMPUTE_RETURN_ERROR_ON(input_to_forget_weights->num_dimensions() > 2);
     ARM_COMPUTE_RETURN_ERROR_ON(input_to_cell_weights->num_dimensions() > 2);
     ARM_COMPUTE_RETURN_ERROR_ON(input_to_output_weights->num_dimensions() > 2);
@@ -530,12 +383,22 @@ Status NELSTMLayer::validate(const ITensorInfo             *input,
     ARM_COMPUTE_RETURN_ERROR_ON(scratch_buffer->num_dimensions() > 2);
     ARM_COMPUTE_RETURN_ERROR_ON(output_state_out->num_dimensions() > 2);
     ARM_COMPUTE_RETURN_ERROR_ON(cell_state_out->num_dimensions() > 2);
-    ARM_COMPUTE_RETURN_ERROR_ON(output->num_dimensions() > 2);
+    ARM_COMPUTE_RETURN_ERROR_ON(output->num_dimensions() > 3);
     ARM_COMPUTE_RETURN_ERROR_ON(cell_bias->dimension(0) * 4 != scratch_buffer->dimension(0) &&
                                 cell_bias->dimension(0) * 3 != scratch_buffer->dimension(0));
 
+    const DataType     data_type   = input->data_type();
     const unsigned int num_batches = input->dimension(1);
     const unsigned int num_cells   = input_to_output_weights->dimension(1);
+    const unsigned int num_steps   = input->dimension(2);
+
+    if (num_steps > 1)
+    {
+        // The input of all the timesteps is read as a single batch
+        ARM_COMPUTE_RETURN_ERROR_ON(input->has_padding());
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(
+            output->tensor_shape(), TensorShape(output_state_out->dimension(0), num_batches, num_steps));
+    }
 
     if (lstm_params.use_layer_norm())
     {
@@ -574,48 +437,7 @@ Status NELSTMLayer::validate(const ITensorInfo             *input,
         ARM_COMPUTE_RETURN_ERROR_ON(lstm_params.cell_to_output_weights()->num_dimensions() > 1);
     }
 
-    TensorShape      units_out_transposed_shape = compute_transposed_shape(*recurrent_to_output_weights);
-    TensorShape      num_units_transposed_shape = compute_transposed_shape(*forget_gate_bias);
-    const TensorInfo units_out_transposed_info  = TensorInfo(units_out_transposed_shape, 1, input->data_type());
-    const TensorInfo num_units_transposed_info  = TensorInfo(num_units_transposed_shape, 1, input->data_type());
-
-    TensorInfo input_gate      = TensorInfo(TensorShape(num_cells, num_batches), 1, input->data_type());
-    TensorInfo forget_gate     = TensorInfo(TensorShape(num_cells, num_batches), 1, input->data_type());
-    TensorInfo output_gate_tmp = TensorInfo(TensorShape(num_cells, num_batches), 1, input->data_type());
-    TensorInfo cell_state_tmp  = TensorInfo(TensorShape(num_cells, num_batches), 1, input->data_type());
-
-    std::vector<const ITensorInfo *> inputs_vector;
-    inputs_vector.emplace_back(input);
-    inputs_vector.emplace_back(output_state_in);
-    const TensorShape concat_shape = arm_compute::misc::shape_calculator::calculate_concatenate_shape(inputs_vector, 0);
-    TensorInfo        forget_gate_concat = TensorInfo(concat_shape, 1, input->data_type());
-    ARM_COMPUTE_RETURN_ON_ERROR(NEConcatenateLayer::validate(inputs_vector, &forget_gate_concat, Window::DimX));
-
-    // Validate forget gate
-    ARM_COMPUTE_RETURN_ON_ERROR(NEFullyConnectedLayer::validate(
-        input, input_to_forget_weights, (lstm_params.use_layer_norm()) ? nullptr : forget_gate_bias, &forget_gate));
-
-    if (lstm_params.has_peephole_opt())
-    {
-        ARM_COMPUTE_RETURN_ON_ERROR(
-            NEPixelWiseMultiplication::validate(cell_state_in, lstm_params.cell_to_forget_weights(), &forget_gate, 1,
-                                                ConvertPolicy::SATURATE, RoundingPolicy::TO_ZERO));
-        ARM_COMPUTE_RETURN_ON_ERROR(
-            NEArithmeticAddition::validate(&forget_gate, &forget_gate, &forget_gate, ConvertPolicy::SATURATE));
-    }
-    if (lstm_params.use_layer_norm())
-    {
-        ARM_COMPUTE_RETURN_ON_ERROR(NEMeanStdDevNormalizationLayer::validate(&forget_gate));
-        ARM_COMPUTE_RETURN_ON_ERROR(
-            NEPixelWiseMultiplication::validate(&forget_gate, lstm_params.forget_layer_norm_weights(), &forget_gate, 1,
-                                                ConvertPolicy::SATURATE, RoundingPolicy::TO_ZERO));
-        ARM_COMPUTE_RETURN_ON_ERROR(
-            NEArithmeticAddition::validate(&forget_gate, forget_gate_bias, &forget_gate, ConvertPolicy::SATURATE));
-    }
-    ARM_COMPUTE_RETURN_ON_ERROR(NEActivationLayer::validate(
-        &forget_gate, &forget_gate, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LOGISTIC)));
-
-    // Validate input gate
+    // Check input gate
     if (!lstm_params.has_cifg_opt())
     {
         ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(lstm_params.input_to_input_weights(),
@@ -623,117 +445,87 @@ Status NELSTMLayer::validate(const ITensorInfo             *input,
         ARM_COMPUTE_RETURN_ERROR_ON(lstm_params.input_to_input_weights()->num_dimensions() > 2);
         ARM_COMPUTE_RETURN_ERROR_ON(lstm_params.recurrent_to_input_weights()->num_dimensions() > 2);
         ARM_COMPUTE_RETURN_ERROR_ON(lstm_params.input_gate_bias()->num_dimensions() > 1);
-
-        std::vector<const ITensorInfo *> lstm_weights;
-        lstm_weights.emplace_back(lstm_params.input_to_input_weights());
-        lstm_weights.emplace_back(lstm_params.recurrent_to_input_weights());
-        TensorShape lstm_weights_concat_shape =
-            arm_compute::misc::shape_calculator::calculate_concatenate_shape(lstm_weights, 0);
-        TensorInfo lstm_gate_concat = TensorInfo(lstm_weights_concat_shape, 1, input->data_type());
-        ARM_COMPUTE_RETURN_ON_ERROR(NEConcatenateLayer::validate(lstm_weights, &lstm_gate_concat, Window::DimX));
-        ARM_COMPUTE_RETURN_ON_ERROR(NEFullyConnectedLayer::validate(
-            input, lstm_params.input_to_input_weights(),
-            (lstm_params.use_layer_norm()) ? nullptr : lstm_params.input_gate_bias(), &input_gate));
-
         if (lstm_params.has_peephole_opt())
         {
             ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(lstm_params.cell_to_input_weights());
             ARM_COMPUTE_RETURN_ERROR_ON(lstm_params.cell_to_input_weights()->num_dimensions() > 1);
-            ARM_COMPUTE_RETURN_ON_ERROR(
-                NEPixelWiseMultiplication::validate(cell_state_in, lstm_params.cell_to_input_weights(), &input_gate, 1,
-                                                    ConvertPolicy::SATURATE, RoundingPolicy::TO_ZERO));
-            ARM_COMPUTE_RETURN_ON_ERROR(
-                NEArithmeticAddition::validate(&input_gate, &input_gate, &input_gate, ConvertPolicy::SATURATE));
         }
-
-        if (lstm_params.use_layer_norm())
-        {
-            ARM_COMPUTE_RETURN_ON_ERROR(NEMeanStdDevNormalizationLayer::validate(&input_gate));
-            ARM_COMPUTE_RETURN_ON_ERROR(
-                NEPixelWiseMultiplication::validate(&input_gate, lstm_params.input_layer_norm_weights(), &input_gate, 1,
-                                                    ConvertPolicy::SATURATE, RoundingPolicy::TO_ZERO));
-            ARM_COMPUTE_RETURN_ON_ERROR(NEArithmeticAddition::validate(&input_gate, lstm_params.input_gate_bias(),
-                                                                       &input_gate, ConvertPolicy::SATURATE));
-        }
-        ARM_COMPUTE_RETURN_ON_ERROR(NEActivationLayer::validate(
-            &input_gate, nullptr, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LOGISTIC)));
-    }
-    else
-    {
-        ARM_COMPUTE_RETURN_ON_ERROR(
-            NEArithmeticSubtraction::validate(&forget_gate, &forget_gate, &forget_gate, ConvertPolicy::SATURATE));
     }
 
-    // Validate cell state
-    ARM_COMPUTE_RETURN_ON_ERROR(NEFullyConnectedLayer::validate(
-        input, input_to_cell_weights, (lstm_params.use_layer_norm()) ? nullptr : cell_bias, &cell_state_tmp));
-    ARM_COMPUTE_RETURN_ON_ERROR(
-        NEGEMM::validate(output_state_in, &units_out_transposed_info, nullptr, &cell_state_tmp, 1.f, 0.f, GEMMInfo()));
+    const unsigned int num_gate_units = (lstm_params.has_cifg_opt() ? 3 : 4) * num_cells;
+    const TensorInfo   cell_state_info(TensorShape(num_cells, num_batches), 1, data_type);
+    const TensorInfo   step_gates_info(TensorShape(num_gate_units, num_batches), 1, data_type);
+
+    // Validate the concatenation of the weights of the gates
+    const std::vector<const ITensorInfo *> input_weights =
+        gates_vector<ITensorInfo>(lstm_params, lstm_params.input_to_input_weights(), input_to_forget_weights,
+                                  input_to_cell_weights, input_to_output_weights);
+    const std::vector<const ITensorInfo *> recurrent_weights =
+        gates_vector<ITensorInfo>(lstm_params, lstm_params.recurrent_to_input_weights(), recurrent_to_forget_weights,
+                                  recurrent_to_cell_weights, recurrent_to_output_weights);
+    const TensorInfo input_weights_concat(calculate_concatenate_shape(input_weights, 1), 1, data_type);
+    const TensorInfo recurrent_weights_concat(calculate_concatenate_shape(recurrent_weights, 1), 1, data_type);
+    ARM_COMPUTE_RETURN_ON_ERROR(NEConcatenateLayer::validate(input_weights, &input_weights_concat, Window::DimY));
     ARM_COMPUTE_RETURN_ON_ERROR(
-        NEArithmeticAddition::validate(&cell_state_tmp, &cell_state_tmp, &cell_state_tmp, ConvertPolicy::SATURATE));
-    if (lstm_params.use_layer_norm())
+        NEConcatenateLayer::validate(recurrent_weights, &recurrent_weights_concat, Window::DimY));
+
+    TensorInfo bias_concat{};
+    if (!lstm_params.use_layer_norm())
     {
-        ARM_COMPUTE_RETURN_ON_ERROR(NEMeanStdDevNormalizationLayer::validate(&cell_state_tmp));
-        ARM_COMPUTE_RETURN_ON_ERROR(
-            NEPixelWiseMultiplication::validate(&cell_state_tmp, lstm_params.cell_layer_norm_weights(), &cell_state_tmp,
-                                                1, ConvertPolicy::SATURATE, RoundingPolicy::TO_ZERO));
-        ARM_COMPUTE_RETURN_ON_ERROR(
-            NEArithmeticAddition::validate(&cell_state_tmp, cell_bias, &cell_state_tmp, ConvertPolicy::SATURATE));
+        const std::vector<const ITensorInfo *> biases = gates_vector<ITensorInfo>(
+            lstm_params, lstm_params.input_gate_bias(), forget_gate_bias, cell_bias, output_gate_bias);
+        bias_concat = TensorInfo(calculate_concatenate_shape(biases, 0), 1, data_type);
+        ARM_COMPUTE_RETURN_ON_ERROR(NEConcatenateLayer::validate(biases, &bias_concat, Window::DimX));
     }
-    ARM_COMPUTE_RETURN_ON_ERROR(NEActivationLayer::validate(&cell_state_tmp, nullptr, activation_info));
-    ARM_COMPUTE_RETURN_ON_ERROR(NEPixelWiseMultiplication::validate(&cell_state_tmp, &input_gate, &cell_state_tmp, 1,
-                                                                    ConvertPolicy::SATURATE, RoundingPolicy::TO_ZERO));
-    ARM_COMPUTE_RETURN_ON_ERROR(NEPixelWiseMultiplication::validate(&cell_state_tmp, &forget_gate, &cell_state_tmp, 1,
-                                                                    ConvertPolicy::SATURATE, RoundingPolicy::TO_ZERO));
-    ARM_COMPUTE_RETURN_ON_ERROR(
-        NEArithmeticAddition::validate(&cell_state_tmp, &cell_state_tmp, &cell_state_tmp, ConvertPolicy::SATURATE));
-    if (cell_threshold != 0.f)
+    const ITensorInfo *bias = lstm_params.use_layer_norm() ? nullptr : &bias_concat;
+
+    const std::vector<const ITensorInfo *> cell_params =
+        cell_params_vector<ITensorInfo>(lstm_params, forget_gate_bias, cell_bias, output_gate_bias);
+    TensorInfo cell_params_concat{};
+    if (!cell_params.empty())
     {
-        ARM_COMPUTE_RETURN_ON_ERROR(
-            NEActivationLayer::validate(&cell_state_tmp, nullptr,
-                                        ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU,
-                                                            cell_threshold, -cell_threshold)));
+        cell_params_concat = TensorInfo(calculate_concatenate_shape(cell_params, 1), 1, data_type);
+        ARM_COMPUTE_RETURN_ON_ERROR(NEConcatenateLayer::validate(cell_params, &cell_params_concat, Window::DimY));
     }
 
-    // Validate output gate tmp
-    std::vector<const ITensorInfo *> in_out_weights;
-    in_out_weights.emplace_back(input_to_output_weights);
-    in_out_weights.emplace_back(recurrent_to_output_weights);
-    TensorShape in_out_weights_concat_shape =
-        arm_compute::misc::shape_calculator::calculate_concatenate_shape(in_out_weights, 0);
-    TensorInfo in_out_gate_concat = TensorInfo(in_out_weights_concat_shape, 1, input->data_type());
-    ARM_COMPUTE_RETURN_ON_ERROR(NEConcatenateLayer::validate(in_out_weights, &in_out_gate_concat, Window::DimX));
+    // Validate the matrix multiplications computing the gates
+    if (num_steps == 1)
+    {
+        std::vector<const ITensorInfo *> inputs_vector;
+        inputs_vector.emplace_back(input);
+        inputs_vector.emplace_back(output_state_in);
+        const TensorInfo inputs_concat(calculate_concatenate_shape(inputs_vector, 0), 1, data_type);
+        ARM_COMPUTE_RETURN_ON_ERROR(NEConcatenateLayer::validate(inputs_vector, &inputs_concat, Window::DimX));
 
-    ARM_COMPUTE_RETURN_ON_ERROR(NEFullyConnectedLayer::validate(
-        input, input_to_output_weights, (lstm_params.use_layer_norm()) ? nullptr : output_gate_bias, &output_gate_tmp));
+        const std::vector<const ITensorInfo *> weights_vector{&input_weights_concat, &recurrent_weights_concat};
+        const TensorInfo weights_concat(calculate_concatenate_shape(weights_vector, 0), 1, data_type);
+        ARM_COMPUTE_RETURN_ON_ERROR(NEConcatenateLayer::validate(weights_vector, &weights_concat, Window::DimX));
 
-    if (lstm_params.has_peephole_opt())
-    {
         ARM_COMPUTE_RETURN_ON_ERROR(
-            NEPixelWiseMultiplication::validate(&cell_state_tmp, lstm_params.cell_to_output_weights(), &output_gate_tmp,
-                                                1, ConvertPolicy::SATURATE, RoundingPolicy::TO_ZERO));
-        ARM_COMPUTE_RETURN_ON_ERROR(NEArithmeticAddition::validate(&output_gate_tmp, &output_gate_tmp, &output_gate_tmp,
-                                                                   ConvertPolicy::SATURATE));
+            NEFullyConnectedLayer::validate(&inputs_concat, &weights_concat, bias, &step_gates_info));
     }
-    if (lstm_params.use_layer_norm())
+    else
     {
-        ARM_COMPUTE_RETURN_ON_ERROR(NEMeanStdDevNormalizationLayer::validate(&output_gate_tmp));
+        const TensorInfo sequence_input(TensorShape(input->dimension(0), num_batches * num_steps), 1, data_type);
+        const TensorInfo gates(TensorShape(num_gate_units, num_batches * num_steps), 1, data_type);
         ARM_COMPUTE_RETURN_ON_ERROR(
-            NEPixelWiseMultiplication::validate(&output_gate_tmp, lstm_params.output_layer_norm_weights(),
-                                                &output_gate_tmp, 1, ConvertPolicy::SATURATE, RoundingPolicy::TO_ZERO));
-        ARM_COMPUTE_RETURN_ON_ERROR(NEArithmeticAddition::validate(&output_gate_tmp, output_gate_bias, &output_gate_tmp,
-                                                                   ConvertPolicy::SATURATE));
+            NEFullyConnectedLayer::validate(&sequence_input, &input_weights_concat, bias, &gates));
+        ARM_COMPUTE_RETURN_ON_ERROR(cpu::CpuCopy::validate(output_state_in, output_state_out));
+        ARM_COMPUTE_RETURN_ON_ERROR(NEFullyConnectedLayer::validate(output_state_out, &recurrent_weights_concat,
+                                                                    nullptr, &step_gates_info));
     }
-    ARM_COMPUTE_RETURN_ON_ERROR(NEActivationLayer::validate(
-        &output_gate_tmp, nullptr, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LOGISTIC)));
+
+    // Validate the element-wise part of the cell
+    const ITensorInfo *cell_output = lstm_params.has_projection() ? &cell_state_info : output_state_out;
+    ARM_COMPUTE_RETURN_ON_ERROR(cpu::kernels::CpuLstmCellKernel::validate(
+        &step_gates_info, num_steps == 1 ? nullptr : &step_gates_info, cell_state_in,
+        cell_params.empty() ? nullptr : &cell_params_concat, cell_state_out, cell_output, scratch_buffer,
+        cell_kernel_info(lstm_params, activation_info, cell_threshold)));
 
     // Validate output state
-    ARM_COMPUTE_RETURN_ON_ERROR(NEActivationLayer::validate(&cell_state_tmp, &cell_state_tmp, activation_info));
-    ARM_COMPUTE_RETURN_ON_ERROR(NEPixelWiseMultiplication::validate(
-        &cell_state_tmp, &output_gate_tmp, &output_gate_tmp, 1, ConvertPolicy::SATURATE, RoundingPolicy::TO_ZERO));
     if (lstm_params.has_projection())
     {
-        ARM_COMPUTE_RETURN_ON_ERROR(NEFullyConnectedLayer::validate(&output_gate_tmp, lstm_params.projection_weights(),
+        ARM_COMPUTE_RETURN_ON_ERROR(NEFullyConnectedLayer::validate(&cell_state_info, lstm_params.projection_weights(),
                                                                     lstm_params.projection_bias(), output_state_out));
         if (projection_threshold != 0.f)
         {
@@ -745,141 +537,100 @@ Status NELSTMLayer::validate(const ITensorInfo             *input,
     }
 
     // Validate copy kernel
-    ARM_COMPUTE_RETURN_ON_ERROR(NECopy::validate(&cell_state_tmp, cell_state_out));
-    ARM_COMPUTE_RETURN_ON_ERROR(NECopy::validate(output_state_out, output));
-
-    // Validate scratch concatenation
-    std::vector<const ITensorInfo *> inputs_vector_info_raw;
-    if (!lstm_params.has_cifg_opt())
+    if (num_steps == 1)
     {
-        inputs_vector_info_raw.push_back(&input_gate);
+        ARM_COMPUTE_RETURN_ON_ERROR(NECopy::validate(output_state_out, output));
     }
-    inputs_vector_info_raw.push_back(&cell_state_tmp);
-    inputs_vector_info_raw.push_back(&forget_gate);
-    inputs_vector_info_raw.push_back(&output_gate_tmp);
-
-    ARM_COMPUTE_RETURN_ON_ERROR(NEConcatenateLayer::validate(inputs_vector_info_raw, scratch_buffer, Window::DimX));
     return Status{};
 }
 
-void NELSTMLayer::run()
+void NELSTMLayer::run_cell(const ITensor *gates,
+                           const ITensor *recurrent_gates,
+                           const ITensor *cell_state_in,
+                           bool           is_last_step)
 {
-    prepare();
-
-    MemoryGroupResourceScope scope_mg(_memory_group);
-
-    _concat_inputs_forget_gate.run();
-    _fully_connected_forget_gate.run();
-
-    if (_run_peephole_opt)
+    ITensorPack pack = {{TensorType::ACL_SRC_0, gates},
+                        {TensorType::ACL_SRC_2, cell_state_in},
+                        {TensorType::ACL_DST_0, _cell_state_out},
+                        {TensorType::ACL_DST_1, _has_projection_weights ? &_cell_output : _output_state_out}};
+    if (recurrent_gates != nullptr)
     {
-        _pixelwise_mul_forget_gate.run();
-        _accum_forget_gate1.run();
+        pack.add_const_tensor(TensorType::ACL_SRC_1, recurrent_gates);
     }
-    if (_is_layer_norm_lstm)
+    if (_has_cell_params)
     {
-        _mean_std_norm_forget_gate.run();
-        _pixelwise_mul_forget_gate_coeff.run();
-        _accum_forget_gate_bias.run();
+        pack.add_const_tensor(TensorType::ACL_SRC_3, &_cell_params);
     }
-    _activation_forget_gate.run();
-
-    if (_run_cifg_opt)
+    if (is_last_step)
     {
-        if (_ones.info()->data_type() == DataType::F16)
-        {
-            std::fill_n(reinterpret_cast<half *>(_ones.buffer()),
-                        _ones.info()->total_size() / _ones.info()->element_size(), 1);
-        }
-        else
-        {
-            std::fill_n(reinterpret_cast<float *>(_ones.buffer()),
-                        _ones.info()->total_size() / _ones.info()->element_size(), 1);
-        }
-        _subtract_input_gate.run();
+        pack.add_tensor(TensorType::ACL_DST_2, _scratch_buffer);
     }
-    else
-    {
-        _fully_connected_input_gate.run();
-
-        if (_run_peephole_opt)
-        {
-            _pixelwise_mul_input_gate.run();
-            _accum_input_gate1.run();
-        }
+    NEScheduler::get().schedule_op(_lstm_cell_kernel.get(), Window::DimY, _lstm_cell_kernel->window(), pack);
 
-        if (_is_layer_norm_lstm)
+    if (_has_projection_weights)
+    {
+        _fully_connected_projection.run();
+        if (_perform_projection_clipping)
         {
-            _mean_std_norm_input_gate.run();
-            _pixelwise_mul_input_gate_coeff.run();
-            _accum_input_gate_bias.run();
+            _projection_clip.run();
         }
-        _activation_input_gate.run();
-    }
-
-    _fully_connected_cell_state.run();
-    _transpose_cell_state.run();
-    _gemm_cell_state1.run();
-    _accum_cell_state1.run();
-    if (_is_layer_norm_lstm)
-    {
-        _mean_std_norm_cell_gate.run();
-        _pixelwise_mul_cell_gate_coeff.run();
-        _accum_cell_gate_bias.run();
     }
+}
 
-    _activation_cell_state.run();
-    _pixelwise_mul_cell_state1.run();
-    _pixelwise_mul_cell_state2.run();
-    _accum_cell_state2.run();
+void NELSTMLayer::run()
+{
+    prepare();
 
-    if (_perform_cell_clipping)
-    {
-        _cell_clip.run();
-    }
+    MemoryGroupResourceScope scope_mg(_memory_group);
 
-    _fully_connected_output.run();
-    if (_run_peephole_opt)
+    if (_num_steps == 1)
     {
-        _pixelwise_mul_output_state1.run();
-        _accum_output1.run();
+        _concat_inputs.run();
+        _fully_connected_gates.run();
+        run_cell(&_gates, nullptr, _cell_state_in, true);
+        _copy_output.run();
+        return;
     }
-    if (_is_layer_norm_lstm)
-    {
-        _mean_std_norm_output_gate.run();
-        _pixelwise_mul_output_gate_coeff.run();
-        _accum_output_gate_bias.run();
-    }
-    _activation_output.run();
 
-    _activation_output_state.run();
-    _pixelwise_mul_output_state2.run();
+    _sequence_input.allocator()->import_memory(_input->buffer() + _input->info()->offset_first_element_in_bytes());
+    _fully_connected_gates.run();
 
-    if (_has_projection_weights)
+    ITensorPack copy_pack = {{TensorType::ACL_SRC, _output_state_in}, {TensorType::ACL_DST, _output_state_out}};
+    _copy_state->run(copy_pack);
+    for (unsigned int t = 0; t < _num_steps; ++t)
     {
-        _fully_connected_output_state.run();
-        if (_perform_projection_clipping)
-        {
-            _projection_clip.run();
-        }
-    }
+        // The cell state is updated in place after the first timestep
+        _fully_connected_recurrent_gates.run();
+        run_cell(&_step_gates[t], &_recurrent_gates, t == 0 ? _cell_state_in : _cell_state_out, t == _num_steps - 1);
 
-    _copy_cell_state.run();
-    _copy_output.run();
-
-    _concat_scratch_buffer.run();
+        copy_pack = {{TensorType::ACL_SRC, _output_state_out}, {TensorType::ACL_DST, &_step_outputs[t]}};
+        _copy_state->run(copy_pack);
+    }
 }
 
 void NELSTMLayer::prepare()
 {
     if (!_is_prepared)
     {
-        _concat_weights_forget_gate.run();
-        if (!_run_cifg_opt)
+        _concat_input_weights.run();
+        _concat_recurrent_weights.run();
+        if (_has_bias)
+        {
+            _concat_bias.run();
+        }
+        if (_has_cell_params)
+        {
+            _concat_cell_params.run();
+        }
+        if (_num_steps == 1)
         {
-            _concat_weights_input_gate.run();
+            // A single timestep only uses the concatenation of the input and recurrent weights
+            _concat_weights.run();
+            _input_weights.mark_as_unused();
+            _input_weights.allocator()->free();
+            _recurrent_weights.mark_as_unused();
+            _recurrent_weights.allocator()->free();
         }
-        _concat_weights_output.run();
         _is_prepared = true;
     }
 }
@@ -23,11 +23,19 @@
  */
 #include "arm_compute/runtime/NEON/functions/NEMeanStdDevNormalizationLayer.h"
 
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+
 #include "src/common/utils/Log.h"
 #include "src/core/NEON/kernels/NEMeanStdDevNormalizationKernel.h"
 
 namespace arm_compute
 {
+NEMeanStdDevNormalizationLayer::NEMeanStdDevNormalizationLayer() : _kernel{}, _is_dynamic(false)
+{
+}
+
 NEMeanStdDevNormalizationLayer::~NEMeanStdDevNormalizationLayer() = default;
 
 void NEMeanStdDevNormalizationLayer::configure(ITensor *input, ITensor *output, float epsilon)
@@ -36,11 +44,21 @@ void NEMeanStdDevNormalizationLayer::configure(ITensor *input, ITensor *output,
 
     auto k = std::make_unique<NEMeanStdDevNormalizationKernel>();
     k->configure(input, output, epsilon);
-    _kernel = std::move(k);
+    _kernel     = std::move(k);
+    _is_dynamic = input->info()->is_dynamic();
 }
 
 Status NEMeanStdDevNormalizationLayer::validate(const ITensorInfo *input, const ITensorInfo *output, float epsilon)
 {
     return NEMeanStdDevNormalizationKernel::validate(input, output, epsilon);
 }
+
+void NEMeanStdDevNormalizationLayer::run()
+{
+    if (_is_dynamic)
+    {
+        _kernel->update_window();
+    }
+    NEScheduler::get().schedule(_kernel.get(), Window::DimY);
+}
 } // namespace arm_compute
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/functions/NEPagedMatMul.h"
+
+#include "arm_compute/core/Validate.h"
+
+#include "src/common/utils/Log.h"
+#include "src/cpu/operators/CpuPagedMatMul.h"
+
+namespace arm_compute
+{
+struct NEPagedMatMul::Impl
+{
+    std::unique_ptr<cpu::CpuPagedMatMul> op{nullptr};
+    ITensorPack                          run_pack{};
+};
+
+NEPagedMatMul::NEPagedMatMul() : _impl(std::make_unique<Impl>())
+{
+}
+
+NEPagedMatMul::NEPagedMatMul(NEPagedMatMul &&)            = default;
+NEPagedMatMul &NEPagedMatMul::operator=(NEPagedMatMul &&) = default;
+NEPagedMatMul::~NEPagedMatMul()                           = default;
+
+void NEPagedMatMul::configure(const ITensor    *lhs,
+                              const ITensor    *cache,
+                              const ITensor    *block_table,
+                              const ITensor    *seq_lens,
+                              ITensor          *dst,
+                              const MatMulInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(lhs, cache, block_table, seq_lens, dst);
+    ARM_COMPUTE_LOG_PARAMS(lhs, cache, block_table, seq_lens, dst);
+
+    _impl->op = std::make_unique<cpu::CpuPagedMatMul>();
+    _impl->op->configure(lhs->info(), cache->info(), block_table->info(), seq_lens->info(), dst->info(), info);
+
+    _impl->run_pack = {{TensorType::ACL_SRC_0, lhs},
+                       {TensorType::ACL_SRC_1, cache},
+                       {TensorType::ACL_SRC_2, block_table},
+                       {TensorType::ACL_SRC_3, seq_lens},
+                       {TensorType::ACL_DST, dst}};
+}
+
+Status NEPagedMatMul::validate(const ITensorInfo *lhs,
+                               const ITensorInfo *cache,
+                               const ITensorInfo *block_table,
+                               const ITensorInfo *seq_lens,
+                               const ITensorInfo *dst,
+                               const MatMulInfo  &info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(lhs, cache, block_table, seq_lens, dst);
+    ARM_COMPUTE_RETURN_ON_ERROR(cpu::CpuPagedMatMul::validate(lhs, cache, block_table, seq_lens, dst, info));
+    return Status{};
+}
+
+void NEPagedMatMul::run()
+{
+    _impl->op->run(_impl->run_pack);
+}
+} // namespace arm_compute
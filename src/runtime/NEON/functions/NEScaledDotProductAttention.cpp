@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/functions/NEScaledDotProductAttention.h"
+
+#include "arm_compute/core/Validate.h"
+
+#include "src/common/utils/Log.h"
+#include "src/cpu/operators/CpuScaledDotProductAttention.h"
+
+namespace arm_compute
+{
+struct NEScaledDotProductAttention::Impl
+{
+    std::unique_ptr<cpu::CpuScaledDotProductAttention> op{nullptr};
+    ITensorPack                                        run_pack{};
+};
+
+NEScaledDotProductAttention::NEScaledDotProductAttention() : _impl(std::make_unique<Impl>())
+{
+}
+
+NEScaledDotProductAttention::NEScaledDotProductAttention(NEScaledDotProductAttention &&)            = default;
+NEScaledDotProductAttention &NEScaledDotProductAttention::operator=(NEScaledDotProductAttention &&) = default;
+NEScaledDotProductAttention::~NEScaledDotProductAttention()                                         = default;
+
+void NEScaledDotProductAttention::configure(const ITensor                       *query,
+                                            const ITensor                       *key,
+                                            const ITensor                       *value,
+                                            const ITensor                       *mask,
+                                            ITensor                             *dst,
+                                            const ScaledDotProductAttentionInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(query, key, value, dst);
+    ARM_COMPUTE_LOG_PARAMS(query, key, value, mask, dst);
+
+    _impl->op = std::make_unique<cpu::CpuScaledDotProductAttention>();
+    _impl->op->configure(query->info(), key->info(), value->info(), mask != nullptr ? mask->info() : nullptr,
+                         dst->info(), info);
+
+    _impl->run_pack = {{TensorType::ACL_SRC_0, query},
+                       {TensorType::ACL_SRC_1, key},
+                       {TensorType::ACL_SRC_2, value},
+                       {TensorType::ACL_SRC_3, mask},
+                       {TensorType::ACL_DST, dst}};
+}
+
+Status NEScaledDotProductAttention::validate(const ITensorInfo                   *query,
+                                             const ITensorInfo                   *key,
+                                             const ITensorInfo                   *value,
+                                             const ITensorInfo                   *mask,
+                                             const ITensorInfo                   *dst,
+                                             const ScaledDotProductAttentionInfo &info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(query, key, value, dst);
+    ARM_COMPUTE_RETURN_ON_ERROR(cpu::CpuScaledDotProductAttention::validate(query, key, value, mask, dst, info));
+    return Status{};
+}
+
+void NEScaledDotProductAttention::run()
+{
+    _impl->op->run(_impl->run_pack);
+}
+} // namespace arm_compute
@@ -24,6 +24,7 @@
 #include "arm_compute/runtime/NEON/functions/NEScatter.h"
 
 #include "arm_compute/function_info/ScatterInfo.h"
+#include "arm_compute/runtime/MemoryGroup.h"
 #include "arm_compute/runtime/Tensor.h"
 
 #include "src/core/helpers/MemoryHelpers.h"
@@ -46,18 +47,28 @@ struct NEScatter::Impl
 NEScatter::NEScatter() : _impl(std::make_unique<Impl>())
 {
 }
-NEScatter::~NEScatter() = default;
+NEScatter::NEScatter(NEScatter &&)            = default;
+NEScatter &NEScatter::operator=(NEScatter &&) = default;
+NEScatter::~NEScatter()                       = default;
 
 void NEScatter::configure(
     const ITensor *src, const ITensor *updates, const ITensor *indices, ITensor *output, const ScatterInfo &info)
 {
-    ARM_COMPUTE_UNUSED(src);
-    ARM_COMPUTE_UNUSED(updates);
-    ARM_COMPUTE_UNUSED(indices);
-    ARM_COMPUTE_UNUSED(output);
-    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(updates, indices, output);
 
-    ARM_COMPUTE_ERROR_ON_NULLPTR(src, updates, indices, output);
+    _impl->src     = src;
+    _impl->updates = updates;
+    _impl->indices = indices;
+    _impl->output  = output;
+    _impl->op      = std::make_unique<cpu::CpuScatter>();
+    _impl->op->configure(src != nullptr ? src->info() : nullptr, updates->info(), indices->info(), output->info(),
+                         info);
+
+    _impl->run_pack          = {{TensorType::ACL_SRC_0, _impl->src},
+                                {TensorType::ACL_SRC_1, _impl->updates},
+                                {TensorType::ACL_SRC_2, _impl->indices},
+                                {TensorType::ACL_DST, _impl->output}};
+    _impl->workspace_tensors = manage_workspace<Tensor>(_impl->op->workspace(), _impl->memory_group, _impl->run_pack);
 }
 
 Status NEScatter::validate(const ITensorInfo *src,
@@ -66,7 +77,7 @@ Status NEScatter::validate(const ITensorInfo *src,
                            const ITensorInfo *output,
                            const ScatterInfo &info)
 {
-    ARM_COMPUTE_ERROR_ON_NULLPTR(src, updates, indices, output);
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(updates, indices, output);
     ARM_COMPUTE_RETURN_ON_ERROR(cpu::CpuScatter::validate(src, updates, indices, output, info));
 
     return Status{};
@@ -76,7 +87,7 @@ void NEScatter::run()
 {
     // Acquire all the temporaries
     MemoryGroupResourceScope scope_mg(_impl->memory_group);
-    ARM_COMPUTE_ERROR_ON_NULLPTR(_impl->src, _impl->updates, _impl->indices, _impl->output);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(_impl->updates, _impl->indices, _impl->output);
     _impl->op->run(_impl->run_pack);
 }
 } // namespace arm_compute
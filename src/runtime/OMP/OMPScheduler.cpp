@@ -48,6 +48,11 @@ OMPScheduler::OMPScheduler() // NOLINT
 #endif /* !defined(_WIN64) && !defined(BARE_METAL) && !defined(__APPLE__) && !defined(__OpenBSD__) && \
     (defined(__arm__) || defined(__aarch64__)) && defined(__ANDROID__)*/
 
+OMPScheduler::~OMPScheduler()
+{
+    drain_async_tasks();
+}
+
 unsigned int OMPScheduler::num_threads() const
 {
     return _num_threads;
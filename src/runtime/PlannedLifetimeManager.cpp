@@ -0,0 +1,247 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/PlannedLifetimeManager.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Log.h"
+#include "arm_compute/runtime/IAllocator.h"
+#include "arm_compute/runtime/IMemoryGroup.h"
+#include "arm_compute/runtime/OffsetMemoryPool.h"
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <vector>
+
+namespace arm_compute
+{
+namespace
+{
+size_t align_offset(size_t offset, size_t alignment)
+{
+    const size_t remainder = (alignment != 0U) ? offset % alignment : 0U;
+    return (remainder != 0U) ? offset + (alignment - remainder) : offset;
+}
+
+/** Object to place in the blob */
+struct PlannedObject
+{
+    IMemory *handle;    /**< Memory handle of the object */
+    size_t   start;     /**< Start of the lifetime */
+    size_t   end;       /**< End of the lifetime */
+    size_t   size;      /**< Size of the object */
+    size_t   alignment; /**< Alignment requirement */
+};
+
+/** Place the objects one at a time, in the given order, at the best fitting gap left by the objects already placed
+ *
+ * @param[in]  objects Objects to place
+ * @param[in]  order   Placement order, as indices in @p objects
+ * @param[out] offsets Offsets of the objects
+ *
+ * @return The size of the blob
+ */
+size_t place_objects(const std::vector<PlannedObject> &objects,
+                     const std::vector<size_t>        &order,
+                     std::vector<size_t>              &offsets)
+{
+    offsets.assign(objects.size(), 0);
+
+    size_t                                 peak = 0;
+    std::vector<size_t>                    placed;
+    std::vector<std::pair<size_t, size_t>> busy;
+    for (const size_t idx : order)
+    {
+        const PlannedObject &obj = objects[idx];
+
+        // Ranges of the blob occupied by the objects alive at the same time
+        busy.clear();
+        for (const size_t other : placed)
+        {
+            if (objects[other].start <= obj.end && obj.start <= objects[other].end)
+            {
+                busy.emplace_back(offsets[other], offsets[other] + objects[other].size);
+            }
+        }
+        std::sort(busy.begin(), busy.end());
+
+        // Use the smallest gap the object fits in, or the end of the occupied ranges
+        size_t best_offset = std::numeric_limits<size_t>::max();
+        size_t best_gap    = std::numeric_limits<size_t>::max();
+        size_t cursor      = 0;
+        for (const auto &range : busy)
+        {
+            const size_t offset = align_offset(cursor, obj.alignment);
+            if (range.first > cursor && offset + obj.size <= range.first && range.first - cursor < best_gap)
+            {
+                best_gap    = range.first - cursor;
+                best_offset = offset;
+            }
+            cursor = std::max(cursor, range.second);
+        }
+        if (best_offset == std::numeric_limits<size_t>::max())
+        {
+            best_offset = align_offset(cursor, obj.alignment);
+        }
+
+        offsets[idx] = best_offset;
+        peak         = std::max(peak, best_offset + obj.size);
+        placed.push_back(idx);
+    }
+    return peak;
+}
+} // namespace
+
+PlannedLifetimeManager::PlannedLifetimeManager() : _blob(0), _lower_bound(0), _clock(0), _intervals()
+{
+}
+
+const PlannedLifetimeManager::info_type &PlannedLifetimeManager::info() const
+{
+    return _blob;
+}
+
+size_t PlannedLifetimeManager::peak_size() const
+{
+    return _blob.size;
+}
+
+size_t PlannedLifetimeManager::lower_bound() const
+{
+    return _lower_bound;
+}
+
+void PlannedLifetimeManager::start_lifetime(void *obj)
+{
+    ISimpleLifetimeManager::start_lifetime(obj);
+    _intervals[obj] = std::make_pair(_clock, _clock);
+    ++_clock;
+}
+
+void PlannedLifetimeManager::end_lifetime(void *obj, IMemory &obj_memory, size_t size, size_t alignment)
+{
+    // The end of the interval must be known before the last lifetime of the group ends and the offsets are planned
+    ARM_COMPUTE_ERROR_ON(_intervals.find(obj) == std::end(_intervals));
+    _intervals[obj].second = _clock;
+    ++_clock;
+    ISimpleLifetimeManager::end_lifetime(obj, obj_memory, size, alignment);
+}
+
+std::unique_ptr<IMemoryPool> PlannedLifetimeManager::create_pool(IAllocator *allocator)
+{
+    ARM_COMPUTE_ERROR_ON(allocator == nullptr);
+    return std::make_unique<OffsetMemoryPool>(allocator, _blob);
+}
+
+MappingType PlannedLifetimeManager::mapping_type() const
+{
+    return MappingType::OFFSETS;
+}
+
+void PlannedLifetimeManager::update_blobs_and_mappings()
+{
+    ARM_COMPUTE_ERROR_ON(!are_all_finalized());
+    ARM_COMPUTE_ERROR_ON(_active_group == nullptr);
+
+    std::vector<PlannedObject> objects;
+    objects.reserve(_active_elements.size());
+    for (const auto &element : _active_elements)
+    {
+        const auto interval = _intervals.find(element.first);
+        ARM_COMPUTE_ERROR_ON(interval == std::end(_intervals));
+        objects.push_back(PlannedObject{element.second.handle, interval->second.first, interval->second.second,
+                                        element.second.size, element.second.alignment});
+        _blob.alignment = std::max(_blob.alignment, element.second.alignment);
+    }
+
+    // Lower bound: largest sum of the sizes of the objects alive at the same time
+    std::vector<std::pair<size_t, long long>> events;
+    for (const auto &obj : objects)
+    {
+        events.emplace_back(obj.start, static_cast<long long>(obj.size));
+        events.emplace_back(obj.end, -static_cast<long long>(obj.size));
+    }
+    std::sort(events.begin(), events.end());
+    long long live_size   = 0;
+    size_t    lower_bound = 0;
+    for (const auto &event : events)
+    {
+        live_size += event.second;
+        lower_bound = std::max(lower_bound, static_cast<size_t>(live_size));
+    }
+
+    // Try the placement orders and keep the smallest blob
+    using Compare = std::function<bool(const PlannedObject &, const PlannedObject &)>;
+    const Compare orders[] = {
+        // Largest objects first
+        [](const PlannedObject &a, const PlannedObject &b)
+        { return a.size != b.size ? a.size > b.size : (a.end - a.start) > (b.end - b.start); },
+        // Longest lived objects first
+        [](const PlannedObject &a, const PlannedObject &b)
+        { return (a.end - a.start) != (b.end - b.start) ? (a.end - a.start) > (b.end - b.start) : a.size > b.size; },
+        // Order of the lifetimes, which colours an interval graph with the fewest colours
+        [](const PlannedObject &a, const PlannedObject &b) { return a.start < b.start; },
+    };
+
+    std::vector<size_t> best_offsets;
+    size_t              best_peak = std::numeric_limits<size_t>::max();
+    std::vector<size_t> order(objects.size());
+    std::vector<size_t> offsets;
+    for (const auto &compare : orders)
+    {
+        for (size_t i = 0; i < order.size(); ++i)
+        {
+            order[i] = i;
+        }
+        std::stable_sort(order.begin(), order.end(),
+                         [&](size_t a, size_t b) { return compare(objects[a], objects[b]); });
+        const size_t peak = place_objects(objects, order, offsets);
+        if (peak < best_peak)
+        {
+            best_peak = peak;
+            best_offsets.swap(offsets);
+        }
+    }
+
+    ARM_COMPUTE_LOG_INFO_MSG_WITH_FORMAT_CORE("Planned %zu objects in %zu bytes (lower bound: %zu bytes)",
+                                              objects.size(), best_peak, lower_bound);
+
+    _blob.owners = std::max(_blob.owners, objects.size());
+    _blob.size   = std::max(_blob.size, best_peak);
+    _lower_bound = std::max(_lower_bound, lower_bound);
+
+    // Calculate group mappings
+    auto &group_mappings = _active_group->mappings();
+    for (size_t i = 0; i < objects.size(); ++i)
+    {
+        group_mappings[objects[i].handle] = best_offsets[i];
+    }
+
+    // The intervals of the finalized group are not needed anymore
+    for (const auto &element : _active_elements)
+    {
+        _intervals.erase(element.first);
+    }
+}
+} // namespace arm_compute
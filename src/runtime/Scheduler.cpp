@@ -48,6 +48,7 @@ Scheduler::Type Scheduler::_scheduler_type = Scheduler::Type::ST;
 #endif /* ARM_COMPUTE_*_SCHEDULER */
 
 std::shared_ptr<IScheduler> Scheduler::_custom_scheduler = nullptr;
+thread_local IScheduler    *Scheduler::_thread_scheduler = nullptr;
 
 namespace
 {
@@ -93,6 +94,11 @@ Scheduler::Type Scheduler::get_type()
 
 IScheduler &Scheduler::get()
 {
+    if (_thread_scheduler != nullptr)
+    {
+        return *_thread_scheduler;
+    }
+
     if (_scheduler_type == Type::CUSTOM)
     {
         if (_custom_scheduler == nullptr)
@@ -124,6 +130,11 @@ IScheduler &Scheduler::get()
     }
 }
 
+void Scheduler::set_thread_scheduler(IScheduler *scheduler)
+{
+    _thread_scheduler = scheduler;
+}
+
 void Scheduler::set(std::shared_ptr<IScheduler> scheduler)
 {
     _custom_scheduler = std::move(scheduler);
@@ -26,6 +26,7 @@
 #include "arm_compute/core/Error.h"
 #if ARM_COMPUTE_CPP_SCHEDULER
 #include "arm_compute/runtime/CPP/CPPScheduler.h"
+#include "arm_compute/runtime/CPP/WorkStealingScheduler.h"
 #endif /* ARM_COMPUTE_CPP_SCHEDULER */
 
 #include "arm_compute/runtime/SingleThreadScheduler.h"
@@ -69,6 +70,14 @@ std::unique_ptr<IScheduler> SchedulerFactory::create(Type type)
 #else  /* ARM_COMPUTE_OPENMP_SCHEDULER */
             ARM_COMPUTE_ERROR("Recompile with openmp=1 to use openmp scheduler.");
 #endif /* ARM_COMPUTE_OPENMP_SCHEDULER */
+        }
+        case Type::WS:
+        {
+#if ARM_COMPUTE_CPP_SCHEDULER
+            return std::make_unique<WorkStealingScheduler>();
+#else  /* ARM_COMPUTE_CPP_SCHEDULER */
+            ARM_COMPUTE_ERROR("Recompile with cppthreads=1 to use the work stealing scheduler.");
+#endif /* ARM_COMPUTE_CPP_SCHEDULER */
         }
         default:
         {
@@ -26,6 +26,7 @@
 #include "arm_compute/core/Coordinates.h"
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/runtime/IAllocator.h"
 #include "arm_compute/runtime/MemoryGroup.h"
 #include "arm_compute/runtime/MemoryRegion.h"
 
@@ -65,7 +66,8 @@ bool validate_subtensor_shape(const TensorInfo &parent_info, const TensorInfo &c
 }
 } // namespace
 
-TensorAllocator::TensorAllocator(IMemoryManageable *owner) : _owner(owner), _associated_memory_group(nullptr), _memory()
+TensorAllocator::TensorAllocator(IMemoryManageable *owner)
+    : _owner(owner), _associated_memory_group(nullptr), _allocator(nullptr), _memory()
 {
 }
 
@@ -78,10 +80,12 @@ TensorAllocator::TensorAllocator(TensorAllocator &&o) noexcept
     : ITensorAllocator(std::move(o)),
       _owner(o._owner),
       _associated_memory_group(o._associated_memory_group),
+      _allocator(o._allocator),
       _memory(std::move(o._memory))
 {
     o._owner                   = nullptr;
     o._associated_memory_group = nullptr;
+    o._allocator               = nullptr;
     o._memory                  = Memory();
 }
 
@@ -95,6 +99,9 @@ TensorAllocator &TensorAllocator::operator=(TensorAllocator &&o) noexcept
         _associated_memory_group   = o._associated_memory_group;
         o._associated_memory_group = nullptr;
 
+        _allocator   = o._allocator;
+        o._allocator = nullptr;
+
         _memory   = std::move(o._memory);
         o._memory = Memory();
 
@@ -134,7 +141,11 @@ void TensorAllocator::allocate()
 {
     // Align to 64-byte boundaries by default if alignment is not specified
     const size_t alignment_to_use = (alignment() != 0) ? alignment() : 64;
-    if (_associated_memory_group == nullptr)
+    if (_associated_memory_group == nullptr && _allocator != nullptr)
+    {
+        _memory.set_owned_region(_allocator->make_region(info().total_size(), alignment_to_use));
+    }
+    else if (_associated_memory_group == nullptr)
     {
         _memory.set_owned_region(std::make_unique<MemoryRegion>(info().total_size(), alignment_to_use));
     }
@@ -145,6 +156,11 @@ void TensorAllocator::allocate()
     info().set_is_resizable(false);
 }
 
+void TensorAllocator::set_allocator(IAllocator *allocator)
+{
+    _allocator = allocator;
+}
+
 void TensorAllocator::free()
 {
     _memory.set_region(nullptr);
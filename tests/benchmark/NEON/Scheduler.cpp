@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/SchedulerFactory.h"
+#include "tests/benchmark/fixtures/SchedulerFixture.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+namespace
+{
+const auto scheduler_dataset = combine(framework::dataset::make("NumWindows", { 64U, 1024U, 16384U }),
+                                       framework::dataset::make("WorkPerIteration", { 16U, 256U }));
+
+const auto dispatch_dataset = combine(combine(framework::dataset::make("NumThreads", { 2U, 4U, 8U }),
+                                              framework::dataset::make("SpinUs", { 0U, 50U })),
+                                      framework::dataset::make("KeepHot", { false, true }));
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(Scheduler)
+#if defined(ARM_COMPUTE_CPP_SCHEDULER)
+REGISTER_FIXTURE_DATA_TEST_CASE(CPP, SchedulerFixture<SchedulerFactory::Type::CPP>, framework::DatasetMode::ALL, scheduler_dataset);
+REGISTER_FIXTURE_DATA_TEST_CASE(WorkStealing, SchedulerFixture<SchedulerFactory::Type::WS>, framework::DatasetMode::ALL, scheduler_dataset);
+// Reported time in us is the dispatch overhead in ns
+REGISTER_FIXTURE_DATA_TEST_CASE(DispatchOverhead, DispatchOverheadFixture, framework::DatasetMode::ALL, dispatch_dataset);
+#endif /* defined(ARM_COMPUTE_CPP_SCHEDULER) */
+#if defined(ARM_COMPUTE_OPENMP_SCHEDULER)
+REGISTER_FIXTURE_DATA_TEST_CASE(OMP, SchedulerFixture<SchedulerFactory::Type::OMP>, framework::DatasetMode::ALL, scheduler_dataset);
+#endif /* defined(ARM_COMPUTE_OPENMP_SCHEDULER) */
+TEST_SUITE_END() // Scheduler
+TEST_SUITE_END() // Neon
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
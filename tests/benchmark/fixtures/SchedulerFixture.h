@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_BENCHMARK_FIXTURES_SCHEDULERFIXTURE_H
+#define ACL_TESTS_BENCHMARK_FIXTURES_SCHEDULERFIXTURE_H
+
+#include "arm_compute/core/CPP/ICPPKernel.h"
+#include "arm_compute/runtime/CPP/CPPScheduler.h"
+#include "arm_compute/runtime/SchedulerFactory.h"
+#include "tests/framework/Fixture.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+namespace detail
+{
+/** Synthetic kernel whose cost per iteration varies along the window, to expose load imbalance between threads */
+class SyntheticKernel : public ICPPKernel
+{
+public:
+    void configure(unsigned int num_iterations, unsigned int work_per_iteration)
+    {
+        _work_per_iteration = work_per_iteration;
+        Window win;
+        win.set(Window::DimX, Window::Dimension(0, num_iterations));
+        ICPPKernel::configure(win);
+    }
+
+    const char *name() const override
+    {
+        return "SyntheticKernel";
+    }
+
+    void run(const Window &window, const ThreadInfo &info) override
+    {
+        ARM_COMPUTE_UNUSED(info);
+        float acc = 0.f;
+        for(int x = window.x().start(); x < window.x().end(); ++x)
+        {
+            // One iteration in eight is four times more expensive than the others
+            const unsigned int work = (x % 8 == 0) ? 4 * _work_per_iteration : _work_per_iteration;
+            for(unsigned int i = 0; i < work; ++i)
+            {
+                acc = acc * 0.999f + static_cast<float>(i);
+            }
+        }
+        _sink = acc;
+    }
+
+private:
+    unsigned int   _work_per_iteration{0};
+    volatile float _sink{0.f};
+};
+
+/** Kernel doing nothing, to measure the cost of the scheduling alone */
+class EmptyKernel : public ICPPKernel
+{
+public:
+    void configure(unsigned int num_iterations)
+    {
+        Window win;
+        win.set(Window::DimX, Window::Dimension(0, num_iterations));
+        ICPPKernel::configure(win);
+    }
+
+    const char *name() const override
+    {
+        return "EmptyKernel";
+    }
+
+    void run(const Window &window, const ThreadInfo &info) override
+    {
+        ARM_COMPUTE_UNUSED(window, info);
+    }
+};
+} // namespace detail
+
+/** Measure the time taken by a scheduler to run a DYNAMIC kernel split in many windows */
+template <SchedulerFactory::Type scheduler_type>
+class SchedulerFixture : public framework::Fixture
+{
+public:
+    void setup(unsigned int num_windows, unsigned int work_per_iteration)
+    {
+        _scheduler = SchedulerFactory::create(scheduler_type);
+        _num_windows = num_windows;
+        _kernel.configure(num_windows, work_per_iteration);
+    }
+
+    void run()
+    {
+        _scheduler->schedule(&_kernel, IScheduler::Hints(Window::DimX, IScheduler::StrategyHint::DYNAMIC, _num_windows));
+    }
+
+    void sync()
+    {
+    }
+
+    void teardown()
+    {
+        _scheduler.reset();
+    }
+
+private:
+    std::unique_ptr<IScheduler> _scheduler{ nullptr };
+    detail::SyntheticKernel     _kernel{};
+    unsigned int                _num_windows{ 0 };
+};
+
+/** Measure the overhead of dispatching a kernel to the threads of a CPPScheduler
+ *
+ * Every run dispatches an empty kernel @ref num_dispatches times, so that the reported wall clock time in
+ * microseconds is the overhead of a single dispatch in nanoseconds.
+ */
+class DispatchOverheadFixture : public framework::Fixture
+{
+public:
+    static constexpr unsigned int num_dispatches = 1000;
+
+    void setup(unsigned int num_threads, unsigned int spin_us, bool keep_hot)
+    {
+        _scheduler = std::make_unique<CPPScheduler>();
+        _scheduler->set_num_threads(num_threads);
+        _scheduler->set_spin_wait(spin_us);
+        _scheduler->set_keep_hot(keep_hot);
+        _kernel.configure(num_threads);
+    }
+
+    void run()
+    {
+        for(unsigned int i = 0; i < num_dispatches; ++i)
+        {
+            _scheduler->schedule(&_kernel, IScheduler::Hints(Window::DimX));
+        }
+    }
+
+    void sync()
+    {
+    }
+
+    void teardown()
+    {
+        _scheduler.reset();
+    }
+
+private:
+    std::unique_ptr<CPPScheduler> _scheduler{ nullptr };
+    detail::EmptyKernel           _kernel{};
+};
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_BENCHMARK_FIXTURES_SCHEDULERFIXTURE_H
@@ -282,6 +282,9 @@ public:
         add_config(TensorShape(9U, 9U, 32U), Size2D(3U, 3U), PadStrideInfo(2, 2, 0, 0, DimensionRoundingType::CEIL));
         add_config(TensorShape(9U, 9U, 32U), Size2D(3U, 3U), PadStrideInfo(2, 2, 0, 0, DimensionRoundingType::CEIL), Size2D(2U, 2U));
         add_config(TensorShape(9U, 9U, 32U), Size2D(3U, 3U), PadStrideInfo(2, 2, 1, 1, DimensionRoundingType::CEIL));
+        // Dilation larger than the output tile
+        add_config(TensorShape(13U, 13U, 16U), Size2D(3U, 3U), PadStrideInfo(1, 1, 3, 3, DimensionRoundingType::CEIL), Size2D(3U, 3U));
+        add_config(TensorShape(17U, 15U, 32U), Size2D(3U, 3U), PadStrideInfo(2, 2, 0, 0, DimensionRoundingType::CEIL), Size2D(4U, 3U));
     }
 };
 /** Dataset containing optimized, 3x3 depthwise convolution shapes. */
@@ -325,6 +328,24 @@ public:
     }
 };
 
+/** Dataset containing optimized, 7x7 depthwise convolution shapes. */
+class SmallOptimizedDepthwiseConvolutionLayerDataset7x7 final : public DepthwiseConvolutionLayerDataset
+{
+public:
+    SmallOptimizedDepthwiseConvolutionLayerDataset7x7()
+    {
+        // Stride 1
+        add_config(TensorShape(11U, 11U, 16U), Size2D(7U, 7U), PadStrideInfo(1, 1, 0, 0, DimensionRoundingType::CEIL));
+        add_config(TensorShape(9U, 8U, 16U), Size2D(7U, 7U), PadStrideInfo(1, 1, 3, 3, DimensionRoundingType::CEIL));
+        add_config(TensorShape(17U, 17U, 16U), Size2D(7U, 7U), PadStrideInfo(1, 1, 0, 0, DimensionRoundingType::CEIL), Size2D(2U, 2U));
+        add_config(TensorShape(9U, 9U, 16U), Size2D(7U, 7U), PadStrideInfo(1, 1, 6, 6, DimensionRoundingType::CEIL), Size2D(2U, 2U));
+        // Stride 2
+        add_config(TensorShape(15U, 15U, 32U), Size2D(7U, 7U), PadStrideInfo(2, 2, 0, 0, DimensionRoundingType::CEIL));
+        add_config(TensorShape(14U, 13U, 32U), Size2D(7U, 7U), PadStrideInfo(2, 2, 3, 3, 3, 3, DimensionRoundingType::CEIL));
+        add_config(TensorShape(21U, 21U, 32U), Size2D(7U, 7U), PadStrideInfo(2, 2, 0, 0, DimensionRoundingType::CEIL), Size2D(2U, 2U));
+    }
+};
+
 /** Dataset containing in-place 1x1 depthwise convolution shapes.
  *
  * For a depthwise convolution op to be in-place:
@@ -222,6 +222,19 @@ public:
         add_config(TensorShape(6U, 5U, 2U), TensorShape(6U, 2U, 2U), TensorShape(2U, 2U, 2U), TensorShape(6U, 5U, 2U));
     }
 };
+
+// Many indices to few destination blocks, either narrow enough for the indices to be split between the threads or
+// wide enough for the blocks to be split.
+class LargeScatterDuplicatesDataset final : public ScatterDataset
+{
+public:
+    LargeScatterDuplicatesDataset()
+    {
+        add_config(TensorShape(64U), TensorShape(5000U), TensorShape(1U, 5000U), TensorShape(64U));
+        add_config(TensorShape(100U, 300U), TensorShape(100U, 3000U), TensorShape(1U, 3000U), TensorShape(100U, 300U));
+        add_config(TensorShape(4096U, 64U), TensorShape(4096U, 500U), TensorShape(1U, 500U), TensorShape(4096U, 64U));
+    }
+};
 } // namespace datasets
 } // namespace test
 } // namespace arm_compute
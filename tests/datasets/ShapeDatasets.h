@@ -1252,7 +1252,8 @@ public:
     {
         TensorShape{ 4U, 7U },
                      TensorShape{ 4U, 13U },
-                     TensorShape{ 4U, 64U }
+                     TensorShape{ 4U, 64U },
+                     TensorShape{ 4U, 137U }
     })
     {
     }
@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/CPP/functions/CPPDetectionOutputLayer.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/validation/Validation.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+constexpr unsigned int num_priors = 6;
+constexpr unsigned int num_images = 2;
+
+const AbsoluteTolerance<float> tolerance_f32(0.0001f);
+
+template <typename U, typename T>
+inline void fill_tensor(U &&tensor, const std::vector<T> &v)
+{
+    std::memcpy(tensor.data(), v.data(), sizeof(T) * v.size());
+}
+
+inline void base_test_case(DetectionOutputLayerInfo info, const SimpleTensor<float> &expected_output)
+{
+    const unsigned int num_loc_classes = info.share_location() ? 1 : info.num_classes();
+
+    Tensor input_loc      = create_tensor<Tensor>(TensorShape(num_priors * num_loc_classes * 4, num_images), DataType::F32);
+    Tensor input_conf     = create_tensor<Tensor>(TensorShape(num_priors * info.num_classes(), num_images), DataType::F32);
+    Tensor input_priorbox = create_tensor<Tensor>(TensorShape(num_priors * 4, 2U, 1U), DataType::F32);
+    Tensor output;
+
+    CPPDetectionOutputLayer detection;
+    detection.configure(&input_loc, &input_conf, &input_priorbox, &output, info);
+
+    input_loc.allocator()->allocate();
+    input_conf.allocator()->allocate();
+    input_priorbox.allocator()->allocate();
+    output.allocator()->allocate();
+
+    const std::vector<float> loc_vector =
+    {
+        0.1f, -0.2f, 0.3f, 0.1f, 0.f, 0.1f, -0.1f, 0.2f, -0.3f, 0.2f, 0.1f, -0.1f,
+        0.2f, 0.f, 0.f, 0.3f, 0.1f, 0.1f, -0.2f, -0.2f, 0.f, 0.f, 0.f, 0.f,
+        -0.1f, 0.3f, 0.2f, 0.f, 0.2f, -0.1f, 0.1f, 0.1f, 0.f, 0.2f, -0.2f, 0.1f,
+        0.3f, 0.1f, 0.f, -0.1f, -0.2f, 0.f, 0.1f, 0.2f, 0.1f, -0.3f, 0.3f, 0.f
+    };
+    const std::vector<float> conf_vector =
+    {
+        0.1f, 0.8f, 0.1f, 0.2f, 0.7f, 0.1f, 0.1f, 0.3f, 0.6f, 0.3f, 0.1f, 0.55f, 0.5f, 0.45f, 0.05f, 0.1f, 0.2f, 0.7f,
+        0.7f, 0.2f, 0.1f, 0.1f, 0.6f, 0.3f, 0.2f, 0.65f, 0.15f, 0.1f, 0.1f, 0.8f, 0.3f, 0.3f, 0.4f, 0.05f, 0.9f, 0.05f
+    };
+    const std::vector<float> priorbox_vector =
+    {
+        0.1f, 0.1f, 0.4f, 0.4f, 0.15f, 0.12f, 0.45f, 0.42f, 0.5f, 0.5f, 0.9f, 0.9f,
+        0.55f, 0.45f, 0.95f, 0.85f, 0.2f, 0.6f, 0.4f, 0.8f, 0.6f, 0.1f, 0.8f, 0.3f,
+        0.1f, 0.1f, 0.2f, 0.2f, 0.1f, 0.1f, 0.2f, 0.2f, 0.1f, 0.1f, 0.2f, 0.2f,
+        0.1f, 0.1f, 0.2f, 0.2f, 0.1f, 0.1f, 0.2f, 0.2f, 0.1f, 0.1f, 0.2f, 0.2f
+    };
+
+    // The location predictions of the other classes are scaled down versions of the first one
+    std::vector<float> loc_per_class_vector;
+    for(unsigned int p = 0; p < num_images * num_priors; ++p)
+    {
+        for(unsigned int c = 0; c < num_loc_classes; ++c)
+        {
+            for(unsigned int k = 0; k < 4; ++k)
+            {
+                loc_per_class_vector.push_back(loc_vector[p * 4 + k] * (1.f - 0.25f * c));
+            }
+        }
+    }
+
+    fill_tensor(Accessor(input_loc), loc_per_class_vector);
+    fill_tensor(Accessor(input_conf), conf_vector);
+    fill_tensor(Accessor(input_priorbox), priorbox_vector);
+
+    detection.run();
+
+    // Validate the number of detections and the detections
+    ARM_COMPUTE_EXPECT(output.info()->valid_region().shape[1] == expected_output.shape()[1], framework::LogLevel::ERRORS);
+    validate(Accessor(output), expected_output, tolerance_f32);
+}
+} // namespace
+
+TEST_SUITE(CPP)
+TEST_SUITE(DetectionOutputLayer)
+
+// *INDENT-OFF*
+// clang-format off
+DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(zip(zip(zip(zip(
+        framework::dataset::make("LocInfo", { TensorInfo(TensorShape(24U, 2U), 1, DataType::F32),
+                                              TensorInfo(TensorShape(24U, 2U), 1, DataType::F16),  // Unsupported data type
+                                              TensorInfo(TensorShape(20U, 2U), 1, DataType::F32),  // Mismatching number of priors
+                                              TensorInfo(TensorShape(24U, 2U), 1, DataType::F32),  // Missing per-class location predictions
+                                              TensorInfo(TensorShape(24U, 2U), 1, DataType::F32)}), // Wrong output shape
+        framework::dataset::make("ConfInfo", { TensorInfo(TensorShape(18U, 2U), 1, DataType::F32),
+                                               TensorInfo(TensorShape(18U, 2U), 1, DataType::F16),
+                                               TensorInfo(TensorShape(18U, 2U), 1, DataType::F32),
+                                               TensorInfo(TensorShape(18U, 2U), 1, DataType::F32),
+                                               TensorInfo(TensorShape(18U, 2U), 1, DataType::F32)})),
+        framework::dataset::make("PriorBoxInfo", { TensorInfo(TensorShape(24U, 2U, 1U), 1, DataType::F32),
+                                                   TensorInfo(TensorShape(24U, 2U, 1U), 1, DataType::F16),
+                                                   TensorInfo(TensorShape(24U, 2U, 1U), 1, DataType::F32),
+                                                   TensorInfo(TensorShape(24U, 2U, 1U), 1, DataType::F32),
+                                                   TensorInfo(TensorShape(24U, 2U, 1U), 1, DataType::F32)})),
+        framework::dataset::make("OutputInfo", { TensorInfo(TensorShape(7U, 8U), 1, DataType::F32),
+                                                 TensorInfo(TensorShape(7U, 8U), 1, DataType::F16),
+                                                 TensorInfo(TensorShape(7U, 8U), 1, DataType::F32),
+                                                 TensorInfo(TensorShape(7U, 8U), 1, DataType::F32),
+                                                 TensorInfo(TensorShape(7U, 6U), 1, DataType::F32)})),
+        framework::dataset::make("DetectionOutputLayerInfo", { DetectionOutputLayerInfo(3, true, DetectionOutputLayerCodeType::CENTER_SIZE, 4, 0.45f, -1),
+                                                               DetectionOutputLayerInfo(3, true, DetectionOutputLayerCodeType::CENTER_SIZE, 4, 0.45f, -1),
+                                                               DetectionOutputLayerInfo(3, true, DetectionOutputLayerCodeType::CENTER_SIZE, 4, 0.45f, -1),
+                                                               DetectionOutputLayerInfo(3, false, DetectionOutputLayerCodeType::CENTER_SIZE, 4, 0.45f, -1),
+                                                               DetectionOutputLayerInfo(3, true, DetectionOutputLayerCodeType::CENTER_SIZE, 4, 0.45f, -1)})),
+        framework::dataset::make("Expected", { true, false, false, false, false })),
+        loc_info, conf_info, priorbox_info, output_info, detect_info, expected)
+{
+    const Status status = CPPDetectionOutputLayer::validate(&loc_info.clone()->set_is_resizable(false),
+                                                            &conf_info.clone()->set_is_resizable(false),
+                                                            &priorbox_info.clone()->set_is_resizable(false),
+                                                            &output_info.clone()->set_is_resizable(false), detect_info);
+    ARM_COMPUTE_EXPECT(bool(status) == expected, framework::LogLevel::ERRORS);
+}
+// clang-format on
+// *INDENT-ON*
+
+TEST_SUITE(F32)
+TEST_CASE(CenterSizeSharedLocation, framework::DatasetMode::ALL)
+{
+    const DetectionOutputLayerInfo info(3 /*num_classes*/, true /*share_location*/, DetectionOutputLayerCodeType::CENTER_SIZE,
+                                        4 /*keep_top_k*/, 0.45f /*nms_threshold*/, -1 /*top_k*/, 0 /*background_label_id*/,
+                                        0.25f /*confidence_threshold*/);
+
+    // Rows of [image_id, label, confidence, xmin, ymin, xmax, ymax]
+    SimpleTensor<float> expected_output(TensorShape(7U, 8U), DataType::F32);
+    fill_tensor(expected_output, std::vector<float>
+    {
+        0.f, 1.f, 0.8f, 0.0937245f, 0.0909698f, 0.412275f, 0.39703f,
+        0.f, 1.f, 0.45f, 0.205921f, 0.605921f, 0.398079f, 0.798079f,
+        0.f, 2.f, 0.7f, 0.6f, 0.1f, 0.8f, 0.3f,
+        0.f, 2.f, 0.6f, 0.48396f, 0.51196f, 0.89204f, 0.90404f,
+        1.f, 1.f, 0.9f, 0.595816f, 0.094f, 0.808184f, 0.294f,
+        1.f, 1.f, 0.65f, 0.507842f, 0.50396f, 0.892158f, 0.91204f,
+        1.f, 1.f, 0.6f, 0.15297f, 0.11397f, 0.45903f, 0.42003f,
+        1.f, 2.f, 0.8f, 0.562f, 0.45796f, 0.962f, 0.85004f
+    });
+    base_test_case(info, expected_output);
+}
+
+TEST_CASE(CornerAdaptiveThreshold, framework::DatasetMode::ALL)
+{
+    const DetectionOutputLayerInfo info(3 /*num_classes*/, false /*share_location*/, DetectionOutputLayerCodeType::CORNER,
+                                        10 /*keep_top_k*/, 0.6f /*nms_threshold*/, 3 /*top_k*/, 0 /*background_label_id*/,
+                                        0.05f /*confidence_threshold*/, false /*variance_encoded_in_target*/, 0.8f /*eta*/);
+
+    // Rows of [image_id, label, confidence, xmin, ymin, xmax, ymax]
+    SimpleTensor<float> expected_output(TensorShape(7U, 10U), DataType::F32);
+    fill_tensor(expected_output, std::vector<float>
+    {
+        0.f, 1.f, 0.8f, 0.1075f, 0.085f, 0.445f, 0.415f,
+        0.f, 1.f, 0.45f, 0.2075f, 0.6075f, 0.37f, 0.77f,
+        0.f, 2.f, 0.7f, 0.6f, 0.1f, 0.8f, 0.3f,
+        0.f, 2.f, 0.6f, 0.485f, 0.51f, 0.91f, 0.89f,
+        1.f, 1.f, 0.9f, 0.6075f, 0.0775f, 0.845f, 0.3f,
+        1.f, 1.f, 0.65f, 0.5f, 0.515f, 0.87f, 0.915f,
+        1.f, 1.f, 0.6f, 0.165f, 0.1125f, 0.465f, 0.435f,
+        1.f, 2.f, 0.8f, 0.565f, 0.455f, 0.95f, 0.84f,
+        1.f, 2.f, 0.4f, 0.19f, 0.6f, 0.41f, 0.82f,
+        1.f, 2.f, 0.3f, 0.16f, 0.115f, 0.46f, 0.43f
+    });
+    base_test_case(info, expected_output);
+}
+TEST_SUITE_END() // F32
+
+TEST_SUITE_END() // DetectionOutputLayer
+TEST_SUITE_END() // CPP
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -341,6 +341,82 @@ TEST_CASE(Float_regular, framework::DatasetMode::ALL)
     // Run test
     base_test_case(info, DataType::F32, expected_output_boxes, expected_output_classes, expected_output_scores, expected_num_detection);
 }
+
+TEST_CASE(Float_regular_many_classes, framework::DatasetMode::ALL)
+{
+    // 8 classes are suppressed in parallel. Anchors 0-7 are disjoint and anchors 8-15 duplicate them:
+    // class c scores anchor c and its duplicate c + 8, so only anchor c must survive for that class
+    constexpr unsigned int num_classes = 8;
+    constexpr unsigned int num_anchors = 2 * num_classes;
+
+    DetectionPostProcessLayerInfo info = DetectionPostProcessLayerInfo(num_classes /*max_detections*/, 1 /*max_classes_per_detection*/, 0.1 /*nms_score_threshold*/,
+                                                                       0.5 /*nms_iou_threshold*/, num_classes /*num_classes*/, { 10.0, 10.0, 5.0, 5.0 } /*scale*/,
+                                                                       true /*use_regular_nms*/, 2 /*detections_per_class*/);
+
+    Tensor box_encoding     = create_tensor<Tensor>(TensorShape(4U, num_anchors, 1U), DataType::F32);
+    Tensor class_prediction = create_tensor<Tensor>(TensorShape(num_classes + 1, num_anchors, 1U), DataType::F32);
+    Tensor anchors          = create_tensor<Tensor>(TensorShape(4U, num_anchors), DataType::F32);
+
+    box_encoding.allocator()->allocate();
+    class_prediction.allocator()->allocate();
+    anchors.allocator()->allocate();
+
+    std::vector<float> box_encoding_vector(4 * num_anchors, 0.0f);
+    std::vector<float> class_prediction_vector((num_classes + 1) * num_anchors, 0.0f);
+    std::vector<float> anchors_vector;
+    std::vector<float> boxes_vector;
+    std::vector<float> classes_vector;
+    std::vector<float> scores_vector;
+    for(unsigned int a = 0; a < num_anchors; ++a)
+    {
+        const unsigned int c = a % num_classes;
+        anchors_vector.insert(anchors_vector.end(), { 0.5f, 10.0f * c + 0.5f, 1.0f, 1.0f });
+        class_prediction_vector[a * (num_classes + 1) + c + 1] = (a < num_classes ? 0.9f : 0.85f) - 0.05f * c;
+    }
+    for(unsigned int c = 0; c < num_classes; ++c)
+    {
+        boxes_vector.insert(boxes_vector.end(), { 0.0f, 10.0f * c, 1.0f, 10.0f * c + 1.0f });
+        classes_vector.push_back(c);
+        scores_vector.push_back(0.9f - 0.05f * c);
+    }
+
+    fill_tensor(Accessor(box_encoding), box_encoding_vector);
+    fill_tensor(Accessor(class_prediction), class_prediction_vector);
+    fill_tensor(Accessor(anchors), anchors_vector);
+
+    Tensor                       output_boxes;
+    Tensor                       output_classes;
+    Tensor                       output_scores;
+    Tensor                       num_detection;
+    CPPDetectionPostProcessLayer detection;
+    detection.configure(&box_encoding, &class_prediction, &anchors, &output_boxes, &output_classes, &output_scores, &num_detection, info);
+
+    output_boxes.allocator()->allocate();
+    output_classes.allocator()->allocate();
+    output_scores.allocator()->allocate();
+    num_detection.allocator()->allocate();
+
+    detection.run();
+
+    // Fill expected detection boxes
+    SimpleTensor<float> expected_output_boxes(TensorShape(4U, num_classes), DataType::F32);
+    fill_tensor(expected_output_boxes, boxes_vector);
+    // Fill expected detection classes
+    SimpleTensor<float> expected_output_classes(TensorShape(num_classes), DataType::F32);
+    fill_tensor(expected_output_classes, classes_vector);
+    // Fill expected detection scores
+    SimpleTensor<float> expected_output_scores(TensorShape(num_classes), DataType::F32);
+    fill_tensor(expected_output_scores, scores_vector);
+    // Fill expected num detections
+    SimpleTensor<float> expected_num_detection(TensorShape(1U), DataType::F32);
+    fill_tensor(expected_num_detection, std::vector<float> { static_cast<float>(num_classes) });
+
+    const AbsoluteTolerance<float> tolerance(0.01f);
+    validate(Accessor(output_boxes), expected_output_boxes, tolerance);
+    validate(Accessor(output_classes), expected_output_classes, tolerance);
+    validate(Accessor(output_scores), expected_output_scores, tolerance);
+    validate(Accessor(num_detection), expected_num_detection, tolerance);
+}
 TEST_SUITE_END() // F32
 
 TEST_SUITE(QASYMM8)
@@ -47,6 +47,35 @@ const auto score_threshold_dataset   = framework::dataset::make("ScoreThreshold"
 const auto iou_nms_threshold_dataset = framework::dataset::make("NMSThreshold", { 0.1f, 0.5f, 0.f, 1.f });
 const auto NMSParametersSmall        = datasets::Small2DNonMaxSuppressionShapes() * max_output_boxes_dataset * score_threshold_dataset * iou_nms_threshold_dataset;
 const auto NMSParametersBig          = datasets::Large2DNonMaxSuppressionShapes() * max_output_boxes_dataset * score_threshold_dataset * iou_nms_threshold_dataset;
+const auto NMSParametersTiled        = framework::dataset::make("Shape", { TensorShape{ 4U, 300U }, TensorShape{ 4U, 1000U } }) * framework::dataset::make("MaxOutputBoxes", { 64U, 300U })
+                                       * framework::dataset::make("ScoreThreshold", { 0.f, 0.5f }) * framework::dataset::make("NMSThreshold", { 0.1f, 0.5f });
+
+/** Run CPPNonMaximumSuppression on boxes in corner format (xmin, ymin, xmax, ymax) and check the selected indices */
+void run_and_validate(const std::vector<float> &boxes, const std::vector<float> &scores, unsigned int max_output,
+                      float score_threshold, float nms_threshold, const std::vector<int> &expected_indices)
+{
+    const unsigned int num_boxes = scores.size();
+
+    Tensor bboxes  = create_tensor<Tensor>(TensorShape(4U, num_boxes), DataType::F32);
+    Tensor bscores = create_tensor<Tensor>(TensorShape(num_boxes), DataType::F32);
+    Tensor indices = create_tensor<Tensor>(TensorShape(max_output), DataType::S32);
+
+    CPPNonMaximumSuppression nms;
+    nms.configure(&bboxes, &bscores, &indices, max_output, score_threshold, nms_threshold);
+
+    bboxes.allocator()->allocate();
+    bscores.allocator()->allocate();
+    indices.allocator()->allocate();
+
+    std::memcpy(Accessor(bboxes).data(), boxes.data(), sizeof(float) * boxes.size());
+    std::memcpy(Accessor(bscores).data(), scores.data(), sizeof(float) * scores.size());
+
+    nms.run();
+
+    SimpleTensor<int> expected(TensorShape(max_output), DataType::S32);
+    std::memcpy(expected.data(), expected_indices.data(), sizeof(int) * expected_indices.size());
+    validate(Accessor(indices), expected);
+}
 
 } // namespace
 
@@ -137,6 +166,53 @@ FIXTURE_DATA_TEST_CASE(RunLarge, CPPNonMaxSuppressionFixture, framework::Dataset
     validate(Accessor(_target), _reference);
 }
 
+FIXTURE_DATA_TEST_CASE(RunTiled, CPPNonMaxSuppressionFixture, framework::DatasetMode::PRECOMMIT, NMSParametersTiled)
+{
+    // Validate output
+    validate(Accessor(_target), _reference);
+}
+
+TEST_CASE(SuppressAcrossTiles, framework::DatasetMode::ALL)
+{
+    // 300 boxes spread over 5 tiles of 64 boxes, in 3 distinct positions:
+    // only the highest scoring box of each position must be kept
+    const unsigned int num_boxes = 300;
+    std::vector<float> boxes;
+    std::vector<float> scores;
+    for(unsigned int i = 0; i < num_boxes; ++i)
+    {
+        const float x = 10.f * (i % 3);
+        boxes.insert(boxes.end(), { x, 0.f, x + 1.f, 1.f });
+        scores.push_back(1.f - 0.001f * i);
+    }
+
+    run_and_validate(boxes, scores, 10U, 0.f, 0.5f, std::vector<int> { 0, 1, 2, -1, -1, -1, -1, -1, -1, -1 });
+}
+
+TEST_CASE(KeepDisjointBoxesAcrossTiles, framework::DatasetMode::ALL)
+{
+    // 200 disjoint boxes with scores increasing with their index:
+    // every box survives and the output is limited by max_output
+    const unsigned int num_boxes  = 200;
+    const unsigned int max_output = 150;
+    std::vector<float> boxes;
+    std::vector<float> scores;
+    for(unsigned int i = 0; i < num_boxes; ++i)
+    {
+        const float x = 2.f * i;
+        boxes.insert(boxes.end(), { x, 0.f, x + 1.f, 1.f });
+        scores.push_back(0.001f * (i + 1));
+    }
+
+    std::vector<int> expected_indices;
+    for(unsigned int i = 0; i < max_output; ++i)
+    {
+        expected_indices.push_back(num_boxes - 1 - i);
+    }
+
+    run_and_validate(boxes, scores, max_output, 0.f, 0.5f, expected_indices);
+}
+
 TEST_SUITE_END() // NMS
 TEST_SUITE_END() // CPP
 } // namespace validation
@@ -328,6 +328,44 @@ FIXTURE_DATA_TEST_CASE(RunSmall, NEActivationLayerFixture<float>, framework::Dat
     // Validate output
     validate(Accessor(_target), _reference, relative_tolerance(_data_type, _function), 0.f, absolute_tolerance(_data_type, _function));
 }
+DATA_TEST_CASE(RunDynamicShape, framework::DatasetMode::ALL, framework::dataset::make("Function", { ActivationLayerInfo::ActivationFunction::RELU,
+                                                                                                   ActivationLayerInfo::ActivationFunction::LOGISTIC,
+                                                                                                   ActivationLayerInfo::ActivationFunction::TANH
+                                                                                                 }),
+               function)
+{
+    const ActivationLayerInfo act_info(function, 0.5f, 1.f);
+    const TensorShape         max_shape(27U, 13U, 2U);
+
+    Tensor src = create_tensor<Tensor>(max_shape, DataType::F32);
+    Tensor dst = create_tensor<Tensor>(max_shape, DataType::F32);
+
+    // The configured shape is the largest one
+    set_tensor_dynamic(src);
+    set_tensor_dynamic(dst);
+    NEActivationLayer act;
+    act.configure(&src, &dst, act_info);
+    set_tensor_static(src);
+    set_tensor_static(dst);
+
+    src.allocator()->allocate();
+    dst.allocator()->allocate();
+
+    unsigned int seed = 0;
+    for(const TensorShape &shape : { TensorShape(9U, 5U, 2U), max_shape, TensorShape(27U, 1U, 1U), TensorShape(9U, 5U, 2U) })
+    {
+        src.info()->set_tensor_shape(shape);
+        dst.info()->set_tensor_shape(shape);
+        library->fill_tensor_uniform(Accessor(src), seed, -1.f, 1.f);
+
+        act.run();
+
+        SimpleTensor<float> ref_src(shape, DataType::F32);
+        library->fill_tensor_uniform(ref_src, seed++, -1.f, 1.f);
+        validate(Accessor(dst), reference::activation_layer<float>(ref_src, act_info), relative_tolerance(DataType::F32, function), 0.f,
+                 absolute_tolerance(DataType::F32, function));
+    }
+}
 // Run only on SME Devices to stress Logistic SME kernel
 #ifdef ARM_COMPUTE_ENABLE_SME2
 TEST_SUITE(SME)
@@ -767,6 +767,97 @@ FIXTURE_DATA_TEST_CASE(RunLarge, NEWinogradConvolutionLayerFastMathFixture16, fr
 TEST_SUITE_END() // Conv3x3
 TEST_SUITE_END() // FP16
 #endif           /* ARM_COMPUTE_ENABLE_FP16 */
+
+#ifdef __aarch64__
+TEST_SUITE(Quantized)
+template <typename T, typename TW = T>
+using NEWinogradConvolutionLayerQuantizedFixture = WinogradConvolutionLayerQuantizedValidationFixture<Tensor, Accessor, NEWinogradConvolutionLayer, T, TW>;
+using NEWinogradConvolutionLayerQuantizedPerChannelFixture = NEWinogradConvolutionLayerQuantizedFixture<uint8_t, int8_t>;
+
+const auto QuantizedWinogradActivationFunctionsDataset = make("ActivationInfo",
+{
+    ActivationLayerInfo(),
+    ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU),
+    ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::BOUNDED_RELU, 6.f)
+});
+
+/** Without fast math the 16-bit transforms of F(2x2, 3x3) are exact and only the requantization rounding differs from
+ * the reference. Fast math allows F(4x4, 3x3), whose transformed weights may be rescaled and lose precision.
+ */
+constexpr AbsoluteTolerance<float> tolerance_winograd_qasymm8(1.0);
+constexpr AbsoluteTolerance<float> tolerance_winograd_qasymm8_fast_math(2.0);
+constexpr float                    tolerance_num_winograd_qasymm8_fast_math = 0.01f;
+
+TEST_SUITE(QASYMM8)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEWinogradConvolutionLayerQuantizedFixture<uint8_t>, framework::DatasetMode::PRECOMMIT,
+                       combine(datasets::SmallWinogradConvolutionLayer3x3Dataset(),
+                               make("DataType", DataType::QASYMM8),
+                               make("WeightsDataType", DataType::QASYMM8),
+                               QuantizedWinogradActivationFunctionsDataset,
+                               make("DataLayout", { DataLayout::NHWC, DataLayout::NCHW }),
+                               make("FastMath", false)))
+{
+    validate(Accessor(_target), _reference, tolerance_winograd_qasymm8);
+}
+FIXTURE_DATA_TEST_CASE(RunSmallFastMath, NEWinogradConvolutionLayerQuantizedFixture<uint8_t>, framework::DatasetMode::PRECOMMIT,
+                       combine(datasets::SmallWinogradConvolutionLayer3x3Dataset(),
+                               make("DataType", DataType::QASYMM8),
+                               make("WeightsDataType", DataType::QASYMM8),
+                               QuantizedWinogradActivationFunctionsDataset,
+                               make("DataLayout", { DataLayout::NHWC }),
+                               make("FastMath", true)))
+{
+    validate(Accessor(_target), _reference, tolerance_winograd_qasymm8_fast_math, tolerance_num_winograd_qasymm8_fast_math);
+}
+TEST_SUITE_END() // QASYMM8
+
+TEST_SUITE(QASYMM8_SIGNED)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEWinogradConvolutionLayerQuantizedFixture<int8_t>, framework::DatasetMode::PRECOMMIT,
+                       combine(datasets::SmallWinogradConvolutionLayer3x3Dataset(),
+                               make("DataType", DataType::QASYMM8_SIGNED),
+                               make("WeightsDataType", DataType::QASYMM8_SIGNED),
+                               QuantizedWinogradActivationFunctionsDataset,
+                               make("DataLayout", { DataLayout::NHWC, DataLayout::NCHW }),
+                               make("FastMath", false)))
+{
+    validate(Accessor(_target), _reference, tolerance_winograd_qasymm8);
+}
+FIXTURE_DATA_TEST_CASE(RunSmallFastMath, NEWinogradConvolutionLayerQuantizedFixture<int8_t>, framework::DatasetMode::PRECOMMIT,
+                       combine(datasets::SmallWinogradConvolutionLayer3x3Dataset(),
+                               make("DataType", DataType::QASYMM8_SIGNED),
+                               make("WeightsDataType", DataType::QASYMM8_SIGNED),
+                               QuantizedWinogradActivationFunctionsDataset,
+                               make("DataLayout", { DataLayout::NHWC }),
+                               make("FastMath", true)))
+{
+    validate(Accessor(_target), _reference, tolerance_winograd_qasymm8_fast_math, tolerance_num_winograd_qasymm8_fast_math);
+}
+TEST_SUITE_END() // QASYMM8_SIGNED
+
+TEST_SUITE(QSYMM8_PER_CHANNEL)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEWinogradConvolutionLayerQuantizedPerChannelFixture, framework::DatasetMode::PRECOMMIT,
+                       combine(datasets::SmallWinogradConvolutionLayer3x3Dataset(),
+                               make("DataType", DataType::QASYMM8),
+                               make("WeightsDataType", DataType::QSYMM8_PER_CHANNEL),
+                               QuantizedWinogradActivationFunctionsDataset,
+                               make("DataLayout", { DataLayout::NHWC }),
+                               make("FastMath", false)))
+{
+    validate(Accessor(_target), _reference, tolerance_winograd_qasymm8);
+}
+FIXTURE_DATA_TEST_CASE(RunSmallFastMath, NEWinogradConvolutionLayerQuantizedPerChannelFixture, framework::DatasetMode::PRECOMMIT,
+                       combine(datasets::SmallWinogradConvolutionLayer3x3Dataset(),
+                               make("DataType", DataType::QASYMM8),
+                               make("WeightsDataType", DataType::QSYMM8_PER_CHANNEL),
+                               QuantizedWinogradActivationFunctionsDataset,
+                               make("DataLayout", { DataLayout::NHWC }),
+                               make("FastMath", true)))
+{
+    validate(Accessor(_target), _reference, tolerance_winograd_qasymm8_fast_math, tolerance_num_winograd_qasymm8_fast_math);
+}
+TEST_SUITE_END() // QSYMM8_PER_CHANNEL
+TEST_SUITE_END() // Quantized
+#endif // __aarch64__
 TEST_SUITE_END() // WinogradLayer
 
 #ifdef ARM_COMPUTE_ENABLE_FIXED_FORMAT_KERNELS
@@ -49,14 +49,34 @@ const auto shapes_1d  = framework::dataset::make("TensorShape", { TensorShape(2U
                                                                   TensorShape(9U, 2U, 3U), TensorShape(25U, 2U, 3U),
                                                                   TensorShape(49U, 2U, 3U), TensorShape(64U, 2U, 3U),
                                                                   TensorShape(16U, 2U, 3U), TensorShape(32U, 2U, 3U),
-                                                                  TensorShape(96U, 2U, 2U)
+                                                                  TensorShape(96U, 2U, 2U), TensorShape(11U, 2U, 3U),
+                                                                  TensorShape(13U, 2U, 3U), TensorShape(22U, 2U, 3U),
+                                                                  TensorShape(97U, 2U, 2U), TensorShape(331U, 2U, 2U)
                                                                 });
 
+const auto shapes_1d_real = framework::dataset::make("TensorShape", { TensorShape(2U, 2U, 3U), TensorShape(9U, 2U, 3U),
+                                                                       TensorShape(10U, 2U, 3U), TensorShape(13U, 2U, 3U),
+                                                                       TensorShape(16U, 2U, 3U), TensorShape(26U, 2U, 3U),
+                                                                       TensorShape(98U, 2U, 2U), TensorShape(250U, 2U, 2U)
+                                                                     });
+
+/** Lengths computed with the Bluestein algorithm */
+const auto shapes_1d_bluestein = framework::dataset::make("TensorShape", { TensorShape(11U, 2U, 3U), TensorShape(13U, 2U, 3U),
+                                                                            TensorShape(331U, 2U, 2U)
+                                                                          });
+
+/** Even lengths whose real inputs are packed as complex sequences of half length */
+const auto shapes_1d_real_even = framework::dataset::make("TensorShape", { TensorShape(2U, 2U, 3U), TensorShape(10U, 2U, 3U),
+                                                                            TensorShape(16U, 2U, 3U), TensorShape(26U, 2U, 3U),
+                                                                            TensorShape(98U, 2U, 2U), TensorShape(250U, 2U, 2U)
+                                                                          });
+
 const auto shapes_2d = framework::dataset::make("TensorShape", { TensorShape(2U, 2U, 3U), TensorShape(3U, 6U, 3U),
                                                                  TensorShape(4U, 5U, 3U), TensorShape(5U, 7U, 3U),
                                                                  TensorShape(7U, 25U, 3U), TensorShape(8U, 2U, 3U),
                                                                  TensorShape(9U, 16U, 3U), TensorShape(25U, 32U, 3U),
-                                                                 TensorShape(192U, 128U, 2U)
+                                                                 TensorShape(192U, 128U, 2U), TensorShape(11U, 13U, 3U),
+                                                                 TensorShape(17U, 32U, 2U), TensorShape(36U, 31U, 2U)
                                                                });
 
 const auto ActivationFunctionsSmallDataset = framework::dataset::make("ActivationInfo",
@@ -65,8 +85,9 @@ const auto ActivationFunctionsSmallDataset = framework::dataset::make("Activatio
     ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU, 0.5f)
 });
 
-RelativeTolerance<float> tolerance_f32(0.1f);   /**< Relative tolerance value for FP32 */
-constexpr float          tolerance_num = 0.07f; /**< Tolerance number */
+RelativeTolerance<float> tolerance_f32(0.1f);              /**< Relative tolerance value for FP32 */
+constexpr float          tolerance_num = 0.07f;            /**< Tolerance number */
+AbsoluteTolerance<float> tolerance_round_trip_f32(0.001f); /**< Absolute tolerance value for FP32 forward then inverse transforms */
 
 } // namespace
 TEST_SUITE(NEON)
@@ -79,7 +100,8 @@ DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(zip(zip(
                                                 TensorInfo(TensorShape(32U, 13U, 2U), 2, DataType::F32), // Mismatching shapes
                                                 TensorInfo(TensorShape(32U, 13U, 2U), 3, DataType::F32), // Invalid channels
                                                 TensorInfo(TensorShape(32U, 13U, 2U), 2, DataType::F32), // Unsupported axis
-                                                TensorInfo(TensorShape(11U, 13U, 2U), 2, DataType::F32), // Undecomposable FFT
+                                                TensorInfo(TensorShape(11U, 13U, 2U), 2, DataType::F32), // Undecomposable FFT, computed with Bluestein
+                                                TensorInfo(TensorShape(25U, 13U, 2U), 1, DataType::F32), // Real input and output
                                                 TensorInfo(TensorShape(25U, 13U, 2U), 2, DataType::F32),
         }),
         framework::dataset::make("OutputInfo",{ TensorInfo(TensorShape(32U, 13U, 2U), 2, DataType::F16),
@@ -87,10 +109,11 @@ DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(zip(zip(
                                                 TensorInfo(TensorShape(32U, 13U, 2U), 2, DataType::F32),
                                                 TensorInfo(TensorShape(32U, 13U, 2U), 2, DataType::F32),
                                                 TensorInfo(TensorShape(11U, 13U, 2U), 2, DataType::F32),
+                                                TensorInfo(TensorShape(25U, 13U, 2U), 1, DataType::F32),
                                                 TensorInfo(TensorShape(25U, 13U, 2U), 2, DataType::F32),
         })),
-        framework::dataset::make("Axis", { 0, 0, 0, 2, 0, 0 })),
-        framework::dataset::make("Expected", { false, false, false, false, false, true })),
+        framework::dataset::make("Axis", { 0, 0, 0, 2, 0, 0, 0 })),
+        framework::dataset::make("Expected", { false, false, false, false, true, false, true })),
         input_info, output_info, axis, expected)
 {
     FFT1DInfo desc;
@@ -103,6 +126,16 @@ DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(zip(zip(
 
 template <typename T>
 using NEFFT1DFixture = FFTValidationFixture<Tensor, Accessor, NEFFT1D, FFT1DInfo, T>;
+template <typename T>
+using NEFFT1DRealInputFixture = FFTRealInputValidationFixture<Tensor, Accessor, NEFFT1D, FFT1DInfo, T>;
+template <typename T>
+using NEFFT1DInverseFixture = FFTInverseValidationFixture<Tensor, Accessor, NEFFT1D, FFT1DInfo, T>;
+template <typename T>
+using NEFFT1DRealInputInverseFixture = FFTRealInputInverseValidationFixture<Tensor, Accessor, NEFFT1D, FFT1DInfo, T>;
+template <typename T>
+using NEFFT1DRoundTripFixture = FFTRoundTripValidationFixture<Tensor, Accessor, NEFFT1D, FFT1DInfo, T>;
+template <typename T>
+using NEFFT1DRealInputRoundTripFixture = FFTRoundTripValidationFixture<Tensor, Accessor, NEFFT1D, FFT1DInfo, T, true>;
 
 TEST_SUITE(Float)
 TEST_SUITE(FP32)
@@ -111,6 +144,31 @@ FIXTURE_DATA_TEST_CASE(RunSmall, NEFFT1DFixture<float>, framework::DatasetMode::
     // Validate output
     validate(Accessor(_target), _reference, tolerance_f32, tolerance_num);
 }
+FIXTURE_DATA_TEST_CASE(RunSmallRealInput, NEFFT1DRealInputFixture<float>, framework::DatasetMode::ALL, combine(shapes_1d_real, framework::dataset::make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f32, tolerance_num);
+}
+FIXTURE_DATA_TEST_CASE(RunSmallInverse, NEFFT1DInverseFixture<float>, framework::DatasetMode::ALL, combine(shapes_1d, framework::dataset::make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f32, tolerance_num);
+}
+FIXTURE_DATA_TEST_CASE(RunSmallRealInputInverse, NEFFT1DRealInputInverseFixture<float>, framework::DatasetMode::ALL, combine(shapes_1d_real, framework::dataset::make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f32, tolerance_num);
+}
+FIXTURE_DATA_TEST_CASE(RunRoundTripBluestein, NEFFT1DRoundTripFixture<float>, framework::DatasetMode::ALL, combine(shapes_1d_bluestein, framework::dataset::make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_round_trip_f32);
+}
+FIXTURE_DATA_TEST_CASE(RunRoundTripRealInput, NEFFT1DRealInputRoundTripFixture<float>, framework::DatasetMode::ALL, combine(shapes_1d_real_even, framework::dataset::make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_round_trip_f32);
+}
 TEST_SUITE_END() // FP32
 TEST_SUITE_END() // Float
 TEST_SUITE_END() // FFT1D
@@ -122,7 +180,7 @@ DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(zip(
         framework::dataset::make("InputInfo", { TensorInfo(TensorShape(32U, 25U, 2U), 2, DataType::F32), // Mismatching data types
                                                 TensorInfo(TensorShape(32U, 25U, 2U), 2, DataType::F32), // Mismatching shapes
                                                 TensorInfo(TensorShape(32U, 25U, 2U), 3, DataType::F32), // Invalid channels
-                                                TensorInfo(TensorShape(32U, 13U, 2U), 2, DataType::F32), // Undecomposable FFT
+                                                TensorInfo(TensorShape(32U, 13U, 2U), 2, DataType::F32), // Undecomposable FFT, computed with Bluestein
                                                 TensorInfo(TensorShape(32U, 25U, 2U), 2, DataType::F32),
         }),
         framework::dataset::make("OutputInfo",{ TensorInfo(TensorShape(32U, 25U, 2U), 2, DataType::F16),
@@ -131,7 +189,7 @@ DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(zip(
                                                 TensorInfo(TensorShape(32U, 13U, 2U), 2, DataType::F32),
                                                 TensorInfo(TensorShape(32U, 25U, 2U), 2, DataType::F32),
         })),
-        framework::dataset::make("Expected", { false, false, false, false, true })),
+        framework::dataset::make("Expected", { false, false, false, true, true })),
                input_info, output_info, expected)
 {
     const Status s = NEFFT2D::validate(&input_info.clone()->set_is_resizable(false), &output_info.clone()->set_is_resizable(false), FFT2DInfo());
@@ -142,6 +200,8 @@ DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(zip(
 
 template <typename T>
 using NEFFT2DFixture = FFTValidationFixture<Tensor, Accessor, NEFFT2D, FFT2DInfo, T>;
+template <typename T>
+using NEFFT2DInverseFixture = FFTInverseValidationFixture<Tensor, Accessor, NEFFT2D, FFT2DInfo, T>;
 
 TEST_SUITE(Float)
 TEST_SUITE(FP32)
@@ -150,6 +210,11 @@ FIXTURE_DATA_TEST_CASE(RunSmall, NEFFT2DFixture<float>, framework::DatasetMode::
     // Validate output
     validate(Accessor(_target), _reference, tolerance_f32, tolerance_num);
 }
+FIXTURE_DATA_TEST_CASE(RunSmallInverse, NEFFT2DInverseFixture<float>, framework::DatasetMode::ALL, combine(shapes_2d, framework::dataset::make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f32, tolerance_num);
+}
 TEST_SUITE_END() // FP32
 TEST_SUITE_END() // Float
 TEST_SUITE_END() // FFT2D
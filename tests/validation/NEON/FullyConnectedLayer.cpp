@@ -58,6 +58,9 @@ constexpr float                           tolerance_num_f16 = 0.07f;
 constexpr AbsoluteTolerance<uint8_t> tolerance_qasymm8(1);
 constexpr AbsoluteTolerance<int8_t>  tolerance_qasymm8_signed(1);
 
+/** Tolerance for F32 inputs quantized at run time, covering a single step difference when rounding an input */
+constexpr AbsoluteTolerance<float> abs_tolerance_dynamic_quantization(0.02f);
+
 /** CNN data types */
 const auto CNNDataTypes = make("DataType",
 {
@@ -563,6 +566,38 @@ FIXTURE_DATA_TEST_CASE(RunDynamicWeights, NEFullyConnectedLayerDynamicWeightsFix
 }
 TEST_SUITE_END() // QASYMM8_SIGNED
 TEST_SUITE_END() // Quantized
+
+using NEFullyConnectedLayerDynamicQuantizationFixture = FullyConnectedDynamicQuantizationFixture<Tensor, Accessor, NEFullyConnectedLayer>;
+
+TEST_SUITE(DynamicQuantization)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEFullyConnectedLayerDynamicQuantizationFixture, framework::DatasetMode::PRECOMMIT,
+                       combine(datasets::SmallFullyConnectedLayerDataset(),
+                               make("WeightsDataType", { DataType::QASYMM8_SIGNED, DataType::QSYMM8, DataType::QSYMM8_PER_CHANNEL }),
+                               make("HasBias", { true, false }),
+                               NoActivationFunctionDataset))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f32, 0, abs_tolerance_dynamic_quantization);
+}
+FIXTURE_DATA_TEST_CASE(RunWithActivation, NEFullyConnectedLayerDynamicQuantizationFixture, framework::DatasetMode::PRECOMMIT,
+                       combine(datasets::FullyConnectedLayerWithActivationDataset(),
+                               make("WeightsDataType", { DataType::QSYMM8, DataType::QSYMM8_PER_CHANNEL }),
+                               make("HasBias", { true }),
+                               ActivationFunctionsDataset))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f32, 0, abs_tolerance_dynamic_quantization);
+}
+FIXTURE_DATA_TEST_CASE(RunLarge, NEFullyConnectedLayerDynamicQuantizationFixture, framework::DatasetMode::NIGHTLY,
+                       combine(datasets::LargeFullyConnectedLayerDataset(),
+                               make("WeightsDataType", { DataType::QASYMM8_SIGNED, DataType::QSYMM8_PER_CHANNEL }),
+                               make("HasBias", { true }),
+                               NoActivationFunctionDataset))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f32, 0, abs_tolerance_dynamic_quantization);
+}
+TEST_SUITE_END() // DynamicQuantization
 TEST_SUITE_END() // FullyConnectedLayer
 TEST_SUITE_END() // NEON
 } // namespace validation
@@ -469,6 +469,55 @@ FIXTURE_DATA_TEST_CASE(RunLarge, NEGEMMFixture<float>, framework::DatasetMode::N
     validate(Accessor(_target), _reference, tolerance_f);
 }
 
+DATA_TEST_CASE(RunDynamicShape, framework::DatasetMode::ALL, make("ActivationInfo", { ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU),
+                                                                                      ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::TANH, 1.f, 1.f)
+                                                                                    }),
+               act_info)
+{
+    constexpr unsigned int max_m = 12;
+    constexpr unsigned int n     = 8;
+    constexpr unsigned int k     = 16;
+    constexpr float        alpha = 2.f;
+
+    Tensor a = create_tensor<Tensor>(TensorShape(k, max_m), DataType::F32);
+    Tensor b = create_tensor<Tensor>(TensorShape(n, k), DataType::F32);
+    Tensor d = create_tensor<Tensor>(TensorShape(n, max_m), DataType::F32);
+
+    // The configured shapes are the largest ones
+    set_tensor_dynamic(a);
+    set_tensor_dynamic(d);
+    GEMMInfo gemm_info;
+    gemm_info.set_activation_info(act_info);
+    NEGEMM gemm;
+    gemm.configure(&a, &b, nullptr, &d, alpha, 0.f, gemm_info);
+    set_tensor_static(a);
+    set_tensor_static(d);
+
+    a.allocator()->allocate();
+    b.allocator()->allocate();
+    d.allocator()->allocate();
+    library->fill_tensor_uniform(Accessor(b), 1, -1.f, 1.f);
+
+    SimpleTensor<float> ref_b(TensorShape(n, k), DataType::F32);
+    library->fill_tensor_uniform(ref_b, 1, -1.f, 1.f);
+
+    for(unsigned int m : { 5U, max_m, 1U, 5U })
+    {
+        a.info()->set_tensor_shape(TensorShape(k, m));
+        d.info()->set_tensor_shape(TensorShape(n, m));
+        library->fill_tensor_uniform(Accessor(a), m, -1.f, 1.f);
+
+        gemm.run();
+
+        SimpleTensor<float> ref_a(TensorShape(k, m), DataType::F32);
+        SimpleTensor<float> ref_c(TensorShape(n, m), DataType::F32);
+        library->fill_tensor_uniform(ref_a, m, -1.f, 1.f);
+        std::fill_n(ref_c.data(), ref_c.num_elements(), 0.f);
+        const SimpleTensor<float> reference = reference::activation_layer(reference::gemm<float>(ref_a, ref_b, ref_c, alpha, 0.f), act_info);
+        validate(Accessor(d), reference, tolerance_f);
+    }
+}
+
 TEST_SUITE(BATCHED_MATMUL)
 FIXTURE_DATA_TEST_CASE(RunSmall, NEBatchedMatMulFixture<float>, framework::DatasetMode::PRECOMMIT, combine(combine(datasets::SmallBatchedMatMulDataset(),
                                                                                                                    make("ReshapeWeights", { false })),
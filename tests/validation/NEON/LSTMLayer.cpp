@@ -179,6 +179,108 @@ FIXTURE_DATA_TEST_CASE(RunSmall, NELSTMLayerFixture<float>, framework::DatasetMo
     validate(Accessor(_target), _reference, tolerance_f32);
     validate(Accessor(_target_scratch), _reference_scratch, tolerance_f32);
 }
+
+/** Check that running all the timesteps of a sequence at once matches chaining single timestep runs */
+TEST_CASE(MultiTimestep, framework::DatasetMode::ALL)
+{
+    constexpr unsigned int num_inputs  = 8;
+    constexpr unsigned int num_cells   = 16;
+    constexpr unsigned int num_batches = 2;
+    constexpr unsigned int num_steps   = 3;
+
+    const TensorShape state_shape(num_cells, num_batches);
+    const auto        make_tensor = [](const TensorShape &shape)
+    {
+        Tensor t = create_tensor<Tensor>(shape, DataType::F32);
+        t.allocator()->allocate();
+        return t;
+    };
+    const auto copy_tensor = [](Tensor &src, Tensor &dst, int z)
+    {
+        Accessor src_accessor(src);
+        Accessor dst_accessor(dst);
+        for(int y = 0; y < static_cast<int>(dst.info()->dimension(1)); ++y)
+        {
+            for(int x = 0; x < static_cast<int>(dst.info()->dimension(0)); ++x)
+            {
+                const Coordinates src_coords = z < 0 ? Coordinates(x, y) : Coordinates(x, y, z);
+                *reinterpret_cast<float *>(dst_accessor(Coordinates(x, y))) = *reinterpret_cast<float *>(src_accessor(src_coords));
+            }
+        }
+    };
+    const auto to_reference = [](Tensor &src)
+    {
+        SimpleTensor<float> reference(src.info()->tensor_shape(), DataType::F32);
+        Accessor            src_accessor(src);
+        for(int i = 0; i < reference.num_elements(); ++i)
+        {
+            const Coordinates coords = index2coord(reference.shape(), i);
+            reference[i]             = *reinterpret_cast<float *>(src_accessor(coords));
+        }
+        return reference;
+    };
+
+    std::vector<Tensor> weights;
+    for(unsigned int i = 0; i < 4; ++i)
+    {
+        weights.emplace_back(make_tensor(TensorShape(num_inputs, num_cells)));
+        weights.emplace_back(make_tensor(TensorShape(num_cells, num_cells)));
+        weights.emplace_back(make_tensor(TensorShape(num_cells)));
+    }
+    for(unsigned int i = 0; i < weights.size(); ++i)
+    {
+        library->fill_tensor_uniform(Accessor(weights[i]), i, -1.f, 1.f);
+    }
+    LSTMParams<ITensor> lstm_params;
+    lstm_params.set_cifg_params(&weights[0], &weights[1], nullptr, &weights[2]);
+
+    const ActivationLayerInfo act_info(ActivationLayerInfo::ActivationFunction::TANH, 1.f, 1.f);
+    Tensor sequence_input = make_tensor(TensorShape(num_inputs, num_batches, num_steps));
+    library->fill_tensor_uniform(Accessor(sequence_input), 100, -1.f, 1.f);
+
+    // Run the whole sequence at once
+    Tensor      output_state_in  = make_tensor(state_shape);
+    Tensor      cell_state_in    = make_tensor(state_shape);
+    Tensor      output_state_out = make_tensor(state_shape);
+    Tensor      cell_state_out   = make_tensor(state_shape);
+    Tensor      scratch          = make_tensor(TensorShape(4 * num_cells, num_batches));
+    Tensor      output           = make_tensor(TensorShape(num_cells, num_batches, num_steps));
+    NELSTMLayer lstm;
+    lstm.configure(&sequence_input, &weights[3], &weights[6], &weights[9], &weights[4], &weights[7], &weights[10], &weights[5], &weights[8], &weights[11],
+                   &output_state_in, &cell_state_in, &scratch, &output_state_out, &cell_state_out, &output, lstm_params, act_info, 10.f);
+    library->fill_tensor_uniform(Accessor(output_state_in), 101, -1.f, 1.f);
+    library->fill_tensor_uniform(Accessor(cell_state_in), 102, -1.f, 1.f);
+    lstm.run();
+
+    // Run one timestep at a time, feeding the states back
+    Tensor      step_input           = make_tensor(TensorShape(num_inputs, num_batches));
+    Tensor      step_output_state_in = make_tensor(state_shape);
+    Tensor      step_cell_state_in   = make_tensor(state_shape);
+    Tensor      step_output_state    = make_tensor(state_shape);
+    Tensor      step_cell_state      = make_tensor(state_shape);
+    Tensor      step_scratch         = make_tensor(TensorShape(4 * num_cells, num_batches));
+    Tensor      step_output          = make_tensor(state_shape);
+    NELSTMLayer step_lstm;
+    step_lstm.configure(&step_input, &weights[3], &weights[6], &weights[9], &weights[4], &weights[7], &weights[10], &weights[5], &weights[8], &weights[11],
+                        &step_output_state_in, &step_cell_state_in, &step_scratch, &step_output_state, &step_cell_state, &step_output, lstm_params, act_info, 10.f);
+    library->fill_tensor_uniform(Accessor(step_output_state_in), 101, -1.f, 1.f);
+    library->fill_tensor_uniform(Accessor(step_cell_state_in), 102, -1.f, 1.f);
+
+    Tensor output_slice = make_tensor(state_shape);
+    for(unsigned int t = 0; t < num_steps; ++t)
+    {
+        copy_tensor(sequence_input, step_input, t);
+        step_lstm.run();
+        copy_tensor(step_output_state, step_output_state_in, -1);
+        copy_tensor(step_cell_state, step_cell_state_in, -1);
+
+        copy_tensor(output, output_slice, t);
+        validate(Accessor(output_slice), to_reference(step_output), tolerance_f32);
+    }
+    validate(Accessor(output_state_out), to_reference(step_output_state), tolerance_f32);
+    validate(Accessor(cell_state_out), to_reference(step_cell_state), tolerance_f32);
+    validate(Accessor(scratch), to_reference(step_scratch), tolerance_f32);
+}
 TEST_SUITE_END() // FP32
 
 #ifdef ARM_COMPUTE_ENABLE_FP16
@@ -50,6 +50,8 @@ const AbsoluteTolerance<half> tolerance_fp16(half(0.1f));
 #ifdef __aarch64__
 constexpr AbsoluteTolerance<int32_t> tolerance_qasymm8(1);
 constexpr AbsoluteTolerance<int32_t> tolerance_qasymm8_signed(1);
+constexpr AbsoluteTolerance<float>   tolerance_dynamic_quantization(
+    0.02f); /**< Tolerance value for F32 lhs quantized at run time, covering a one step rounding difference */
 #endif // __aarch64__
 
 // clang-format off
@@ -185,6 +187,9 @@ using NEMatMulDynamicTensorsFixture =
 template <typename T>
 using NEQuantizedMatMulFixture = QuantizedMatMulValidationFixture<Tensor, Accessor, NEMatMul, CpuMatMulSettings, T>;
 
+using NEMatMulDynamicQuantizationFixture =
+    MatMulDynamicQuantizationFixture<Tensor, Accessor, NEMatMul, CpuMatMulSettings>;
+
 TEST_SUITE(Float)
 TEST_SUITE(FP32)
 FIXTURE_DATA_TEST_CASE(RunSmall,
@@ -253,6 +258,65 @@ make("NumberOfRuns", 5)))
     // Validate output
     validate(Accessor(_target), _reference, tolerance_fp32);
 }
+
+// Configure once with the number of rows of lhs marked dynamic, then run on smaller and equal numbers of rows
+DATA_TEST_CASE(RunDynamicShape, framework::DatasetMode::ALL, make("TransposeA", {false, true}), transpose_a)
+{
+    constexpr unsigned int max_m = 12;
+    constexpr unsigned int n     = 8;
+    constexpr unsigned int k     = 16;
+
+    const auto lhs_shape = [&](unsigned int m)
+    {
+        return transpose_a ? TensorShape(m, k) : TensorShape(k, m);
+    };
+    const auto to_reference = [](Tensor &src, bool transpose)
+    {
+        const TensorShape  &shape = src.info()->tensor_shape();
+        SimpleTensor<float> reference(transpose ? TensorShape(shape.y(), shape.x()) : shape, DataType::F32);
+        Accessor            src_accessor(src);
+        for(int i = 0; i < reference.num_elements(); ++i)
+        {
+            const Coordinates coords     = index2coord(reference.shape(), i);
+            const Coordinates src_coords = transpose ? Coordinates(coords.y(), coords.x()) : coords;
+            reference[i]                 = *reinterpret_cast<float *>(src_accessor(src_coords));
+        }
+        return reference;
+    };
+
+    Tensor lhs = create_tensor<Tensor>(lhs_shape(max_m), DataType::F32);
+    Tensor rhs = create_tensor<Tensor>(TensorShape(n, k), DataType::F32);
+    Tensor dst = create_tensor<Tensor>(TensorShape(n, max_m), DataType::F32);
+    lhs.info()->set_are_values_constant(false);
+    rhs.info()->set_are_values_constant(false);
+
+    // The configured shapes are the largest ones
+    set_tensor_dynamic(lhs);
+    set_tensor_dynamic(dst);
+    NEMatMul matmul;
+    matmul.configure(&lhs, &rhs, &dst, MatMulInfo().adj_lhs(transpose_a), CpuMatMulSettings());
+    set_tensor_static(lhs);
+    set_tensor_static(dst);
+
+    lhs.allocator()->allocate();
+    rhs.allocator()->allocate();
+    dst.allocator()->allocate();
+    library->fill_tensor_uniform(Accessor(rhs), 1, -1.f, 1.f);
+
+    for(unsigned int m : { 5U, max_m, 1U, 5U })
+    {
+        lhs.info()->set_tensor_shape(lhs_shape(m));
+        dst.info()->set_tensor_shape(TensorShape(n, m));
+        library->fill_tensor_uniform(Accessor(lhs), m, -1.f, 1.f);
+
+        matmul.run();
+
+        SimpleTensor<float> bias(TensorShape(n, m), DataType::F32);
+        std::fill_n(bias.data(), bias.num_elements(), 0.f);
+        const SimpleTensor<float> reference = reference::gemm<float>(to_reference(lhs, transpose_a), to_reference(rhs, false), bias, 1.f, 0.f);
+        validate(Accessor(dst), reference, tolerance_fp32);
+    }
+}
 TEST_SUITE_END() // FP32
 
 #ifdef ARM_COMPUTE_ENABLE_BF16
@@ -538,6 +602,29 @@ make("OutQInfo", {QuantizationInfo(1.f, 1)})))
 TEST_SUITE_END() // QASYMM8_SIGNED
 
 TEST_SUITE_END() // Quantized
+
+TEST_SUITE(DynamicQuantization)
+FIXTURE_DATA_TEST_CASE(RunSmall,
+                       NEMatMulDynamicQuantizationFixture,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(zip(make("LhsShape", {TensorShape(9U, 6U), TensorShape(31U, 1U), TensorShape(8U, 4U, 2U),
+                                                     TensorShape(32U, 3U, 2U, 2U)}),
+                                   make("RhsShape", {TensorShape(5U, 9U), TensorShape(23U, 31U), TensorShape(16U, 8U),
+                                                     TensorShape(17U, 32U)}),
+                                   make("OutputShape", {TensorShape(5U, 6U), TensorShape(23U, 1U),
+                                                        TensorShape(16U, 4U, 2U), TensorShape(17U, 3U, 2U, 2U)})),
+                               make("TransposeB", {false, true}),
+                               make("RhsDataType",
+                                    {DataType::QASYMM8_SIGNED, DataType::QSYMM8, DataType::QSYMM8_PER_CHANNEL}),
+                               make("ConstantRhs", {false, true}),
+                               make("ActivationInfo",
+                                    {ActivationLayerInfo(),
+                                     ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU)})))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_dynamic_quantization);
+}
+TEST_SUITE_END() // DynamicQuantization
 #endif           // __aarch64__
 
 TEST_SUITE_END() // MatMul
@@ -132,6 +132,40 @@ FIXTURE_DATA_TEST_CASE(RunLarge, NEMeanStdDevNormalizationLayerFixture<float>, f
     validate(Accessor(_target), _reference, tolerance_f32);
 }
 
+DATA_TEST_CASE(RunDynamicShape, framework::DatasetMode::ALL, framework::dataset::make("InPlace", { false, true }), in_place)
+{
+    constexpr float   epsilon = 1e-7f;
+    const TensorShape max_shape(27U, 13U);
+
+    Tensor src = create_tensor<Tensor>(max_shape, DataType::F32);
+    Tensor dst = create_tensor<Tensor>(max_shape, DataType::F32);
+
+    // The configured shape is the largest one
+    set_tensor_dynamic(src);
+    set_tensor_dynamic(dst);
+    NEMeanStdDevNormalizationLayer norm;
+    norm.configure(&src, in_place ? nullptr : &dst, epsilon);
+    set_tensor_static(src);
+    set_tensor_static(dst);
+
+    src.allocator()->allocate();
+    dst.allocator()->allocate();
+
+    unsigned int seed = 0;
+    for(const TensorShape &shape : { TensorShape(9U, 5U), max_shape, TensorShape(27U, 1U), TensorShape(9U, 5U) })
+    {
+        src.info()->set_tensor_shape(shape);
+        dst.info()->set_tensor_shape(shape);
+        library->fill_tensor_uniform(Accessor(src), seed, -1.f, 1.f);
+
+        norm.run();
+
+        SimpleTensor<float> ref_src(shape, DataType::F32);
+        library->fill_tensor_uniform(ref_src, seed++, -1.f, 1.f);
+        validate(Accessor(in_place ? src : dst), reference::mean_std_normalization_layer<float>(ref_src, epsilon), tolerance_f32);
+    }
+}
+
 TEST_SUITE_END() // FP32
 TEST_SUITE_END() // Float
 
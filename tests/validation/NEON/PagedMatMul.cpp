@@ -0,0 +1,216 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NEPagedMatMul.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/validation/Validation.h"
+#include "tests/validation/fixtures/PagedMatMulFixture.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+constexpr AbsoluteTolerance<float> tolerance_f32(0.0001f);
+constexpr RelativeTolerance<float> tolerance_rel_f32(0.0001f);
+constexpr float                    abs_tolerance_f32(0.0001f);
+#ifdef ARM_COMPUTE_ENABLE_FP16
+constexpr RelativeTolerance<float> tolerance_rel_f16(0.01f);
+constexpr float                    abs_tolerance_f16(0.01f);
+#endif // ARM_COMPUTE_ENABLE_FP16
+
+/** A single decoding stream, grouped heads with a row size which is not a multiple of the vector length, and a full
+ *  block of rows per head. The blocks are shuffled and the lengths do not fill the last block of the sequences. */
+const auto SmallPagedMatMulDataset = combine(zip(zip(zip(zip(
+    framework::dataset::make("CacheShape", { TensorShape(16U, 4U, 2U, 12U), TensorShape(33U, 16U, 1U, 8U), TensorShape(64U, 5U, 4U, 20U) }),
+    framework::dataset::make("NumRows", { 1U, 3U, 8U })),
+    framework::dataset::make("NumHeads", { 4U, 2U, 8U })),
+    framework::dataset::make("NumBatches", { 2U, 1U, 3U })),
+    framework::dataset::make("MaxBlocks", { 3U, 4U, 6U })),
+    framework::dataset::make("AdjRhs", { false, true }));
+
+const auto LargePagedMatMulDataset = combine(zip(zip(zip(zip(
+    framework::dataset::make("CacheShape", { TensorShape(128U, 16U, 8U, 256U) }),
+    framework::dataset::make("NumRows", { 1U })),
+    framework::dataset::make("NumHeads", { 32U })),
+    framework::dataset::make("NumBatches", { 4U })),
+    framework::dataset::make("MaxBlocks", { 64U })),
+    framework::dataset::make("AdjRhs", { false, true }));
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(PagedMatMul)
+
+// *INDENT-OFF*
+// clang-format off
+DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(zip(zip(zip(zip(zip(
+        framework::dataset::make("LhsInfo", { TensorInfo(TensorShape(16U, 1U, 4U, 2U), 1, DataType::U8),   // Wrong data type
+                                              TensorInfo(TensorShape(16U, 1U, 4U, 2U), 1, DataType::F32),  // Mismatching cache data type
+                                              TensorInfo(TensorShape(300U, 1U, 4U, 2U), 1, DataType::F32), // Row size too large
+                                              TensorInfo(TensorShape(16U, 1U, 3U, 2U), 1, DataType::F32),  // Heads not a multiple of the cache heads
+                                              TensorInfo(TensorShape(16U, 1U, 4U, 2U), 1, DataType::F32),  // Wrong block table data type
+                                              TensorInfo(TensorShape(12U, 1U, 4U, 2U), 1, DataType::F32),  // Mismatching K
+                                              TensorInfo(TensorShape(16U, 1U, 4U, 2U), 1, DataType::F32),  // Mismatching number of batches
+                                              TensorInfo(TensorShape(16U, 1U, 4U, 2U), 1, DataType::F32),  // Wrong output shape
+                                              TensorInfo(TensorShape(16U, 1U, 4U, 2U), 1, DataType::F32),
+                                              TensorInfo(TensorShape(12U, 8U, 4U, 2U), 1, DataType::F32),
+        }),
+        framework::dataset::make("CacheInfo", { TensorInfo(TensorShape(16U, 4U, 2U, 10U), 1, DataType::U8),
+                                                TensorInfo(TensorShape(16U, 4U, 2U, 10U), 1, DataType::F16),
+                                                TensorInfo(TensorShape(300U, 4U, 2U, 10U), 1, DataType::F32),
+                                                TensorInfo(TensorShape(16U, 4U, 2U, 10U), 1, DataType::F32),
+                                                TensorInfo(TensorShape(16U, 4U, 2U, 10U), 1, DataType::F32),
+                                                TensorInfo(TensorShape(16U, 4U, 2U, 10U), 1, DataType::F32),
+                                                TensorInfo(TensorShape(16U, 4U, 2U, 10U), 1, DataType::F32),
+                                                TensorInfo(TensorShape(16U, 4U, 2U, 10U), 1, DataType::F32),
+                                                TensorInfo(TensorShape(16U, 4U, 2U, 10U), 1, DataType::F32),
+                                                TensorInfo(TensorShape(16U, 4U, 2U, 10U), 1, DataType::QASYMM8_SIGNED),
+        })),
+        framework::dataset::make("BlockTableInfo", { TensorInfo(TensorShape(3U, 2U), 1, DataType::S32),
+                                                     TensorInfo(TensorShape(3U, 2U), 1, DataType::S32),
+                                                     TensorInfo(TensorShape(3U, 2U), 1, DataType::S32),
+                                                     TensorInfo(TensorShape(3U, 2U), 1, DataType::S32),
+                                                     TensorInfo(TensorShape(3U, 2U), 1, DataType::F32),
+                                                     TensorInfo(TensorShape(3U, 2U), 1, DataType::S32),
+                                                     TensorInfo(TensorShape(3U, 2U), 1, DataType::S32),
+                                                     TensorInfo(TensorShape(3U, 2U), 1, DataType::S32),
+                                                     TensorInfo(TensorShape(3U, 2U), 1, DataType::S32),
+                                                     TensorInfo(TensorShape(3U, 2U), 1, DataType::S32),
+        })),
+        framework::dataset::make("SeqLensInfo", { TensorInfo(TensorShape(2U), 1, DataType::S32),
+                                                  TensorInfo(TensorShape(2U), 1, DataType::S32),
+                                                  TensorInfo(TensorShape(2U), 1, DataType::S32),
+                                                  TensorInfo(TensorShape(2U), 1, DataType::S32),
+                                                  TensorInfo(TensorShape(2U), 1, DataType::S32),
+                                                  TensorInfo(TensorShape(2U), 1, DataType::S32),
+                                                  TensorInfo(TensorShape(3U), 1, DataType::S32),
+                                                  TensorInfo(TensorShape(2U), 1, DataType::S32),
+                                                  TensorInfo(TensorShape(2U), 1, DataType::S32),
+                                                  TensorInfo(TensorShape(2U), 1, DataType::S32),
+        })),
+        framework::dataset::make("OutputInfo", { TensorInfo(TensorShape(12U, 1U, 4U, 2U), 1, DataType::U8),
+                                                 TensorInfo(TensorShape(12U, 1U, 4U, 2U), 1, DataType::F32),
+                                                 TensorInfo(TensorShape(12U, 1U, 4U, 2U), 1, DataType::F32),
+                                                 TensorInfo(TensorShape(12U, 1U, 3U, 2U), 1, DataType::F32),
+                                                 TensorInfo(TensorShape(12U, 1U, 4U, 2U), 1, DataType::F32),
+                                                 TensorInfo(TensorShape(12U, 1U, 4U, 2U), 1, DataType::F32),
+                                                 TensorInfo(TensorShape(12U, 1U, 4U, 2U), 1, DataType::F32),
+                                                 TensorInfo(TensorShape(16U, 1U, 4U, 2U), 1, DataType::F32),
+                                                 TensorInfo(TensorShape(12U, 1U, 4U, 2U), 1, DataType::F32),
+                                                 TensorInfo(TensorShape(16U, 8U, 4U, 2U), 1, DataType::F32),
+        })),
+        framework::dataset::make("AdjRhs", { true, true, true, true, true, true, true, true, true, false })),
+        framework::dataset::make("Expected", { false, false, false, false, false, false, false, false, true, true })),
+        lhs_info, cache_info, block_table_info, seq_lens_info, output_info, adj_rhs, expected)
+{
+    const Status status = NEPagedMatMul::validate(&lhs_info.clone()->set_is_resizable(false),
+                                                  &cache_info.clone()->set_is_resizable(false),
+                                                  &block_table_info.clone()->set_is_resizable(false),
+                                                  &seq_lens_info.clone()->set_is_resizable(false),
+                                                  &output_info.clone()->set_is_resizable(false),
+                                                  MatMulInfo().adj_rhs(adj_rhs));
+    ARM_COMPUTE_EXPECT(bool(status) == expected, framework::LogLevel::ERRORS);
+}
+// clang-format on
+// *INDENT-ON*
+
+template <typename T>
+using NEPagedMatMulFixture = PagedMatMulValidationFixture<Tensor, Accessor, NEPagedMatMul, T>;
+template <typename T>
+using NEPagedMatMulQuantizedCacheFixture = PagedMatMulValidationFixture<Tensor, Accessor, NEPagedMatMul, T, int8_t>;
+
+TEST_SUITE(Float)
+#ifdef ARM_COMPUTE_ENABLE_FP16
+TEST_SUITE(FP16)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEPagedMatMulFixture<half>, framework::DatasetMode::PRECOMMIT, combine(SmallPagedMatMulDataset,
+                                                                                                    framework::dataset::make("DataType", DataType::F16),
+                                                                                                    framework::dataset::make("CacheDataType", DataType::F16)))
+{
+    if(CPUInfo::get().has_fp16())
+    {
+        // Validate output
+        validate(Accessor(_target), _reference, tolerance_rel_f16, 0.f, abs_tolerance_f16);
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_INFO("Device does not support fp16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_INFO();
+    }
+}
+FIXTURE_DATA_TEST_CASE(RunSmallQuantizedCache, NEPagedMatMulQuantizedCacheFixture<half>, framework::DatasetMode::PRECOMMIT, combine(SmallPagedMatMulDataset,
+                                                                                                                             framework::dataset::make("DataType", DataType::F16),
+                                                                                                                             framework::dataset::make("CacheDataType", DataType::QASYMM8_SIGNED)))
+{
+    if(CPUInfo::get().has_fp16())
+    {
+        // Validate output
+        validate(Accessor(_target), _reference, tolerance_rel_f16, 0.f, abs_tolerance_f16);
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_INFO("Device does not support fp16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_INFO();
+    }
+}
+TEST_SUITE_END() // FP16
+#endif           // ARM_COMPUTE_ENABLE_FP16
+
+TEST_SUITE(FP32)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEPagedMatMulFixture<float>, framework::DatasetMode::PRECOMMIT, combine(SmallPagedMatMulDataset,
+                                                                                                     framework::dataset::make("DataType", DataType::F32),
+                                                                                                     framework::dataset::make("CacheDataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f32);
+}
+FIXTURE_DATA_TEST_CASE(RunSmallQuantizedCache, NEPagedMatMulQuantizedCacheFixture<float>, framework::DatasetMode::PRECOMMIT, combine(SmallPagedMatMulDataset,
+                                                                                                                              framework::dataset::make("DataType", DataType::F32),
+                                                                                                                              framework::dataset::make("CacheDataType", DataType::QASYMM8_SIGNED)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_rel_f32, 0.f, abs_tolerance_f32);
+}
+FIXTURE_DATA_TEST_CASE(RunLarge, NEPagedMatMulFixture<float>, framework::DatasetMode::NIGHTLY, combine(LargePagedMatMulDataset,
+                                                                                                   framework::dataset::make("DataType", DataType::F32),
+                                                                                                   framework::dataset::make("CacheDataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_rel_f32, 0.f, abs_tolerance_f32);
+}
+TEST_SUITE_END() // FP32
+TEST_SUITE_END() // Float
+
+TEST_SUITE_END() // PagedMatMul
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NEScaledDotProductAttention.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/validation/Validation.h"
+#include "tests/validation/fixtures/ScaledDotProductAttentionFixture.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+constexpr AbsoluteTolerance<float> tolerance_f32(0.0001f);
+#ifdef ARM_COMPUTE_ENABLE_FP16
+constexpr AbsoluteTolerance<float> tolerance_f16(0.01f);
+#endif // ARM_COMPUTE_ENABLE_FP16
+#ifdef ARM_COMPUTE_ENABLE_BF16
+/** The inputs and the output are rounded to bf16, whose 8-bit mantissa gives a step of 2^-8 close to 1 */
+constexpr AbsoluteTolerance<float> tolerance_bf16(0.02f);
+#endif // ARM_COMPUTE_ENABLE_BF16
+
+/** Self-attention, decoding against a longer sequence of keys with grouped heads, and sizes which are not multiples of
+ *  the vector length nor of the tiles of keys */
+const auto SmallSDPADataset = combine(combine(zip(zip(zip(
+    framework::dataset::make("QueryShape", { TensorShape(16U, 7U, 2U, 1U), TensorShape(8U, 1U, 4U, 2U), TensorShape(33U, 9U, 3U, 2U) }),
+    framework::dataset::make("NumKeys", { 7U, 70U, 131U })),
+    framework::dataset::make("NumKvHeads", { 2U, 2U, 1U })),
+    framework::dataset::make("ValueHeadSize", { 16U, 12U, 5U })),
+    framework::dataset::make("HasMask", { false, true })),
+    framework::dataset::make("IsCausal", { false, true }));
+
+const auto LargeSDPADataset = combine(combine(zip(zip(zip(
+    framework::dataset::make("QueryShape", { TensorShape(64U, 512U, 8U, 1U), TensorShape(128U, 1U, 32U, 1U) }),
+    framework::dataset::make("NumKeys", { 512U, 2048U })),
+    framework::dataset::make("NumKvHeads", { 8U, 8U })),
+    framework::dataset::make("ValueHeadSize", { 64U, 128U })),
+    framework::dataset::make("HasMask", { false })),
+    framework::dataset::make("IsCausal", { true }));
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(ScaledDotProductAttention)
+
+// *INDENT-OFF*
+// clang-format off
+DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(zip(zip(zip(zip(
+        framework::dataset::make("QueryInfo", { TensorInfo(TensorShape(16U, 8U, 4U), 1, DataType::U8),   // Wrong data type
+                                                TensorInfo(TensorShape(16U, 8U, 4U), 1, DataType::F32),  // Mismatching head sizes
+                                                TensorInfo(TensorShape(300U, 8U, 4U), 1, DataType::F32), // Head size too large
+                                                TensorInfo(TensorShape(16U, 8U, 3U), 1, DataType::F32),  // Heads not a multiple of the key heads
+                                                TensorInfo(TensorShape(16U, 8U, 4U), 1, DataType::F32),  // Wrong mask shape
+                                                TensorInfo(TensorShape(16U, 8U, 4U), 1, DataType::F32),  // Wrong output shape
+                                                TensorInfo(TensorShape(16U, 8U, 4U), 1, DataType::F32),
+        }),
+        framework::dataset::make("KeyInfo", { TensorInfo(TensorShape(16U, 20U, 2U), 1, DataType::U8),
+                                              TensorInfo(TensorShape(15U, 20U, 2U), 1, DataType::F32),
+                                              TensorInfo(TensorShape(300U, 20U, 2U), 1, DataType::F32),
+                                              TensorInfo(TensorShape(16U, 20U, 2U), 1, DataType::F32),
+                                              TensorInfo(TensorShape(16U, 20U, 2U), 1, DataType::F32),
+                                              TensorInfo(TensorShape(16U, 20U, 2U), 1, DataType::F32),
+                                              TensorInfo(TensorShape(16U, 20U, 2U), 1, DataType::F32),
+        })),
+        framework::dataset::make("ValueInfo", { TensorInfo(TensorShape(32U, 20U, 2U), 1, DataType::U8),
+                                                TensorInfo(TensorShape(32U, 20U, 2U), 1, DataType::F32),
+                                                TensorInfo(TensorShape(32U, 20U, 2U), 1, DataType::F32),
+                                                TensorInfo(TensorShape(32U, 20U, 2U), 1, DataType::F32),
+                                                TensorInfo(TensorShape(32U, 20U, 2U), 1, DataType::F32),
+                                                TensorInfo(TensorShape(32U, 20U, 2U), 1, DataType::F32),
+                                                TensorInfo(TensorShape(32U, 20U, 2U), 1, DataType::F32),
+        })),
+        framework::dataset::make("MaskInfo", { TensorInfo(TensorShape(20U, 8U), 1, DataType::U8),
+                                               TensorInfo(TensorShape(20U, 8U), 1, DataType::F32),
+                                               TensorInfo(TensorShape(20U, 8U), 1, DataType::F32),
+                                               TensorInfo(TensorShape(20U, 8U), 1, DataType::F32),
+                                               TensorInfo(TensorShape(8U, 20U), 1, DataType::F32),
+                                               TensorInfo(TensorShape(20U, 8U), 1, DataType::F32),
+                                               TensorInfo(TensorShape(20U, 8U, 4U), 1, DataType::F32),
+        })),
+        framework::dataset::make("OutputInfo", { TensorInfo(TensorShape(32U, 8U, 4U), 1, DataType::U8),
+                                                 TensorInfo(TensorShape(32U, 8U, 4U), 1, DataType::F32),
+                                                 TensorInfo(TensorShape(32U, 8U, 4U), 1, DataType::F32),
+                                                 TensorInfo(TensorShape(32U, 8U, 3U), 1, DataType::F32),
+                                                 TensorInfo(TensorShape(32U, 8U, 4U), 1, DataType::F32),
+                                                 TensorInfo(TensorShape(16U, 8U, 4U), 1, DataType::F32),
+                                                 TensorInfo(TensorShape(32U, 8U, 4U), 1, DataType::F32),
+        })),
+        framework::dataset::make("Expected", { false, false, false, false, false, false, true })),
+        query_info, key_info, value_info, mask_info, output_info, expected)
+{
+    const Status status = NEScaledDotProductAttention::validate(&query_info.clone()->set_is_resizable(false),
+                                                                &key_info.clone()->set_is_resizable(false),
+                                                                &value_info.clone()->set_is_resizable(false),
+                                                                &mask_info.clone()->set_is_resizable(false),
+                                                                &output_info.clone()->set_is_resizable(false));
+    ARM_COMPUTE_EXPECT(bool(status) == expected, framework::LogLevel::ERRORS);
+}
+// clang-format on
+// *INDENT-ON*
+
+template <typename T>
+using NEScaledDotProductAttentionFixture = ScaledDotProductAttentionValidationFixture<Tensor, Accessor, NEScaledDotProductAttention, T>;
+
+TEST_SUITE(Float)
+#ifdef ARM_COMPUTE_ENABLE_FP16
+TEST_SUITE(FP16)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEScaledDotProductAttentionFixture<half>, framework::DatasetMode::PRECOMMIT, combine(SmallSDPADataset, framework::dataset::make("DataType", DataType::F16)))
+{
+    if(CPUInfo::get().has_fp16())
+    {
+        // Validate output
+        validate(Accessor(_target), _reference, tolerance_f16);
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_INFO("Device does not support fp16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_INFO();
+    }
+}
+TEST_SUITE_END() // FP16
+#endif           // ARM_COMPUTE_ENABLE_FP16
+
+#ifdef ARM_COMPUTE_ENABLE_BF16
+TEST_SUITE(BF16)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEScaledDotProductAttentionFixture<bfloat16>, framework::DatasetMode::PRECOMMIT, combine(SmallSDPADataset, framework::dataset::make("DataType", DataType::BFLOAT16)))
+{
+    if(CPUInfo::get().has_bf16())
+    {
+        // Validate output
+        validate(Accessor(_target), _reference, tolerance_bf16);
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_INFO("Device does not support bf16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_INFO();
+    }
+}
+TEST_SUITE_END() // BF16
+#endif           // ARM_COMPUTE_ENABLE_BF16
+
+TEST_SUITE(FP32)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEScaledDotProductAttentionFixture<float>, framework::DatasetMode::PRECOMMIT, combine(SmallSDPADataset, framework::dataset::make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f32);
+}
+FIXTURE_DATA_TEST_CASE(RunLarge, NEScaledDotProductAttentionFixture<float>, framework::DatasetMode::NIGHTLY, combine(LargeSDPADataset, framework::dataset::make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f32);
+}
+TEST_SUITE_END() // FP32
+TEST_SUITE_END() // Float
+
+TEST_SUITE_END() // ScaledDotProductAttention
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
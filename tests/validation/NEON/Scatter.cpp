@@ -49,7 +49,7 @@ using framework::dataset::make;
 
 TEST_SUITE(NEON)
 TEST_SUITE(Scatter)
-DATA_TEST_CASE(Validate, framework::DatasetMode::DISABLED, zip(
+DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(
     make("InputInfo", { TensorInfo(TensorShape(9U), 1, DataType::F32),    // Mismatching data types
                         TensorInfo(TensorShape(15U), 1, DataType::F32),   // Valid
                         TensorInfo(TensorShape(15U), 1, DataType::U8),   // Valid
@@ -117,7 +117,7 @@ const auto allScatterFunctions = make("ScatterFunction",
 
 TEST_SUITE(Float)
 TEST_SUITE(FP32)
-FIXTURE_DATA_TEST_CASE(RunSmall, NEScatterLayerFixture<float>, framework::DatasetMode::DISABLED,
+FIXTURE_DATA_TEST_CASE(RunSmall, NEScatterLayerFixture<float>, framework::DatasetMode::PRECOMMIT,
     combine(datasets::Small1DScatterDataset(),
         make("DataType", {DataType::F32}),
         allScatterFunctions,
@@ -129,7 +129,7 @@ FIXTURE_DATA_TEST_CASE(RunSmall, NEScatterLayerFixture<float>, framework::Datase
 }
 
 // With this test, src should be passed as nullptr.
-FIXTURE_DATA_TEST_CASE(RunSmallZeroInit, NEScatterLayerFixture<float>, framework::DatasetMode::DISABLED,
+FIXTURE_DATA_TEST_CASE(RunSmallZeroInit, NEScatterLayerFixture<float>, framework::DatasetMode::PRECOMMIT,
     combine(datasets::Small1DScatterDataset(),
         make("DataType", {DataType::F32}),
         make("ScatterFunction", {ScatterFunction::Add}),
@@ -141,7 +141,7 @@ FIXTURE_DATA_TEST_CASE(RunSmallZeroInit, NEScatterLayerFixture<float>, framework
 }
 
 // Updates/src/dst have same no. dims.
-FIXTURE_DATA_TEST_CASE(RunSmallMultiDim, NEScatterLayerFixture<float>, framework::DatasetMode::DISABLED,
+FIXTURE_DATA_TEST_CASE(RunSmallMultiDim, NEScatterLayerFixture<float>, framework::DatasetMode::PRECOMMIT,
     combine(datasets::SmallScatterMultiDimDataset(),
         make("DataType", {DataType::F32}),
         allScatterFunctions,
@@ -153,7 +153,7 @@ FIXTURE_DATA_TEST_CASE(RunSmallMultiDim, NEScatterLayerFixture<float>, framework
 }
 
 // m+1-D to m+n-D cases
-FIXTURE_DATA_TEST_CASE(RunSmallMultiIndices, NEScatterLayerFixture<float>, framework::DatasetMode::DISABLED,
+FIXTURE_DATA_TEST_CASE(RunSmallMultiIndices, NEScatterLayerFixture<float>, framework::DatasetMode::PRECOMMIT,
     combine(datasets::SmallScatterMultiIndicesDataset(),
         make("DataType", {DataType::F32}),
         make("ScatterFunction", {ScatterFunction::Update, ScatterFunction::Add }),
@@ -165,7 +165,7 @@ FIXTURE_DATA_TEST_CASE(RunSmallMultiIndices, NEScatterLayerFixture<float>, frame
 }
 
 // m+k, k-1-D m+n-D case
-FIXTURE_DATA_TEST_CASE(RunSmallBatchedMultiIndices, NEScatterLayerFixture<float>, framework::DatasetMode::DISABLED,
+FIXTURE_DATA_TEST_CASE(RunSmallBatchedMultiIndices, NEScatterLayerFixture<float>, framework::DatasetMode::PRECOMMIT,
     combine(datasets::SmallScatterBatchedDataset(),
         make("DataType", {DataType::F32}),
         make("ScatterFunction", {ScatterFunction::Update, ScatterFunction::Add}),
@@ -177,7 +177,7 @@ FIXTURE_DATA_TEST_CASE(RunSmallBatchedMultiIndices, NEScatterLayerFixture<float>
 }
 
 // m+k, k-1-D m+n-D case
-FIXTURE_DATA_TEST_CASE(RunSmallScatterScalar, NEScatterLayerFixture<float>, framework::DatasetMode::DISABLED,
+FIXTURE_DATA_TEST_CASE(RunSmallScatterScalar, NEScatterLayerFixture<float>, framework::DatasetMode::PRECOMMIT,
     combine(datasets::SmallScatterScalarDataset(),
         make("DataType", {DataType::F32}),
         make("ScatterFunction", {ScatterFunction::Update, ScatterFunction::Add}),
@@ -188,14 +188,27 @@ FIXTURE_DATA_TEST_CASE(RunSmallScatterScalar, NEScatterLayerFixture<float>, fram
     validate(Accessor(_target), _reference, tolerance_f32);
 }
 
+// Duplicate indices
+FIXTURE_DATA_TEST_CASE(RunLargeDuplicates, NEScatterLayerFixture<float>, framework::DatasetMode::NIGHTLY,
+    combine(datasets::LargeScatterDuplicatesDataset(),
+        make("DataType", {DataType::F32}),
+        allScatterFunctions,
+        make("ZeroInit", {false}),
+        make("Inplace", {false}),
+        make("Padding", {false, true})))
+{
+    validate(Accessor(_target), _reference, tolerance_f32);
+}
+
 TEST_SUITE_END() // FP32
 
 
 // NOTE: Padding is disabled for the SmallScatterMixedDataset due certain shapes not supporting padding.
 //       Padding is well tested in F32 Datatype test cases.
 
+#ifdef ARM_COMPUTE_ENABLE_FP16
 TEST_SUITE(FP16)
-FIXTURE_DATA_TEST_CASE(RunSmallMixed, NEScatterLayerFixture<half>, framework::DatasetMode::DISABLED,
+FIXTURE_DATA_TEST_CASE(RunSmallMixed, NEScatterLayerFixture<half>, framework::DatasetMode::PRECOMMIT,
     combine(datasets::SmallScatterMixedDataset(),
         make("DataType", {DataType::F16}),
         allScatterFunctions,
@@ -203,14 +216,23 @@ FIXTURE_DATA_TEST_CASE(RunSmallMixed, NEScatterLayerFixture<half>, framework::Da
         make("Inplace", {false}),
         make("Padding", {false})))
 {
-    validate(Accessor(_target), _reference, tolerance_f16);
+    if(CPUInfo::get().has_fp16())
+    {
+        validate(Accessor(_target), _reference, tolerance_f16);
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_INFO("Device does not support fp16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_INFO();
+    }
 }
 TEST_SUITE_END() // FP16
+#endif           // ARM_COMPUTE_ENABLE_FP16
 TEST_SUITE_END() // Float
 
 TEST_SUITE(Integer)
 TEST_SUITE(S32)
-FIXTURE_DATA_TEST_CASE(RunSmallMixed, NEScatterLayerFixture<int32_t>, framework::DatasetMode::DISABLED,
+FIXTURE_DATA_TEST_CASE(RunSmallMixed, NEScatterLayerFixture<int32_t>, framework::DatasetMode::PRECOMMIT,
     combine(datasets::SmallScatterMixedDataset(),
         make("DataType", {DataType::S32}),
         allScatterFunctions,
@@ -223,7 +245,7 @@ FIXTURE_DATA_TEST_CASE(RunSmallMixed, NEScatterLayerFixture<int32_t>, framework:
 TEST_SUITE_END() // S32
 
 TEST_SUITE(S16)
-FIXTURE_DATA_TEST_CASE(RunSmallMixed, NEScatterLayerFixture<int16_t>, framework::DatasetMode::DISABLED,
+FIXTURE_DATA_TEST_CASE(RunSmallMixed, NEScatterLayerFixture<int16_t>, framework::DatasetMode::PRECOMMIT,
     combine(datasets::SmallScatterMixedDataset(),
         make("DataType", {DataType::S16}),
         allScatterFunctions,
@@ -236,7 +258,7 @@ FIXTURE_DATA_TEST_CASE(RunSmallMixed, NEScatterLayerFixture<int16_t>, framework:
 TEST_SUITE_END() // S16
 
 TEST_SUITE(S8)
-FIXTURE_DATA_TEST_CASE(RunSmallMixed, NEScatterLayerFixture<int8_t>, framework::DatasetMode::DISABLED,
+FIXTURE_DATA_TEST_CASE(RunSmallMixed, NEScatterLayerFixture<int8_t>, framework::DatasetMode::PRECOMMIT,
     combine(datasets::SmallScatterMixedDataset(),
         make("DataType", {DataType::S8}),
         allScatterFunctions,
@@ -249,7 +271,7 @@ FIXTURE_DATA_TEST_CASE(RunSmallMixed, NEScatterLayerFixture<int8_t>, framework::
 TEST_SUITE_END() // S8
 
 TEST_SUITE(U32)
-FIXTURE_DATA_TEST_CASE(RunSmallMixed, NEScatterLayerFixture<uint32_t>, framework::DatasetMode::DISABLED,
+FIXTURE_DATA_TEST_CASE(RunSmallMixed, NEScatterLayerFixture<uint32_t>, framework::DatasetMode::PRECOMMIT,
     combine(datasets::SmallScatterMixedDataset(),
         make("DataType", {DataType::U32}),
         allScatterFunctions,
@@ -262,7 +284,7 @@ FIXTURE_DATA_TEST_CASE(RunSmallMixed, NEScatterLayerFixture<uint32_t>, framework
 TEST_SUITE_END() // U32
 
 TEST_SUITE(U16)
-FIXTURE_DATA_TEST_CASE(RunSmallMixed, NEScatterLayerFixture<uint16_t>, framework::DatasetMode::DISABLED,
+FIXTURE_DATA_TEST_CASE(RunSmallMixed, NEScatterLayerFixture<uint16_t>, framework::DatasetMode::PRECOMMIT,
     combine(datasets::SmallScatterMixedDataset(),
         make("DataType", {DataType::U16}),
         allScatterFunctions,
@@ -275,7 +297,7 @@ FIXTURE_DATA_TEST_CASE(RunSmallMixed, NEScatterLayerFixture<uint16_t>, framework
 TEST_SUITE_END() // U16
 
 TEST_SUITE(U8)
-FIXTURE_DATA_TEST_CASE(RunSmallMixed, NEScatterLayerFixture<uint8_t>, framework::DatasetMode::DISABLED,
+FIXTURE_DATA_TEST_CASE(RunSmallMixed, NEScatterLayerFixture<uint8_t>, framework::DatasetMode::PRECOMMIT,
     combine(datasets::SmallScatterMixedDataset(),
         make("DataType", {DataType::U8}),
         allScatterFunctions,
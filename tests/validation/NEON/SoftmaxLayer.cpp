@@ -285,6 +285,38 @@ FIXTURE_DATA_TEST_CASE(RunLarge, NESoftmaxLayerFixture<float>, framework::Datase
     // Validate output
     validate(Accessor(_target), _reference, tolerance_f32);
 }
+DATA_TEST_CASE(RunDynamicShape, framework::DatasetMode::ALL, make("Beta", { 1.0f, 2.0f }), beta)
+{
+    const TensorShape max_shape(27U, 13U, 2U);
+
+    Tensor src = create_tensor<Tensor>(max_shape, DataType::F32);
+    Tensor dst = create_tensor<Tensor>(max_shape, DataType::F32);
+
+    // The configured shape is the largest one
+    set_tensor_dynamic(src);
+    set_tensor_dynamic(dst);
+    NESoftmaxLayer softmax;
+    softmax.configure(&src, &dst, beta, 0);
+    set_tensor_static(src);
+    set_tensor_static(dst);
+
+    src.allocator()->allocate();
+    dst.allocator()->allocate();
+
+    unsigned int seed = 0;
+    for(const TensorShape &shape : { TensorShape(9U, 5U, 2U), max_shape, TensorShape(27U, 1U, 1U), TensorShape(9U, 5U, 2U) })
+    {
+        src.info()->set_tensor_shape(shape);
+        dst.info()->set_tensor_shape(shape);
+        library->fill_tensor_uniform(Accessor(src), seed, -10.f, 10.f);
+
+        softmax.run();
+
+        SimpleTensor<float> ref_src(shape, DataType::F32);
+        library->fill_tensor_uniform(ref_src, seed++, -10.f, 10.f);
+        validate(Accessor(dst), reference::softmax_layer<float>(ref_src, beta, 0), tolerance_f32);
+    }
+}
 TEST_SUITE_END() //FP32
 TEST_SUITE_END() //Float
 
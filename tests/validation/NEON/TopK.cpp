@@ -0,0 +1,227 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/utils/StringUtils.h"
+#include "arm_compute/runtime/NEON/functions/NETopK.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+#include "src/common/cpuinfo/CpuIsaInfo.h"
+#include "src/cpu/kernels/CpuTopKKernel.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/validation/Validation.h"
+#include "tests/validation/fixtures/TopKFixture.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+/** Rows short enough to be handled by the left-over loop, or to fit in the candidates buffer */
+const auto SmallTopKDataset = combine(combine(
+    framework::dataset::make("Shape", { TensorShape(5U, 9U), TensorShape(7U, 3U), TensorShape(67U, 4U, 2U), TensorShape(45U, 1U, 3U, 5U), TensorShape(1000U, 3U) }),
+    framework::dataset::make("K", { 1U, 5U })),
+    framework::dataset::make("Sorted", { true, false }));
+
+/** Rows long enough to fill the candidates buffer several times */
+const auto LargeTopKDataset = combine(combine(
+    framework::dataset::make("Shape", { TensorShape(32000U, 2U), TensorShape(5003U, 7U) }),
+    framework::dataset::make("K", { 1U, 50U, 1500U })),
+    framework::dataset::make("Sorted", { true, false }));
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(TopK)
+
+// *INDENT-OFF*
+// clang-format off
+DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(zip(zip(zip(
+        framework::dataset::make("InputInfo", { TensorInfo(TensorShape(32U, 13U), 1, DataType::U8),  // Wrong data type
+                                                TensorInfo(TensorShape(32U, 13U), 1, DataType::F32), // Mismatching values data type
+                                                TensorInfo(TensorShape(32U, 13U), 1, DataType::F32), // Wrong indices data type
+                                                TensorInfo(TensorShape(32U, 13U), 1, DataType::F32), // Mismatching shapes
+                                                TensorInfo(TensorShape(32U, 13U), 1, DataType::F32), // k larger than the row
+                                                TensorInfo(TensorShape(32U, 13U), 1, DataType::F32), // k is zero
+                                                TensorInfo(TensorShape(32U, 13U), 1, DataType::F32),
+        }),
+        framework::dataset::make("ValuesInfo",{ TensorInfo(TensorShape(4U, 13U), 1, DataType::U8),
+                                                TensorInfo(TensorShape(4U, 13U), 1, DataType::F16),
+                                                TensorInfo(TensorShape(4U, 13U), 1, DataType::F32),
+                                                TensorInfo(TensorShape(5U, 13U), 1, DataType::F32),
+                                                TensorInfo(TensorShape(33U, 13U), 1, DataType::F32),
+                                                TensorInfo(TensorShape(4U, 13U), 1, DataType::F32),
+                                                TensorInfo(TensorShape(4U, 13U), 1, DataType::F32),
+        })),
+        framework::dataset::make("IndicesInfo",{ TensorInfo(TensorShape(4U, 13U), 1, DataType::S32),
+                                                 TensorInfo(TensorShape(4U, 13U), 1, DataType::S32),
+                                                 TensorInfo(TensorShape(4U, 13U), 1, DataType::U32),
+                                                 TensorInfo(TensorShape(4U, 13U), 1, DataType::S32),
+                                                 TensorInfo(TensorShape(33U, 13U), 1, DataType::S32),
+                                                 TensorInfo(TensorShape(4U, 13U), 1, DataType::S32),
+                                                 TensorInfo(TensorShape(4U, 13U), 1, DataType::S32),
+        })),
+        framework::dataset::make("K", { 4U, 4U, 4U, 4U, 33U, 0U, 4U })),
+        framework::dataset::make("Expected", { false, false, false, false, false, false, true })),
+               input_info, values_info, indices_info, k, expected)
+{
+    const Status status = NETopK::validate(&input_info.clone()->set_is_resizable(false),
+                                           &values_info.clone()->set_is_resizable(false),
+                                           &indices_info.clone()->set_is_resizable(false), k);
+    ARM_COMPUTE_EXPECT(bool(status) == expected, framework::LogLevel::ERRORS);
+}
+
+DATA_TEST_CASE(KernelSelection, framework::DatasetMode::ALL,
+               combine(framework::dataset::make("CpuExt", std::string("NEON")),
+                       framework::dataset::make("DataType", { DataType::F32,
+                                                              DataType::F16,
+                                                              DataType::QASYMM8,
+                                                              DataType::QASYMM8_SIGNED
+                                                            })),
+               cpu_ext, data_type)
+{
+    using namespace cpu::kernels;
+
+    cpuinfo::CpuIsaInfo cpu_isa{};
+    cpu_isa.neon = (cpu_ext == "NEON");
+    cpu_isa.fp16 = (data_type == DataType::F16);
+
+    const auto *selected_impl = CpuTopKKernel::get_implementation(DataTypeISASelectorData{data_type, cpu_isa}, cpu::KernelSelectionType::Preferred);
+
+    ARM_COMPUTE_ERROR_ON_NULLPTR(selected_impl);
+
+    std::string expected = lower_string(cpu_ext) + "_" + cpu_impl_dt(data_type) + "_topk";
+    std::string actual   = selected_impl->name;
+
+    ARM_COMPUTE_EXPECT_EQUAL(expected, actual, framework::LogLevel::ERRORS);
+}
+// clang-format on
+// *INDENT-ON*
+
+template <typename T>
+using NETopKFixture = TopKValidationFixture<Tensor, Accessor, NETopK, T>;
+
+TEST_SUITE(Float)
+#ifdef ARM_COMPUTE_ENABLE_FP16
+TEST_SUITE(FP16)
+FIXTURE_DATA_TEST_CASE(RunSmall, NETopKFixture<half>, framework::DatasetMode::PRECOMMIT, combine(SmallTopKDataset, framework::dataset::make("DataType", DataType::F16)))
+{
+    if(CPUInfo::get().has_fp16())
+    {
+        // Validate output
+        validate(Accessor(_target_values), _reference_values);
+        validate(Accessor(_target_indices), _reference_indices);
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_INFO("Device does not support fp16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_INFO();
+    }
+}
+TEST_SUITE_END() // FP16
+#endif           // ARM_COMPUTE_ENABLE_FP16
+
+TEST_SUITE(FP32)
+FIXTURE_DATA_TEST_CASE(RunSmall, NETopKFixture<float>, framework::DatasetMode::PRECOMMIT, combine(SmallTopKDataset, framework::dataset::make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target_values), _reference_values);
+    validate(Accessor(_target_indices), _reference_indices);
+}
+FIXTURE_DATA_TEST_CASE(RunLarge, NETopKFixture<float>, framework::DatasetMode::NIGHTLY, combine(LargeTopKDataset, framework::dataset::make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target_values), _reference_values);
+    validate(Accessor(_target_indices), _reference_indices);
+}
+TEST_CASE(MoreThreadsThanConfigured, framework::DatasetMode::ALL)
+{
+    constexpr unsigned int k = 5;
+    const TensorShape      shape(67U, 16U);
+    const TensorShape      dst_shape(k, 16U);
+    const unsigned int     num_threads = NEScheduler::get().num_threads();
+
+    Tensor src     = create_tensor<Tensor>(shape, DataType::F32);
+    Tensor values  = create_tensor<Tensor>(dst_shape, DataType::F32);
+    Tensor indices = create_tensor<Tensor>(dst_shape, DataType::S32);
+
+    // The scratch is sized for a single thread at configuration, and run with more threads
+    NEScheduler::get().set_num_threads(1);
+    NETopK topk;
+    topk.configure(&src, &values, &indices, k);
+    NEScheduler::get().set_num_threads(4);
+
+    src.allocator()->allocate();
+    values.allocator()->allocate();
+    indices.allocator()->allocate();
+    library->fill_tensor_uniform(Accessor(src), 0);
+
+    topk.run();
+    NEScheduler::get().set_num_threads(num_threads);
+
+    SimpleTensor<float> ref_src{ shape, DataType::F32 };
+    library->fill_tensor_uniform(ref_src, 0);
+    const auto reference = reference::topk<float>(ref_src, k, true);
+    validate(Accessor(values), reference.first);
+    validate(Accessor(indices), reference.second);
+}
+TEST_SUITE_END() // FP32
+TEST_SUITE_END() // Float
+
+TEST_SUITE(Quantized)
+TEST_SUITE(QASYMM8)
+FIXTURE_DATA_TEST_CASE(RunSmall, NETopKFixture<uint8_t>, framework::DatasetMode::PRECOMMIT, combine(SmallTopKDataset, framework::dataset::make("DataType", DataType::QASYMM8)))
+{
+    // Validate output
+    validate(Accessor(_target_values), _reference_values);
+    validate(Accessor(_target_indices), _reference_indices);
+}
+TEST_SUITE_END() // QASYMM8
+
+TEST_SUITE(QASYMM8_SIGNED)
+FIXTURE_DATA_TEST_CASE(RunSmall, NETopKFixture<int8_t>, framework::DatasetMode::PRECOMMIT, combine(SmallTopKDataset, framework::dataset::make("DataType", DataType::QASYMM8_SIGNED)))
+{
+    // Validate output
+    validate(Accessor(_target_values), _reference_values);
+    validate(Accessor(_target_indices), _reference_indices);
+}
+FIXTURE_DATA_TEST_CASE(RunLarge, NETopKFixture<int8_t>, framework::DatasetMode::NIGHTLY, combine(LargeTopKDataset, framework::dataset::make("DataType", DataType::QASYMM8_SIGNED)))
+{
+    // Validate output
+    validate(Accessor(_target_values), _reference_values);
+    validate(Accessor(_target_indices), _reference_indices);
+}
+TEST_SUITE_END() // QASYMM8_SIGNED
+TEST_SUITE_END() // Quantized
+
+TEST_SUITE_END() // TopK
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
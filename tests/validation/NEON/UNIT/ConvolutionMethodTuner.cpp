@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/NEConvolutionMethodTuner.h"
+
+#include "arm_compute/runtime/NEON/functions/NEConvolutionLayer.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "tests/Globals.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/Utils.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/validation/Validation.h"
+#include "tests/validation/reference/ConvolutionLayer.h"
+
+#include <cstdio>
+#include <string>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+constexpr AbsoluteTolerance<float> tolerance_f(0.002f); /**< Tolerance value for comparing reference's output against implementation's output for FP32 data types */
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(UNIT)
+TEST_SUITE(ConvolutionMethodTuner)
+
+TEST_CASE(MethodTable, framework::DatasetMode::ALL)
+{
+    NEConvolutionMethodTuner tuner(false);
+    ARM_COMPUTE_EXPECT(!tuner.tune_new_convolutions(), framework::LogLevel::ERRORS);
+
+    ConvolutionMethod method = ConvolutionMethod::GEMM;
+    ARM_COMPUTE_EXPECT(!tuner.find_method("conv_0", method), framework::LogLevel::ERRORS);
+
+    tuner.add_method("conv_0", ConvolutionMethod::WINOGRAD);
+    tuner.add_method("conv_1", ConvolutionMethod::GEMM_CONV2D);
+    tuner.add_method("conv_0", ConvolutionMethod::DIRECT);
+    ARM_COMPUTE_EXPECT(tuner.method_table().size() == 2, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(tuner.find_method("conv_0", method), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(method == ConvolutionMethod::DIRECT, framework::LogLevel::ERRORS);
+
+    // Round-trip through a file
+    const std::string filename = "acl_conv_method_table.csv";
+    ARM_COMPUTE_EXPECT(tuner.save_to_file(filename), framework::LogLevel::ERRORS);
+
+    NEConvolutionMethodTuner loaded;
+    loaded.load_from_file(filename);
+    std::remove(filename.c_str());
+    ARM_COMPUTE_EXPECT(loaded.method_table() == tuner.method_table(), framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(TunedConvolution, framework::DatasetMode::ALL)
+{
+    const TensorShape   src_shape(12U, 12U, 16U);
+    const TensorShape   weights_shape(3U, 3U, 16U, 8U);
+    const TensorShape   bias_shape(8U);
+    const TensorShape   dst_shape(12U, 12U, 8U);
+    const PadStrideInfo conv_info(1, 1, 1, 1);
+
+    NEConvolutionMethodTuner tuner;
+    NEConvolutionMethodTuner::set_active_tuner(&tuner);
+
+    Tensor src     = create_tensor<Tensor>(src_shape, DataType::F32);
+    Tensor weights = create_tensor<Tensor>(weights_shape, DataType::F32);
+    Tensor bias    = create_tensor<Tensor>(bias_shape, DataType::F32);
+    Tensor dst     = create_tensor<Tensor>(dst_shape, DataType::F32);
+
+    NEConvolutionLayer conv;
+    conv.configure(&src, &weights, &bias, &dst, conv_info);
+    NEConvolutionMethodTuner::set_active_tuner(nullptr);
+
+    // The convolution has been tuned once, the method recorded by NEConvolutionLayer being reused by CpuConv2d
+    ARM_COMPUTE_EXPECT(tuner.method_table().size() == 1, framework::LogLevel::ERRORS);
+
+    src.allocator()->allocate();
+    weights.allocator()->allocate();
+    bias.allocator()->allocate();
+    dst.allocator()->allocate();
+    library->fill_tensor_uniform(Accessor(src), 0);
+    library->fill_tensor_uniform(Accessor(weights), 1);
+    library->fill_tensor_uniform(Accessor(bias), 2);
+
+    conv.run();
+
+    SimpleTensor<float> ref_src{ src_shape, DataType::F32 };
+    SimpleTensor<float> ref_weights{ weights_shape, DataType::F32 };
+    SimpleTensor<float> ref_bias{ bias_shape, DataType::F32 };
+    library->fill_tensor_uniform(ref_src, 0);
+    library->fill_tensor_uniform(ref_weights, 1);
+    library->fill_tensor_uniform(ref_bias, 2);
+
+    validate(Accessor(dst), reference::convolution_layer<float>(ref_src, ref_weights, ref_bias, dst_shape, conv_info), tolerance_f);
+}
+
+TEST_CASE(ValidateDoesNotTune, framework::DatasetMode::ALL)
+{
+    const TensorInfo src(TensorShape(12U, 12U, 16U), 1, DataType::F32);
+    const TensorInfo weights(TensorShape(3U, 3U, 16U, 8U), 1, DataType::F32);
+    const TensorInfo bias(TensorShape(8U), 1, DataType::F32);
+    const TensorInfo dst(TensorShape(12U, 12U, 8U), 1, DataType::F32);
+
+    NEConvolutionMethodTuner tuner;
+    NEConvolutionMethodTuner::set_active_tuner(&tuner);
+    const Status status = NEConvolutionLayer::validate(&src, &weights, &bias, &dst, PadStrideInfo(1, 1, 1, 1));
+    NEConvolutionLayer::get_convolution_method(&src, &weights, &dst, PadStrideInfo(1, 1, 1, 1));
+    NEConvolutionMethodTuner::set_active_tuner(nullptr);
+
+    // Only configure() times the convolution methods
+    ARM_COMPUTE_EXPECT(bool(status), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(tuner.method_table().empty(), framework::LogLevel::ERRORS);
+}
+
+TEST_SUITE_END() // ConvolutionMethodTuner
+TEST_SUITE_END() // UNIT
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/NEGEMMTuner.h"
+
+#include "arm_compute/runtime/NEON/functions/NEGEMM.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "tests/Globals.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/Utils.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/validation/Validation.h"
+#include "tests/validation/reference/GEMM.h"
+
+#include <cstdio>
+#include <string>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+constexpr AbsoluteTolerance<float> tolerance_f(0.001f); /**< Tolerance value for comparing reference's output against implementation's output for FP32 data types */
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(UNIT)
+TEST_SUITE(GEMMTuner)
+
+TEST_CASE(KernelTable, framework::DatasetMode::ALL)
+{
+    NEGEMMTuner tuner(false);
+    ARM_COMPUTE_EXPECT(!tuner.tune_new_kernels(), framework::LogLevel::ERRORS);
+
+    std::string kernel_name;
+    ARM_COMPUTE_EXPECT(!tuner.find_kernel("gemm_0", kernel_name), framework::LogLevel::ERRORS);
+
+    tuner.add_kernel("gemm_0", "kernel_a");
+    tuner.add_kernel("gemm_1", "kernel_b");
+    tuner.add_kernel("gemm_0", "kernel_c");
+    ARM_COMPUTE_EXPECT(tuner.kernel_table().size() == 2, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(tuner.find_kernel("gemm_0", kernel_name), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(kernel_name == "kernel_c", framework::LogLevel::ERRORS);
+
+    // Round-trip through a file
+    const std::string filename = "acl_gemm_tuner_table.csv";
+    ARM_COMPUTE_EXPECT(tuner.save_to_file(filename), framework::LogLevel::ERRORS);
+
+    NEGEMMTuner loaded;
+    loaded.load_from_file(filename);
+    std::remove(filename.c_str());
+    ARM_COMPUTE_EXPECT(loaded.kernel_table() == tuner.kernel_table(), framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(TunedGEMM, framework::DatasetMode::ALL)
+{
+    const unsigned int M = 33;
+    const unsigned int N = 47;
+    const unsigned int K = 64;
+
+    const TensorShape a_shape(K, M);
+    const TensorShape b_shape(N, K);
+    const TensorShape d_shape(N, M);
+
+    NEGEMMTuner tuner;
+    NEGEMMTuner::set_active_tuner(&tuner);
+
+    Tensor a = create_tensor<Tensor>(a_shape, DataType::F32);
+    Tensor b = create_tensor<Tensor>(b_shape, DataType::F32);
+    Tensor d = create_tensor<Tensor>(d_shape, DataType::F32);
+
+    NEGEMM gemm;
+    gemm.configure(&a, &b, nullptr, &d, 1.f, 0.f);
+    NEGEMMTuner::set_active_tuner(nullptr);
+
+    // At most one shape has been tuned, and only kernels with a name can be recorded
+    ARM_COMPUTE_EXPECT(tuner.kernel_table().size() <= 1, framework::LogLevel::ERRORS);
+    for(const auto &entry : tuner.kernel_table())
+    {
+        ARM_COMPUTE_EXPECT(!entry.second.empty(), framework::LogLevel::ERRORS);
+    }
+
+    a.allocator()->allocate();
+    b.allocator()->allocate();
+    d.allocator()->allocate();
+    library->fill_tensor_uniform(Accessor(a), 0);
+    library->fill_tensor_uniform(Accessor(b), 1);
+
+    gemm.run();
+
+    SimpleTensor<float> ref_a{ a_shape, DataType::F32 };
+    SimpleTensor<float> ref_b{ b_shape, DataType::F32 };
+    SimpleTensor<float> ref_c{ d_shape, DataType::F32 };
+    library->fill_tensor_uniform(ref_a, 0);
+    library->fill_tensor_uniform(ref_b, 1);
+    library->fill_tensor_value(ref_c, 0.f);
+
+    validate(Accessor(d), reference::gemm<float>(ref_a, ref_b, ref_c, 1.f, 0.f), tolerance_f);
+}
+
+TEST_SUITE_END() // GEMMTuner
+TEST_SUITE_END() // UNIT
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
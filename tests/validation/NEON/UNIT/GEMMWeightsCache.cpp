@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/NEGEMMWeightsCache.h"
+
+#include "arm_compute/runtime/NEON/functions/NEGEMM.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "src/cpu/operators/internal/CpuGemmAssemblyDispatch.h"
+#include "tests/Globals.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/Utils.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/validation/Validation.h"
+#include "tests/validation/reference/GEMM.h"
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#if !defined(_WIN64) && !defined(BARE_METAL)
+#include <dirent.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+constexpr AbsoluteTolerance<float> tolerance_f(0.001f); /**< Tolerance value for comparing reference's output against implementation's output for FP32 data types */
+
+/** Temporary directory removed with its content on destruction */
+class TemporaryDirectory
+{
+public:
+    TemporaryDirectory()
+    {
+        char path[] = "/tmp/acl_weights_cache_XXXXXX";
+        ARM_COMPUTE_ASSERT(mkdtemp(path) != nullptr);
+        _path = path;
+    }
+    ~TemporaryDirectory()
+    {
+        DIR *dir = opendir(_path.c_str());
+        if(dir != nullptr)
+        {
+            for(struct dirent *entry = readdir(dir); entry != nullptr; entry = readdir(dir))
+            {
+                if(std::strcmp(entry->d_name, ".") != 0 && std::strcmp(entry->d_name, "..") != 0)
+                {
+                    std::remove((_path + "/" + entry->d_name).c_str());
+                }
+            }
+            closedir(dir);
+        }
+        rmdir(_path.c_str());
+    }
+    const std::string &path() const
+    {
+        return _path;
+    }
+
+private:
+    std::string _path{};
+};
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(UNIT)
+TEST_SUITE(GEMMWeightsCache)
+
+TEST_CASE(StoreAndFind, framework::DatasetMode::ALL)
+{
+    TemporaryDirectory dir;
+    std::vector<char>  data(10000);
+    for(size_t i = 0; i < data.size(); ++i)
+    {
+        data[i] = static_cast<char>(i * 7);
+    }
+
+    {
+        NEGEMMWeightsCache cache(dir.path());
+        ARM_COMPUTE_EXPECT(cache.find("entry", data.size()) == nullptr, framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(cache.store("entry", data.data(), data.size()), framework::LogLevel::ERRORS);
+    }
+
+    NEGEMMWeightsCache cache(dir.path());
+    const void        *mapped = cache.find("entry", data.size());
+    ARM_COMPUTE_ASSERT(mapped != nullptr);
+    ARM_COMPUTE_EXPECT(reinterpret_cast<uintptr_t>(mapped) % 128 == 0, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(std::memcmp(mapped, data.data(), data.size()) == 0, framework::LogLevel::ERRORS);
+
+    // Entries only match with the same key and size
+    ARM_COMPUTE_EXPECT(cache.find("entry", data.size() - 1) == nullptr, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(cache.find("other_entry", data.size()) == nullptr, framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(CachedGEMM, framework::DatasetMode::ALL)
+{
+    const TensorShape a_shape(64U, 33U);
+    const TensorShape b_shape(47U, 64U);
+    const TensorShape d_shape(47U, 33U);
+
+    SimpleTensor<float> ref_a{ a_shape, DataType::F32 };
+    SimpleTensor<float> ref_b{ b_shape, DataType::F32 };
+    SimpleTensor<float> ref_c{ d_shape, DataType::F32 };
+    library->fill_tensor_uniform(ref_a, 0);
+    library->fill_tensor_uniform(ref_b, 1);
+    library->fill_tensor_value(ref_c, 0.f);
+    const SimpleTensor<float> reference = reference::gemm<float>(ref_a, ref_b, ref_c, 1.f, 0.f);
+
+    TemporaryDirectory dir;
+    NEGEMMWeightsCache cache(dir.path());
+    NEGEMMWeightsCache::set_active_cache(&cache);
+
+    // The first run reshapes and stores the weights, the second one maps them
+    for(int i = 0; i < 2; ++i)
+    {
+        Tensor a = create_tensor<Tensor>(a_shape, DataType::F32);
+        Tensor b = create_tensor<Tensor>(b_shape, DataType::F32);
+        Tensor d = create_tensor<Tensor>(d_shape, DataType::F32);
+
+        NEGEMM gemm;
+        gemm.configure(&a, &b, nullptr, &d, 1.f, 0.f);
+
+        a.allocator()->allocate();
+        b.allocator()->allocate();
+        d.allocator()->allocate();
+        library->fill_tensor_uniform(Accessor(a), 0);
+        library->fill_tensor_uniform(Accessor(b), 1);
+
+        gemm.run();
+
+        validate(Accessor(d), reference, tolerance_f);
+    }
+
+    NEGEMMWeightsCache::set_active_cache(nullptr);
+}
+
+TEST_CASE(NoPersistentReshapedWeights, framework::DatasetMode::ALL)
+{
+    const TensorInfo a_info(TensorShape(64U, 33U), 1, DataType::F32);
+    const TensorInfo b_info(TensorShape(47U, 64U), 1, DataType::F32);
+    TensorInfo       d_info(TensorShape(47U, 33U), 1, DataType::F32);
+
+    if(!bool(cpu::CpuGemmAssemblyDispatch::validate(&a_info, &b_info, nullptr, &d_info, cpu::AsmGemmInfo())))
+    {
+        ARM_COMPUTE_TEST_INFO("No assembly GEMM for this configuration. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_INFO();
+        return;
+    }
+
+    TemporaryDirectory dir;
+    NEGEMMWeightsCache cache(dir.path());
+    NEGEMMWeightsCache::set_active_cache(&cache);
+    cpu::CpuGemmAssemblyDispatch gemm;
+    gemm.configure(&a_info, &b_info, nullptr, &d_info, cpu::AsmGemmInfo());
+    NEGEMMWeightsCache::set_active_cache(nullptr);
+
+    // The functions run on the cache entry, so the reshaped weights only live during prepare()
+    for(const auto &req : gemm.workspace())
+    {
+        ARM_COMPUTE_EXPECT(req.lifetime != experimental::MemoryLifetime::Persistent || req.size == 0, framework::LogLevel::ERRORS);
+    }
+}
+
+TEST_SUITE_END() // GEMMWeightsCache
+TEST_SUITE_END() // UNIT
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif // !defined(_WIN64) && !defined(BARE_METAL)
@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/graph.h"
+
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+
+#include <memory>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+namespace frontend = arm_compute::graph::frontend;
+
+/** Input accessor filling a F32 tensor with a different pattern for each of a fixed number of frames */
+class FrameInputAccessor final : public graph::ITensorAccessor
+{
+public:
+    explicit FrameInputAccessor(unsigned int num_frames) : _num_frames(num_frames)
+    {
+    }
+
+    bool access_tensor(ITensor &tensor) override
+    {
+        if (_frame == _num_frames)
+        {
+            return false;
+        }
+
+        Window window;
+        window.use_tensor_dimensions(tensor.info()->tensor_shape());
+        Iterator     it(&tensor, window);
+        unsigned int i = 0;
+        execute_window_loop(
+            window,
+            [&](const Coordinates &)
+            {
+                *reinterpret_cast<float *>(it.ptr()) = static_cast<float>((i++ * 7 + _frame * 13) % 29) / 7.f - 2.f;
+            },
+            it);
+        ++_frame;
+        return true;
+    }
+
+private:
+    unsigned int _num_frames;
+    unsigned int _frame{0};
+};
+
+/** Output accessor recording the F32 content of a tensor at every frame */
+class FrameOutputAccessor final : public graph::ITensorAccessor
+{
+public:
+    explicit FrameOutputAccessor(std::vector<std::vector<float>> &frames) : _frames(frames)
+    {
+    }
+
+    bool access_tensor(ITensor &tensor) override
+    {
+        Window window;
+        window.use_tensor_dimensions(tensor.info()->tensor_shape());
+        Iterator           it(&tensor, window);
+        std::vector<float> values;
+        execute_window_loop(
+            window, [&](const Coordinates &) { values.push_back(*reinterpret_cast<const float *>(it.ptr())); }, it);
+        _frames.emplace_back(std::move(values));
+        return true;
+    }
+
+private:
+    std::vector<std::vector<float>> &_frames;
+};
+
+/** Run a graph with two independent branches joined by an addition over @p num_frames frames
+ *
+ * @return The output of each frame
+ */
+std::vector<std::vector<float>>
+run_two_branch_graph(graph::GraphID id, const graph::GraphConfig &config, unsigned int num_frames)
+{
+    std::vector<std::vector<float>> outputs;
+
+    frontend::Stream stream(id, "TwoBranches");
+    stream << graph::Target::NEON
+           << frontend::InputLayer(graph::TensorDescriptor(TensorShape(16U, 16U, 8U, 1U), DataType::F32),
+                                   std::make_unique<FrameInputAccessor>(num_frames));
+
+    frontend::SubStream left(stream);
+    left << frontend::ActivationLayer(ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::TANH))
+         << frontend::PoolingLayer(PoolingLayerInfo(PoolingType::AVG, 3, DataLayout::NCHW, PadStrideInfo(1, 1, 1, 1)));
+
+    frontend::SubStream right(stream);
+    right << frontend::ActivationLayer(ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LOGISTIC))
+          << frontend::ActivationLayer(ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU));
+
+    stream << frontend::EltwiseLayer(std::move(left), std::move(right), graph::EltwiseOperation::Add)
+           << frontend::ActivationLayer(ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU))
+           << frontend::OutputLayer(std::make_unique<FrameOutputAccessor>(outputs));
+
+    stream.finalize(graph::Target::NEON, config);
+    stream.run();
+
+    return outputs;
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(UNIT)
+TEST_SUITE(GraphExecution)
+
+#if !defined(BARE_METAL)
+TEST_CASE(ParallelBranchesMatchSerial, framework::DatasetMode::ALL)
+{
+    constexpr unsigned int num_frames = 3;
+
+    const graph::GraphConfig serial_config{};
+    const auto               reference = run_two_branch_graph(0, serial_config, num_frames);
+
+    graph::GraphConfig parallel_config    = serial_config;
+    parallel_config.num_parallel_branches = 2;
+    const auto outputs                    = run_two_branch_graph(1, parallel_config, num_frames);
+
+    ARM_COMPUTE_ASSERT(reference.size() == num_frames);
+    ARM_COMPUTE_EXPECT(outputs == reference, framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(PipelineStagesMatchSerial, framework::DatasetMode::ALL)
+{
+    // Enough frames for all the stages to run concurrently
+    constexpr unsigned int num_frames = 5;
+
+    const graph::GraphConfig serial_config{};
+    const auto               reference = run_two_branch_graph(0, serial_config, num_frames);
+    ARM_COMPUTE_ASSERT(reference.size() == num_frames);
+
+    graph::GraphID id = 1;
+    for (unsigned int num_stages : {2U, 3U})
+    {
+        graph::GraphConfig pipelined_config  = serial_config;
+        pipelined_config.num_pipeline_stages = num_stages;
+        const auto outputs                   = run_two_branch_graph(id++, pipelined_config, num_frames);
+
+        ARM_COMPUTE_EXPECT(outputs == reference, framework::LogLevel::ERRORS);
+    }
+}
+#endif // !defined(BARE_METAL)
+
+TEST_SUITE_END() // GraphExecution
+TEST_SUITE_END() // UNIT
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
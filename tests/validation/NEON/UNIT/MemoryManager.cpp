@@ -26,6 +26,8 @@
 #include "arm_compute/runtime/MemoryGroup.h"
 #include "arm_compute/runtime/MemoryManagerOnDemand.h"
 #include "arm_compute/runtime/NEON/functions/NENormalizationLayer.h"
+#include "arm_compute/runtime/OffsetLifetimeManager.h"
+#include "arm_compute/runtime/PlannedLifetimeManager.h"
 #include "arm_compute/runtime/PoolManager.h"
 #include "arm_compute/runtime/TensorAllocator.h"
 #include "tests/AssetsLibrary.h"
@@ -89,6 +91,64 @@ TEST_CASE(BlobMemoryManagerSimpleWithinFunctionLevel, framework::DatasetMode::AL
     ARM_COMPUTE_EXPECT(mm->pool_manager()->num_pools() == 0, framework::LogLevel::ERRORS);
 }
 
+TEST_CASE(PlannedMemoryManagerOffsets, framework::DatasetMode::ALL)
+{
+    // Lifetimes: a and b overlap, then b, c and d overlap once a is released
+    const std::vector<size_t> sizes{ 1000U, 200U, 200U, 1000U };
+
+    const auto plan = [&](std::shared_ptr<ISimpleLifetimeManager> lifetime_mgr, std::vector<uint8_t *> &buffers)
+    {
+        Allocator   allocator{};
+        auto        mm = std::make_shared<MemoryManagerOnDemand>(lifetime_mgr, std::make_shared<PoolManager>());
+        MemoryGroup group(mm);
+
+        std::vector<Tensor> tensors(sizes.size());
+        for(size_t i = 0; i < sizes.size(); ++i)
+        {
+            tensors[i].allocator()->init(TensorInfo(TensorShape(sizes[i]), 1, DataType::F32));
+        }
+        group.manage(&tensors[0]);
+        group.manage(&tensors[1]);
+        tensors[0].allocator()->allocate();
+        group.manage(&tensors[2]);
+        group.manage(&tensors[3]);
+        tensors[1].allocator()->allocate();
+        tensors[2].allocator()->allocate();
+        tensors[3].allocator()->allocate();
+
+        mm->populate(allocator, 1 /* num_pools */);
+        ARM_COMPUTE_EXPECT(lifetime_mgr->are_all_finalized(), framework::LogLevel::ERRORS);
+
+        group.acquire();
+        buffers.clear();
+        for(auto &tensor : tensors)
+        {
+            buffers.push_back(tensor.buffer());
+        }
+        group.release();
+        mm->clear();
+    };
+
+    auto                   offset_mgr  = std::make_shared<OffsetLifetimeManager>();
+    auto                   planned_mgr = std::make_shared<PlannedLifetimeManager>();
+    std::vector<uint8_t *> buffers;
+    plan(offset_mgr, buffers);
+    plan(planned_mgr, buffers);
+
+    // Tensors alive at the same time don't overlap
+    const auto overlap = [&](size_t i, size_t j)
+    {
+        return buffers[i] < buffers[j] + sizes[j] * sizeof(float) && buffers[j] < buffers[i] + sizes[i] * sizeof(float);
+    };
+    ARM_COMPUTE_EXPECT(!overlap(0, 1), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(!overlap(1, 2) && !overlap(1, 3) && !overlap(2, 3), framework::LogLevel::ERRORS);
+
+    // The largest set of tensors alive at the same time is { b, c, d }
+    ARM_COMPUTE_EXPECT(planned_mgr->lower_bound() == (sizes[1] + sizes[2] + sizes[3]) * sizeof(float), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(planned_mgr->peak_size() >= planned_mgr->lower_bound(), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(planned_mgr->peak_size() < offset_mgr->info().size, framework::LogLevel::ERRORS);
+}
+
 TEST_SUITE_END()
 TEST_SUITE_END()
 TEST_SUITE_END()
@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/Tensor.h"
+
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "utils/GraphUtils.h"
+#include "utils/Utils.h"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#if !defined(_WIN64) && !defined(BARE_METAL)
+#include <stdlib.h>
+#include <unistd.h>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+const TensorShape tensor_shape(4U, 3U);
+
+/** Value of the element (x, y) of the test tensor */
+float expected_value(size_t x, size_t y)
+{
+    return static_cast<float>(x * 10 + y) + 0.5f;
+}
+
+/** Temporary F32 .npy file of @ref tensor_shape removed on destruction
+ *
+ * The header is padded so that the data is 64-byte aligned and can be imported. The NumPy shape lists the dimensions
+ * of the tensor in reverse order: C-ordered data therefore matches the tensor layout, while Fortran-ordered data is
+ * its transpose.
+ */
+class TemporaryNpyFile
+{
+public:
+    explicit TemporaryNpyFile(bool fortran_order)
+    {
+        char path[] = "/tmp/acl_npy_XXXXXX";
+        const int fd = mkstemp(path);
+        ARM_COMPUTE_ASSERT(fd >= 0);
+        close(fd);
+        _path = path;
+
+        const size_t dim0 = tensor_shape[0];
+        const size_t dim1 = tensor_shape[1];
+
+        std::string dict = "{'descr': '" + utils::get_typestring(DataType::F32) + "', 'fortran_order': " +
+                           (fortran_order ? "True" : "False") + ", 'shape': (" + std::to_string(dim1) + ", " +
+                           std::to_string(dim0) + "), }";
+        // Magic string, version and header length take 10 bytes, the header ends with a newline
+        while((10 + dict.size() + 1) % 64 != 0)
+        {
+            dict += ' ';
+        }
+        dict += '\n';
+
+        std::ofstream fs(_path, std::ios::out | std::ios::binary);
+        const char    preamble[] = { '\x93', 'N', 'U', 'M', 'P', 'Y', '\x01', '\x00' };
+        fs.write(preamble, sizeof(preamble));
+        const uint16_t header_len = static_cast<uint16_t>(dict.size());
+        fs.put(static_cast<char>(header_len & 0xff));
+        fs.put(static_cast<char>(header_len >> 8));
+        fs.write(dict.data(), dict.size());
+
+        std::vector<float> data(dim0 * dim1);
+        for(size_t y = 0; y < dim1; ++y)
+        {
+            for(size_t x = 0; x < dim0; ++x)
+            {
+                data[fortran_order ? x * dim1 + y : y * dim0 + x] = expected_value(x, y);
+            }
+        }
+        fs.write(reinterpret_cast<const char *>(data.data()), data.size() * sizeof(float));
+    }
+    ~TemporaryNpyFile()
+    {
+        std::remove(_path.c_str());
+    }
+    const std::string &path() const
+    {
+        return _path;
+    }
+
+private:
+    std::string _path{};
+};
+
+/** Check that a F32 tensor without padding holds the expected values */
+bool has_expected_values(const float *data)
+{
+    for(size_t y = 0; y < tensor_shape[1]; ++y)
+    {
+        for(size_t x = 0; x < tensor_shape[0]; ++x)
+        {
+            if(data[y * tensor_shape[0] + x] != expected_value(x, y))
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(UNIT)
+TEST_SUITE(NumPyBinLoader)
+
+TEST_CASE(ImportMatchesCopy, framework::DatasetMode::ALL)
+{
+    TemporaryNpyFile file(false);
+    const TensorInfo info(tensor_shape, 1, DataType::F32);
+
+    // Imported tensor
+    graph_utils::NumPyBinLoader import_loader(file.path());
+    void                       *mapped = import_loader.import_memory(info);
+    ARM_COMPUTE_ASSERT(mapped != nullptr);
+    Tensor imported;
+    imported.allocator()->init(info);
+    ARM_COMPUTE_ASSERT(bool(imported.allocator()->import_memory(mapped)));
+    ARM_COMPUTE_EXPECT(import_loader.access_tensor(imported), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(imported.buffer() == mapped, framework::LogLevel::ERRORS);
+
+    // Copied tensor
+    graph_utils::NumPyBinLoader copy_loader(file.path(), DataLayout::NCHW, false);
+    ARM_COMPUTE_EXPECT(copy_loader.import_memory(info) == nullptr, framework::LogLevel::ERRORS);
+    Tensor copied;
+    copied.allocator()->init(info);
+    copied.allocator()->allocate();
+    ARM_COMPUTE_EXPECT(copy_loader.access_tensor(copied), framework::LogLevel::ERRORS);
+
+    ARM_COMPUTE_EXPECT(has_expected_values(reinterpret_cast<const float *>(imported.buffer())), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(std::memcmp(imported.buffer(), copied.buffer(), info.total_size()) == 0, framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(FortranOrderIsCopied, framework::DatasetMode::ALL)
+{
+    TemporaryNpyFile file(true);
+    const TensorInfo info(tensor_shape, 1, DataType::F32);
+
+    // Fortran-ordered data needs to be transposed: the file must not be imported as is
+    graph_utils::NumPyBinLoader loader(file.path());
+    ARM_COMPUTE_EXPECT(loader.import_memory(info) == nullptr, framework::LogLevel::ERRORS);
+
+    Tensor tensor;
+    tensor.allocator()->init(info);
+    tensor.allocator()->allocate();
+    ARM_COMPUTE_EXPECT(loader.access_tensor(tensor), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(has_expected_values(reinterpret_cast<const float *>(tensor.buffer())), framework::LogLevel::ERRORS);
+}
+
+TEST_SUITE_END() // NumPyBinLoader
+TEST_SUITE_END() // UNIT
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif // !defined(_WIN64) && !defined(BARE_METAL)
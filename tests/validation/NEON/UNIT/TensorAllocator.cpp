@@ -25,6 +25,7 @@
 
 #include "arm_compute/core/utils/misc/MMappedFile.h"
 #include "arm_compute/core/utils/misc/Utility.h"
+#include "arm_compute/runtime/HugePageAllocator.h"
 #include "arm_compute/runtime/MemoryGroup.h"
 #include "arm_compute/runtime/MemoryRegion.h"
 #include "arm_compute/runtime/NEON/functions/NEActivationLayer.h"
@@ -36,8 +37,11 @@
 #include "tests/validation/Validation.h"
 #include "tests/validation/reference/ActivationLayer.h"
 
+#include <cstring>
+#include <fstream>
 #include <memory>
 #include <random>
+#include <string>
 
 namespace arm_compute
 {
@@ -274,6 +278,99 @@ TEST_CASE(AlignedAlloc, framework::DatasetMode::ALL)
                        framework::LogLevel::ERRORS);
 }
 
+TEST_CASE(HugePageAlloc, framework::DatasetMode::ALL)
+{
+    // Map every buffer, however small, to exercise the huge page path
+    HugePageAllocator allocator(HugePageMode::Transparent, -1, true, 0);
+    const size_t      page_size = allocator.page_size();
+    ARM_COMPUTE_ASSERT(page_size != 0);
+
+    // Regions are aligned to the huge page size and writable
+    std::unique_ptr<IMemoryRegion> region = allocator.make_region(3 * page_size / 2, 0);
+    ARM_COMPUTE_ASSERT(region != nullptr);
+    ARM_COMPUTE_ASSERT(region->buffer() != nullptr);
+    ARM_COMPUTE_EXPECT(region->size() == 3 * page_size / 2, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(arm_compute::utility::check_aligned(region->buffer(), page_size), framework::LogLevel::ERRORS);
+    std::memset(region->buffer(), 0xA5, region->size());
+
+    std::unique_ptr<IMemoryRegion> sub_region = region->extract_subregion(page_size, 64);
+    ARM_COMPUTE_ASSERT(sub_region != nullptr);
+    ARM_COMPUTE_EXPECT(sub_region->buffer() == static_cast<uint8_t *>(region->buffer()) + page_size,
+                       framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(*static_cast<uint8_t *>(sub_region->buffer()) == 0xA5, framework::LogLevel::ERRORS);
+
+    // Raw allocations
+    void *ptr = allocator.allocate(4096, 256);
+    ARM_COMPUTE_ASSERT(ptr != nullptr);
+    ARM_COMPUTE_EXPECT(arm_compute::utility::check_aligned(ptr, 256), framework::LogLevel::ERRORS);
+    std::memset(ptr, 0, 4096);
+    allocator.free(ptr);
+
+    // Unmanaged tensors are allocated through the allocator set on them
+    TensorInfo info(TensorShape(24U, 16U, 3U), 1, DataType::F32);
+    Tensor     t;
+    t.allocator()->init(info);
+    t.allocator()->set_allocator(&allocator);
+    t.allocator()->allocate();
+
+    ARM_COMPUTE_ASSERT(t.buffer() != nullptr);
+    ARM_COMPUTE_EXPECT(arm_compute::utility::check_aligned(reinterpret_cast<void *>(t.buffer()), page_size),
+                       framework::LogLevel::ERRORS);
+    std::memset(t.buffer(), 0, info.total_size());
+    t.allocator()->free();
+}
+
+#if !defined(_WIN64) && !defined(BARE_METAL)
+TEST_CASE(HugePageAllocExplicit, framework::DatasetMode::ALL)
+{
+    // Number of free pages of the huge page pool, 0 if there is no pool
+    const auto free_huge_pages = []()
+    {
+        std::ifstream meminfo("/proc/meminfo");
+        std::string   line;
+        while(std::getline(meminfo, line))
+        {
+            if(line.compare(0, 15, "HugePages_Free:") == 0)
+            {
+                return std::stoul(line.substr(15));
+            }
+        }
+        return 0UL;
+    };
+
+    const unsigned long free_before = free_huge_pages();
+    if(free_before < 2)
+    {
+        ARM_COMPUTE_TEST_INFO("The huge page pool has less than 2 free pages. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_INFO();
+        return;
+    }
+
+    HugePageAllocator allocator(HugePageMode::Explicit, -1, true, 0);
+    const size_t      page_size = allocator.page_size();
+    ARM_COMPUTE_ASSERT(page_size != 0);
+
+    // A region of one and a half pages takes exactly two pages of the pool
+    std::unique_ptr<IMemoryRegion> region = allocator.make_region(3 * page_size / 2, 0);
+    ARM_COMPUTE_ASSERT(region != nullptr);
+    ARM_COMPUTE_ASSERT(region->buffer() != nullptr);
+    ARM_COMPUTE_EXPECT(arm_compute::utility::check_aligned(region->buffer(), page_size), framework::LogLevel::ERRORS);
+    std::memset(region->buffer(), 0xA5, region->size());
+    ARM_COMPUTE_EXPECT(free_huge_pages() == free_before - 2, framework::LogLevel::ERRORS);
+
+    // All the pages go back to the pool
+    region.reset();
+    ARM_COMPUTE_EXPECT(free_huge_pages() == free_before, framework::LogLevel::ERRORS);
+
+    void *ptr = allocator.allocate(page_size, 256);
+    ARM_COMPUTE_ASSERT(ptr != nullptr);
+    std::memset(ptr, 0, page_size);
+    ARM_COMPUTE_EXPECT(free_huge_pages() == free_before - 1, framework::LogLevel::ERRORS);
+    allocator.free(ptr);
+    ARM_COMPUTE_EXPECT(free_huge_pages() == free_before, framework::LogLevel::ERRORS);
+}
+#endif // !defined(_WIN64) && !defined(BARE_METAL)
+
 TEST_SUITE_END()
 TEST_SUITE_END()
 TEST_SUITE_END()
@@ -26,8 +26,13 @@
 #include "arm_compute/core/CPP/ICPPKernel.h"
 #include "tests/framework/Asserts.h"
 #include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
 
+#include <atomic>
 #include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
 
 using namespace arm_compute;
 using namespace arm_compute::test;
@@ -64,10 +69,165 @@ public:
     }
 
 };
+
+/** Kernel recording, for every element of its window, the value of a shared step counter when it was visited */
+class RecordingKernel: public ICPPKernel
+{
+public:
+    RecordingKernel(std::atomic<int> &step, unsigned int size)
+        : _step(step), _visits(size)
+    {
+        Window window;
+        window.set(0, Window::Dimension(0, size));
+        configure(window);
+    }
+
+    const char* name() const override
+    {
+        return "RecordingKernel";
+    }
+
+    void run(const Window &window, const ThreadInfo &) override
+    {
+        for(int x = window.x().start(); x < window.x().end(); ++x)
+        {
+            _visits[x] = _step++;
+        }
+    }
+
+    int first_visit() const
+    {
+        int first = _visits[0];
+        for(auto v : _visits)
+        {
+            first = std::min(first, v);
+        }
+        return first;
+    }
+
+    int last_visit() const
+    {
+        int last = _visits[0];
+        for(auto v : _visits)
+        {
+            last = std::max(last, v);
+        }
+        return last;
+    }
+
+private:
+    std::atomic<int> &_step;
+    std::vector<int>  _visits;
+};
+
+/** Kernel recording the number of elements of its window processed by each thread */
+class SharingKernel: public ICPPKernel
+{
+public:
+    SharingKernel(unsigned int size, unsigned int num_threads)
+        : _shares(num_threads)
+    {
+        Window window;
+        window.set(0, Window::Dimension(0, size));
+        configure(window);
+    }
+
+    const char* name() const override
+    {
+        return "SharingKernel";
+    }
+
+    void run(const Window &window, const ThreadInfo &info) override
+    {
+        _shares[info.thread_id] += window.x().end() - window.x().start();
+    }
+
+    const std::vector<int> &shares() const
+    {
+        return _shares;
+    }
+
+private:
+    std::vector<int> _shares;
+};
+
+/** Scheduler running the workloads sequentially, on threads with the given capacities */
+class WeightedScheduler final : public IScheduler
+{
+public:
+    explicit WeightedScheduler(std::vector<unsigned int> weights)
+        : _weights(std::move(weights))
+    {
+    }
+
+    void set_num_threads(unsigned int) override
+    {
+    }
+
+    unsigned int num_threads() const override
+    {
+        return _weights.size();
+    }
+
+    void schedule(ICPPKernel *kernel, const Hints &hints) override
+    {
+        ITensorPack tensors;
+        schedule_common(kernel, hints, kernel->window(), tensors);
+    }
+
+    void schedule_op(ICPPKernel *kernel, const Hints &hints, const Window &window, ITensorPack &tensors) override
+    {
+        schedule_common(kernel, hints, window, tensors);
+    }
+
+protected:
+    void run_workloads(std::vector<Workload> &workloads) override
+    {
+        ThreadInfo info;
+        info.num_threads = workloads.size();
+        for(unsigned int t = 0; t < workloads.size(); ++t)
+        {
+            info.thread_id = t;
+            workloads[t](info);
+        }
+    }
+
+    std::vector<unsigned int> thread_weights(unsigned int num_threads, const Hints &) const override
+    {
+        return std::vector<unsigned int>(_weights.begin(), _weights.begin() + num_threads);
+    }
+
+private:
+    std::vector<unsigned int> _weights;
+};
 }
 
 TEST_SUITE(UNIT)
 TEST_SUITE(CPPScheduler)
+TEST_CASE(WeightedStaticSplit, framework::DatasetMode::ALL)
+{
+    WeightedScheduler scheduler({ 1024, 384, 1024, 512 });
+    SharingKernel     kernel(2944, 4);
+
+    scheduler.schedule(&kernel, IScheduler::Hints(0));
+
+    // Shares proportional to the capacities of the threads
+    const std::vector<int> expected{ 1024, 384, 1024, 512 };
+    ARM_COMPUTE_EXPECT(kernel.shares() == expected, framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(IdleThreads, framework::DatasetMode::ALL)
+{
+    WeightedScheduler scheduler({ 1, 0, 1 });
+    SharingKernel     kernel(100, 3);
+
+    // Threads with a weight of 0 are kept idle even with the DYNAMIC strategy
+    scheduler.schedule(&kernel, IScheduler::Hints(0, IScheduler::StrategyHint::DYNAMIC, 16));
+
+    const std::vector<int> expected{ 50, 0, 50 };
+    ARM_COMPUTE_EXPECT(kernel.shares() == expected, framework::LogLevel::ERRORS);
+}
+
 #if defined(ARM_COMPUTE_CPP_SCHEDULER) && !defined(BARE_METAL)
 TEST_CASE(RethrowException, framework::DatasetMode::ALL)
 {
@@ -86,6 +246,118 @@ TEST_CASE(RethrowException, framework::DatasetMode::ALL)
     }
     ARM_COMPUTE_EXPECT_FAIL("Expected exception not caught", framework::LogLevel::ERRORS);
 }
+
+TEST_CASE(AsyncDependencies, framework::DatasetMode::ALL)
+{
+    // Two schedulers with disjoint pools of threads, one per branch
+    CPPScheduler scheduler_a;
+    CPPScheduler scheduler_b;
+    scheduler_a.set_num_threads(2);
+    scheduler_b.set_num_threads(2);
+
+    std::atomic<int> step{ 0 };
+    RecordingKernel  producer(step, 64);
+    RecordingKernel  branch_a(step, 64);
+    RecordingKernel  branch_b(step, 64);
+    RecordingKernel  consumer(step, 64);
+
+    const CPPScheduler::Hints hints(0, IScheduler::StrategyHint::DYNAMIC, 16);
+    ITensorPack               tensors;
+
+    auto done_producer = scheduler_a.schedule_op_async(&producer, hints, producer.window(), tensors);
+    auto done_a        = scheduler_a.schedule_op_async(&branch_a, hints, branch_a.window(), tensors, { done_producer });
+    auto done_b        = scheduler_b.schedule_op_async(&branch_b, hints, branch_b.window(), tensors, { done_producer });
+    auto done_consumer = scheduler_b.schedule_op_async(&consumer, hints, consumer.window(), tensors, { done_a, done_b });
+    done_consumer.get();
+
+    ARM_COMPUTE_EXPECT(producer.last_visit() < branch_a.first_visit(), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(producer.last_visit() < branch_b.first_visit(), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(branch_a.last_visit() < consumer.first_visit(), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(branch_b.last_visit() < consumer.first_visit(), framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(AsyncRethrowException, framework::DatasetMode::ALL)
+{
+    CPPScheduler scheduler;
+    CPPScheduler::Hints hints(0);
+    TestKernel kernel;
+
+    scheduler.set_num_threads(2);
+    ITensorPack tensors;
+    auto        done_kernel = scheduler.schedule_op_async(&kernel, hints, kernel.window(), tensors);
+    // The failure of a dependency is propagated to the tasks depending on it
+    auto        done_task   = scheduler.run_async([]() {}, { done_kernel });
+    try
+    {
+        done_task.get();
+    }
+    catch(const TestException&)
+    {
+        return;
+    }
+    ARM_COMPUTE_EXPECT_FAIL("Expected exception not caught", framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(AsyncPendingAtDestruction, framework::DatasetMode::ALL)
+{
+    std::atomic<int> step{ 0 };
+    RecordingKernel  first(step, 64);
+    RecordingKernel  second(step, 64);
+    std::atomic<int> gate{ 0 };
+    {
+        CPPScheduler scheduler;
+        scheduler.set_num_threads(2);
+
+        const CPPScheduler::Hints hints(0);
+        ITensorPack               tensors;
+
+        // Hold the dispatcher so that the kernels are still pending when the scheduler is destroyed
+        scheduler.run_async([&gate]() { while(gate.load() == 0) { std::this_thread::yield(); } });
+        scheduler.schedule_op_async(&first, hints, first.window(), tensors);
+        scheduler.schedule_op_async(&second, hints, second.window(), tensors);
+        gate = 1;
+    }
+
+    // The destructor ran the pending kernels on its own threads
+    ARM_COMPUTE_EXPECT(step.load() == 128, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(first.last_visit() < second.first_visit(), framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(CapacityPolicyWithUnpinnedThreads, framework::DatasetMode::ALL)
+{
+    CPPScheduler scheduler;
+    scheduler.set_capacity_policy(CPPScheduler::CapacityPolicy::WEIGHTED_BIG_ONLY);
+    scheduler.set_num_threads(3);
+
+    // The capacities of unpinned threads are unknown: the workload is split evenly
+    SharingKernel kernel(300, 3);
+    scheduler.schedule(&kernel, IScheduler::Hints(0).set_latency_critical(true));
+
+    const std::vector<int> expected{ 100, 100, 100 };
+    ARM_COMPUTE_EXPECT(kernel.shares() == expected, framework::LogLevel::ERRORS);
+}
+
+DATA_TEST_CASE(SpinWait, framework::DatasetMode::ALL,
+               combine(framework::dataset::make("SpinUs", { 0U, 20U }),
+                       framework::dataset::make("KeepHot", { false, true })),
+               spin_us, keep_hot)
+{
+    CPPScheduler scheduler;
+    scheduler.set_num_threads(3);
+    scheduler.set_spin_wait(spin_us);
+    scheduler.set_keep_hot(keep_hot);
+
+    // Back to back dispatches, some of them while the threads are still spinning
+    SharingKernel kernel(3, 3);
+    for(int i = 0; i < 100; ++i)
+    {
+        scheduler.schedule(&kernel, IScheduler::Hints(0));
+    }
+    scheduler.set_keep_hot(false);
+
+    const std::vector<int> expected{ 100, 100, 100 };
+    ARM_COMPUTE_EXPECT(kernel.shares() == expected, framework::LogLevel::ERRORS);
+}
 #endif // defined(ARM_COMPUTE_CPP_SCHEDULER) &&  !defined(BARE_METAL)
 TEST_SUITE_END()
 TEST_SUITE_END()
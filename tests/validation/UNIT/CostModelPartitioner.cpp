@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/CostModelPartitioner.h"
+
+#include "arm_compute/core/CPP/ICPPKernel.h"
+#include "arm_compute/runtime/CPP/CPPScheduler.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+using namespace arm_compute;
+using namespace arm_compute::test;
+
+namespace
+{
+/** Kernel over a width x height x depth window counting how many times each element has been visited */
+class CountingKernel: public ICPPKernel
+{
+public:
+    CountingKernel(unsigned int width, unsigned int height, unsigned int depth, size_t bytes, bool by_window = true)
+        : _width(width), _height(height), _bytes(bytes), _by_window(by_window), _num_runs(0), _visits(width * height * depth)
+    {
+        Window window;
+        window.set(Window::DimX, Window::Dimension(0, width));
+        window.set(Window::DimY, Window::Dimension(0, height));
+        window.set(Window::DimZ, Window::Dimension(0, depth));
+        configure(window);
+    }
+
+    const char* name() const override
+    {
+        return "CountingKernel";
+    }
+
+    size_t estimate_bytes_accessed(const ITensorPack &) const override
+    {
+        return _bytes;
+    }
+
+    bool partitions_by_window() const override
+    {
+        return _by_window;
+    }
+
+    void run(const Window &window, const ThreadInfo &) override
+    {
+        _num_runs++;
+        for(int z = window.z().start(); z < window.z().end(); ++z)
+        {
+            for(int y = window.y().start(); y < window.y().end(); ++y)
+            {
+                for(int x = window.x().start(); x < window.x().end(); ++x)
+                {
+                    _visits[(z * _height + y) * _width + x]++;
+                }
+            }
+        }
+    }
+
+    bool all_visited_once() const
+    {
+        for(const auto &v : _visits)
+        {
+            if(v.load() != 1)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    int num_runs() const
+    {
+        return _num_runs.load();
+    }
+
+private:
+    unsigned int                  _width;
+    unsigned int                  _height;
+    size_t                        _bytes;
+    bool                          _by_window;
+    std::atomic<int>              _num_runs;
+    std::vector<std::atomic<int>> _visits;
+};
+
+constexpr size_t large_workload = 1024 * 1024 * 1024;
+} // namespace
+
+TEST_SUITE(UNIT)
+TEST_SUITE(CostModelPartitioner)
+TEST_CASE(SplitsNarrowDimensionIn2D, framework::DatasetMode::ALL)
+{
+    const CostModelPartitioner partitioner;
+    CountingKernel             kernel(16, 2, 64, large_workload);
+    ITensorPack                tensors;
+
+    const WorkloadPartition partition = partitioner.partition(kernel, kernel.window(), IScheduler::Hints(Window::DimY, IScheduler::StrategyHint::DYNAMIC, 8),
+                                                              tensors, 8, CPUInfo::get());
+
+    ARM_COMPUTE_EXPECT(partition.split_dimension == Window::DimY, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(partition.num_windows == 2, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(partition.split_dimension_2 == Window::DimZ, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(partition.num_windows_2 == 4, framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(DoesNotSplitSmallWorkloads, framework::DatasetMode::ALL)
+{
+    const CostModelPartitioner partitioner;
+    CountingKernel             kernel(16, 64, 1, 1024);
+    ITensorPack                tensors;
+
+    const WorkloadPartition partition = partitioner.partition(kernel, kernel.window(), IScheduler::Hints(Window::DimY), tensors, 8, CPUInfo::get());
+
+    ARM_COMPUTE_EXPECT(partition.num_windows * partition.num_windows_2 == 1, framework::LogLevel::ERRORS);
+}
+
+#if defined(ARM_COMPUTE_CPP_SCHEDULER) && !defined(BARE_METAL)
+DATA_TEST_CASE(RunsEveryElementOnce, framework::DatasetMode::ALL,
+               combine(framework::dataset::make("NumThreads", { 2U, 3U, 8U }),
+                       framework::dataset::make("Height", { 1U, 3U, 100U })),
+               num_threads, height)
+{
+    CPPScheduler scheduler;
+    scheduler.set_num_threads(num_threads);
+    scheduler.set_workload_partitioner(std::make_shared<CostModelPartitioner>());
+
+    CountingKernel kernel(8, height, 5, large_workload);
+    scheduler.schedule(&kernel, IScheduler::Hints(Window::DimY));
+
+    ARM_COMPUTE_EXPECT(kernel.all_visited_once(), framework::LogLevel::ERRORS);
+}
+
+DATA_TEST_CASE(KeepsOneWorkloadPerThreadWithoutOptIn, framework::DatasetMode::ALL,
+               framework::dataset::make("NumThreads", { 2U, 3U, 8U }),
+               num_threads)
+{
+    CPPScheduler scheduler;
+    scheduler.set_num_threads(num_threads);
+    scheduler.set_workload_partitioner(std::make_shared<CostModelPartitioner>());
+
+    CountingKernel kernel(8, 100, 5, large_workload, false);
+    scheduler.schedule(&kernel, IScheduler::Hints(Window::DimY));
+
+    ARM_COMPUTE_EXPECT(kernel.all_visited_once(), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(kernel.num_runs() == static_cast<int>(num_threads), framework::LogLevel::ERRORS);
+}
+#endif // defined(ARM_COMPUTE_CPP_SCHEDULER) && !defined(BARE_METAL)
+TEST_SUITE_END() // CostModelPartitioner
+TEST_SUITE_END() // UNIT
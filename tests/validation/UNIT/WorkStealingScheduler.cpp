@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/CPP/WorkStealingScheduler.h"
+
+#include "arm_compute/core/CPP/ICPPKernel.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+using namespace arm_compute;
+using namespace arm_compute::test;
+
+namespace
+{
+class TestException: public std::exception
+{
+public:
+    const char* what() const noexcept override
+    {
+        return "Expected test exception";
+    }
+};
+
+class ThrowingKernel: public ICPPKernel
+{
+public:
+    ThrowingKernel()
+    {
+        Window window;
+        window.set(0, Window::Dimension(0, 2));
+        configure(window);
+    }
+
+    const char* name() const override
+    {
+        return "ThrowingKernel";
+    }
+
+    void run(const Window &, const ThreadInfo &) override
+    {
+        throw TestException();
+    }
+};
+
+/** Kernel counting how many times each element of its window has been visited */
+class CountingKernel: public ICPPKernel
+{
+public:
+    explicit CountingKernel(unsigned int size)
+        : _visits(size)
+    {
+        Window window;
+        window.set(0, Window::Dimension(0, size));
+        configure(window);
+    }
+
+    const char* name() const override
+    {
+        return "CountingKernel";
+    }
+
+    void run(const Window &window, const ThreadInfo &) override
+    {
+        for(int x = window.x().start(); x < window.x().end(); ++x)
+        {
+            _visits[x]++;
+        }
+    }
+
+    bool all_visited_once() const
+    {
+        for(const auto &v : _visits)
+        {
+            if(v.load() != 1)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+private:
+    std::vector<std::atomic<int>> _visits;
+};
+}
+
+TEST_SUITE(UNIT)
+TEST_SUITE(WorkStealingScheduler)
+#if defined(ARM_COMPUTE_CPP_SCHEDULER) && !defined(BARE_METAL)
+DATA_TEST_CASE(RunsEveryWorkloadOnce, framework::DatasetMode::ALL,
+               combine(framework::dataset::make("NumThreads", { 1U, 2U, 3U, 8U }),
+                       framework::dataset::make("NumIterations", { 1U, 7U, 64U, 1000U })),
+               num_threads, num_iterations)
+{
+    WorkStealingScheduler scheduler;
+    scheduler.set_num_threads(num_threads);
+
+    CountingKernel kernel(num_iterations);
+    scheduler.schedule(&kernel, IScheduler::Hints(Window::DimX, IScheduler::StrategyHint::DYNAMIC, num_iterations));
+
+    ARM_COMPUTE_EXPECT(kernel.all_visited_once(), framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(RethrowException, framework::DatasetMode::ALL)
+{
+    WorkStealingScheduler scheduler;
+    WorkStealingScheduler::Hints hints(0);
+    ThrowingKernel kernel;
+
+    scheduler.set_num_threads(2);
+    try
+    {
+        scheduler.schedule(&kernel, hints);
+    }
+    catch(const TestException&)
+    {
+        return;
+    }
+    ARM_COMPUTE_EXPECT_FAIL("Expected exception not caught", framework::LogLevel::ERRORS);
+}
+#endif // defined(ARM_COMPUTE_CPP_SCHEDULER) &&  !defined(BARE_METAL)
+TEST_SUITE_END()
+TEST_SUITE_END()
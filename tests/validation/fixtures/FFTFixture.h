@@ -44,13 +44,15 @@ namespace test
 namespace validation
 {
 template <typename TensorType, typename AccessorType, typename FunctionType, typename InfoType, typename T>
-class FFTValidationFixture : public framework::Fixture
+class FFTValidationGenericFixture : public framework::Fixture
 {
 public:
-    void setup(TensorShape shape, DataType data_type)
+    void setup(TensorShape shape, DataType data_type, bool is_real_input, FFTDirection direction = FFTDirection::Forward)
     {
-        _target    = compute_target(shape, data_type);
-        _reference = compute_reference(shape, data_type);
+        _num_src_channels = is_real_input ? 1 : 2;
+        _direction        = direction;
+        _target           = compute_target(shape, data_type);
+        _reference        = compute_reference(shape, data_type);
         ARM_COMPUTE_ERROR_ON_MISMATCHING_DIMENSIONS(_target.info()->tensor_shape(), _reference.shape());
     }
 
@@ -80,12 +82,14 @@ protected:
     TensorType compute_target(const TensorShape &shape, DataType data_type)
     {
         // Create tensors
-        TensorType src = create_tensor<TensorType>(shape, data_type, 2);
+        TensorType src = create_tensor<TensorType>(shape, data_type, _num_src_channels);
         TensorType dst = create_tensor<TensorType>(shape, data_type, 2);
 
         // Create and configure function
+        InfoType info;
+        info.direction = _direction;
         FunctionType fft;
-        fft.configure(&src, &dst, InfoType());
+        fft.configure(&src, &dst, info);
 
         ARM_COMPUTE_ASSERT(src.info()->is_resizable());
         ARM_COMPUTE_ASSERT(dst.info()->is_resizable());
@@ -109,24 +113,142 @@ protected:
     }
 
     SimpleTensor<T> compute_reference(const TensorShape &shape, DataType data_type)
+    {
+        const SimpleTensor<T>         src       = compute_complex_source(shape, data_type);
+        const reference::FFTDirection direction = _direction == FFTDirection::Forward ? reference::FFTDirection::Forward : reference::FFTDirection::Inverse;
+        if(std::is_same<InfoType, FFT1DInfo>::value)
+        {
+            return reference::dft_1d(src, direction);
+        }
+        else
+        {
+            return reference::dft_2d(src, direction);
+        }
+    }
+
+    /** Fill the source as a complex tensor, whatever the number of channels of the source of the function */
+    SimpleTensor<T> compute_complex_source(const TensorShape &shape, DataType data_type)
     {
         // Create reference
         SimpleTensor<T> src{ shape, data_type, 2 };
 
         // Fill reference
-        fill(src);
-        if(std::is_same<InfoType, FFT1DInfo>::value)
+        if(_num_src_channels == 1)
         {
-            return reference::dft_1d(src, reference::FFTDirection::Forward);
+            // Real inputs are transformed as complex inputs with a null imaginary part
+            SimpleTensor<T> src_real{ shape, data_type, 1 };
+            fill(src_real);
+            for(size_t i = 0; i < size_t(src_real.num_elements()); ++i)
+            {
+                src[i * 2]     = src_real[i];
+                src[i * 2 + 1] = T(0);
+            }
         }
         else
         {
-            return reference::dft_2d(src, reference::FFTDirection::Forward);
+            fill(src);
         }
+        return src;
     }
 
     TensorType      _target{};
     SimpleTensor<T> _reference{};
+    int             _num_src_channels{ 2 };
+    FFTDirection    _direction{ FFTDirection::Forward };
+};
+
+template <typename TensorType, typename AccessorType, typename FunctionType, typename InfoType, typename T>
+class FFTValidationFixture : public FFTValidationGenericFixture<TensorType, AccessorType, FunctionType, InfoType, T>
+{
+public:
+    void setup(TensorShape shape, DataType data_type)
+    {
+        FFTValidationGenericFixture<TensorType, AccessorType, FunctionType, InfoType, T>::setup(shape, data_type, false);
+    }
+};
+
+template <typename TensorType, typename AccessorType, typename FunctionType, typename InfoType, typename T>
+class FFTRealInputValidationFixture : public FFTValidationGenericFixture<TensorType, AccessorType, FunctionType, InfoType, T>
+{
+public:
+    void setup(TensorShape shape, DataType data_type)
+    {
+        FFTValidationGenericFixture<TensorType, AccessorType, FunctionType, InfoType, T>::setup(shape, data_type, true);
+    }
+};
+
+template <typename TensorType, typename AccessorType, typename FunctionType, typename InfoType, typename T>
+class FFTInverseValidationFixture : public FFTValidationGenericFixture<TensorType, AccessorType, FunctionType, InfoType, T>
+{
+public:
+    void setup(TensorShape shape, DataType data_type)
+    {
+        FFTValidationGenericFixture<TensorType, AccessorType, FunctionType, InfoType, T>::setup(shape, data_type, false, FFTDirection::Inverse);
+    }
+};
+
+template <typename TensorType, typename AccessorType, typename FunctionType, typename InfoType, typename T>
+class FFTRealInputInverseValidationFixture : public FFTValidationGenericFixture<TensorType, AccessorType, FunctionType, InfoType, T>
+{
+public:
+    void setup(TensorShape shape, DataType data_type)
+    {
+        FFTValidationGenericFixture<TensorType, AccessorType, FunctionType, InfoType, T>::setup(shape, data_type, true, FFTDirection::Inverse);
+    }
+};
+
+/** Fixture running a forward transform followed by an inverse transform, which must give back the source */
+template <typename TensorType, typename AccessorType, typename FunctionType, typename InfoType, typename T, bool is_real_input = false>
+class FFTRoundTripValidationFixture : public FFTValidationGenericFixture<TensorType, AccessorType, FunctionType, InfoType, T>
+{
+public:
+    void setup(TensorShape shape, DataType data_type)
+    {
+        this->_num_src_channels = is_real_input ? 1 : 2;
+        this->_target           = compute_round_trip_target(shape, data_type);
+        this->_reference        = this->compute_complex_source(shape, data_type);
+    }
+
+protected:
+    TensorType compute_round_trip_target(const TensorShape &shape, DataType data_type)
+    {
+        // Create tensors
+        TensorType src      = create_tensor<TensorType>(shape, data_type, this->_num_src_channels);
+        TensorType spectrum = create_tensor<TensorType>(shape, data_type, 2);
+        TensorType dst      = create_tensor<TensorType>(shape, data_type, 2);
+
+        // Create and configure functions
+        InfoType inverse_info;
+        inverse_info.direction = FFTDirection::Inverse;
+        FunctionType forward;
+        FunctionType inverse;
+        forward.configure(&src, &spectrum, InfoType());
+        inverse.configure(&spectrum, &dst, inverse_info);
+
+        ARM_COMPUTE_ASSERT(src.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(spectrum.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(dst.info()->is_resizable());
+
+        add_padding_x({ &src, &spectrum, &dst });
+
+        // Allocate tensors
+        src.allocator()->allocate();
+        spectrum.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        ARM_COMPUTE_ASSERT(!src.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(!spectrum.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(!dst.info()->is_resizable());
+
+        // Fill tensors
+        this->fill(AccessorType(src));
+
+        // Compute functions
+        forward.run();
+        inverse.run();
+
+        return dst;
+    }
 };
 
 template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
@@ -36,7 +36,9 @@
 #include "tests/validation/Helpers.h"
 #include "tests/validation/Validation.h"
 #include "tests/validation/reference/ActivationLayer.h"
+#include "tests/validation/reference/DynamicQuantizedGemm.h"
 #include "tests/validation/reference/FullyConnectedLayer.h"
+#include "tests/validation/reference/Permute.h"
 #include "tests/validation/reference/Utils.h"
 
 #include <random>
@@ -659,6 +661,113 @@ public:
                                                                                                   dst_shape, data_type, activation_info, true, false, false, false);
     }
 };
+
+template <typename TensorType, typename AccessorType, typename FunctionType>
+class FullyConnectedDynamicQuantizationFixture : public framework::Fixture
+{
+public:
+    void setup(TensorShape input_shape, TensorShape weights_shape, TensorShape bias_shape, TensorShape output_shape,
+               DataType weights_data_type, bool has_bias, ActivationLayerInfo activation_info)
+    {
+        _hash = weights_shape[0] + weights_shape[1] + output_shape[0] + output_shape[1];
+
+        // Symmetric weights, with one scale per output for the per channel case
+        std::mt19937                          generator(library->seed() + _hash);
+        std::uniform_real_distribution<float> distribution_scale(1.f / 128.f, 1.f / 32.f);
+        std::vector<float>                    scales(is_data_type_quantized_per_channel(weights_data_type) ? weights_shape[1] : 1);
+        for(auto &scale : scales)
+        {
+            scale = distribution_scale(generator);
+        }
+        _weights_q_info = QuantizationInfo(scales);
+
+        _target    = compute_target(input_shape, weights_shape, bias_shape, output_shape, weights_data_type, has_bias, activation_info);
+        _reference = compute_reference(input_shape, weights_shape, bias_shape, output_shape, weights_data_type, has_bias, activation_info);
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor, int i)
+    {
+        if(tensor.data_type() == DataType::F32)
+        {
+            std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+            library->fill(tensor, distribution, i);
+        }
+        else
+        {
+            std::uniform_int_distribution<int32_t> distribution(-127, 127);
+            library->fill(tensor, distribution, i);
+        }
+    }
+
+    TensorType compute_target(const TensorShape &input_shape, const TensorShape &weights_shape, const TensorShape &bias_shape, const TensorShape &output_shape,
+                              DataType weights_data_type, bool has_bias, ActivationLayerInfo activation_info)
+    {
+        // Create tensors
+        TensorType src     = create_tensor<TensorType>(input_shape, DataType::F32, 1);
+        TensorType weights = create_tensor<TensorType>(weights_shape, weights_data_type, 1, _weights_q_info);
+        TensorType bias    = create_tensor<TensorType>(bias_shape, DataType::F32, 1);
+        TensorType dst     = create_tensor<TensorType>(output_shape, DataType::F32, 1);
+
+        FullyConnectedLayerInfo fc_info;
+        fc_info.activation_info = activation_info;
+
+        // Create and configure function.
+        FunctionType fc;
+        fc.configure(&src, &weights, has_bias ? &bias : nullptr, &dst, fc_info);
+
+        add_padding_x({ &src, &weights, &bias, &dst });
+
+        // Allocate tensors
+        src.allocator()->allocate();
+        weights.allocator()->allocate();
+        bias.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        // Fill tensors
+        fill(AccessorType(src), 0 + _hash);
+        fill(AccessorType(weights), 1 + _hash);
+        fill(AccessorType(bias), 2 + _hash);
+
+        // Run twice, so that the already prepared weights are reused
+        fc.run();
+        fc.run();
+
+        return dst;
+    }
+
+    SimpleTensor<float> compute_reference(const TensorShape &input_shape, const TensorShape &weights_shape, const TensorShape &bias_shape, const TensorShape &output_shape,
+                                          DataType weights_data_type, bool has_bias, ActivationLayerInfo activation_info)
+    {
+        // The input is flattened to one row per batch, as in the function
+        const size_t num_inputs = weights_shape[0];
+
+        SimpleTensor<float>  src{ TensorShape(num_inputs, input_shape.total_size() / num_inputs), DataType::F32 };
+        SimpleTensor<int8_t> weights{ weights_shape, weights_data_type, 1, _weights_q_info };
+        SimpleTensor<float>  bias{ has_bias ? bias_shape : TensorShape(), DataType::F32 };
+
+        // Fill reference
+        fill(src, 0 + _hash);
+        fill(weights, 1 + _hash);
+        if(has_bias)
+        {
+            fill(bias, 2 + _hash);
+        }
+
+        const SimpleTensor<float> mm = reference::dynamic_quantized_gemm(src, reference::permute(weights, PermutationVector(1U, 0U)), bias);
+
+        SimpleTensor<float> dst{ output_shape, DataType::F32 };
+        std::copy_n(mm.data(), mm.num_elements(), dst.data());
+
+        return reference::activation_layer(dst, activation_info);
+    }
+
+    TensorType          _target{};
+    SimpleTensor<float> _reference{};
+    QuantizationInfo    _weights_q_info{};
+    int                 _hash{ 0 };
+};
 } // namespace validation
 } // namespace test
 } // namespace arm_compute
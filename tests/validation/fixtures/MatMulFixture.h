@@ -32,6 +32,7 @@
 #include "tests/framework/Asserts.h" // Required for ARM_COMPUTE_ASSERT
 #include "tests/framework/Fixture.h"
 #include "tests/validation/reference/ActivationLayer.h"
+#include "tests/validation/reference/DynamicQuantizedGemm.h"
 #include "tests/validation/reference/GEMM.h"
 #include "tests/validation/reference/GEMMLowp.h"
 #include "tests/validation/reference/Permute.h"
@@ -612,6 +613,122 @@ public:
     }
 };
 
+template <typename TensorType, typename AccessorType, typename FunctionType, typename Settings>
+class MatMulDynamicQuantizationFixture : public framework::Fixture
+{
+public:
+    void setup(TensorShape         shape_a,
+               TensorShape         shape_b,
+               TensorShape         output_shape,
+               bool                transpose_b,
+               DataType            data_type_b,
+               bool                constant_b,
+               ActivationLayerInfo act_info)
+    {
+        // Symmetric rhs, with one scale per output column for the per channel case
+        std::mt19937                          generator(library->seed());
+        std::uniform_real_distribution<float> distribution_scale(1.f / 128.f, 1.f / 32.f);
+        std::vector<float> scales(is_data_type_quantized_per_channel(data_type_b) ? shape_b[0] : 1);
+        for (auto &scale : scales)
+        {
+            scale = distribution_scale(generator);
+        }
+        _b_qinfo = QuantizationInfo(scales);
+
+        // For brevity, the input shape is assumed to be not-transposed for the b matrix.
+        if (transpose_b)
+        {
+            permute(shape_b, PermutationVector(1U, 0U));
+        }
+
+        _target    = compute_target(shape_a, shape_b, output_shape, transpose_b, data_type_b, constant_b, act_info);
+        _reference = compute_reference(shape_a, shape_b, transpose_b, data_type_b, act_info);
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor, int i)
+    {
+        if (tensor.data_type() == DataType::F32)
+        {
+            std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+            library->fill(tensor, distribution, i);
+        }
+        else
+        {
+            std::uniform_int_distribution<int32_t> distribution(-127, 127);
+            library->fill(tensor, distribution, i);
+        }
+    }
+
+    TensorType compute_target(const TensorShape  &shape_a,
+                              const TensorShape  &shape_b,
+                              const TensorShape  &output_shape,
+                              bool                transpose_b,
+                              DataType            data_type_b,
+                              bool                constant_b,
+                              ActivationLayerInfo act_info)
+    {
+        TensorType a   = create_tensor<TensorType>(shape_a, DataType::F32, 1);
+        TensorType b   = create_tensor<TensorType>(shape_b, data_type_b, 1, _b_qinfo);
+        TensorType dst = create_tensor<TensorType>(output_shape, DataType::F32, 1);
+
+        a.info()->set_are_values_constant(false);
+        b.info()->set_are_values_constant(constant_b);
+
+        FunctionType matmul;
+        matmul.configure(&a, &b, &dst, MatMulInfo().adj_rhs(transpose_b), Settings(), act_info);
+
+        ARM_COMPUTE_ASSERT(a.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(b.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(dst.info()->is_resizable());
+
+        a.allocator()->allocate();
+        b.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        ARM_COMPUTE_ASSERT(!a.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(!b.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(!dst.info()->is_resizable());
+
+        fill(AccessorType(b), 1);
+
+        // Run with a different lhs first, so that the second run reuses the prepared rhs
+        fill(AccessorType(a), 100);
+        matmul.run();
+
+        fill(AccessorType(a), 0);
+        matmul.run();
+
+        return dst;
+    }
+
+    SimpleTensor<float> compute_reference(const TensorShape  &shape_a,
+                                          const TensorShape  &shape_b,
+                                          bool                transpose_b,
+                                          DataType            data_type_b,
+                                          ActivationLayerInfo act_info)
+    {
+        SimpleTensor<float>  a{shape_a, DataType::F32, 1};
+        SimpleTensor<int8_t> b{shape_b, data_type_b, 1, _b_qinfo};
+        SimpleTensor<float>  bias{TensorShape(), DataType::F32, 1};
+
+        fill(a, 0);
+        fill(b, 1);
+
+        if (transpose_b)
+        {
+            b = reference::permute(b, PermutationVector(1U, 0U));
+        }
+
+        return reference::activation_layer(reference::dynamic_quantized_gemm(a, b, bias), act_info);
+    }
+
+    TensorType          _target{};
+    SimpleTensor<float> _reference{};
+    QuantizationInfo    _b_qinfo{};
+};
+
 } // namespace validation
 } // namespace test
 } // namespace arm_compute
@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_VALIDATION_FIXTURES_PAGEDMATMULFIXTURE_H
+#define ACL_TESTS_VALIDATION_FIXTURES_PAGEDMATMULFIXTURE_H
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/function_info/MatMulInfo.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "tests/AssetsLibrary.h"
+#include "tests/Globals.h"
+#include "tests/IAccessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Fixture.h"
+#include "tests/validation/reference/PagedMatMul.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T, typename TC = T>
+class PagedMatMulValidationFixture : public framework::Fixture
+{
+public:
+    void setup(TensorShape  cache_shape,
+               unsigned int num_rows,
+               unsigned int num_heads,
+               unsigned int num_batches,
+               unsigned int max_blocks,
+               bool         adj_rhs,
+               DataType     data_type,
+               DataType     cache_data_type)
+    {
+        if(std::is_same<TensorType, Tensor>::value &&  // Cpu
+            data_type == DataType::F16 && !CPUInfo::get().has_fp16())
+        {
+            return;
+        }
+
+        const unsigned int max_seq_len = max_blocks * cache_shape[1];
+        const TensorShape  lhs_shape(adj_rhs ? cache_shape[0] : max_seq_len, num_rows, num_heads, num_batches);
+        const TensorShape  block_table_shape(max_blocks, num_batches);
+        const TensorShape  seq_lens_shape(num_batches);
+
+        // The quantization information of a floating-point cache is ignored
+        const QuantizationInfo cache_qinfo(1.f / 32, 5);
+
+        _max_seq_len = max_seq_len;
+        _num_blocks  = cache_shape[3];
+
+        compute_target(lhs_shape, cache_shape, block_table_shape, seq_lens_shape, adj_rhs, data_type, cache_data_type,
+                       cache_qinfo);
+        compute_reference(lhs_shape, cache_shape, block_table_shape, seq_lens_shape, adj_rhs, data_type,
+                          cache_data_type, cache_qinfo);
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor, int i)
+    {
+        switch(tensor.data_type())
+        {
+            case DataType::F16:
+            {
+                arm_compute::utils::uniform_real_distribution_16bit<half> distribution{ -1.0f, 1.0f };
+                library->fill(tensor, distribution, i);
+                break;
+            }
+            case DataType::F32:
+            {
+                std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+                library->fill(tensor, distribution, i);
+                break;
+            }
+            default:
+                library->fill_tensor_uniform(tensor, i);
+        }
+    }
+
+    template <typename U>
+    void fill_paging(U &&block_table, U &&seq_lens)
+    {
+        // Sequences may share blocks, as when they share a prefix, and their lengths cover empty and full sequences
+        std::uniform_int_distribution<int32_t> block_distribution(0, _num_blocks - 1);
+        library->fill(block_table, block_distribution, 2);
+        std::uniform_int_distribution<int32_t> length_distribution(0, _max_seq_len);
+        library->fill(seq_lens, length_distribution, 3);
+    }
+
+    void compute_target(const TensorShape      &lhs_shape,
+                        const TensorShape      &cache_shape,
+                        const TensorShape      &block_table_shape,
+                        const TensorShape      &seq_lens_shape,
+                        bool                    adj_rhs,
+                        DataType                data_type,
+                        DataType                cache_data_type,
+                        const QuantizationInfo &cache_qinfo)
+    {
+        // Create tensors
+        TensorType lhs         = create_tensor<TensorType>(lhs_shape, data_type);
+        TensorType cache       = create_tensor<TensorType>(cache_shape, cache_data_type, 1, cache_qinfo);
+        TensorType block_table = create_tensor<TensorType>(block_table_shape, DataType::S32);
+        TensorType seq_lens    = create_tensor<TensorType>(seq_lens_shape, DataType::S32);
+        TensorType dst         = create_tensor<TensorType>(TensorShape(), data_type);
+
+        // Create and configure function
+        FunctionType paged_matmul;
+        paged_matmul.configure(&lhs, &cache, &block_table, &seq_lens, &dst, MatMulInfo().adj_rhs(adj_rhs));
+
+        ARM_COMPUTE_ASSERT(lhs.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(cache.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(block_table.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(seq_lens.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(dst.info()->is_resizable());
+
+        // Allocate tensors
+        lhs.allocator()->allocate();
+        cache.allocator()->allocate();
+        block_table.allocator()->allocate();
+        seq_lens.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        ARM_COMPUTE_ASSERT(!lhs.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(!cache.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(!block_table.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(!seq_lens.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(!dst.info()->is_resizable());
+
+        // Fill tensors
+        fill(AccessorType(lhs), 0);
+        fill(AccessorType(cache), 1);
+        fill_paging(AccessorType(block_table), AccessorType(seq_lens));
+
+        // Compute function
+        paged_matmul.run();
+
+        _target = std::move(dst);
+    }
+
+    void compute_reference(const TensorShape      &lhs_shape,
+                           const TensorShape      &cache_shape,
+                           const TensorShape      &block_table_shape,
+                           const TensorShape      &seq_lens_shape,
+                           bool                    adj_rhs,
+                           DataType                data_type,
+                           DataType                cache_data_type,
+                           const QuantizationInfo &cache_qinfo)
+    {
+        // Create reference
+        SimpleTensor<T>       lhs{ lhs_shape, data_type };
+        SimpleTensor<TC>      cache{ cache_shape, cache_data_type, 1, cache_qinfo };
+        SimpleTensor<int32_t> block_table{ block_table_shape, DataType::S32 };
+        SimpleTensor<int32_t> seq_lens{ seq_lens_shape, DataType::S32 };
+
+        // Fill reference
+        fill(lhs, 0);
+        fill(cache, 1);
+        fill_paging(block_table, seq_lens);
+
+        _reference = reference::paged_matmul<T, TC>(lhs, cache, block_table, seq_lens, adj_rhs);
+    }
+
+    TensorType      _target{};
+    SimpleTensor<T> _reference{};
+    int32_t         _max_seq_len{0};
+    int32_t         _num_blocks{0};
+};
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_VALIDATION_FIXTURES_PAGEDMATMULFIXTURE_H
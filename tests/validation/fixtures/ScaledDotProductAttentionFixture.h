@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_VALIDATION_FIXTURES_SCALEDDOTPRODUCTATTENTIONFIXTURE_H
+#define ACL_TESTS_VALIDATION_FIXTURES_SCALEDDOTPRODUCTATTENTIONFIXTURE_H
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/function_info/ScaledDotProductAttentionInfo.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "tests/AssetsLibrary.h"
+#include "tests/Globals.h"
+#include "tests/IAccessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Fixture.h"
+#include "tests/validation/reference/ScaledDotProductAttention.h"
+
+#include <cmath>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class ScaledDotProductAttentionValidationFixture : public framework::Fixture
+{
+public:
+    void setup(TensorShape  query_shape,
+               unsigned int num_keys,
+               unsigned int num_kv_heads,
+               unsigned int value_head_size,
+               bool         has_mask,
+               bool         is_causal,
+               DataType     data_type)
+    {
+        if(std::is_same<TensorType, Tensor>::value &&  // Cpu
+            ((data_type == DataType::F16 && !CPUInfo::get().has_fp16()) || (data_type == DataType::BFLOAT16 && !CPUInfo::get().has_bf16())))
+        {
+            return;
+        }
+
+        TensorShape key_shape = query_shape;
+        key_shape.set(1, num_keys);
+        key_shape.set(2, num_kv_heads);
+
+        TensorShape value_shape = key_shape;
+        value_shape.set(0, value_head_size);
+
+        const TensorShape mask_shape(num_keys, query_shape[1]);
+
+        const ScaledDotProductAttentionInfo info = ScaledDotProductAttentionInfo().is_causal(is_causal);
+
+        compute_target(query_shape, key_shape, value_shape, has_mask ? &mask_shape : nullptr, info, data_type);
+        compute_reference(query_shape, key_shape, value_shape, has_mask ? &mask_shape : nullptr, info, data_type);
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor, int i)
+    {
+        switch(tensor.data_type())
+        {
+            case DataType::F16:
+            {
+                arm_compute::utils::uniform_real_distribution_16bit<half> distribution{ -1.0f, 1.0f };
+                library->fill(tensor, distribution, i);
+                break;
+            }
+            case DataType::BFLOAT16:
+            {
+                arm_compute::utils::uniform_real_distribution_16bit<bfloat16> distribution{ -1.0f, 1.0f };
+                library->fill(tensor, distribution, i);
+                break;
+            }
+            case DataType::F32:
+            {
+                std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+                library->fill(tensor, distribution, i);
+                break;
+            }
+            default:
+                library->fill_tensor_uniform(tensor, i);
+        }
+    }
+
+    void compute_target(const TensorShape                   &query_shape,
+                        const TensorShape                   &key_shape,
+                        const TensorShape                   &value_shape,
+                        const TensorShape                   *mask_shape,
+                        const ScaledDotProductAttentionInfo &info,
+                        DataType                             data_type)
+    {
+        // Create tensors
+        TensorType query = create_tensor<TensorType>(query_shape, data_type);
+        TensorType key   = create_tensor<TensorType>(key_shape, data_type);
+        TensorType value = create_tensor<TensorType>(value_shape, data_type);
+        TensorType mask  = create_tensor<TensorType>(mask_shape != nullptr ? *mask_shape : TensorShape(), data_type);
+        TensorType dst   = create_tensor<TensorType>(TensorShape(), data_type);
+
+        // Create and configure function
+        FunctionType sdpa;
+        sdpa.configure(&query, &key, &value, mask_shape != nullptr ? &mask : nullptr, &dst, info);
+
+        ARM_COMPUTE_ASSERT(query.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(key.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(value.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(dst.info()->is_resizable());
+
+        // Allocate tensors
+        query.allocator()->allocate();
+        key.allocator()->allocate();
+        value.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        ARM_COMPUTE_ASSERT(!query.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(!key.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(!value.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(!dst.info()->is_resizable());
+
+        // Fill tensors
+        fill(AccessorType(query), 0);
+        fill(AccessorType(key), 1);
+        fill(AccessorType(value), 2);
+        if(mask_shape != nullptr)
+        {
+            mask.allocator()->allocate();
+            fill(AccessorType(mask), 3);
+        }
+
+        // Compute function
+        sdpa.run();
+
+        _target = std::move(dst);
+    }
+
+    void compute_reference(const TensorShape                   &query_shape,
+                           const TensorShape                   &key_shape,
+                           const TensorShape                   &value_shape,
+                           const TensorShape                   *mask_shape,
+                           const ScaledDotProductAttentionInfo &info,
+                           DataType                             data_type)
+    {
+        // Create reference
+        SimpleTensor<T> query{ query_shape, data_type };
+        SimpleTensor<T> key{ key_shape, data_type };
+        SimpleTensor<T> value{ value_shape, data_type };
+        SimpleTensor<T> mask{ mask_shape != nullptr ? *mask_shape : TensorShape(), data_type };
+
+        // Fill reference
+        fill(query, 0);
+        fill(key, 1);
+        fill(value, 2);
+        if(mask_shape != nullptr)
+        {
+            fill(mask, 3);
+        }
+
+        const float            scale     = 1.f / std::sqrt(static_cast<float>(query_shape[0]));
+        const SimpleTensor<T> *mask_data = mask_shape != nullptr ? &mask : nullptr;
+        _reference = reference::scaled_dot_product_attention<T>(query, key, value, mask_data, scale, info.is_causal());
+    }
+
+    TensorType      _target{};
+    SimpleTensor<T> _reference{};
+};
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_VALIDATION_FIXTURES_SCALEDDOTPRODUCTATTENTIONFIXTURE_H
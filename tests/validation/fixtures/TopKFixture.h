@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_VALIDATION_FIXTURES_TOPKFIXTURE_H
+#define ACL_TESTS_VALIDATION_FIXTURES_TOPKFIXTURE_H
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "tests/AssetsLibrary.h"
+#include "tests/Globals.h"
+#include "tests/IAccessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Fixture.h"
+#include "tests/validation/reference/TopK.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class TopKValidationFixture : public framework::Fixture
+{
+public:
+    void setup(TensorShape shape, unsigned int k, bool sorted, DataType data_type)
+    {
+        if(std::is_same<TensorType, Tensor>::value &&  // Cpu
+            data_type == DataType::F16 && !CPUInfo::get().has_fp16())
+        {
+            return;
+        }
+
+        const QuantizationInfo qinfo(0.5f, 10);
+
+        compute_target(shape, k, sorted, data_type, qinfo);
+        compute_reference(shape, k, sorted, data_type, qinfo);
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor)
+    {
+        library->fill_tensor_uniform(tensor, 0);
+    }
+
+    void compute_target(const TensorShape &shape, unsigned int k, bool sorted, DataType data_type, QuantizationInfo qinfo)
+    {
+        // Create tensors
+        TensorType src     = create_tensor<TensorType>(shape, data_type, 1, qinfo);
+        TensorType values  = create_tensor<TensorType>(TensorShape(), data_type, 1, qinfo);
+        TensorType indices = create_tensor<TensorType>(TensorShape(), DataType::S32);
+
+        // Create and configure function
+        FunctionType topk;
+        topk.configure(&src, &values, &indices, k, sorted);
+
+        ARM_COMPUTE_ASSERT(src.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(values.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(indices.info()->is_resizable());
+
+        // Allocate tensors
+        src.allocator()->allocate();
+        values.allocator()->allocate();
+        indices.allocator()->allocate();
+
+        ARM_COMPUTE_ASSERT(!src.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(!values.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(!indices.info()->is_resizable());
+
+        // Fill tensors
+        fill(AccessorType(src));
+
+        // Compute function
+        topk.run();
+
+        _target_values  = std::move(values);
+        _target_indices = std::move(indices);
+    }
+
+    void compute_reference(const TensorShape &shape, unsigned int k, bool sorted, DataType data_type, QuantizationInfo qinfo)
+    {
+        // Create reference
+        SimpleTensor<T> src{ shape, data_type, 1, qinfo };
+
+        // Fill reference
+        fill(src);
+
+        std::tie(_reference_values, _reference_indices) = reference::topk<T>(src, k, sorted);
+    }
+
+    TensorType            _target_values{};
+    TensorType            _target_indices{};
+    SimpleTensor<T>       _reference_values{};
+    SimpleTensor<int32_t> _reference_indices{};
+};
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_VALIDATION_FIXTURES_TOPKFIXTURE_H
@@ -41,7 +41,10 @@
 #include "tests/validation/reference/Winograd.h"
 #include "utils/Utils.h"
 
+#include <cmath>
+#include <limits>
 #include <random>
+#include <vector>
 
 namespace arm_compute
 {
@@ -244,6 +247,170 @@ protected:
     bool            _mixed_layout{ false };
 };
 
+/** Fixture validating quantized Winograd convolution against the direct convolution reference
+ *
+ * As in @ref ConvolutionValidationGenericFixture, the input and weights quantization is random, the tensors are filled
+ * across their whole range and the output quantization is chosen so that the outputs rarely saturate.
+ */
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T, typename TW>
+class WinogradConvolutionLayerQuantizedValidationFixture : public framework::Fixture
+{
+public:
+    void setup(TensorShape input_shape, TensorShape weights_shape, TensorShape bias_shape, TensorShape output_shape, PadStrideInfo info, Size2D dilation,
+               DataType data_type, DataType weights_data_type, ActivationLayerInfo act_info, const DataLayout &data_layout, bool enable_fast_math)
+    {
+        ARM_COMPUTE_UNUSED(dilation);
+
+        _hash = input_shape[0] + input_shape[1] + input_shape[2] + input_shape[3] + weights_shape[2] + weights_shape[3] + (data_layout == DataLayout::NHWC)
+                + enable_fast_math;
+        setup_quantization(input_shape, weights_shape, data_type, weights_data_type);
+
+        _target    = compute_target(input_shape, weights_shape, bias_shape, output_shape, info, data_type, weights_data_type, act_info, data_layout, enable_fast_math);
+        _reference = compute_reference(input_shape, weights_shape, bias_shape, output_shape, info, data_type, weights_data_type, act_info);
+    }
+
+protected:
+    void setup_quantization(const TensorShape &input_shape, const TensorShape &weights_shape, DataType data_type, DataType weights_data_type)
+    {
+        std::mt19937                           generator(library->seed() + _hash);
+        std::uniform_real_distribution<float>  distribution_scale(-5.0f, 3.0f);
+        std::uniform_real_distribution<float>  distribution_channel_scale(0.5f, 1.5f);
+        std::uniform_int_distribution<int32_t> distribution_offset(std::numeric_limits<T>::lowest(), std::numeric_limits<T>::max());
+
+        const float   src_scale     = std::pow(2.f, distribution_scale(generator)); // [2^-5, 2^3]
+        const float   weights_scale = std::pow(2.f, distribution_scale(generator)); // [2^-5, 2^3]
+        const int32_t src_offset    = distribution_offset(generator);
+
+        _src_q_info = QuantizationInfo(src_scale, src_offset);
+        if(is_data_type_quantized_per_channel(weights_data_type))
+        {
+            std::vector<float> scales(weights_shape[3]);
+            for(auto &scale : scales)
+            {
+                scale = weights_scale * distribution_channel_scale(generator);
+            }
+            _weights_q_info = QuantizationInfo(scales);
+        }
+        else
+        {
+            _weights_q_info = QuantizationInfo(weights_scale, distribution_offset(generator));
+        }
+
+        const QuantizationHint q_hint = suggest_conv_dst_q_info_and_bias(_src_q_info, QuantizationInfo(weights_scale, _weights_q_info.uniform().offset),
+                                                                         weights_shape[1], weights_shape[0], input_shape[2], data_type, 0.5f /* bias_fraction */);
+        _dst_q_info = q_hint.q_info;
+        _min_bias   = q_hint.bias_min;
+        _max_bias   = q_hint.bias_max;
+    }
+
+    template <typename U>
+    void fill(U &&tensor, int i)
+    {
+        switch(tensor.data_type())
+        {
+            case DataType::QASYMM8:
+            {
+                std::uniform_int_distribution<int32_t> distribution(0, 255);
+                library->fill(tensor, distribution, i);
+                break;
+            }
+            case DataType::QASYMM8_SIGNED:
+            case DataType::QSYMM8_PER_CHANNEL:
+            {
+                std::uniform_int_distribution<int32_t> distribution(-127, 127);
+                library->fill(tensor, distribution, i);
+                break;
+            }
+            case DataType::S32:
+            {
+                std::uniform_int_distribution<int32_t> distribution(_min_bias, _max_bias);
+                library->fill(tensor, distribution, i);
+                break;
+            }
+            default:
+            {
+                ARM_COMPUTE_ERROR("Not supported");
+            }
+        }
+    }
+
+    TensorType compute_target(TensorShape input_shape, TensorShape weights_shape, const TensorShape &bias_shape, TensorShape output_shape, const PadStrideInfo &info,
+                              DataType data_type, DataType weights_data_type, ActivationLayerInfo act_info, const DataLayout data_layout, bool enable_fast_math)
+    {
+        if(data_layout == DataLayout::NHWC)
+        {
+            permute(input_shape, PermutationVector(2U, 0U, 1U));
+            permute(weights_shape, PermutationVector(2U, 0U, 1U));
+            permute(output_shape, PermutationVector(2U, 0U, 1U));
+        }
+
+        // Create tensors
+        TensorType src     = create_tensor<TensorType>(input_shape, data_type, 1, _src_q_info, data_layout);
+        TensorType weights = create_tensor<TensorType>(weights_shape, weights_data_type, 1, _weights_q_info, data_layout);
+        TensorType bias    = create_tensor<TensorType>(bias_shape, DataType::S32, 1, QuantizationInfo(), data_layout);
+        TensorType dst     = create_tensor<TensorType>(output_shape, data_type, 1, _dst_q_info, data_layout);
+
+        // Create and configure function
+        FunctionType conv;
+        ARM_COMPUTE_EXPECT(static_cast<bool>(conv.validate(src.info(), weights.info(), bias.info(), dst.info(), info, act_info, enable_fast_math)),
+                           framework::LogLevel::ERRORS);
+        conv.configure(&src, &weights, &bias, &dst, info, act_info, enable_fast_math);
+
+        ARM_COMPUTE_ASSERT(src.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(weights.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(bias.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(dst.info()->is_resizable());
+
+        add_padding_x({ &src, &weights, &bias, &dst }, data_layout);
+
+        // Allocate tensors
+        src.allocator()->allocate();
+        weights.allocator()->allocate();
+        dst.allocator()->allocate();
+        bias.allocator()->allocate();
+
+        ARM_COMPUTE_ASSERT(!src.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(!weights.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(!bias.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(!dst.info()->is_resizable());
+
+        // Fill tensors
+        fill(AccessorType(src), 0 + _hash);
+        fill(AccessorType(weights), 1 + _hash);
+        fill(AccessorType(bias), 2 + _hash);
+
+        // Compute function
+        conv.run();
+
+        return dst;
+    }
+
+    SimpleTensor<T> compute_reference(const TensorShape &input_shape, const TensorShape &weights_shape, const TensorShape &bias_shape, const TensorShape &output_shape,
+                                      const PadStrideInfo &info, DataType data_type, DataType weights_data_type, ActivationLayerInfo act_info)
+    {
+        // Create reference
+        SimpleTensor<T>       src{ input_shape, data_type, 1, _src_q_info };
+        SimpleTensor<TW>      weights{ weights_shape, weights_data_type, 1, _weights_q_info };
+        SimpleTensor<int32_t> bias{ bias_shape, DataType::S32, 1 };
+
+        fill(src, 0 + _hash);
+        fill(weights, 1 + _hash);
+        fill(bias, 2 + _hash);
+
+        const SimpleTensor<T> conv_out = reference::convolution_layer<T, TW, int32_t>(src, weights, bias, output_shape, info, Size2D(1U, 1U), 1, _dst_q_info);
+        return (act_info.enabled()) ? reference::activation_layer<T>(conv_out, act_info) : conv_out;
+    }
+
+    TensorType       _target{};
+    SimpleTensor<T>  _reference{};
+    QuantizationInfo _src_q_info{};
+    QuantizationInfo _weights_q_info{};
+    QuantizationInfo _dst_q_info{};
+    int32_t          _min_bias{ 0 };
+    int32_t          _max_bias{ 0 };
+    int32_t          _hash{ 0 };
+};
+
 template <typename TensorType, typename AccessorType, typename FunctionType, typename T, bool mixed_layout = false>
 class WinogradInputTransformValidationFixture : public framework::Fixture
 {
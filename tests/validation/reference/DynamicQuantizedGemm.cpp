@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "DynamicQuantizedGemm.h"
+
+#include "arm_compute/core/utils/misc/Utility.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace reference
+{
+SimpleTensor<float>
+dynamic_quantized_gemm(const SimpleTensor<float> &a, const SimpleTensor<int8_t> &b, const SimpleTensor<float> &bias)
+{
+    const int K    = a.shape()[0];
+    const int N    = b.shape()[0];
+    const int rows = a.num_elements() / K;
+
+    TensorShape dst_shape = a.shape();
+    dst_shape.set(0, N);
+    SimpleTensor<float> dst(dst_shape, DataType::F32);
+
+    const bool               per_channel = is_data_type_quantized_per_channel(b.data_type());
+    const std::vector<float> b_scale     = b.quantization_info().scale();
+
+    std::vector<int8_t> quantized_row(K);
+    for (int r = 0; r < rows; ++r)
+    {
+        const float *row = a.data() + r * K;
+
+        // The range of the row always includes 0
+        float min = 0.f;
+        float max = 0.f;
+        for (int k = 0; k < K; ++k)
+        {
+            min = std::min(min, row[k]);
+            max = std::max(max, row[k]);
+        }
+
+        const float   scale = (max > min) ? (max - min) / 255.f : 1.f;
+        const int32_t offset =
+            utility::clamp<int32_t>(-128 - static_cast<int32_t>(std::lround(min / scale)), -128, 127);
+
+        const UniformQuantizationInfo qinfo(scale, offset);
+        for (int k = 0; k < K; ++k)
+        {
+            quantized_row[k] = quantize_qasymm8_signed(row[k], qinfo);
+        }
+
+        for (int n = 0; n < N; ++n)
+        {
+            int32_t acc = 0;
+            for (int k = 0; k < K; ++k)
+            {
+                acc += (static_cast<int32_t>(quantized_row[k]) - offset) * static_cast<int32_t>(b[n + k * N]);
+            }
+
+            const float b_scale_n = per_channel ? b_scale[n] : b_scale[0];
+            const float bias_n    = bias.num_elements() > 0 ? bias[n] : 0.f;
+            dst[r * N + n]        = static_cast<float>(acc) * (scale * b_scale_n) + bias_n;
+        }
+    }
+
+    return dst;
+}
+} // namespace reference
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_VALIDATION_REFERENCE_DYNAMICQUANTIZEDGEMM_H
+#define ACL_TESTS_VALIDATION_REFERENCE_DYNAMICQUANTIZEDGEMM_H
+
+#include "tests/SimpleTensor.h"
+#include "tests/validation/Helpers.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace reference
+{
+/** Multiply a F32 matrix by a symmetrically quantized matrix, quantizing on the fly each row of the F32 matrix to
+ * QASYMM8_SIGNED with a scale and offset computed from its range, and dequantize the result to F32
+ *
+ * @param[in] a    F32 matrix of shape [K, M, ...]
+ * @param[in] b    Quantized matrix of shape [N, K], with one scale per column if QSYMM8_PER_CHANNEL
+ * @param[in] bias Bias of shape [N], added to each row of the result. Can be empty.
+ *
+ * @return the result, of shape [N, M, ...]
+ */
+SimpleTensor<float>
+dynamic_quantized_gemm(const SimpleTensor<float> &a, const SimpleTensor<int8_t> &b, const SimpleTensor<float> &bias);
+} // namespace reference
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_VALIDATION_REFERENCE_DYNAMICQUANTIZEDGEMM_H
@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "PagedMatMul.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace reference
+{
+namespace
+{
+template <typename TC>
+float cache_value(const SimpleTensor<TC> &cache, int index)
+{
+    return static_cast<float>(cache[index]);
+}
+
+template <>
+float cache_value(const SimpleTensor<int8_t> &cache, int index)
+{
+    return dequantize_qasymm8_signed(cache[index], cache.quantization_info());
+}
+} // namespace
+
+template <typename T, typename TC>
+SimpleTensor<T> paged_matmul(const SimpleTensor<T>       &lhs,
+                             const SimpleTensor<TC>      &cache,
+                             const SimpleTensor<int32_t> &block_table,
+                             const SimpleTensor<int32_t> &seq_lens,
+                             bool                         adj_rhs)
+{
+    const int K            = lhs.shape()[0];
+    const int M            = lhs.shape()[1];
+    const int num_heads    = lhs.shape()[2];
+    const int num_batches  = lhs.shape()[3];
+    const int row_size     = cache.shape()[0];
+    const int block_size   = cache.shape()[1];
+    const int num_kv_heads = cache.shape()[2];
+    const int max_blocks   = block_table.shape()[0];
+    const int max_seq_len  = max_blocks * block_size;
+    const int group_size   = num_heads / num_kv_heads;
+    const int N            = adj_rhs ? max_seq_len : row_size;
+
+    TensorShape dst_shape = lhs.shape();
+    dst_shape.set(0, N);
+    SimpleTensor<T> dst{dst_shape, lhs.data_type()};
+
+    for (int b = 0; b < num_batches; ++b)
+    {
+        const int seq_len = std::max(0, std::min(seq_lens[b], max_seq_len));
+
+        for (int h = 0; h < num_heads; ++h)
+        {
+            const int kv_head = h / group_size;
+
+            // Offset of the first element of the row j of the sequence in the cache
+            const auto cache_row = [&](int j)
+            {
+                const int block = block_table[b * max_blocks + j / block_size];
+                return ((block * num_kv_heads + kv_head) * block_size + j % block_size) * row_size;
+            };
+
+            for (int m = 0; m < M; ++m)
+            {
+                const int lhs_row = ((b * num_heads + h) * M + m) * K;
+                const int dst_row = ((b * num_heads + h) * M + m) * N;
+                if (adj_rhs)
+                {
+                    for (int j = 0; j < max_seq_len; ++j)
+                    {
+                        float acc = -std::numeric_limits<float>::infinity();
+                        if (j < seq_len)
+                        {
+                            acc = 0.f;
+                            for (int k = 0; k < K; ++k)
+                            {
+                                acc += static_cast<float>(lhs[lhs_row + k]) * cache_value(cache, cache_row(j) + k);
+                            }
+                        }
+                        dst[dst_row + j] = static_cast<T>(acc);
+                    }
+                }
+                else
+                {
+                    for (int x = 0; x < N; ++x)
+                    {
+                        float acc = 0.f;
+                        for (int j = 0; j < seq_len; ++j)
+                        {
+                            acc += static_cast<float>(lhs[lhs_row + j]) * cache_value(cache, cache_row(j) + x);
+                        }
+                        dst[dst_row + x] = static_cast<T>(acc);
+                    }
+                }
+            }
+        }
+    }
+
+    return dst;
+}
+
+template SimpleTensor<float> paged_matmul(const SimpleTensor<float>   &lhs,
+                                          const SimpleTensor<float>   &cache,
+                                          const SimpleTensor<int32_t> &block_table,
+                                          const SimpleTensor<int32_t> &seq_lens,
+                                          bool                         adj_rhs);
+template SimpleTensor<float> paged_matmul(const SimpleTensor<float>   &lhs,
+                                          const SimpleTensor<int8_t>  &cache,
+                                          const SimpleTensor<int32_t> &block_table,
+                                          const SimpleTensor<int32_t> &seq_lens,
+                                          bool                         adj_rhs);
+template SimpleTensor<half> paged_matmul(const SimpleTensor<half>    &lhs,
+                                         const SimpleTensor<half>    &cache,
+                                         const SimpleTensor<int32_t> &block_table,
+                                         const SimpleTensor<int32_t> &seq_lens,
+                                         bool                         adj_rhs);
+template SimpleTensor<half> paged_matmul(const SimpleTensor<half>    &lhs,
+                                         const SimpleTensor<int8_t>  &cache,
+                                         const SimpleTensor<int32_t> &block_table,
+                                         const SimpleTensor<int32_t> &seq_lens,
+                                         bool                         adj_rhs);
+} // namespace reference
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "ScaledDotProductAttention.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace reference
+{
+template <typename T>
+SimpleTensor<T> scaled_dot_product_attention(const SimpleTensor<T> &query,
+                                             const SimpleTensor<T> &key,
+                                             const SimpleTensor<T> &value,
+                                             const SimpleTensor<T> *mask,
+                                             float                  scale,
+                                             bool                   is_causal)
+{
+    const int head_size       = query.shape()[0];
+    const int num_queries     = query.shape()[1];
+    const int num_heads       = query.shape()[2];
+    const int num_batches     = query.shape()[3];
+    const int num_keys        = key.shape()[1];
+    const int num_kv_heads    = key.shape()[2];
+    const int value_head_size = value.shape()[0];
+    const int group_size      = num_heads / num_kv_heads;
+
+    TensorShape dst_shape = query.shape();
+    dst_shape.set(0, value_head_size);
+    SimpleTensor<T> dst{dst_shape, query.data_type()};
+
+    std::vector<float> scores(num_keys);
+    for (int b = 0; b < num_batches; ++b)
+    {
+        for (int h = 0; h < num_heads; ++h)
+        {
+            // The mask is broadcast over the heads and the batches it has a single plane for
+            const int kv_plane   = b * num_kv_heads + h / group_size;
+            const int mask_head  = (mask != nullptr && mask->shape()[2] > 1) ? h : 0;
+            const int mask_batch = (mask != nullptr && mask->shape()[3] > 1) ? b : 0;
+            const int mask_plane = mask_batch * (mask != nullptr ? mask->shape()[2] : 1) + mask_head;
+            for (int i = 0; i < num_queries; ++i)
+            {
+                const T *q = query.data() + ((b * num_heads + h) * num_queries + i) * head_size;
+
+                float max_score = -std::numeric_limits<float>::infinity();
+                for (int j = 0; j < num_keys; ++j)
+                {
+                    const T *k = key.data() + (kv_plane * num_keys + j) * head_size;
+
+                    float score = 0.f;
+                    for (int x = 0; x < head_size; ++x)
+                    {
+                        score += static_cast<float>(q[x]) * static_cast<float>(k[x]);
+                    }
+                    score *= scale;
+                    if (mask != nullptr)
+                    {
+                        score += static_cast<float>((*mask)[(mask_plane * num_queries + i) * num_keys + j]);
+                    }
+                    if (is_causal && j > i + num_keys - num_queries)
+                    {
+                        score = -std::numeric_limits<float>::infinity();
+                    }
+                    scores[j] = score;
+                    max_score = std::max(max_score, score);
+                }
+
+                float sum = 0.f;
+                for (int j = 0; j < num_keys; ++j)
+                {
+                    scores[j] = std::isinf(max_score) ? 0.f : std::exp(scores[j] - max_score);
+                    sum += scores[j];
+                }
+
+                T *out = dst.data() + ((b * num_heads + h) * num_queries + i) * value_head_size;
+                for (int x = 0; x < value_head_size; ++x)
+                {
+                    float acc = 0.f;
+                    for (int j = 0; j < num_keys; ++j)
+                    {
+                        acc += scores[j] * static_cast<float>(value[(kv_plane * num_keys + j) * value_head_size + x]);
+                    }
+                    out[x] = static_cast<T>(sum > 0.f ? acc / sum : 0.f);
+                }
+            }
+        }
+    }
+
+    return dst;
+}
+
+template SimpleTensor<float> scaled_dot_product_attention(const SimpleTensor<float> &query,
+                                                          const SimpleTensor<float> &key,
+                                                          const SimpleTensor<float> &value,
+                                                          const SimpleTensor<float> *mask,
+                                                          float                      scale,
+                                                          bool                       is_causal);
+template SimpleTensor<half> scaled_dot_product_attention(const SimpleTensor<half> &query,
+                                                        const SimpleTensor<half> &key,
+                                                        const SimpleTensor<half> &value,
+                                                        const SimpleTensor<half> *mask,
+                                                        float                     scale,
+                                                        bool                      is_causal);
+template SimpleTensor<bfloat16> scaled_dot_product_attention(const SimpleTensor<bfloat16> &query,
+                                                            const SimpleTensor<bfloat16> &key,
+                                                            const SimpleTensor<bfloat16> &value,
+                                                            const SimpleTensor<bfloat16> *mask,
+                                                            float                         scale,
+                                                            bool                          is_causal);
+} // namespace reference
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
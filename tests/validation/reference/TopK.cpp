@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "TopK.h"
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace reference
+{
+template <typename T>
+std::pair<SimpleTensor<T>, SimpleTensor<int32_t>> topk(const SimpleTensor<T> &src, unsigned int k, bool sorted)
+{
+    TensorShape dst_shape = src.shape();
+    dst_shape.set(0, k);
+
+    SimpleTensor<T>       values{dst_shape, src.data_type(), 1, src.quantization_info()};
+    SimpleTensor<int32_t> indices{dst_shape, DataType::S32};
+
+    const int len      = src.shape()[0];
+    const int num_rows = src.num_elements() / len;
+
+    std::vector<int32_t> order(len);
+    for (int row = 0; row < num_rows; ++row)
+    {
+        const T *row_src = src.data() + row * len;
+
+        // Stable sort keeps equal values ordered by index
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&](int32_t a, int32_t b) { return row_src[a] > row_src[b]; });
+        if (!sorted)
+        {
+            std::sort(order.begin(), order.begin() + k);
+        }
+
+        for (unsigned int i = 0; i < k; ++i)
+        {
+            values[row * k + i]  = row_src[order[i]];
+            indices[row * k + i] = order[i];
+        }
+    }
+
+    return std::make_pair(std::move(values), std::move(indices));
+}
+
+template std::pair<SimpleTensor<float>, SimpleTensor<int32_t>>
+topk(const SimpleTensor<float> &src, unsigned int k, bool sorted);
+template std::pair<SimpleTensor<half>, SimpleTensor<int32_t>>
+topk(const SimpleTensor<half> &src, unsigned int k, bool sorted);
+template std::pair<SimpleTensor<uint8_t>, SimpleTensor<int32_t>>
+topk(const SimpleTensor<uint8_t> &src, unsigned int k, bool sorted);
+template std::pair<SimpleTensor<int8_t>, SimpleTensor<int32_t>>
+topk(const SimpleTensor<int8_t> &src, unsigned int k, bool sorted);
+} // namespace reference
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -35,10 +35,18 @@
 #pragma GCC diagnostic pop
 #include "utils/Utils.h"
 
+#include <fstream>
 #include <inttypes.h>
 #include <iomanip>
 #include <limits>
 
+#if !defined(_WIN64) && !defined(BARE_METAL)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif // !defined(_WIN64) && !defined(BARE_METAL)
+
 using namespace arm_compute::graph_utils;
 
 namespace
@@ -782,14 +790,103 @@ bool RandomAccessor::access_tensor(ITensor &tensor)
     return true;
 }
 
-NumPyBinLoader::NumPyBinLoader(std::string filename, DataLayout file_layout)
-    : _already_loaded(false), _filename(std::move(filename)), _file_layout(file_layout)
+NumPyBinLoader::NumPyBinLoader(std::string filename, DataLayout file_layout, bool import_mapped_file)
+    : _already_loaded(false),
+      _filename(std::move(filename)),
+      _file_layout(file_layout),
+      _import_mapped_file(import_mapped_file),
+      _mapped_file(),
+      _mapped_data(nullptr)
 {
 }
 
+void *NumPyBinLoader::import_memory(const ITensorInfo &info)
+{
+#if !defined(_WIN64) && !defined(BARE_METAL)
+    // Alignment of the data in the file required to import it
+    constexpr size_t alignment = 64;
+
+    const size_t data_size = info.total_size();
+    if (!_import_mapped_file || _already_loaded || _mapped_file != nullptr || data_size == 0 ||
+        !info.padding().empty())
+    {
+        return nullptr;
+    }
+
+    // Only import the data if it is stored exactly as the tensor expects it
+    std::ifstream fs(_filename, std::ios::in | std::ios::binary);
+    if (!fs.good())
+    {
+        return nullptr;
+    }
+    std::string                typestring;
+    std::vector<unsigned long> shape;
+    bool                       fortran_order = false;
+    size_t                     data_offset   = 0;
+    try
+    {
+        fs.exceptions(std::ifstream::failbit | std::ifstream::badbit);
+        const npy::header_t header = utils::parse_npy_header(fs);
+        typestring                 = header.dtype.str();
+        shape                      = header.shape;
+        fortran_order              = header.fortran_order;
+        data_offset                = fs.tellg();
+    }
+    catch (const std::ifstream::failure &)
+    {
+        return nullptr;
+    }
+
+    // Correct dimensions (Needs to match TensorShape dimension corrections)
+    while (shape.size() > info.num_dimensions() && shape.back() == 1)
+    {
+        shape.pop_back();
+    }
+    // Fortran-ordered data must be transposed, which fill_tensor() does while copying
+    bool is_importable = !fortran_order && typestring == utils::get_typestring(info.data_type()) &&
+                         (_file_layout == info.data_layout() || info.num_dimensions() <= 2) &&
+                         shape.size() == info.num_dimensions() && data_offset % alignment == 0;
+    for (size_t i = 0; is_importable && i < shape.size(); ++i)
+    {
+        is_importable = shape[i] == info.dimension(i);
+    }
+    if (!is_importable)
+    {
+        return nullptr;
+    }
+
+    const int fd = ::open(_filename.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+    {
+        return nullptr;
+    }
+    struct stat st; // NOLINT
+    void       *address = MAP_FAILED;
+    if (::fstat(fd, &st) == 0 && static_cast<size_t>(st.st_size) >= data_offset + data_size)
+    {
+        // Writable private mapping: functions modifying constants in place only copy the pages they modify
+        address = ::mmap(nullptr, st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    }
+    ::close(fd);
+    if (address == MAP_FAILED)
+    {
+        return nullptr;
+    }
+
+    const size_t map_size = st.st_size;
+    _mapped_file          = std::shared_ptr<void>(address, [map_size](void *ptr) { ::munmap(ptr, map_size); });
+    _mapped_data          = static_cast<uint8_t *>(address) + data_offset;
+    return _mapped_data;
+#else  // !defined(_WIN64) && !defined(BARE_METAL)
+    ARM_COMPUTE_UNUSED(info);
+    return nullptr;
+#endif // !defined(_WIN64) && !defined(BARE_METAL)
+}
+
 bool NumPyBinLoader::access_tensor(ITensor &tensor)
 {
-    if (!_already_loaded)
+    // Nothing to load if the tensor has imported the mapped file
+    if (!_already_loaded && (_mapped_data == nullptr || tensor.buffer() != _mapped_data))
     {
         utils::NPYLoader loader;
         loader.open(_filename, _file_layout);
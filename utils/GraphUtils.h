@@ -35,6 +35,7 @@
 #include "utils/CommonGraphOptions.h"
 
 #include <array>
+#include <memory>
 #include <random>
 #include <string>
 #include <vector>
@@ -434,26 +435,38 @@ private:
     std::random_device::result_type _seed;
 };
 
-/** Numpy Binary loader class*/
+/** Numpy Binary loader class
+ *
+ * When the data of a constant tensor is stored in the file exactly as the tensor expects it (same data type, shape
+ * and layout, no padding), the file is memory-mapped and imported by the tensor instead of being copied. The mapping
+ * is private: the pages are shared through the page cache by all the processes loading the same file, until a
+ * function modifies the constant in place.
+ */
 class NumPyBinLoader final : public graph::ITensorAccessor
 {
 public:
     /** Default Constructor
      *
-     * @param[in] filename    Binary file name
-     * @param[in] file_layout (Optional) Layout of the numpy tensor data. Defaults to NCHW
+     * @param[in] filename           Binary file name
+     * @param[in] file_layout        (Optional) Layout of the numpy tensor data. Defaults to NCHW
+     * @param[in] import_mapped_file (Optional) Import the memory-mapped file in constant tensors when possible.
+     *                               Defaults to true
      */
-    NumPyBinLoader(std::string filename, DataLayout file_layout = DataLayout::NCHW);
+    NumPyBinLoader(std::string filename, DataLayout file_layout = DataLayout::NCHW, bool import_mapped_file = true);
     /** Allows instances to move constructed */
     NumPyBinLoader(NumPyBinLoader &&) = default;
 
     // Inherited methods overriden:
-    bool access_tensor(ITensor &tensor) override;
+    bool  access_tensor(ITensor &tensor) override;
+    void *import_memory(const ITensorInfo &info) override;
 
 private:
-    bool              _already_loaded;
-    const std::string _filename;
-    const DataLayout  _file_layout;
+    bool                  _already_loaded;
+    const std::string     _filename;
+    const DataLayout      _file_layout;
+    const bool            _import_mapped_file;
+    std::shared_ptr<void> _mapped_file;
+    uint8_t              *_mapped_data;
 };
 
 /** Generates appropriate random accessor
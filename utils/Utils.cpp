@@ -237,12 +237,11 @@ npy::header_t parse_npy_header(std::ifstream &fs) //NOLINT
     // Parse header
     npy::header_t header = npy::parse_header(header_s);
 
-    bool                       fortran_order = false;
-    std::vector<unsigned long> shape         = header.shape;
+    std::vector<unsigned long> shape = header.shape;
 
     std::reverse(shape.begin(), shape.end());
 
-    return npy::header_t{header.dtype, fortran_order, shape};
+    return npy::header_t{header.dtype, header.fortran_order, shape};
 }
 
 /** This function returns the amount of memory free reading from /proc/meminfo
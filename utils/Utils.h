@@ -354,17 +354,13 @@ public:
         ARM_COMPUTE_ERROR_ON(!is_open());
         ARM_COMPUTE_ERROR_ON(dt != arm_compute::DataType::F32);
 
-        // Use the size of the input NPY tensor
+        // Use the size of the input NPY tensor, whose shape is already in the order of the tensor dimensions. The
+        // data of Fortran-ordered files is transposed by fill_tensor().
         TensorShape shape;
         shape.set_num_dimensions(_shape.size());
         for (size_t i = 0; i < _shape.size(); ++i)
         {
-            size_t src = i;
-            if (_fortran_order)
-            {
-                src = _shape.size() - 1 - i;
-            }
-            shape.set(i, _shape.at(src));
+            shape.set(i, _shape.at(i));
         }
 
         arm_compute::TensorInfo tensor_info(shape, 1, dt);